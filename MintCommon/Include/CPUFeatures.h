@@ -0,0 +1,59 @@
+﻿#pragma once
+
+
+#ifndef _MINT_COMMON_CPU_FEATURES_H_
+#define _MINT_COMMON_CPU_FEATURES_H_
+
+
+#include <MintCommon/Include/CommonDefinitions.h>
+
+
+// 빌드 옵션 (/arch, -m) 보다 높은 명령어 집합을 함수 단위로 쓸 수 있게 한다.
+// 이 함수들은 CPUFeatures 로 지원 여부를 확인한 뒤에만 호출해야 한다.
+// MSVC 는 /arch 와 무관하게 모든 intrinsic 을 쓸 수 있으므로 비워 둔다.
+#if defined _MSC_VER && !defined __clang__
+#define MINT_TARGET_AVX2_FMA
+#define MINT_TARGET_AVX512
+#define MINT_TARGET_BMI2
+#else
+#define MINT_TARGET_AVX2_FMA __attribute__((target("avx2,fma")))
+#define MINT_TARGET_AVX512 __attribute__((target("avx512f,avx2,fma")))
+#define MINT_TARGET_BMI2 __attribute__((target("bmi2")))
+#endif
+
+
+namespace mint
+{
+	// 실행 중인 CPU (와 OS) 가 지원하는 SIMD 명령어 집합
+	// 처음 GetInstance() 를 호출할 때 CPUID 로 한 번만 검사한다.
+	class CPUFeatures final
+	{
+	public:
+		static const CPUFeatures& GetInstance() noexcept;
+
+	private:
+		CPUFeatures();
+
+	public:
+		MINT_INLINE bool HasSSE41() const noexcept { return _hasSSE41; }
+		MINT_INLINE bool HasAVX() const noexcept { return _hasAVX; }
+		MINT_INLINE bool HasAVX2() const noexcept { return _hasAVX2; }
+		MINT_INLINE bool HasFMA() const noexcept { return _hasFMA; }
+		MINT_INLINE bool HasAVX512F() const noexcept { return _hasAVX512F; }
+		MINT_INLINE bool HasBMI2() const noexcept { return _hasBMI2; }
+		// Zen 2 이하의 AMD CPU 는 PDEP / PEXT 를 microcode 로 실행해서 (수백 cycle) 쓰지 않는 편이 빠르다.
+		MINT_INLINE bool HasFastBMI2() const noexcept { return _hasFastBMI2; }
+
+	private:
+		bool _hasSSE41;
+		bool _hasAVX;
+		bool _hasAVX2;
+		bool _hasFMA;
+		bool _hasAVX512F;
+		bool _hasBMI2;
+		bool _hasFastBMI2;
+	};
+}
+
+
+#endif // !_MINT_COMMON_CPU_FEATURES_H_
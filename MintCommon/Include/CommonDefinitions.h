@@ -97,6 +97,19 @@ static constexpr uint32 kStackSizeLimit = 1 << 14;
 static constexpr uint32 kInvalidIndexUint32 = kUint32Max;
 static constexpr uint64 kInvalidIndexUint64 = kUint64Max;
 constexpr bool IsValidIndex(uint32 index) { return index != kUint32Max; }
+
+namespace mint
+{
+	// 1 인 bit 의 수
+	// POPCNT 명령어가 없는 CPU 에서도 돌도록 bit 연산으로 센다. (gcc 와 clang 은 POPCNT 를 쓸 수 있게 빌드하면 이 식을 POPCNT 하나로 바꾼다.)
+	MINT_INLINE constexpr uint32 PopCount64(uint64 value) noexcept
+	{
+		value -= (value >> 1) & 0x5555555555555555ull;
+		value = (value & 0x3333333333333333ull) + ((value >> 2) & 0x3333333333333333ull);
+		value = (value + (value >> 4)) & 0x0F0F0F0F0F0F0F0Full;
+		return static_cast<uint32>((value * 0x0101010101010101ull) >> 56);
+	}
+}
 #pragma endregion
 
 
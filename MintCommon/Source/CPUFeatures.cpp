@@ -0,0 +1,112 @@
+﻿#include <MintCommon/Include/CPUFeatures.h>
+
+#if defined _MSC_VER
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#endif
+
+
+namespace mint
+{
+	namespace CPUID
+	{
+		// result = { EAX, EBX, ECX, EDX }
+		static void Query(const uint32 leaf, const uint32 subLeaf, uint32(&result)[4]) noexcept
+		{
+#if defined _MSC_VER
+			int32 registers[4]{};
+			__cpuidex(registers, static_cast<int32>(leaf), static_cast<int32>(subLeaf));
+			for (uint32 i = 0; i < 4; ++i)
+			{
+				result[i] = static_cast<uint32>(registers[i]);
+			}
+#else
+			__cpuid_count(leaf, subLeaf, result[0], result[1], result[2], result[3]);
+#endif
+		}
+
+		// OS 가 context switch 때 저장해 주는 register 상태 (XCR0)
+		static uint64 QueryEnabledXSaveFeatures() noexcept
+		{
+#if defined _MSC_VER
+			return _xgetbv(0);
+#else
+			uint32 eax = 0;
+			uint32 edx = 0;
+			__asm__ volatile("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+			return (static_cast<uint64>(edx) << 32) | eax;
+#endif
+		}
+
+		MINT_INLINE bool HasBit(const uint32 value, const uint32 bitIndex) noexcept
+		{
+			return (value & (1u << bitIndex)) != 0;
+		}
+	}
+
+
+	const CPUFeatures& CPUFeatures::GetInstance() noexcept
+	{
+		static const CPUFeatures instance;
+		return instance;
+	}
+
+	CPUFeatures::CPUFeatures()
+		: _hasSSE41{ false }
+		, _hasAVX{ false }
+		, _hasAVX2{ false }
+		, _hasFMA{ false }
+		, _hasAVX512F{ false }
+		, _hasBMI2{ false }
+		, _hasFastBMI2{ false }
+	{
+		uint32 registers[4]{};
+		CPUID::Query(0, 0, registers);
+		const uint32 maxLeaf = registers[0];
+		// "AuthenticAMD" 의 EBX 부분
+		const bool isAMD = (registers[1] == 0x68747541);
+		if (maxLeaf < 1)
+		{
+			return;
+		}
+
+		CPUID::Query(1, 0, registers);
+		const uint32 leaf1EAX = registers[0];
+		const uint32 leaf1ECX = registers[2];
+		_hasSSE41 = CPUID::HasBit(leaf1ECX, 19);
+
+		const uint32 baseFamily = (leaf1EAX >> 8) & 0xF;
+		const uint32 family = (baseFamily == 0xF) ? baseFamily + ((leaf1EAX >> 20) & 0xFF) : baseFamily;
+		if (maxLeaf >= 7)
+		{
+			// BMI2 는 OS 의 register 저장과 무관하다.
+			CPUID::Query(7, 0, registers);
+			_hasBMI2 = CPUID::HasBit(registers[1], 8);
+			// Zen 3 (family 19h) 부터 PDEP / PEXT 가 빠르다.
+			_hasFastBMI2 = _hasBMI2 && (isAMD == false || family >= 0x19);
+		}
+
+		// AVX 이상은 OS 가 YMM (ZMM) register 를 저장해 줘야 쓸 수 있다.
+		const bool hasOSXSave = CPUID::HasBit(leaf1ECX, 27);
+		if (hasOSXSave == false)
+		{
+			return;
+		}
+
+		const uint64 xcr0 = CPUID::QueryEnabledXSaveFeatures();
+		const bool isYMMEnabled = (xcr0 & 0x06) == 0x06;
+		const bool isZMMEnabled = (xcr0 & 0xE6) == 0xE6;
+		_hasAVX = isYMMEnabled && CPUID::HasBit(leaf1ECX, 28);
+		_hasFMA = _hasAVX && CPUID::HasBit(leaf1ECX, 12);
+		if (maxLeaf < 7)
+		{
+			return;
+		}
+
+		CPUID::Query(7, 0, registers);
+		const uint32 leaf7EBX = registers[1];
+		_hasAVX2 = _hasAVX && CPUID::HasBit(leaf7EBX, 5);
+		_hasAVX512F = isZMMEnabled && CPUID::HasBit(leaf7EBX, 16);
+	}
+}
@@ -25,11 +25,73 @@ namespace mint
 	template <typename T, typename ValueType, typename Evaluator>
 	uint32 BinarySearch(const Vector<T>& vec, const ValueType& value, Evaluator evaluator);
 
+	// 정렬된 vector 에서 value 이상인 첫 entry 의 index 를 반환한다. (없으면 vector.Size())
+	// 분기 없이 구간을 절반씩 줄여 나가므로 branch misprediction 이 없다.
+	template <typename T>
+	uint32 LowerBound(const Vector<T>& vector, const T& value);
+
+	template <typename T, typename ValueType, typename Evaluator>
+	uint32 LowerBound(const Vector<T>& vector, const ValueType& value, Evaluator evaluator);
+
+	// 정렬된 vector 를 Eytzinger (BFS 순서의 암묵적 이진 트리) 배치로 바꾼다.
+	// - outEytzingerVector 의 크기는 sortedVector.Size() + 1 이며 [0] 은 사용하지 않는다.
+	// - 탐색 경로가 메모리 상에서 앞쪽에 몰리므로 큰 배열을 반복 탐색할 때 cache 효율이 좋다.
+	template <typename T>
+	void MakeEytzingerLayout(const Vector<T>& sortedVector, Vector<T>& outEytzingerVector);
+
+	// Eytzinger 배치에서 value 이상인 첫 entry 의 (Eytzinger vector 기준) index 를 반환한다. (없으면 kInvalidIndexUint32)
+	template <typename T>
+	uint32 LowerBoundEytzinger(const Vector<T>& eytzingerVector, const T& value);
+
+	// 아래 함수들은 float, int32, uint32, Float2, Float4 에 대해 SSE 로 처리하고 그 외의 타입은 scalar 로 처리한다.
+	// Find 는 없으면 kInvalidIndexUint32 를 반환한다.
+	template <typename T>
+	uint32 Find(const Vector<T>& vector, const T& value);
+
+	template <typename T>
+	uint32 Count(const Vector<T>& vector, const T& value);
+
+	// vector 가 비어 있으면 false 를 반환하고 outMin, outMax 는 건드리지 않는다.
+	// Float2, Float4 는 성분별 min, max 를 구한다.
+	template <typename T>
+	bool MinMax(const Vector<T>& vector, T& outMin, T& outMax);
+
+	// float 의 경우 lane 별로 나누어 더하므로 순차 합과 마지막 몇 bit 가 다를 수 있다.
+	template <typename T>
+	T Sum(const Vector<T>& vector);
+
+	// predicate 가 true 인 entry 들을 앞쪽으로 모으고 그 개수를 반환한다. (unstable)
+	template <typename T, typename Predicate>
+	uint32 Partition(Vector<T>& vector, Predicate predicate);
+
+	// Introsort 계열의 불안정(unstable) 정렬이다.
+	// - 작은 구간은 InsertionSort 로 처리한다.
+	// - pivot 은 median-of-3 (큰 구간은 ninther) 로 고른다.
+	// - 이미 정렬된 구간은 partial insertion sort 로 조기 종료하고, 재귀가 깊어지면 HeapSort 로 전환해 O(n log n) 을 보장한다.
 	template <typename T, typename Comparator>
 	void QuickSort(Vector<T>& vector, Comparator comparator);
 	
 	template <typename T, typename Comparator>
 	void QuickSort(T* arrayPointer, uint32 arraySize, Comparator comparator);
+
+	template <typename T, typename Comparator>
+	void InsertionSort(T* arrayPointer, uint32 arraySize, Comparator comparator);
+
+	template <typename T, typename Comparator>
+	void HeapSort(T* arrayPointer, uint32 arraySize, Comparator comparator);
+
+	// 안정(stable) 정렬이다. (merge sort, 보조 버퍼로 arraySize 만큼의 메모리를 사용한다)
+	template <typename T, typename Comparator>
+	void StableSort(Vector<T>& vector, Comparator comparator);
+
+	// LSD radix sort 이다. 안정 정렬이며 보조 버퍼로 vector.Size() 만큼의 메모리를 사용한다.
+	// - keyEvaluator(entry) 는 uint32, uint64, int32, int64, float, double 중 하나를 반환해야 한다.
+	// - 모든 key 가 같은 byte 를 갖는 자리는 건너뛴다.
+	template <typename T, typename KeyEvaluator>
+	void RadixSort(Vector<T>& vector, KeyEvaluator keyEvaluator);
+
+	template <typename T>
+	void RadixSort(Vector<T>& vector);
 }
 
 
@@ -4,6 +4,11 @@
 #include <MintContainer/Include/Algorithm.h>
 #include <MintContainer/Include/Vector.hpp>
 
+#include <MintMath/Include/Float4.h>
+
+#include <type_traits>
+#include <intrin.h>
+
 
 namespace mint
 {
@@ -13,8 +18,32 @@ namespace mint
 	template <typename T, typename ValueType, typename Evaluator>
 	int32 BinarySearchInternal(const Vector<T>& vec, const ValueType& value, Evaluator evaluator, const int32 indexBegin, const int32 indexEnd);
 
+	template <typename T>
+	void MakeEytzingerLayoutInternal(const Vector<T>& sortedVector, Vector<T>& outEytzingerVector, uint32& sortedAt, const uint32 eytzingerAt);
+
+	template <typename T>
+	constexpr bool IsSIMDInt32Internal() noexcept { return std::is_same_v<T, int32> || std::is_same_v<T, uint32>; }
+
+	template<typename T, typename Comparator>
+	void QuickSortInternal(T* begin, T* end, Comparator comparator, uint32 depthLimit, bool isLeftmost);
+
+	template<typename T, typename Comparator>
+	void Sort3(T& a, T& b, T& c, Comparator comparator);
+
+	template<typename T, typename Comparator>
+	T* PartitionRight(T* const begin, T* const end, Comparator comparator, bool& outIsAlreadyPartitioned);
+
+	template<typename T, typename Comparator>
+	T* PartitionLeft(T* const begin, T* const end, Comparator comparator);
+
+	template<typename T, typename Comparator>
+	bool PartialInsertionSort(T* const begin, T* const end, Comparator comparator);
+
 	template<typename T, typename Comparator>
-	void QuickSortInternal(T* vector, const int32 front, const int32 back, Comparator comparator);
+	void SiftDown(T* arrayPointer, uint32 at, const uint32 arraySize, Comparator comparator);
+
+	template<typename T, typename Comparator>
+	void MergeRuns(T* source, T* destination, const uint32 front, const uint32 middle, const uint32 end, Comparator comparator);
 
 
 	template <typename T>
@@ -93,83 +122,897 @@ namespace mint
 		}
 	}
 
+	template <typename T>
+	uint32 LowerBound(const Vector<T>& vector, const T& value)
+	{
+		const uint32 size = vector.Size();
+		if (size == 0)
+		{
+			return 0;
+		}
+
+		const T* const data = vector.Data();
+		const T* base = data;
+		uint32 remainingSize = size;
+		while (remainingSize > 1)
+		{
+			const uint32 halfSize = remainingSize / 2;
+			// cmov 로 컴파일되도록 분기 대신 삼항 연산자를 쓴다.
+			base = (base[halfSize] < value) ? base + halfSize : base;
+			remainingSize -= halfSize;
+		}
+		return static_cast<uint32>(base - data) + ((*base < value) ? 1 : 0);
+	}
+
+	template <typename T, typename ValueType, typename Evaluator>
+	uint32 LowerBound(const Vector<T>& vector, const ValueType& value, Evaluator evaluator)
+	{
+		const uint32 size = vector.Size();
+		if (size == 0)
+		{
+			return 0;
+		}
+
+		const T* const data = vector.Data();
+		const T* base = data;
+		uint32 remainingSize = size;
+		while (remainingSize > 1)
+		{
+			const uint32 halfSize = remainingSize / 2;
+			base = (evaluator(base[halfSize]) < value) ? base + halfSize : base;
+			remainingSize -= halfSize;
+		}
+		return static_cast<uint32>(base - data) + ((evaluator(*base) < value) ? 1 : 0);
+	}
+
+	template <typename T>
+	void MakeEytzingerLayout(const Vector<T>& sortedVector, Vector<T>& outEytzingerVector)
+	{
+		outEytzingerVector.Clear();
+		outEytzingerVector.Resize(sortedVector.Size() + 1);
+
+		uint32 sortedAt = 0;
+		MakeEytzingerLayoutInternal(sortedVector, outEytzingerVector, sortedAt, 1);
+	}
+
+	template <typename T>
+	void MakeEytzingerLayoutInternal(const Vector<T>& sortedVector, Vector<T>& outEytzingerVector, uint32& sortedAt, const uint32 eytzingerAt)
+	{
+		if (eytzingerAt > sortedVector.Size())
+		{
+			return;
+		}
+
+		MakeEytzingerLayoutInternal(sortedVector, outEytzingerVector, sortedAt, eytzingerAt * 2);
+		outEytzingerVector[eytzingerAt] = sortedVector[sortedAt];
+		++sortedAt;
+		MakeEytzingerLayoutInternal(sortedVector, outEytzingerVector, sortedAt, eytzingerAt * 2 + 1);
+	}
+
+	template <typename T>
+	uint32 LowerBoundEytzinger(const Vector<T>& eytzingerVector, const T& value)
+	{
+		if (eytzingerVector.Size() < 2)
+		{
+			return kInvalidIndexUint32;
+		}
+
+		const T* const data = eytzingerVector.Data();
+		const uint32 size = eytzingerVector.Size() - 1;
+		uint32 at = 1;
+		while (at <= size)
+		{
+			at = at * 2 + ((data[at] < value) ? 1 : 0);
+		}
+
+		// 마지막으로 왼쪽으로 내려간 지점까지 되돌아간다. (하위의 연속된 1 들과 그 다음 0 하나를 버린다)
+		unsigned long trailingOneCount = 0;
+		_BitScanForward(&trailingOneCount, ~at);
+		at >>= (trailingOneCount + 1);
+		return (at == 0) ? kInvalidIndexUint32 : at;
+	}
+
+	MINT_INLINE float HorizontalAddInternal(const __m128 value) noexcept
+	{
+		const __m128 shuffled = _mm_movehdup_ps(value);
+		const __m128 sum2 = _mm_add_ps(value, shuffled);
+		return _mm_cvtss_f32(_mm_add_ss(sum2, _mm_movehl_ps(shuffled, sum2)));
+	}
+
+	MINT_INLINE uint32 HorizontalAddInternal(const __m128i value) noexcept
+	{
+		const __m128i sum2 = _mm_add_epi32(value, _mm_shuffle_epi32(value, _MM_SHUFFLE(1, 0, 3, 2)));
+		const __m128i sum1 = _mm_add_epi32(sum2, _mm_shuffle_epi32(sum2, _MM_SHUFFLE(2, 3, 0, 1)));
+		return static_cast<uint32>(_mm_cvtsi128_si32(sum1));
+	}
+
+	template <typename T>
+	uint32 Find(const Vector<T>& vector, const T& value)
+	{
+		const uint32 size = vector.Size();
+		const T* const data = vector.Data();
+		uint32 at = 0;
+		if constexpr (std::is_same_v<T, float> || IsSIMDInt32Internal<T>())
+		{
+			for (; at + 4 <= size; at += 4)
+			{
+				int32 mask = 0;
+				if constexpr (std::is_same_v<T, float>)
+				{
+					mask = _mm_movemask_ps(_mm_cmpeq_ps(_mm_loadu_ps(data + at), _mm_set1_ps(value)));
+				}
+				else
+				{
+					const __m128i cmp = _mm_cmpeq_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data + at)), _mm_set1_epi32(static_cast<int32>(value)));
+					mask = _mm_movemask_ps(_mm_castsi128_ps(cmp));
+				}
+
+				if (mask != 0)
+				{
+					unsigned long laneIndex = 0;
+					_BitScanForward(&laneIndex, static_cast<unsigned long>(mask));
+					return at + laneIndex;
+				}
+			}
+		}
+		for (; at < size; ++at)
+		{
+			if (data[at] == value)
+			{
+				return at;
+			}
+		}
+		return kInvalidIndexUint32;
+	}
+
+	template <typename T>
+	uint32 Count(const Vector<T>& vector, const T& value)
+	{
+		const uint32 size = vector.Size();
+		const T* const data = vector.Data();
+		uint32 at = 0;
+		uint32 count = 0;
+		if constexpr (std::is_same_v<T, float> || IsSIMDInt32Internal<T>())
+		{
+			// 일치하면 lane 이 -1 이 되므로 빼서 누적한다.
+			__m128i counts = _mm_setzero_si128();
+			for (; at + 4 <= size; at += 4)
+			{
+				__m128i cmp;
+				if constexpr (std::is_same_v<T, float>)
+				{
+					cmp = _mm_castps_si128(_mm_cmpeq_ps(_mm_loadu_ps(data + at), _mm_set1_ps(value)));
+				}
+				else
+				{
+					cmp = _mm_cmpeq_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data + at)), _mm_set1_epi32(static_cast<int32>(value)));
+				}
+				counts = _mm_sub_epi32(counts, cmp);
+			}
+			count = HorizontalAddInternal(counts);
+		}
+		for (; at < size; ++at)
+		{
+			count += (data[at] == value) ? 1 : 0;
+		}
+		return count;
+	}
+
+	template <typename T>
+	bool MinMax(const Vector<T>& vector, T& outMin, T& outMax)
+	{
+		const uint32 size = vector.Size();
+		if (size == 0)
+		{
+			return false;
+		}
+
+		const T* const data = vector.Data();
+		uint32 at = 0;
+		if constexpr (std::is_same_v<T, float>)
+		{
+			__m128 min = _mm_set1_ps(data[0]);
+			__m128 max = min;
+			for (; at + 4 <= size; at += 4)
+			{
+				const __m128 values = _mm_loadu_ps(data + at);
+				min = _mm_min_ps(min, values);
+				max = _mm_max_ps(max, values);
+			}
+			min = _mm_min_ps(min, _mm_movehl_ps(min, min));
+			min = _mm_min_ss(min, _mm_movehdup_ps(min));
+			max = _mm_max_ps(max, _mm_movehl_ps(max, max));
+			max = _mm_max_ss(max, _mm_movehdup_ps(max));
+			outMin = _mm_cvtss_f32(min);
+			outMax = _mm_cvtss_f32(max);
+		}
+		else if constexpr (IsSIMDInt32Internal<T>())
+		{
+			__m128i min = _mm_set1_epi32(static_cast<int32>(data[0]));
+			__m128i max = min;
+			for (; at + 4 <= size; at += 4)
+			{
+				const __m128i values = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + at));
+				if constexpr (std::is_same_v<T, int32>)
+				{
+					min = _mm_min_epi32(min, values);
+					max = _mm_max_epi32(max, values);
+				}
+				else
+				{
+					min = _mm_min_epu32(min, values);
+					max = _mm_max_epu32(max, values);
+				}
+			}
+			alignas(16) T minLanes[4];
+			alignas(16) T maxLanes[4];
+			_mm_store_si128(reinterpret_cast<__m128i*>(minLanes), min);
+			_mm_store_si128(reinterpret_cast<__m128i*>(maxLanes), max);
+			outMin = Min(Min(minLanes[0], minLanes[1]), Min(minLanes[2], minLanes[3]));
+			outMax = Max(Max(maxLanes[0], maxLanes[1]), Max(maxLanes[2], maxLanes[3]));
+		}
+		else if constexpr (std::is_same_v<T, Float2>)
+		{
+			// __m128 하나에 Float2 두 개 (x0, y0, x1, y1) 를 담는다.
+			__m128 min = _mm_setr_ps(data[0]._x, data[0]._y, data[0]._x, data[0]._y);
+			__m128 max = min;
+			for (; at + 2 <= size; at += 2)
+			{
+				const __m128 values = _mm_loadu_ps(&data[at]._x);
+				min = _mm_min_ps(min, values);
+				max = _mm_max_ps(max, values);
+			}
+			min = _mm_min_ps(min, _mm_movehl_ps(min, min));
+			max = _mm_max_ps(max, _mm_movehl_ps(max, max));
+			alignas(16) float minLanes[4];
+			alignas(16) float maxLanes[4];
+			_mm_store_ps(minLanes, min);
+			_mm_store_ps(maxLanes, max);
+			outMin = Float2(minLanes[0], minLanes[1]);
+			outMax = Float2(maxLanes[0], maxLanes[1]);
+		}
+		else if constexpr (std::is_same_v<T, Float4>)
+		{
+			__m128 min = _mm_load_ps(data[0]._c);
+			__m128 max = min;
+			for (at = 1; at < size; ++at)
+			{
+				const __m128 values = _mm_load_ps(data[at]._c);
+				min = _mm_min_ps(min, values);
+				max = _mm_max_ps(max, values);
+			}
+			_mm_store_ps(outMin._c, min);
+			_mm_store_ps(outMax._c, max);
+		}
+		else
+		{
+			outMin = data[0];
+			outMax = data[0];
+			at = 1;
+		}
+
+		if constexpr (std::is_same_v<T, Float4> == false)
+		{
+			for (; at < size; ++at)
+			{
+				if constexpr (std::is_same_v<T, Float2>)
+				{
+					outMin = Float2::Min(outMin, data[at]);
+					outMax = Float2::Max(outMax, data[at]);
+				}
+				else
+				{
+					outMin = Min(outMin, data[at]);
+					outMax = Max(outMax, data[at]);
+				}
+			}
+		}
+		return true;
+	}
+
+	template <typename T>
+	T Sum(const Vector<T>& vector)
+	{
+		const uint32 size = vector.Size();
+		const T* const data = vector.Data();
+		uint32 at = 0;
+		T sum{};
+		if constexpr (std::is_same_v<T, float>)
+		{
+			__m128 sum4 = _mm_setzero_ps();
+			for (; at + 4 <= size; at += 4)
+			{
+				sum4 = _mm_add_ps(sum4, _mm_loadu_ps(data + at));
+			}
+			sum = HorizontalAddInternal(sum4);
+		}
+		else if constexpr (IsSIMDInt32Internal<T>())
+		{
+			__m128i sum4 = _mm_setzero_si128();
+			for (; at + 4 <= size; at += 4)
+			{
+				sum4 = _mm_add_epi32(sum4, _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + at)));
+			}
+			sum = static_cast<T>(HorizontalAddInternal(sum4));
+		}
+		else if constexpr (std::is_same_v<T, Float2>)
+		{
+			__m128 sum2 = _mm_setzero_ps();
+			for (; at + 2 <= size; at += 2)
+			{
+				sum2 = _mm_add_ps(sum2, _mm_loadu_ps(&data[at]._x));
+			}
+			sum2 = _mm_add_ps(sum2, _mm_movehl_ps(sum2, sum2));
+			alignas(16) float lanes[4];
+			_mm_store_ps(lanes, sum2);
+			sum = Float2(lanes[0], lanes[1]);
+		}
+		else if constexpr (std::is_same_v<T, Float4>)
+		{
+			__m128 sum1 = _mm_setzero_ps();
+			for (; at < size; ++at)
+			{
+				sum1 = _mm_add_ps(sum1, _mm_load_ps(data[at]._c));
+			}
+			_mm_store_ps(sum._c, sum1);
+		}
+
+		for (; at < size; ++at)
+		{
+			sum += data[at];
+		}
+		return sum;
+	}
+
+	template <typename T, typename Predicate>
+	uint32 Partition(Vector<T>& vector, Predicate predicate)
+	{
+		const uint32 size = vector.Size();
+		T* const data = vector.Data();
+		uint32 first = 0;
+		uint32 last = size;
+		while (true)
+		{
+			while (first < last && predicate(data[first]))
+			{
+				++first;
+			}
+			while (first < last && predicate(data[last - 1]) == false)
+			{
+				--last;
+			}
+			if (first >= last)
+			{
+				break;
+			}
+			std::swap(data[first], data[last - 1]);
+			++first;
+			--last;
+		}
+		return first;
+	}
+
 	template<typename T, typename Comparator>
 	void QuickSort(Vector<T>& vector, Comparator comparator)
 	{
-		const int32 begin = 0;
-		const int32 end = static_cast<int32>(vector.Size() - 1);
-		QuickSortInternal(vector.Data(), begin, end, comparator);
+		QuickSort(vector.Data(), vector.Size(), comparator);
 	}
 
 	template <typename T, typename Comparator>
 	void QuickSort(T* arrayPointer, uint32 arraySize, Comparator comparator)
 	{
-		const int32 begin = 0;
-		const int32 end = static_cast<int32>(arraySize);
-		QuickSortInternal(arrayPointer, begin, end, comparator);
+		if (arraySize < 2)
+		{
+			return;
+		}
+
+		uint32 depthLimit = 0;
+		for (uint32 size = arraySize; size > 1; size >>= 1)
+		{
+			depthLimit += 2;
+		}
+		QuickSortInternal(arrayPointer, arrayPointer + arraySize, comparator, depthLimit, true);
 	}
 
 	template<typename T, typename Comparator>
-	void QuickSortInternal(T* vector, const int32 front, const int32 back, Comparator comparator)
+	void QuickSortInternal(T* begin, T* end, Comparator comparator, uint32 depthLimit, bool isLeftmost)
 	{
-		if (back <= front)
-		{
-			return;
-		}
+		static constexpr uint32 kInsertionSortThreshold = 24;
+		static constexpr uint32 kNintherThreshold = 128;
 
-		int32 pivot = back;
-		int32 left = front;
-		int32 right = back - 1;
 		while (true)
 		{
-			while (left < pivot && comparator(vector[left], vector[pivot]))
+			const uint32 size = static_cast<uint32>(end - begin);
+			if (size < kInsertionSortThreshold)
 			{
-				++left;
+				InsertionSort(begin, size, comparator);
+				return;
 			}
 
-			// 모든 entry 에 대해 { cmp(entry, pivot) == true } 이다.
-			// 예) 3, 2, 1, 4, 5
-			if (left == pivot)
+			if (depthLimit == 0)
 			{
-				break;
+				HeapSort(begin, size, comparator);
+				return;
 			}
+			--depthLimit;
 
-			while (right >= front && comparator(vector[pivot], vector[right]))
+			// pivot 을 begin 으로 옮긴다.
+			// 이때 end 쪽에 pivot 이상인 원소가 반드시 하나 이상 존재하게 되어 PartitionRight 의 sentinel 역할을 한다.
+			const uint32 halfSize = size / 2;
+			if (size > kNintherThreshold)
 			{
-				--right;
+				Sort3(begin[0], begin[halfSize], end[-1], comparator);
+				Sort3(begin[1], begin[halfSize - 1], end[-2], comparator);
+				Sort3(begin[2], begin[halfSize + 1], end[-3], comparator);
+				Sort3(begin[halfSize - 1], begin[halfSize], begin[halfSize + 1], comparator);
+				std::swap(begin[0], begin[halfSize]);
+			}
+			else
+			{
+				Sort3(begin[halfSize], begin[0], end[-1], comparator);
 			}
 
-			// 모든 entry 에 대해 { cmp(pivot, entry) == true } 이다.
-			// 예) 7, 9, 8, 6, 4
-			if (right < front)
+			// 바로 앞 원소(이전 partition 의 pivot)와 pivot 이 같다면, pivot 과 같은 원소들을 왼쪽으로 몰고 건너뛴다.
+			// 중복 값이 많은 경우에도 O(n log n) 을 유지한다.
+			if (isLeftmost == false && comparator(begin[-1], begin[0]) == false)
 			{
-				std::swap(vector[left], vector[pivot]);
-				pivot = left;
-				break;
+				begin = PartitionLeft(begin, end, comparator) + 1;
+				continue;
 			}
 
-			// left 및 right 의 모든 entry 에 대해 cmp 가 완료되었다.
-			if (right <= left)
+			bool isAlreadyPartitioned = false;
+			T* const pivot = PartitionRight(begin, end, comparator, isAlreadyPartitioned);
+
+			// 이미 정렬된(또는 거의 정렬된) 입력은 여기서 O(n) 으로 끝난다.
+			if (isAlreadyPartitioned == true)
 			{
-				if (left == right)
-				{
-					std::swap(vector[right + 1], vector[pivot]);
-					pivot = right + 1;
-				}
-				else
+				if (PartialInsertionSort(begin, pivot, comparator) == true && PartialInsertionSort(pivot + 1, end, comparator) == true)
 				{
-					std::swap(vector[left], vector[pivot]);
-					pivot = left;
+					return;
 				}
+			}
+
+			// 작은 쪽은 재귀, 큰 쪽은 반복으로 처리해 stack 깊이를 O(log n) 으로 제한한다.
+			if (pivot - begin < end - (pivot + 1))
+			{
+				QuickSortInternal(begin, pivot, comparator, depthLimit, isLeftmost);
+				begin = pivot + 1;
+				isLeftmost = false;
+			}
+			else
+			{
+				QuickSortInternal(pivot + 1, end, comparator, depthLimit, false);
+				end = pivot;
+			}
+		}
+	}
+
+	template<typename T, typename Comparator>
+	void Sort3(T& a, T& b, T& c, Comparator comparator)
+	{
+		if (comparator(b, a))
+		{
+			std::swap(a, b);
+		}
+		if (comparator(c, b))
+		{
+			std::swap(b, c);
+			if (comparator(b, a))
+			{
+				std::swap(a, b);
+			}
+		}
+	}
+
+	template<typename T, typename Comparator>
+	T* PartitionRight(T* const begin, T* const end, Comparator comparator, bool& outIsAlreadyPartitioned)
+	{
+		T pivot = std::move(*begin);
+		T* first = begin;
+		T* last = end;
+
+		while (comparator(*++first, pivot))
+		{
+			__noop;
+		}
+
+		if (first - 1 == begin)
+		{
+			while (first < last && comparator(*--last, pivot) == false)
+			{
+				__noop;
+			}
+		}
+		else
+		{
+			while (comparator(*--last, pivot) == false)
+			{
+				__noop;
+			}
+		}
+
+		outIsAlreadyPartitioned = (first >= last);
+
+		while (first < last)
+		{
+			std::swap(*first, *last);
+			while (comparator(*++first, pivot))
+			{
+				__noop;
+			}
+			while (comparator(*--last, pivot) == false)
+			{
+				__noop;
+			}
+		}
+
+		T* const pivotAt = first - 1;
+		*begin = std::move(*pivotAt);
+		*pivotAt = std::move(pivot);
+		return pivotAt;
+	}
+
+	template<typename T, typename Comparator>
+	T* PartitionLeft(T* const begin, T* const end, Comparator comparator)
+	{
+		T pivot = std::move(*begin);
+		T* first = begin;
+		T* last = end;
+
+		while (comparator(pivot, *--last))
+		{
+			__noop;
+		}
+
+		if (last + 1 == end)
+		{
+			while (first < last && comparator(pivot, *++first) == false)
+			{
+				__noop;
+			}
+		}
+		else
+		{
+			while (comparator(pivot, *++first) == false)
+			{
+				__noop;
+			}
+		}
+
+		while (first < last)
+		{
+			std::swap(*first, *last);
+			while (comparator(pivot, *--last))
+			{
+				__noop;
+			}
+			while (comparator(pivot, *++first) == false)
+			{
+				__noop;
+			}
+		}
+
+		*begin = std::move(*last);
+		*last = std::move(pivot);
+		return last;
+	}
+
+	template<typename T, typename Comparator>
+	bool PartialInsertionSort(T* const begin, T* const end, Comparator comparator)
+	{
+		// 이동 횟수가 이 값을 넘으면 정렬을 포기하고 false 를 반환한다.
+		static constexpr uint32 kMoveLimit = 8;
+
+		if (begin == end)
+		{
+			return true;
+		}
+
+		uint32 moveCount = 0;
+		for (T* current = begin + 1; current != end; ++current)
+		{
+			if (comparator(*current, *(current - 1)) == false)
+			{
+				continue;
+			}
+
+			T temp = std::move(*current);
+			T* hole = current;
+			do
+			{
+				*hole = std::move(*(hole - 1));
+				--hole;
+			} while (hole != begin && comparator(temp, *(hole - 1)));
+			*hole = std::move(temp);
+
+			moveCount += static_cast<uint32>(current - hole);
+			if (moveCount > kMoveLimit)
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	template <typename T, typename Comparator>
+	void InsertionSort(T* arrayPointer, uint32 arraySize, Comparator comparator)
+	{
+		for (uint32 at = 1; at < arraySize; ++at)
+		{
+			if (comparator(arrayPointer[at], arrayPointer[at - 1]) == false)
+			{
+				continue;
+			}
+
+			T temp = std::move(arrayPointer[at]);
+			uint32 hole = at;
+			do
+			{
+				arrayPointer[hole] = std::move(arrayPointer[hole - 1]);
+				--hole;
+			} while (hole > 0 && comparator(temp, arrayPointer[hole - 1]));
+			arrayPointer[hole] = std::move(temp);
+		}
+	}
+
+	template <typename T, typename Comparator>
+	void HeapSort(T* arrayPointer, uint32 arraySize, Comparator comparator)
+	{
+		if (arraySize < 2)
+		{
+			return;
+		}
+
+		for (uint32 at = arraySize / 2; at > 0; --at)
+		{
+			SiftDown(arrayPointer, at - 1, arraySize, comparator);
+		}
+		for (uint32 heapSize = arraySize - 1; heapSize > 0; --heapSize)
+		{
+			std::swap(arrayPointer[0], arrayPointer[heapSize]);
+			SiftDown(arrayPointer, 0, heapSize, comparator);
+		}
+	}
+
+	template<typename T, typename Comparator>
+	void SiftDown(T* arrayPointer, uint32 at, const uint32 arraySize, Comparator comparator)
+	{
+		T temp = std::move(arrayPointer[at]);
+		while (true)
+		{
+			uint32 child = at * 2 + 1;
+			if (child >= arraySize)
+			{
+				break;
+			}
+			if (child + 1 < arraySize && comparator(arrayPointer[child], arrayPointer[child + 1]))
+			{
+				++child;
+			}
+			if (comparator(temp, arrayPointer[child]) == false)
+			{
 				break;
 			}
+			arrayPointer[at] = std::move(arrayPointer[child]);
+			at = child;
+		}
+		arrayPointer[at] = std::move(temp);
+	}
+
+	template <typename T, typename Comparator>
+	void StableSort(Vector<T>& vector, Comparator comparator)
+	{
+		static constexpr uint32 kRunSize = 16;
+
+		const uint32 size = vector.Size();
+		if (size < 2)
+		{
+			return;
+		}
+
+		// InsertionSort 는 stable 하므로 작은 run 들은 먼저 InsertionSort 로 정렬해 둔다.
+		for (uint32 front = 0; front < size; front += kRunSize)
+		{
+			InsertionSort(vector.Data() + front, Min(kRunSize, size - front), comparator);
+		}
+		if (size <= kRunSize)
+		{
+			return;
+		}
+
+		Vector<T> buffer;
+		buffer.Resize(size);
+		T* source = vector.Data();
+		T* destination = buffer.Data();
+		for (uint32 runSize = kRunSize; runSize < size; runSize *= 2)
+		{
+			for (uint32 front = 0; front < size; front += runSize * 2)
+			{
+				const uint32 middle = Min(front + runSize, size);
+				const uint32 end = Min(front + runSize * 2, size);
+				MergeRuns(source, destination, front, middle, end, comparator);
+			}
+			std::swap(source, destination);
+		}
+
+		if (source != vector.Data())
+		{
+			for (uint32 at = 0; at < size; ++at)
+			{
+				vector[at] = std::move(source[at]);
+			}
+		}
+	}
+
+	template<typename T, typename Comparator>
+	void MergeRuns(T* source, T* destination, const uint32 front, const uint32 middle, const uint32 end, Comparator comparator)
+	{
+		uint32 left = front;
+		uint32 right = middle;
+		uint32 at = front;
+		while (left < middle && right < end)
+		{
+			// 같은 값이면 왼쪽을 먼저 취해야 stable 하다.
+			if (comparator(source[right], source[left]))
+			{
+				destination[at++] = std::move(source[right++]);
+			}
+			else
+			{
+				destination[at++] = std::move(source[left++]);
+			}
+		}
+		while (left < middle)
+		{
+			destination[at++] = std::move(source[left++]);
+		}
+		while (right < end)
+		{
+			destination[at++] = std::move(source[right++]);
+		}
+	}
+
+	template <typename KeyType>
+	struct RadixSortKey;
+
+	template <>
+	struct RadixSortKey<uint32>
+	{
+		using UnsignedType = uint32;
+		static MINT_INLINE UnsignedType Convert(const uint32 key) noexcept { return key; }
+	};
+
+	template <>
+	struct RadixSortKey<uint64>
+	{
+		using UnsignedType = uint64;
+		static MINT_INLINE UnsignedType Convert(const uint64 key) noexcept { return key; }
+	};
+
+	template <>
+	struct RadixSortKey<int32>
+	{
+		using UnsignedType = uint32;
+		// 부호 비트를 뒤집으면 unsigned 비교 순서가 signed 비교 순서와 같아진다.
+		static MINT_INLINE UnsignedType Convert(const int32 key) noexcept { return static_cast<uint32>(key) ^ 0x80000000u; }
+	};
+
+	template <>
+	struct RadixSortKey<int64>
+	{
+		using UnsignedType = uint64;
+		static MINT_INLINE UnsignedType Convert(const int64 key) noexcept { return static_cast<uint64>(key) ^ 0x8000000000000000ull; }
+	};
+
+	template <>
+	struct RadixSortKey<float>
+	{
+		using UnsignedType = uint32;
+		// 양수는 부호 비트만, 음수는 모든 비트를 뒤집는다. (NaN 은 고려하지 않는다)
+		static MINT_INLINE UnsignedType Convert(const float key) noexcept
+		{
+			uint32 bits = 0;
+			::memcpy(&bits, &key, sizeof(uint32));
+			const uint32 mask = static_cast<uint32>(-static_cast<int32>(bits >> 31)) | 0x80000000u;
+			return bits ^ mask;
+		}
+	};
+
+	template <>
+	struct RadixSortKey<double>
+	{
+		using UnsignedType = uint64;
+		static MINT_INLINE UnsignedType Convert(const double key) noexcept
+		{
+			uint64 bits = 0;
+			::memcpy(&bits, &key, sizeof(uint64));
+			const uint64 mask = static_cast<uint64>(-static_cast<int64>(bits >> 63)) | 0x8000000000000000ull;
+			return bits ^ mask;
+		}
+	};
+
+	template <typename UnsignedKeyType>
+	struct RadixSortKeyIndex
+	{
+		UnsignedKeyType _key;
+		uint32 _index;
+	};
+
+	template <typename T, typename KeyEvaluator>
+	void RadixSort(Vector<T>& vector, KeyEvaluator keyEvaluator)
+	{
+		using KeyType = std::decay_t<decltype(keyEvaluator(vector[0]))>;
+		using UnsignedKeyType = typename RadixSortKey<KeyType>::UnsignedType;
+		static constexpr uint32 kRadixBitCount = 8;
+		static constexpr uint32 kBucketCount = 1 << kRadixBitCount;
+		static constexpr uint32 kPassCount = sizeof(UnsignedKeyType);
+		using KeyIndex = RadixSortKeyIndex<UnsignedKeyType>;
+
+		const uint32 size = vector.Size();
+		if (size < 2)
+		{
+			return;
+		}
+
+		// key 는 한 번만 계산하고, (key, index) 쌍을 정렬한 뒤 마지막에 원소들을 한 번만 옮긴다.
+		Vector<KeyIndex> keyIndices;
+		Vector<KeyIndex> keyIndicesBuffer;
+		keyIndices.Resize(size);
+		keyIndicesBuffer.Resize(size);
+
+		uint32 histograms[kPassCount][kBucketCount]{};
+		for (uint32 at = 0; at < size; ++at)
+		{
+			const UnsignedKeyType key = RadixSortKey<KeyType>::Convert(keyEvaluator(vector[at]));
+			keyIndices[at]._key = key;
+			keyIndices[at]._index = at;
+			for (uint32 pass = 0; pass < kPassCount; ++pass)
+			{
+				++histograms[pass][(key >> (pass * kRadixBitCount)) & (kBucketCount - 1)];
+			}
+		}
+
+		KeyIndex* source = keyIndices.Data();
+		KeyIndex* destination = keyIndicesBuffer.Data();
+		for (uint32 pass = 0; pass < kPassCount; ++pass)
+		{
+			uint32(&histogram)[kBucketCount] = histograms[pass];
+			const uint32 shift = pass * kRadixBitCount;
 
-			std::swap(vector[left], vector[right]);
-			++left;
-			--right;
+			// 모든 key 가 이 자리에서 같은 값을 가지면 순서가 바뀌지 않으므로 건너뛴다.
+			if (histogram[(source[0]._key >> shift) & (kBucketCount - 1)] == size)
+			{
+				continue;
+			}
+
+			uint32 offset = 0;
+			for (uint32 bucket = 0; bucket < kBucketCount; ++bucket)
+			{
+				const uint32 count = histogram[bucket];
+				histogram[bucket] = offset;
+				offset += count;
+			}
+
+			for (uint32 at = 0; at < size; ++at)
+			{
+				const uint32 bucket = (source[at]._key >> shift) & (kBucketCount - 1);
+				destination[histogram[bucket]++] = source[at];
+			}
+			std::swap(source, destination);
 		}
 
-		QuickSortInternal(vector, front, pivot - 1, comparator);
-		QuickSortInternal(vector, pivot, back, comparator);
+		Vector<T> sorted;
+		sorted.Reserve(size);
+		for (uint32 at = 0; at < size; ++at)
+		{
+			sorted.PushBack(std::move(vector[source[at]._index]));
+		}
+		vector = std::move(sorted);
+	}
+
+	template <typename T>
+	void RadixSort(Vector<T>& vector)
+	{
+		RadixSort(vector, [](const T& entry) { return entry; });
 	}
 }
@@ -20,6 +20,7 @@
 #include <MintContainer/Include/ID.h>
 #include <MintContainer/Include/Index.h>
 #include <MintContainer/Include/HashMap.h>
+#include <MintContainer/Include/FlatMap.h>
 #include <MintContainer/Include/Queue.h>
 #include <MintContainer/Include/RefCounted.h>
 #include <MintContainer/Include/OwnPtr.h>
@@ -28,6 +29,7 @@
 #include <MintContainer/Include/StringView.h>
 #include <MintContainer/Include/Color.h>
 #include <MintContainer/Include/Algorithm.h>
+#include <MintContainer/Include/TLSFAllocator.h>
 
 
 #endif // !_MINT_CONTAINER_ALL_HEADERS_H_
@@ -17,6 +17,7 @@
 #include <MintContainer/Include/StackVector.hpp>
 #include <MintContainer/Include/InlineVector.hpp>
 #include <MintContainer/Include/HashMap.hpp>
+#include <MintContainer/Include/FlatMap.hpp>
 #include <MintContainer/Include/Queue.hpp>
 #include <MintContainer/Include/RefCounted.hpp>
 #include <MintContainer/Include/SharedPtr.hpp>
@@ -10,9 +10,13 @@
 
 namespace mint
 {
+	// 내부 저장소는 uint64 word 단위이며, 비트 순서는 기존과 같이 MSB-first 이다.
+	// (bitAt 0 은 첫 word 의 최상위 비트, GetByte(0) 은 첫 word 의 최상위 byte)
 	class BitVector final
 	{
-		static constexpr uint32	kMinByteCapacity = 1;
+		static constexpr uint32	kBitsPerWord = 64;
+		static constexpr uint32	kBytesPerWord = kBitsPerWord / kBitsPerByte;
+		static constexpr uint32	kMinWordCapacity = 1;
 
 	public:
 		BitVector();
@@ -24,6 +28,7 @@ namespace mint
 		bool PopBack();
 		void ResizeBitCount(const uint32 newBitCount);
 		void ReserveByteCapacity(const uint32 newByteCapacity);
+		void ReserveWordCapacity(const uint32 newWordCapacity);
 
 	public:
 		bool IsEmpty() const noexcept;
@@ -31,17 +36,38 @@ namespace mint
 		bool IsInSizeBoundary(const uint32 bitAt) const noexcept;
 		bool Get(const uint32 bitAt) const noexcept;
 		uint8 GetByte(const uint32 byteAt) const noexcept;
+		uint64 GetWord(const uint32 wordAt) const noexcept;
 		bool First() const noexcept;
 		bool Last() const noexcept;
 		void Set(const uint32 bitAt, const bool value) noexcept;
 		void Set(const uint32 byteAt, const uint32 bitOffsetFromLeft, const bool value) noexcept;
 		void SetByte(const uint32 byteAt, const uint8 byte) noexcept;
+		void SetWord(const uint32 wordAt, const uint64 word) noexcept;
+		// [bitAtBegin, bitAtEnd) 범위를 word 단위로 채운다.
+		void SetRange(const uint32 bitAtBegin, const uint32 bitAtEnd, const bool value) noexcept;
 		void Fill(const bool value) noexcept;
 		void Swap(const uint32 aBitAt, const uint32 bBitAt) noexcept;
 
+	public:
+		// rhs 의 BitCount 를 넘어서는 비트는 0 으로 간주한다.
+		void And(const BitVector& rhs) noexcept;
+		void Or(const BitVector& rhs) noexcept;
+		void Xor(const BitVector& rhs) noexcept;
+		// this &= ~rhs
+		void AndNot(const BitVector& rhs) noexcept;
+
+	public:
+		uint32 PopCount() const noexcept;
+		// set 된 비트가 없으면 kUint32Max 를 반환한다.
+		// for (uint32 bitAt = FindFirstSet(); bitAt != kUint32Max; bitAt = FindNextSet(bitAt)) 형태로 순회한다.
+		uint32 FindFirstSet() const noexcept;
+		uint32 FindNextSet(const uint32 previousBitAt) const noexcept;
+
 	public:
 		uint32 BitCount() const noexcept;
 		uint32 ByteCapacity() const noexcept;
+		uint32 WordCapacity() const noexcept;
+		uint32 WordCount() const noexcept;
 
 	public:
 		// 여러 비트를 set, get 할 때는 아래 함수들을 이용하는 게 성능에 훨씬 좋다!
@@ -52,12 +78,23 @@ namespace mint
 		static uint32 ComputeByteCount(const uint32 BitCount) noexcept;
 		static uint32 ComputeByteAt(const uint32 bitAt) noexcept;
 		static uint32 ComputeBitOffset(const uint32 bitAt) noexcept;
+		static uint32 ComputeWordCount(const uint32 BitCount) noexcept;
+		static uint32 ComputeWordAt(const uint32 bitAt) noexcept;
+		static uint32 ComputeWordBitOffset(const uint32 bitAt) noexcept;
 		static uint8 MakeByte(const bool(&valueArray)[8]) noexcept;
 		static uint8 MakeBitMaskOneAt(const uint32 bitOffsetFromLeft) noexcept;
+		static uint64 MakeWordBitMaskOneAt(const uint32 wordBitOffsetFromLeft) noexcept;
+
+	private:
+		// 마지막 word 에서 _bitCount 안쪽에 해당하는 비트들의 mask
+		uint64 ComputeLastWordMask() const noexcept;
+		// _bitCount 밖의 비트는 쓰레기 값일 수 있으므로 읽을 때는 mask 를 적용한다.
+		uint64 GetMaskedWord(const uint32 wordAt) const noexcept;
+		uint32 FindSetFrom(const uint32 bitAt) const noexcept;
 
 	private:
-		uint8* _byteArray;
-		uint32 _byteCapacity;
+		uint64* _wordArray;
+		uint32 _wordCapacity;
 		uint32 _bitCount;
 	};
 }
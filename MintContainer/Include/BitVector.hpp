@@ -5,33 +5,36 @@
 
 #include <MintMath/Include/MathCommon.h>
 
+#include <intrin.h>
+
 
 namespace mint
 {
 	MINT_INLINE BitVector::BitVector()
-		: _byteCapacity{ kMinByteCapacity }
+		: _wordCapacity{ kMinWordCapacity }
 		, _bitCount{ 0 }
 	{
-		_byteArray = MINT_NEW_ARRAY(uint8, kMinByteCapacity);
+		_wordArray = MINT_NEW_ARRAY(uint64, kMinWordCapacity);
 	}
 
 	MINT_INLINE BitVector::BitVector(const uint32 ByteCapacity)
-		: _byteCapacity{ 0 }
+		: _wordArray{ nullptr }
+		, _wordCapacity{ 0 }
 		, _bitCount{ 0 }
 	{
-		ReserveByteCapacity(Max(ByteCapacity, kMinByteCapacity));
+		ReserveByteCapacity(Max(ByteCapacity, kMinWordCapacity * kBytesPerWord));
 	}
 
 	MINT_INLINE BitVector::~BitVector()
 	{
-		MINT_DELETE_ARRAY(_byteArray);
+		MINT_DELETE_ARRAY(_wordArray);
 	}
 
 	MINT_INLINE void BitVector::PushBack(const bool value)
 	{
 		if (IsFull() == true)
 		{
-			ReserveByteCapacity(_byteCapacity * 2);
+			ReserveWordCapacity(_wordCapacity * 2);
 		}
 
 		++_bitCount;
@@ -60,61 +63,38 @@ namespace mint
 			return;
 		}
 
-		const uint32 newByteCapacity = (newBitCount + kBitsPerByte - 1) / kBitsPerByte;
-		if (_byteCapacity < newByteCapacity)
-		{
-			uint8* temp = nullptr;
-
-			if (_byteArray != nullptr)
-			{
-				temp = MINT_NEW_ARRAY(uint8, _byteCapacity);
-				memcpy(temp, _byteArray, _byteCapacity);
-
-				MINT_DELETE_ARRAY(_byteArray);
-			}
-
-			_byteArray = MINT_NEW_ARRAY(uint8, newByteCapacity);
-
-			if (temp != nullptr)
-			{
-				memcpy(_byteArray, temp, Min(_byteCapacity, newByteCapacity));
-
-				MINT_DELETE_ARRAY(temp);
-			}
-
-			_byteCapacity = newByteCapacity;
-		}
+		ReserveWordCapacity(ComputeWordCount(newBitCount));
 
+		const uint32 oldBitCount = _bitCount;
 		_bitCount = newBitCount;
+		if (oldBitCount < newBitCount)
+		{
+			// 이전에 사용되던 비트가 남아 있을 수 있으므로 새로 늘어난 범위는 0 으로 만든다.
+			SetRange(oldBitCount, newBitCount, false);
+		}
 	}
 
 	MINT_INLINE void BitVector::ReserveByteCapacity(const uint32 newByteCapacity)
 	{
-		if (newByteCapacity <= _byteCapacity)
-		{
-			return;
-		}
-
-		uint8* temp = nullptr;
+		ReserveWordCapacity((newByteCapacity + kBytesPerWord - 1) / kBytesPerWord);
+	}
 
-		if (_byteArray != nullptr)
+	MINT_INLINE void BitVector::ReserveWordCapacity(const uint32 newWordCapacity)
+	{
+		if (newWordCapacity <= _wordCapacity)
 		{
-			temp = MINT_NEW_ARRAY(uint8, _byteCapacity);
-			memcpy(temp, _byteArray, _byteCapacity);
-
-			MINT_DELETE_ARRAY(_byteArray);
+			return;
 		}
 
-		_byteArray = MINT_NEW_ARRAY(uint8, newByteCapacity);
-
-		if (temp != nullptr)
+		uint64* const newWordArray = MINT_NEW_ARRAY(uint64, newWordCapacity);
+		if (_wordArray != nullptr)
 		{
-			memcpy(_byteArray, temp, Min(_byteCapacity, newByteCapacity));
+			::memcpy(newWordArray, _wordArray, sizeof(uint64) * _wordCapacity);
 
-			MINT_DELETE_ARRAY(temp);
+			MINT_DELETE_ARRAY(_wordArray);
 		}
-
-		_byteCapacity = newByteCapacity;
+		_wordArray = newWordArray;
+		_wordCapacity = newWordCapacity;
 	}
 
 	MINT_INLINE bool BitVector::IsEmpty() const noexcept
@@ -124,7 +104,7 @@ namespace mint
 
 	MINT_INLINE bool BitVector::IsFull() const noexcept
 	{
-		return (_byteCapacity < ComputeByteAt(_bitCount) + 1);
+		return (_wordCapacity < ComputeWordAt(_bitCount) + 1);
 	}
 
 	MINT_INLINE bool BitVector::IsInSizeBoundary(const uint32 bitAt) const noexcept
@@ -136,18 +116,24 @@ namespace mint
 	{
 		MINT_ASSERT(IsInSizeBoundary(bitAt), "범위를 벗어난 접근입니다.");
 
-		const uint32 byteAt = ComputeByteAt(bitAt);
-		const uint32 byteBitOffsetFromLeft = ComputeBitOffset(bitAt);
-
-		const uint8 bitMaskOneAt = MakeBitMaskOneAt(byteBitOffsetFromLeft);
-		return (_byteArray[byteAt] & bitMaskOneAt);
+		const uint32 wordAt = ComputeWordAt(bitAt);
+		const uint32 wordBitOffset = ComputeWordBitOffset(bitAt);
+		return (_wordArray[wordAt] & MakeWordBitMaskOneAt(wordBitOffset)) != 0;
 	}
 
 	MINT_INLINE uint8 BitVector::GetByte(const uint32 byteAt) const noexcept
 	{
-		MINT_ASSERT(byteAt < _byteCapacity, "범위를 벗어난 접근입니다.");
+		MINT_ASSERT(byteAt < ByteCapacity(), "범위를 벗어난 접근입니다.");
 
-		return _byteArray[byteAt];
+		const uint32 byteShift = (kBytesPerWord - 1 - (byteAt % kBytesPerWord)) * kBitsPerByte;
+		return static_cast<uint8>(_wordArray[byteAt / kBytesPerWord] >> byteShift);
+	}
+
+	MINT_INLINE uint64 BitVector::GetWord(const uint32 wordAt) const noexcept
+	{
+		MINT_ASSERT(wordAt < _wordCapacity, "범위를 벗어난 접근입니다.");
+
+		return _wordArray[wordAt];
 	}
 
 	MINT_INLINE bool BitVector::First() const noexcept
@@ -164,32 +150,71 @@ namespace mint
 	{
 		MINT_ASSERT(IsInSizeBoundary(bitAt), "범위를 벗어난 접근입니다.");
 
-		const uint32 byteAt = ComputeByteAt(bitAt);
-		const uint32 bitOffsetFromLeft = ComputeBitOffset(bitAt);
-		SetBit(_byteArray[byteAt], bitOffsetFromLeft, value);
+		const uint32 wordAt = ComputeWordAt(bitAt);
+		const uint64 wordBitMask = MakeWordBitMaskOneAt(ComputeWordBitOffset(bitAt));
+		if (value == true)
+		{
+			_wordArray[wordAt] |= wordBitMask;
+		}
+		else
+		{
+			_wordArray[wordAt] &= ~wordBitMask;
+		}
 	}
 
 	MINT_INLINE void BitVector::Set(const uint32 byteAt, const uint32 bitOffsetFromLeft, const bool value) noexcept
 	{
-		MINT_ASSERT(IsInSizeBoundary(byteAt * kBitsPerByte + bitOffsetFromLeft), "범위를 벗어난 접근입니다.");
-
-		SetBit(_byteArray[byteAt], bitOffsetFromLeft, value);
+		Set(byteAt * kBitsPerByte + bitOffsetFromLeft, value);
 	}
 
 	MINT_INLINE void BitVector::SetByte(const uint32 byteAt, const uint8 byte) noexcept
 	{
-		MINT_ASSERT(byteAt < _byteCapacity, "범위를 벗어난 접근입니다.");
+		MINT_ASSERT(byteAt < ByteCapacity(), "범위를 벗어난 접근입니다.");
 
-		_byteArray[byteAt] = byte;
+		const uint32 byteShift = (kBytesPerWord - 1 - (byteAt % kBytesPerWord)) * kBitsPerByte;
+		uint64& word = _wordArray[byteAt / kBytesPerWord];
+		word = (word & ~(static_cast<uint64>(kUint8Max) << byteShift)) | (static_cast<uint64>(byte) << byteShift);
 	}
 
-	MINT_INLINE void BitVector::Fill(const bool value) noexcept
+	MINT_INLINE void BitVector::SetWord(const uint32 wordAt, const uint64 word) noexcept
 	{
-		const uint8 byteValue = (value == true) ? 255 : 0;
-		for (uint32 byteAt = 0; byteAt < _byteCapacity; ++byteAt)
+		MINT_ASSERT(wordAt < _wordCapacity, "범위를 벗어난 접근입니다.");
+
+		_wordArray[wordAt] = word;
+	}
+
+	MINT_INLINE void BitVector::SetRange(const uint32 bitAtBegin, const uint32 bitAtEnd, const bool value) noexcept
+	{
+		MINT_ASSERT(bitAtBegin <= bitAtEnd && bitAtEnd <= _bitCount, "범위를 벗어난 접근입니다.");
+
+		if (bitAtBegin >= bitAtEnd)
 		{
-			_byteArray[byteAt] = byteValue;
+			return;
+		}
+
+		const uint32 firstWordAt = ComputeWordAt(bitAtBegin);
+		const uint32 lastWordAt = ComputeWordAt(bitAtEnd - 1);
+		const uint64 firstWordMask = kUint64Max >> ComputeWordBitOffset(bitAtBegin);
+		const uint64 lastWordMask = kUint64Max << (kBitsPerWord - 1 - ComputeWordBitOffset(bitAtEnd - 1));
+		const uint64 fillWord = (value == true) ? kUint64Max : 0;
+		if (firstWordAt == lastWordAt)
+		{
+			const uint64 mask = firstWordMask & lastWordMask;
+			_wordArray[firstWordAt] = (_wordArray[firstWordAt] & ~mask) | (fillWord & mask);
+			return;
 		}
+
+		_wordArray[firstWordAt] = (_wordArray[firstWordAt] & ~firstWordMask) | (fillWord & firstWordMask);
+		for (uint32 wordAt = firstWordAt + 1; wordAt < lastWordAt; ++wordAt)
+		{
+			_wordArray[wordAt] = fillWord;
+		}
+		_wordArray[lastWordAt] = (_wordArray[lastWordAt] & ~lastWordMask) | (fillWord & lastWordMask);
+	}
+
+	MINT_INLINE void BitVector::Fill(const bool value) noexcept
+	{
+		::memset(_wordArray, (value == true) ? kUint8Max : 0, sizeof(uint64) * _wordCapacity);
 	}
 
 	MINT_INLINE void BitVector::Swap(const uint32 aBitAt, const uint32 bBitAt) noexcept
@@ -202,6 +227,119 @@ namespace mint
 		Set(bBitAt, a);
 	}
 
+	MINT_INLINE void BitVector::And(const BitVector& rhs) noexcept
+	{
+		const uint32 commonWordCount = Min(WordCount(), rhs.WordCount());
+		uint32 wordAt = 0;
+		for (; wordAt + 2 < commonWordCount; wordAt += 2)
+		{
+			const __m128i lhs128 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&_wordArray[wordAt]));
+			const __m128i rhs128 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&rhs._wordArray[wordAt]));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(&_wordArray[wordAt]), _mm_and_si128(lhs128, rhs128));
+		}
+		for (; wordAt < commonWordCount; ++wordAt)
+		{
+			_wordArray[wordAt] &= rhs.GetMaskedWord(wordAt);
+		}
+
+		const uint32 wordCount = WordCount();
+		for (; wordAt < wordCount; ++wordAt)
+		{
+			_wordArray[wordAt] = 0;
+		}
+	}
+
+	MINT_INLINE void BitVector::Or(const BitVector& rhs) noexcept
+	{
+		const uint32 commonWordCount = Min(WordCount(), rhs.WordCount());
+		if (commonWordCount == 0)
+		{
+			return;
+		}
+
+		uint32 wordAt = 0;
+		for (; wordAt + 2 < commonWordCount; wordAt += 2)
+		{
+			const __m128i lhs128 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&_wordArray[wordAt]));
+			const __m128i rhs128 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&rhs._wordArray[wordAt]));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(&_wordArray[wordAt]), _mm_or_si128(lhs128, rhs128));
+		}
+		for (; wordAt < commonWordCount; ++wordAt)
+		{
+			_wordArray[wordAt] |= rhs.GetMaskedWord(wordAt);
+		}
+	}
+
+	MINT_INLINE void BitVector::Xor(const BitVector& rhs) noexcept
+	{
+		const uint32 commonWordCount = Min(WordCount(), rhs.WordCount());
+		if (commonWordCount == 0)
+		{
+			return;
+		}
+
+		uint32 wordAt = 0;
+		for (; wordAt + 2 < commonWordCount; wordAt += 2)
+		{
+			const __m128i lhs128 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&_wordArray[wordAt]));
+			const __m128i rhs128 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&rhs._wordArray[wordAt]));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(&_wordArray[wordAt]), _mm_xor_si128(lhs128, rhs128));
+		}
+		for (; wordAt < commonWordCount; ++wordAt)
+		{
+			_wordArray[wordAt] ^= rhs.GetMaskedWord(wordAt);
+		}
+	}
+
+	MINT_INLINE void BitVector::AndNot(const BitVector& rhs) noexcept
+	{
+		const uint32 commonWordCount = Min(WordCount(), rhs.WordCount());
+		if (commonWordCount == 0)
+		{
+			return;
+		}
+
+		uint32 wordAt = 0;
+		for (; wordAt + 2 < commonWordCount; wordAt += 2)
+		{
+			const __m128i lhs128 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&_wordArray[wordAt]));
+			const __m128i rhs128 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&rhs._wordArray[wordAt]));
+			// _mm_andnot_si128(a, b) == ~a & b
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(&_wordArray[wordAt]), _mm_andnot_si128(rhs128, lhs128));
+		}
+		for (; wordAt < commonWordCount; ++wordAt)
+		{
+			_wordArray[wordAt] &= ~rhs.GetMaskedWord(wordAt);
+		}
+	}
+
+	MINT_INLINE uint32 BitVector::PopCount() const noexcept
+	{
+		const uint32 wordCount = WordCount();
+		if (wordCount == 0)
+		{
+			return 0;
+		}
+
+		uint64 count = 0;
+		for (uint32 wordAt = 0; wordAt < wordCount - 1; ++wordAt)
+		{
+			count += PopCount64(_wordArray[wordAt]);
+		}
+		count += PopCount64(GetMaskedWord(wordCount - 1));
+		return static_cast<uint32>(count);
+	}
+
+	MINT_INLINE uint32 BitVector::FindFirstSet() const noexcept
+	{
+		return FindSetFrom(0);
+	}
+
+	MINT_INLINE uint32 BitVector::FindNextSet(const uint32 previousBitAt) const noexcept
+	{
+		return FindSetFrom(previousBitAt + 1);
+	}
+
 	MINT_INLINE uint32 BitVector::BitCount() const noexcept
 	{
 		return _bitCount;
@@ -209,7 +347,17 @@ namespace mint
 
 	MINT_INLINE uint32 BitVector::ByteCapacity() const noexcept
 	{
-		return _byteCapacity;
+		return _wordCapacity * kBytesPerWord;
+	}
+
+	MINT_INLINE uint32 BitVector::WordCapacity() const noexcept
+	{
+		return _wordCapacity;
+	}
+
+	MINT_INLINE uint32 BitVector::WordCount() const noexcept
+	{
+		return (_bitCount + kBitsPerWord - 1) / kBitsPerWord;
 	}
 
 	MINT_INLINE void BitVector::SetBit(uint8& inOutByte, const uint32 bitOffsetFromLeft, const bool value) noexcept
@@ -247,6 +395,21 @@ namespace mint
 		return bitAt % kBitsPerByte;
 	}
 
+	MINT_INLINE uint32 BitVector::ComputeWordCount(const uint32 BitCount) noexcept
+	{
+		return (BitCount + kBitsPerWord - 1) / kBitsPerWord;
+	}
+
+	MINT_INLINE uint32 BitVector::ComputeWordAt(const uint32 bitAt) noexcept
+	{
+		return bitAt / kBitsPerWord;
+	}
+
+	MINT_INLINE uint32 BitVector::ComputeWordBitOffset(const uint32 bitAt) noexcept
+	{
+		return bitAt % kBitsPerWord;
+	}
+
 	MINT_INLINE uint8 BitVector::MakeByte(const bool(&valueArray)[8]) noexcept
 	{
 		return static_cast<uint8>(
@@ -265,4 +428,53 @@ namespace mint
 	{
 		return (1 << (kBitsPerByte - bitOffsetFromLeft - 1));
 	}
+
+	MINT_INLINE uint64 BitVector::MakeWordBitMaskOneAt(const uint32 wordBitOffsetFromLeft) noexcept
+	{
+		return (1ULL << (kBitsPerWord - wordBitOffsetFromLeft - 1));
+	}
+
+	MINT_INLINE uint64 BitVector::ComputeLastWordMask() const noexcept
+	{
+		const uint32 usedBitCount = ComputeWordBitOffset(_bitCount);
+		return (usedBitCount == 0) ? kUint64Max : ~(kUint64Max >> usedBitCount);
+	}
+
+	MINT_INLINE uint64 BitVector::GetMaskedWord(const uint32 wordAt) const noexcept
+	{
+		return (wordAt + 1 == WordCount()) ? (_wordArray[wordAt] & ComputeLastWordMask()) : _wordArray[wordAt];
+	}
+
+	MINT_INLINE uint32 BitVector::FindSetFrom(const uint32 bitAt) const noexcept
+	{
+		if (bitAt >= _bitCount)
+		{
+			return kUint32Max;
+		}
+
+		const uint32 wordCount = WordCount();
+		uint32 wordAt = ComputeWordAt(bitAt);
+		uint64 word = _wordArray[wordAt] & (kUint64Max >> ComputeWordBitOffset(bitAt));
+		while (true)
+		{
+			if (wordAt == wordCount - 1)
+			{
+				word &= ComputeLastWordMask();
+			}
+
+			if (word != 0)
+			{
+				unsigned long highestSetBitIndex = 0;
+				_BitScanReverse64(&highestSetBitIndex, word);
+				return wordAt * kBitsPerWord + (kBitsPerWord - 1 - highestSetBitIndex);
+			}
+
+			++wordAt;
+			if (wordAt >= wordCount)
+			{
+				return kUint32Max;
+			}
+			word = _wordArray[wordAt];
+		}
+	}
 }
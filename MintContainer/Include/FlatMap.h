@@ -0,0 +1,170 @@
+﻿#pragma once
+
+
+#ifndef _MINT_CONTAINER_FLAT_MAP_H_
+#define _MINT_CONTAINER_FLAT_MAP_H_
+
+
+#include <MintCommon/Include/CommonDefinitions.h>
+
+#include <MintContainer/Include/Vector.h>
+#include <MintContainer/Include/HashMap.h>
+
+
+namespace mint
+{
+	// 정렬된 Vector 위의 map
+	// - 작고 주로 읽기만 하는 dictionary 용이다. (HashMap 처럼 bucket 을 미리 잡지 않는다)
+	// - Find 는 branchless 이진 탐색으로 O(log n), Insert/Erase 는 뒤쪽 원소를 밀어야 하므로 O(n) 이다.
+	// - key 와 value 를 따로 저장하여 탐색 시 key 만 cache 에 올라오도록 한다.
+	// Key must have bool operator<(const Key&) defined
+	template<typename Key, typename Value>
+	class FlatMap final
+	{
+	public:
+		FlatMap() = default;
+		FlatMap(const FlatMap& rhs) = default;
+		FlatMap(FlatMap&& rhs) noexcept = default;
+		~FlatMap() = default;
+
+	public:
+		FlatMap& operator=(const FlatMap& rhs) = default;
+		FlatMap& operator=(FlatMap&& rhs) noexcept = default;
+
+	public:
+		// 정렬되지 않은 key, value 들로 한 번에 구성한다. O(n log n)
+		// 중복된 key 는 Insert 와 마찬가지로 먼저 나온 것만 남는다.
+		void Assign(const Vector<Key>& keys, const Vector<Value>& values) noexcept;
+		// rhs 에만 있는 key 들을 추가한다. 둘 다 정렬되어 있으므로 O(n + m)
+		void Merge(const FlatMap& rhs) noexcept;
+		void Reserve(const uint32 capacity) noexcept;
+
+	public:
+		bool Contains(const Key& key) const noexcept;
+
+	public:
+		void Insert(const Key& key, const Value& value) noexcept;
+		void Insert(const Key& key, Value&& value) noexcept;
+
+		void Erase(const Key& key) noexcept;
+		void Clear() noexcept;
+
+	public:
+		KeyValuePair<Key, Value> Find(const Key& key) const noexcept;
+		const Value& At(const Key& key) const noexcept;
+		Value& At(const Key& key) noexcept;
+
+	public:
+		MINT_INLINE uint32 Size() const noexcept { return _keys.Size(); }
+		MINT_INLINE bool IsEmpty() const noexcept { return _keys.IsEmpty(); }
+		MINT_INLINE const Vector<Key>& GetKeys() const noexcept { return _keys; }
+		MINT_INLINE const Vector<Value>& GetValues() const noexcept { return _values; }
+		MINT_INLINE Vector<Value>& GetValues() noexcept { return _values; }
+
+	private:
+		uint32 FindIndex(const Key& key) const noexcept;
+
+	private:
+		static Value& GetInvalidValue() noexcept;
+
+	private:
+		Vector<Key> _keys;
+		Vector<Value> _values;
+	};
+
+
+	// 정렬된 Vector 위의 set
+	// Key must have bool operator<(const Key&) defined
+	template<typename Key>
+	class FlatSet final
+	{
+	public:
+		FlatSet() = default;
+		FlatSet(const FlatSet& rhs) = default;
+		FlatSet(FlatSet&& rhs) noexcept = default;
+		~FlatSet() = default;
+
+	public:
+		FlatSet& operator=(const FlatSet& rhs) = default;
+		FlatSet& operator=(FlatSet&& rhs) noexcept = default;
+
+	public:
+		// 정렬되지 않은 key 들로 한 번에 구성한다. O(n log n)
+		void Assign(const Vector<Key>& keys) noexcept;
+		// 합집합. O(n + m)
+		void Merge(const FlatSet& rhs) noexcept;
+		void Reserve(const uint32 capacity) noexcept;
+
+	public:
+		bool Contains(const Key& key) const noexcept;
+
+	public:
+		void Insert(const Key& key) noexcept;
+		void Erase(const Key& key) noexcept;
+		void Clear() noexcept;
+
+	public:
+		MINT_INLINE uint32 Size() const noexcept { return _keys.Size(); }
+		MINT_INLINE bool IsEmpty() const noexcept { return _keys.IsEmpty(); }
+		MINT_INLINE const Vector<Key>& GetKeys() const noexcept { return _keys; }
+
+	public:
+		MINT_INLINE typename Vector<Key>::ConstIterator begin() const noexcept { return _keys.begin(); }
+		MINT_INLINE typename Vector<Key>::ConstIterator end() const noexcept { return _keys.end(); }
+
+	private:
+		Vector<Key> _keys;
+	};
+
+
+	// char 를 key 로 하는 256 칸짜리 직접 색인 table
+	// - Find 는 비교 없이 한 번의 memory 접근으로 끝난다.
+	// Value must be default_constructible
+	template<typename Value>
+	class CharTable final
+	{
+	public:
+		CharTable();
+		CharTable(const CharTable& rhs) = default;
+		CharTable(CharTable&& rhs) noexcept = default;
+		~CharTable() = default;
+
+	public:
+		CharTable& operator=(const CharTable& rhs) = default;
+		CharTable& operator=(CharTable&& rhs) noexcept = default;
+
+	public:
+		MINT_INLINE bool Contains(const char key) const noexcept { return ((_isUsedBits[ComputeWordAt(key)] >> ComputeBitOffset(key)) & 1) != 0; }
+
+	public:
+		void Insert(const char key, const Value& value) noexcept;
+		void Insert(const char key, Value&& value) noexcept;
+
+		void Erase(const char key) noexcept;
+		void Clear() noexcept;
+
+	public:
+		// 없으면 nullptr 를 반환한다.
+		MINT_INLINE const Value* Find(const char key) const noexcept { return (Contains(key) == true) ? &_values[static_cast<uint8>(key)] : nullptr; }
+		MINT_INLINE Value* Find(const char key) noexcept { return (Contains(key) == true) ? &_values[static_cast<uint8>(key)] : nullptr; }
+
+	public:
+		MINT_INLINE uint32 Size() const noexcept { return _size; }
+		MINT_INLINE bool IsEmpty() const noexcept { return _size == 0; }
+
+	private:
+		static MINT_INLINE constexpr uint32 ComputeWordAt(const char key) noexcept { return static_cast<uint8>(key) >> 6; }
+		static MINT_INLINE constexpr uint32 ComputeBitOffset(const char key) noexcept { return static_cast<uint8>(key) & 63; }
+
+	private:
+		static constexpr uint32 kKeyCount = 256;
+
+	private:
+		uint64 _isUsedBits[kKeyCount / 64];
+		uint32 _size;
+		Value _values[kKeyCount];
+	};
+}
+
+
+#endif // !_MINT_CONTAINER_FLAT_MAP_H_
@@ -0,0 +1,374 @@
+﻿#pragma once
+
+
+#ifndef _MINT_CONTAINER_FLAT_MAP_HPP_
+#define _MINT_CONTAINER_FLAT_MAP_HPP_
+
+
+#include <MintContainer/Include/FlatMap.h>
+
+#include <MintContainer/Include/Vector.hpp>
+#include <MintContainer/Include/Algorithm.hpp>
+
+
+namespace mint
+{
+#pragma region FlatMap
+	template<typename Key, typename Value>
+	inline void FlatMap<Key, Value>::Assign(const Vector<Key>& keys, const Vector<Value>& values) noexcept
+	{
+		MINT_ASSERT(keys.Size() == values.Size(), "keys 와 values 의 크기가 다릅니다!");
+
+		const uint32 count = Min(keys.Size(), values.Size());
+		Vector<uint32> sortedIndices;
+		sortedIndices.Resize(count);
+		for (uint32 i = 0; i < count; ++i)
+		{
+			sortedIndices[i] = i;
+		}
+		// 같은 key 끼리는 원래 순서를 유지해야 먼저 나온 것을 남길 수 있다.
+		StableSort(sortedIndices, [&keys](const uint32 lhs, const uint32 rhs) { return keys[lhs] < keys[rhs]; });
+
+		_keys.Clear();
+		_values.Clear();
+		_keys.Reserve(count);
+		_values.Reserve(count);
+		for (const uint32 index : sortedIndices)
+		{
+			if (_keys.IsEmpty() == false && (_keys.Back() < keys[index]) == false)
+			{
+				continue;
+			}
+
+			_keys.PushBack(keys[index]);
+			_values.PushBack(values[index]);
+		}
+	}
+
+	template<typename Key, typename Value>
+	inline void FlatMap<Key, Value>::Merge(const FlatMap& rhs) noexcept
+	{
+		if (rhs.IsEmpty() == true)
+		{
+			return;
+		}
+
+		Vector<Key> mergedKeys;
+		Vector<Value> mergedValues;
+		mergedKeys.Reserve(_keys.Size() + rhs._keys.Size());
+		mergedValues.Reserve(_keys.Size() + rhs._keys.Size());
+
+		uint32 lhsAt = 0;
+		uint32 rhsAt = 0;
+		while (lhsAt < _keys.Size() && rhsAt < rhs._keys.Size())
+		{
+			if (rhs._keys[rhsAt] < _keys[lhsAt])
+			{
+				mergedKeys.PushBack(rhs._keys[rhsAt]);
+				mergedValues.PushBack(rhs._values[rhsAt]);
+				++rhsAt;
+				continue;
+			}
+
+			if ((_keys[lhsAt] < rhs._keys[rhsAt]) == false)
+			{
+				// 같은 key 는 기존 값을 유지한다.
+				++rhsAt;
+			}
+			mergedKeys.PushBack(std::move(_keys[lhsAt]));
+			mergedValues.PushBack(std::move(_values[lhsAt]));
+			++lhsAt;
+		}
+		for (; lhsAt < _keys.Size(); ++lhsAt)
+		{
+			mergedKeys.PushBack(std::move(_keys[lhsAt]));
+			mergedValues.PushBack(std::move(_values[lhsAt]));
+		}
+		for (; rhsAt < rhs._keys.Size(); ++rhsAt)
+		{
+			mergedKeys.PushBack(rhs._keys[rhsAt]);
+			mergedValues.PushBack(rhs._values[rhsAt]);
+		}
+
+		_keys = std::move(mergedKeys);
+		_values = std::move(mergedValues);
+	}
+
+	template<typename Key, typename Value>
+	inline void FlatMap<Key, Value>::Reserve(const uint32 capacity) noexcept
+	{
+		_keys.Reserve(capacity);
+		_values.Reserve(capacity);
+	}
+
+	template<typename Key, typename Value>
+	inline bool FlatMap<Key, Value>::Contains(const Key& key) const noexcept
+	{
+		return FindIndex(key) != kInvalidIndexUint32;
+	}
+
+	template<typename Key, typename Value>
+	inline void FlatMap<Key, Value>::Insert(const Key& key, const Value& value) noexcept
+	{
+		const uint32 index = LowerBound(_keys, key);
+		if (index < _keys.Size() && (key < _keys[index]) == false)
+		{
+			return;
+		}
+
+		_keys.Insert(index, key);
+		_values.Insert(index, value);
+	}
+
+	template<typename Key, typename Value>
+	inline void FlatMap<Key, Value>::Insert(const Key& key, Value&& value) noexcept
+	{
+		const uint32 index = LowerBound(_keys, key);
+		if (index < _keys.Size() && (key < _keys[index]) == false)
+		{
+			return;
+		}
+
+		_keys.Insert(index, key);
+		_values.Insert(index, std::move(value));
+	}
+
+	template<typename Key, typename Value>
+	inline void FlatMap<Key, Value>::Erase(const Key& key) noexcept
+	{
+		const uint32 index = FindIndex(key);
+		if (index == kInvalidIndexUint32)
+		{
+			return;
+		}
+
+		_keys.Erase(index);
+		_values.Erase(index);
+	}
+
+	template<typename Key, typename Value>
+	inline void FlatMap<Key, Value>::Clear() noexcept
+	{
+		_keys.Clear();
+		_values.Clear();
+	}
+
+	template<typename Key, typename Value>
+	inline KeyValuePair<Key, Value> FlatMap<Key, Value>::Find(const Key& key) const noexcept
+	{
+		KeyValuePair<Key, Value> findResult;
+		const uint32 index = FindIndex(key);
+		if (index != kInvalidIndexUint32)
+		{
+			findResult._key = &_keys[index];
+			findResult._value = const_cast<Value*>(&_values[index]);
+		}
+		return findResult;
+	}
+
+	template<typename Key, typename Value>
+	inline const Value& FlatMap<Key, Value>::At(const Key& key) const noexcept
+	{
+		const uint32 index = FindIndex(key);
+		return (index == kInvalidIndexUint32) ? GetInvalidValue() : _values[index];
+	}
+
+	template<typename Key, typename Value>
+	inline Value& FlatMap<Key, Value>::At(const Key& key) noexcept
+	{
+		const uint32 index = FindIndex(key);
+		return (index == kInvalidIndexUint32) ? GetInvalidValue() : _values[index];
+	}
+
+	template<typename Key, typename Value>
+	MINT_INLINE uint32 FlatMap<Key, Value>::FindIndex(const Key& key) const noexcept
+	{
+		const uint32 index = LowerBound(_keys, key);
+		return (index < _keys.Size() && (key < _keys[index]) == false) ? index : kInvalidIndexUint32;
+	}
+
+	template<typename Key, typename Value>
+	inline Value& FlatMap<Key, Value>::GetInvalidValue() noexcept
+	{
+		static Value invalidValue{};
+		return invalidValue;
+	}
+#pragma endregion
+
+
+#pragma region FlatSet
+	template<typename Key>
+	inline void FlatSet<Key>::Assign(const Vector<Key>& keys) noexcept
+	{
+		_keys = keys;
+		QuickSort(_keys, ComparatorAscending<Key>());
+
+		// 중복 제거
+		uint32 uniqueCount = 0;
+		for (uint32 i = 0; i < _keys.Size(); ++i)
+		{
+			if (uniqueCount > 0 && (_keys[uniqueCount - 1] < _keys[i]) == false)
+			{
+				continue;
+			}
+
+			if (uniqueCount != i)
+			{
+				_keys[uniqueCount] = std::move(_keys[i]);
+			}
+			++uniqueCount;
+		}
+		_keys.Resize(uniqueCount);
+	}
+
+	template<typename Key>
+	inline void FlatSet<Key>::Merge(const FlatSet& rhs) noexcept
+	{
+		if (rhs.IsEmpty() == true)
+		{
+			return;
+		}
+
+		Vector<Key> mergedKeys;
+		mergedKeys.Reserve(_keys.Size() + rhs._keys.Size());
+
+		uint32 lhsAt = 0;
+		uint32 rhsAt = 0;
+		while (lhsAt < _keys.Size() && rhsAt < rhs._keys.Size())
+		{
+			if (rhs._keys[rhsAt] < _keys[lhsAt])
+			{
+				mergedKeys.PushBack(rhs._keys[rhsAt]);
+				++rhsAt;
+				continue;
+			}
+
+			if ((_keys[lhsAt] < rhs._keys[rhsAt]) == false)
+			{
+				++rhsAt;
+			}
+			mergedKeys.PushBack(std::move(_keys[lhsAt]));
+			++lhsAt;
+		}
+		for (; lhsAt < _keys.Size(); ++lhsAt)
+		{
+			mergedKeys.PushBack(std::move(_keys[lhsAt]));
+		}
+		for (; rhsAt < rhs._keys.Size(); ++rhsAt)
+		{
+			mergedKeys.PushBack(rhs._keys[rhsAt]);
+		}
+
+		_keys = std::move(mergedKeys);
+	}
+
+	template<typename Key>
+	inline void FlatSet<Key>::Reserve(const uint32 capacity) noexcept
+	{
+		_keys.Reserve(capacity);
+	}
+
+	template<typename Key>
+	inline bool FlatSet<Key>::Contains(const Key& key) const noexcept
+	{
+		const uint32 index = LowerBound(_keys, key);
+		return index < _keys.Size() && (key < _keys[index]) == false;
+	}
+
+	template<typename Key>
+	inline void FlatSet<Key>::Insert(const Key& key) noexcept
+	{
+		const uint32 index = LowerBound(_keys, key);
+		if (index < _keys.Size() && (key < _keys[index]) == false)
+		{
+			return;
+		}
+
+		_keys.Insert(index, key);
+	}
+
+	template<typename Key>
+	inline void FlatSet<Key>::Erase(const Key& key) noexcept
+	{
+		const uint32 index = LowerBound(_keys, key);
+		if (index < _keys.Size() && (key < _keys[index]) == false)
+		{
+			_keys.Erase(index);
+		}
+	}
+
+	template<typename Key>
+	inline void FlatSet<Key>::Clear() noexcept
+	{
+		_keys.Clear();
+	}
+#pragma endregion
+
+
+#pragma region CharTable
+	template<typename Value>
+	inline CharTable<Value>::CharTable()
+		: _isUsedBits{}
+		, _size{ 0 }
+		, _values{}
+	{
+		__noop;
+	}
+
+	template<typename Value>
+	inline void CharTable<Value>::Insert(const char key, const Value& value) noexcept
+	{
+		if (Contains(key) == true)
+		{
+			return;
+		}
+
+		_isUsedBits[ComputeWordAt(key)] |= (1ULL << ComputeBitOffset(key));
+		_values[static_cast<uint8>(key)] = value;
+		++_size;
+	}
+
+	template<typename Value>
+	inline void CharTable<Value>::Insert(const char key, Value&& value) noexcept
+	{
+		if (Contains(key) == true)
+		{
+			return;
+		}
+
+		_isUsedBits[ComputeWordAt(key)] |= (1ULL << ComputeBitOffset(key));
+		_values[static_cast<uint8>(key)] = std::move(value);
+		++_size;
+	}
+
+	template<typename Value>
+	inline void CharTable<Value>::Erase(const char key) noexcept
+	{
+		if (Contains(key) == false)
+		{
+			return;
+		}
+
+		_isUsedBits[ComputeWordAt(key)] &= ~(1ULL << ComputeBitOffset(key));
+		_values[static_cast<uint8>(key)] = Value();
+		--_size;
+	}
+
+	template<typename Value>
+	inline void CharTable<Value>::Clear() noexcept
+	{
+		for (uint64& isUsedBits : _isUsedBits)
+		{
+			isUsedBits = 0;
+		}
+		for (Value& value : _values)
+		{
+			value = Value();
+		}
+		_size = 0;
+	}
+#pragma endregion
+}
+
+
+#endif // !_MINT_CONTAINER_FLAT_MAP_HPP_
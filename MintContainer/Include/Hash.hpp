@@ -13,7 +13,8 @@ namespace mint
 	{
 		// Hashing algorithm: FNV1a
 
-		if (StringUtil::IsNullOrEmpty(rhs) == true)
+		// 정수 등의 byte 열도 받으므로 첫 byte 가 0 이어도 비어 있는 것이 아니다.
+		if (rhs == nullptr || length == 0)
 		{
 			return kUint64Max;
 		}
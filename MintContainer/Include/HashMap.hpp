@@ -358,15 +358,21 @@ namespace mint
 	template<typename Key, typename Value>
 	inline bool HashMap<Key, Value>::Displace(const uint32 startBucketIndex, uint32& hopDistance) noexcept
 	{
-		const uint32 bucketH_1Index = startBucketIndex + hopDistance - (kHopRange - 1);
-		auto& bucketH_1 = _bucketArray[bucketH_1Index];
-		for (uint32 hopAt = 0; hopAt < kHopRange; ++hopAt)
+		// 빈 bucket 보다 앞에 있고, 자기 start bucket 의 HopRange 를 벗어나지 않고 빈 bucket 으로 옮길 수 있는 원소를 찾는다.
+		// 옮기고 나면 그 원소가 있던 자리가 새 빈 bucket 이 된다.
+		const uint32 emptyBucketIndex = startBucketIndex + hopDistance;
+		for (uint32 baseBucketIndex = emptyBucketIndex - (kHopRange - 1); baseBucketIndex < emptyBucketIndex; ++baseBucketIndex)
 		{
-			if (bucketH_1._hopInfo.Get(hopAt) == true)
+			const uint32 emptyHopDistance = emptyBucketIndex - baseBucketIndex;
+			const auto& baseBucket = _bucketArray[baseBucketIndex];
+			for (uint32 hopAt = 0; hopAt < emptyHopDistance; ++hopAt)
 			{
-				DisplaceBucket(bucketH_1Index, hopAt, 3);
-				hopDistance = bucketH_1Index + hopAt - startBucketIndex;
-				return true;
+				if (baseBucket._hopInfo.Get(hopAt) == true)
+				{
+					DisplaceBucket(baseBucketIndex, hopAt, emptyHopDistance);
+					hopDistance = baseBucketIndex + hopAt - startBucketIndex;
+					return true;
+				}
 			}
 		}
 		return false;
@@ -404,7 +410,7 @@ namespace mint
 	template<typename Key, typename Value>
 	MINT_INLINE uint32 HashMap<Key, Value>::ComputeSegmentIndex(const uint64 keyHash) const noexcept
 	{
-		return keyHash % (_bucketArray.Capacity() / kSegmentLength);
+		return keyHash % (_bucketArray.Size() / kSegmentLength);
 	}
 
 	template<typename Key, typename Value>
@@ -23,8 +23,14 @@ namespace mint
 	public:
 		InlineVectorStorage();
 		InlineVectorStorage(const std::initializer_list<T>& initializerList);
+		InlineVectorStorage(const InlineVectorStorage& rhs);
+		InlineVectorStorage(InlineVectorStorage&& rhs) noexcept;
 		~InlineVectorStorage();
 
+	public:
+		InlineVectorStorage& operator=(const InlineVectorStorage& rhs);
+		InlineVectorStorage& operator=(InlineVectorStorage&& rhs) noexcept;
+
 	public:
 		void Reserve(const uint32 newCapacity);
 		void Resize(const uint32 newSize) requires (IsDefaultConstructible<T>() == true);
@@ -39,13 +45,14 @@ namespace mint
 		void Clear() noexcept;
 
 	public:
-		MINT_INLINE virtual T* Data() noexcept override final { return _ptr; }
-		MINT_INLINE virtual const T* Data() const noexcept override final { return _ptr; }
+		MINT_INLINE virtual T* Data() noexcept override final { return IsUsingHeap() ? _ptr : reinterpret_cast<T*>(__array); }
+		MINT_INLINE virtual const T* Data() const noexcept override final { return IsUsingHeap() ? _ptr : reinterpret_cast<const T*>(__array); }
 		MINT_INLINE virtual constexpr uint32 Capacity() const noexcept override final { return _capacity; }
 		MINT_INLINE virtual uint32 Size() const noexcept override final { return _size; }
 
 	private:
-		MINT_INLINE bool IsUsingHeap() const noexcept { return _ptr != reinterpret_cast<const T*>(__array); }
+		MINT_INLINE bool IsUsingHeap() const noexcept { return _ptr != nullptr; }
+		void TakeFrom(InlineVectorStorage&& rhs) noexcept;
 
 	public:
 		static constexpr bool kSupportsDynamicCapacity = true;
@@ -53,6 +60,8 @@ namespace mint
 	private:
 		uint32 _capacity;
 		uint32 _size;
+		// nullptr while the inline array is used. It never points into this object,
+		// so an InlineVector can be relocated with memmove (as Vector does when it grows).
 		T* _ptr = nullptr;
 		alignas(T) byte __array[sizeof(T) * kCapacity];
 
@@ -15,7 +15,7 @@ namespace mint
 	inline InlineVectorStorage<T, kCapacity>::InlineVectorStorage()
 		: _capacity{ kCapacity }
 		, _size{ 0 }
-		, _ptr{ reinterpret_cast<T*>(__array) }
+		, _ptr{ nullptr }
 		, __array{}
 	{
 		__noop;
@@ -25,7 +25,7 @@ namespace mint
 	inline InlineVectorStorage<T, kCapacity>::InlineVectorStorage(const std::initializer_list<T>& initializerList)
 		: _capacity{ kCapacity }
 		, _size{ 0 }
-		, _ptr{ reinterpret_cast<T*>(__array) }
+		, _ptr{ nullptr }
 		, __array{}
 	{
 		Reserve(static_cast<uint32>(initializerList.size()));
@@ -36,6 +36,25 @@ namespace mint
 		}
 	}
 
+	template<typename T, const uint32 kCapacity>
+	inline InlineVectorStorage<T, kCapacity>::InlineVectorStorage(const InlineVectorStorage& rhs)
+		: InlineVectorStorage()
+	{
+		Reserve(rhs._size);
+
+		for (uint32 at = 0; at < rhs._size; ++at)
+		{
+			PushBack(rhs.Data()[at]);
+		}
+	}
+
+	template<typename T, const uint32 kCapacity>
+	inline InlineVectorStorage<T, kCapacity>::InlineVectorStorage(InlineVectorStorage&& rhs) noexcept
+		: InlineVectorStorage()
+	{
+		TakeFrom(std::move(rhs));
+	}
+
 	template<typename T, const uint32 kCapacity>
 	inline InlineVectorStorage<T, kCapacity>::~InlineVectorStorage()
 	{
@@ -46,12 +65,47 @@ namespace mint
 			MINT_FREE(_ptr);
 
 			// Though not necessary, make it clear that we are back to using inline array.
-			_ptr = reinterpret_cast<T*>(__array);
+			_ptr = nullptr;
 			_capacity = kCapacity;
 			MINT_ASSERT(IsUsingHeap() == false, "This must be guaranteed after destructor is done.");
 		}
 	}
 
+	template<typename T, const uint32 kCapacity>
+	inline InlineVectorStorage<T, kCapacity>& InlineVectorStorage<T, kCapacity>::operator=(const InlineVectorStorage& rhs)
+	{
+		if (this != &rhs)
+		{
+			Clear();
+
+			Reserve(rhs._size);
+
+			for (uint32 at = 0; at < rhs._size; ++at)
+			{
+				PushBack(rhs.Data()[at]);
+			}
+		}
+		return *this;
+	}
+
+	template<typename T, const uint32 kCapacity>
+	inline InlineVectorStorage<T, kCapacity>& InlineVectorStorage<T, kCapacity>::operator=(InlineVectorStorage&& rhs) noexcept
+	{
+		if (this != &rhs)
+		{
+			Clear();
+			if (IsUsingHeap() == true)
+			{
+				MINT_FREE(_ptr);
+
+				_capacity = kCapacity;
+			}
+
+			TakeFrom(std::move(rhs));
+		}
+		return *this;
+	}
+
 	template<typename T, const uint32 kCapacity>
 	inline void InlineVectorStorage<T, kCapacity>::Reserve(const uint32 newCapacity)
 	{
@@ -61,19 +115,20 @@ namespace mint
 		}
 
 		const uint32 sizeCache = _size;
+		T* const data = Data();
 		T* newPtr = MINT_MALLOC(T, newCapacity);
 		if constexpr (IsMovable<T>() == true)
 		{
 			for (uint32 at = 0; at < sizeCache; ++at)
 			{
-				MemoryRaw::MoveConstructAt(newPtr[at], std::move(_ptr[at]));
+				MemoryRaw::MoveConstructAt(newPtr[at], std::move(data[at]));
 			}
 		}
 		else // though inefficient, make it work.
 		{
 			for (uint32 at = 0; at < sizeCache; ++at)
 			{
-				MemoryRaw::CopyConstructAt(newPtr[at], _ptr[at]);
+				MemoryRaw::CopyConstructAt(newPtr[at], data[at]);
 			}
 		}
 
@@ -103,7 +158,7 @@ namespace mint
 
 			for (uint32 at = _size; at < newSize; ++at)
 			{
-				MemoryRaw::ConstructAt(_ptr[at]);
+				MemoryRaw::ConstructAt(Data()[at]);
 			}
 		}
 		else
@@ -111,7 +166,7 @@ namespace mint
 			MINT_ASSERT(newSize < _size, "This must be guaranteed by if statement above!");
 			for (uint32 at = newSize; at < _size; ++at)
 			{
-				MemoryRaw::DestroyAt(_ptr[at]);
+				MemoryRaw::DestroyAt(Data()[at]);
 			}
 		}
 
@@ -126,7 +181,7 @@ namespace mint
 			Reserve(Capacity() * 2);
 		}
 
-		MemoryRaw::CopyConstructAt(_ptr[_size], entry);
+		MemoryRaw::CopyConstructAt(Data()[_size], entry);
 		++_size;
 	}
 
@@ -138,7 +193,7 @@ namespace mint
 			Reserve(Capacity() * 2);
 		}
 
-		MemoryRaw::MoveConstructAt(_ptr[_size], std::move(entry));
+		MemoryRaw::MoveConstructAt(Data()[_size], std::move(entry));
 		++_size;
 	}
 
@@ -150,7 +205,7 @@ namespace mint
 			return;
 		}
 
-		MemoryRaw::DestroyAt(_ptr[_size - 1]);
+		MemoryRaw::DestroyAt(Data()[_size - 1]);
 		--_size;
 	}
 
@@ -175,21 +230,21 @@ namespace mint
 		}
 		if constexpr (IsMovable<T>() == true)
 		{
-			MemoryRaw::MoveConstructAt(_ptr[_size], std::move(_ptr[_size - 1]));
+			MemoryRaw::MoveConstructAt(Data()[_size], std::move(Data()[_size - 1]));
 			for (uint32 iter = _size - 1; iter > at; --iter)
 			{
-				_ptr[iter] = std::move(_ptr[iter - 1]);
+				Data()[iter] = std::move(Data()[iter - 1]);
 			}
 		}
 		else // Though inefficient, make it work.
 		{
-			MemoryRaw::CopyConstructAt(_ptr[_size], _ptr[_size - 1]);
+			MemoryRaw::CopyConstructAt(Data()[_size], Data()[_size - 1]);
 			for (uint32 iter = _size; iter > at; --iter)
 			{
-				_ptr[iter] = _ptr[iter - 1];
+				Data()[iter] = Data()[iter - 1];
 			}
 		}
-		_ptr[at] = newEntry;
+		Data()[at] = newEntry;
 		++_size;
 		return true;
 	}
@@ -213,12 +268,12 @@ namespace mint
 		{
 			Reserve(Capacity() * 2);
 		}
-		MemoryRaw::MoveConstructAt(_ptr[_size], std::move(_ptr[_size - 1]));
+		MemoryRaw::MoveConstructAt(Data()[_size], std::move(Data()[_size - 1]));
 		for (uint32 iter = _size - 1; iter > at; --iter)
 		{
-			_ptr[iter] = std::move(_ptr[iter - 1]);
+			Data()[iter] = std::move(Data()[iter - 1]);
 		}
-		_ptr[at] = std::move(newEntry);
+		Data()[at] = std::move(newEntry);
 		++_size;
 		return true;
 	}
@@ -247,17 +302,17 @@ namespace mint
 		{
 			for (uint32 iter = at + 1; iter < _size; ++iter)
 			{
-				_ptr[iter - 1] = std::move(_ptr[iter]);
+				Data()[iter - 1] = std::move(Data()[iter]);
 			}
 		}
 		else // Though inefficient, make it work.
 		{
 			for (uint32 iter = at + 1; iter < _size; ++iter)
 			{
-				_ptr[iter - 1] = _ptr[iter];
+				Data()[iter - 1] = Data()[iter];
 			}
 		}
-		MemoryRaw::DestroyAt(_ptr[_size - 1]);
+		MemoryRaw::DestroyAt(Data()[_size - 1]);
 		--_size;
 	}
 
@@ -270,13 +325,38 @@ namespace mint
 #endif // defined(MINT_DEBUG)
 		for (uint32 at = 0; at < _size; ++at)
 		{
-			MemoryRaw::DestroyAt(_ptr[at]);
+			MemoryRaw::DestroyAt(Data()[at]);
 		}
 		_size = 0;
 		MINT_ASSERT(BasicVectorStorage<T>::IsEmpty() == true, "This must be guaranteed after Clear() is processed.");
 		MINT_ASSERT(oldCapacity == _capacity, "This must be guaranteed after Clear() is processed.");
 		MINT_ASSERT(wasUsingHeap == IsUsingHeap(), "This must be guaranteed after Clear() is processed.");
 	}
+
+	template<typename T, const uint32 kCapacity>
+	inline void InlineVectorStorage<T, kCapacity>::TakeFrom(InlineVectorStorage&& rhs) noexcept
+	{
+		MINT_ASSERT(_size == 0 && IsUsingHeap() == false, "This must be empty and using inline array.");
+
+		// Heap memory can be taken as is, but entries in the inline array must be moved one by one.
+		if (rhs.IsUsingHeap() == true)
+		{
+			_ptr = rhs._ptr;
+			_capacity = rhs._capacity;
+			_size = rhs._size;
+
+			rhs._ptr = nullptr;
+			rhs._capacity = kCapacity;
+			rhs._size = 0;
+			return;
+		}
+
+		for (uint32 at = 0; at < rhs._size; ++at)
+		{
+			PushBack(std::move(rhs.Data()[at]));
+		}
+		rhs.Clear();
+	}
 }
 
 
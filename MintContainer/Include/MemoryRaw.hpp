@@ -7,6 +7,10 @@
 
 #include <MintContainer/Include/MemoryRaw.h>
 
+#if defined MINT_USE_TLSF_ALLOCATOR
+#include <MintContainer/Include/TLSFAllocator.h>
+#endif
+
 #include <type_traits>
 
 
@@ -69,7 +73,11 @@ namespace mint
 		{
 			static_assert(IsConstructible<T>(), "T is not constructible type!!!");
 
+#if defined MINT_USE_TLSF_ALLOCATOR
+			return static_cast<T*>(TLSFAllocator::GetGlobalInstance().Allocate(sizeof(T) * size));
+#else
 			return MINT_MALLOC(T, size);
+#endif
 		}
 
 		template<typename T>
@@ -86,7 +94,12 @@ namespace mint
 				return;
 			}
 
+#if defined MINT_USE_TLSF_ALLOCATOR
+			TLSFAllocator::GetGlobalInstance().Deallocate(rawPointer);
+			rawPointer = nullptr;
+#else
 			MINT_FREE(rawPointer);
+#endif
 		}
 
 		template<typename T>
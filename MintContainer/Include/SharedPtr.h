@@ -7,6 +7,10 @@
 
 #include <MintCommon/Include/CommonDefinitions.h>
 
+#if defined MINT_USE_TLSF_ALLOCATOR
+#include <MintContainer/Include/TLSFAllocator.h>
+#endif
+
 
 namespace mint
 {
@@ -54,6 +58,11 @@ namespace mint
 			}
 			return *this;
 		}
+#if defined MINT_USE_TLSF_ALLOCATOR
+	public:
+		static void* operator new(const size_t byteSize) { return TLSFAllocator::GetGlobalInstance().Allocate(byteSize); }
+		static void operator delete(void* const pointer) { TLSFAllocator::GetGlobalInstance().Deallocate(pointer); }
+#endif
 	public:
 		MINT_INLINE void IncreaseStrongRefCount() { ++_strongRefCount; }
 		MINT_INLINE void IncreaseWeakRefCount() { ++_weakRefCount; }
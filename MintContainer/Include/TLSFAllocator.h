@@ -0,0 +1,140 @@
+﻿#pragma once
+
+
+#ifndef _MINT_CONTAINER_TLSF_ALLOCATOR_H_
+#define _MINT_CONTAINER_TLSF_ALLOCATOR_H_
+
+
+#include <MintCommon/Include/CommonDefinitions.h>
+
+
+namespace mint
+{
+	// Two-Level Segregated Fit 할당자
+	// - Allocate, Deallocate 모두 O(1) 이다. (2 단계 bitmap 으로 알맞은 크기의 free list 를 바로 찾는다)
+	// - 할당 단위와 정렬은 16 byte 이다.
+	// - 공간이 부족하면 page 를 새로 할당 받아 늘어나고, 완전히 비게 된 page 는 (마지막 하나를 제외하고) 반환한다.
+	// - MINT_USE_TLSF_ALLOCATOR 를 정의하면 MemoryRaw (Vector, String) 와 SharedRefCounter 가 GetGlobalInstance() 를 사용한다.
+	class TLSFAllocator final
+	{
+	public:
+		struct Statistics
+		{
+			uint32 _pageCount = 0;
+			uint32 _allocationCount = 0;
+			uint32 _freeBlockCount = 0;
+			uint64 _pageByteSize = 0;
+			uint64 _usedByteSize = 0;
+			uint64 _freeByteSize = 0;
+			uint64 _largestFreeBlockByteSize = 0;
+
+		public:
+			// 0 이면 free 공간이 한 덩어리, 1 에 가까울수록 잘게 쪼개져 있다.
+			float ComputeFragmentation() const noexcept { return (_freeByteSize == 0) ? 0.0f : 1.0f - static_cast<float>(_largestFreeBlockByteSize) / static_cast<float>(_freeByteSize); }
+		};
+
+	private:
+		struct BlockHeader
+		{
+			BlockHeader* _previousPhysicalBlock;
+			uint64 _sizeAndFlags;
+		};
+
+		// Free block 의 payload 에 저장된다.
+		struct FreeBlockLinks
+		{
+			BlockHeader* _nextFreeBlock;
+			BlockHeader* _previousFreeBlock;
+		};
+
+		struct PageHeader
+		{
+			PageHeader* _nextPage;
+			PageHeader* _previousPage;
+			uint64 _byteSize;
+			uint64 _padding;
+		};
+
+		static constexpr uint32 kAlignmentLog2 = 4;
+		static constexpr uint64 kAlignment = 1ULL << kAlignmentLog2;
+		static constexpr uint32 kSLIndexCountLog2 = 4;
+		static constexpr uint32 kSLIndexCount = 1 << kSLIndexCountLog2;
+		static constexpr uint32 kFLIndexShift = kSLIndexCountLog2 + kAlignmentLog2;
+		static constexpr uint32 kFLIndexMax = 39;
+		static constexpr uint32 kFLIndexCount = kFLIndexMax - kFLIndexShift + 1;
+		static constexpr uint64 kSmallBlockByteSize = 1ULL << kFLIndexShift;
+		static constexpr uint64 kMinBlockByteSize = sizeof(FreeBlockLinks);
+		static constexpr uint64 kMaxBlockByteSize = 1ULL << kFLIndexMax;
+		static constexpr uint64 kBlockHeaderByteSize = sizeof(BlockHeader);
+		static constexpr uint64 kPageHeaderByteSize = sizeof(PageHeader);
+		static constexpr uint64 kFreeFlag = 1;
+		static constexpr uint64 kSizeMask = ~(kAlignment - 1);
+
+		static_assert(kBlockHeaderByteSize == kAlignment, "BlockHeader must keep payloads aligned!!!");
+		static_assert(kPageHeaderByteSize % kAlignment == 0, "PageHeader must keep blocks aligned!!!");
+
+	public:
+		static constexpr uint64 kDefaultPageByteSize = 1ULL << 20;
+
+	public:
+		TLSFAllocator();
+		TLSFAllocator(const uint64 pageByteSize, const bool isThreadSafe);
+		TLSFAllocator(const TLSFAllocator& rhs) = delete;
+		TLSFAllocator(TLSFAllocator&& rhs) = delete;
+		~TLSFAllocator();
+
+	public:
+		TLSFAllocator& operator=(const TLSFAllocator& rhs) = delete;
+		TLSFAllocator& operator=(TLSFAllocator&& rhs) = delete;
+
+	public:
+		// 프로그램 종료 시까지 해제되지 않는다. (다른 static 객체의 소멸자에서 Deallocate 해도 안전하도록)
+		static TLSFAllocator& GetGlobalInstance() noexcept;
+
+	public:
+		void* Allocate(const uint64 byteSize) noexcept;
+		void Deallocate(void* const pointer) noexcept;
+
+	public:
+		uint64 GetAllocationByteSize(const void* const pointer) const noexcept;
+		// free list 들을 순회하므로 free block 수에 비례하는 비용이 든다. (진단 용도)
+		Statistics ComputeStatistics() const noexcept;
+
+	private:
+		bool AddPage(const uint64 minBlockByteSize) noexcept;
+		void ReleasePage(BlockHeader* const block) noexcept;
+		BlockHeader* FindFreeBlock(const uint64 blockByteSize, uint32& outFLIndex, uint32& outSLIndex) const noexcept;
+		void InsertFreeBlock(BlockHeader* const block) noexcept;
+		void RemoveFreeBlock(BlockHeader* const block, const uint32 flIndex, const uint32 slIndex) noexcept;
+		void RemoveFreeBlock(BlockHeader* const block) noexcept;
+		void Lock() const noexcept;
+		void Unlock() const noexcept;
+
+	private:
+		static uint64 ComputeBlockByteSize(const uint64 byteSize) noexcept;
+		static void MapInsert(const uint64 blockByteSize, uint32& outFLIndex, uint32& outSLIndex) noexcept;
+		static void MapSearch(const uint64 blockByteSize, uint32& outFLIndex, uint32& outSLIndex) noexcept;
+		static uint64 GetBlockByteSize(const BlockHeader* const block) noexcept;
+		static bool IsFreeBlock(const BlockHeader* const block) noexcept;
+		static BlockHeader* GetNextPhysicalBlock(const BlockHeader* const block) noexcept;
+		static FreeBlockLinks& AccessFreeBlockLinks(BlockHeader* const block) noexcept;
+		static void* GetPayload(BlockHeader* const block) noexcept;
+		static BlockHeader* GetBlockHeader(const void* const payload) noexcept;
+
+	private:
+		uint64 _pageByteSize;
+		bool _isThreadSafe;
+		mutable std::mutex _mutex;
+		PageHeader* _pageHead;
+		uint32 _pageCount;
+		uint32 _allocationCount;
+		uint64 _totalPageByteSize;
+		uint64 _usedByteSize;
+		uint32 _flBitmap;
+		uint32 _slBitmaps[kFLIndexCount];
+		BlockHeader* _freeBlocks[kFLIndexCount][kSLIndexCount];
+	};
+}
+
+
+#endif // !_MINT_CONTAINER_TLSF_ALLOCATOR_H_
@@ -20,11 +20,13 @@ namespace mint
 		bool Test_StackHolder();
 		bool Test_Vector();
 		bool Test_HashMap();
+		bool Test_FlatMap();
 		bool Test_SharedPtr();
 		bool Test_StringTypes();
 		bool Test_StringUtil();
 		bool Test_Queue();
 		bool Test_Tree();
+		bool Test_TLSFAllocator();
 	};
 }
 
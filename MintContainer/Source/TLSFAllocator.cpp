@@ -0,0 +1,405 @@
+#include <MintContainer/Include/TLSFAllocator.h>
+
+#include <intrin.h>
+
+
+namespace mint
+{
+	TLSFAllocator::TLSFAllocator()
+		: TLSFAllocator(kDefaultPageByteSize, false)
+	{
+		__noop;
+	}
+
+	TLSFAllocator::TLSFAllocator(const uint64 pageByteSize, const bool isThreadSafe)
+		: _pageByteSize{ pageByteSize }
+		, _isThreadSafe{ isThreadSafe }
+		, _pageHead{ nullptr }
+		, _pageCount{ 0 }
+		, _allocationCount{ 0 }
+		, _totalPageByteSize{ 0 }
+		, _usedByteSize{ 0 }
+		, _flBitmap{ 0 }
+		, _slBitmaps{}
+		, _freeBlocks{}
+	{
+		__noop;
+	}
+
+	TLSFAllocator::~TLSFAllocator()
+	{
+		MINT_ASSERT(_allocationCount == 0, "해제되지 않은 메모리가 %d 개 있습니다!", _allocationCount);
+
+		while (_pageHead != nullptr)
+		{
+			PageHeader* const nextPage = _pageHead->_nextPage;
+			::free(_pageHead);
+			_pageHead = nextPage;
+		}
+	}
+
+	TLSFAllocator& TLSFAllocator::GetGlobalInstance() noexcept
+	{
+		static TLSFAllocator* const globalInstance = MINT_NEW(TLSFAllocator, kDefaultPageByteSize, true);
+		return *globalInstance;
+	}
+
+	void* TLSFAllocator::Allocate(const uint64 byteSize) noexcept
+	{
+		const uint64 blockByteSize = ComputeBlockByteSize(byteSize);
+		if (blockByteSize > kMaxBlockByteSize)
+		{
+			return nullptr;
+		}
+
+		Lock();
+
+		uint32 flIndex = 0;
+		uint32 slIndex = 0;
+		BlockHeader* block = FindFreeBlock(blockByteSize, flIndex, slIndex);
+		if (block == nullptr)
+		{
+			if (AddPage(blockByteSize) == false)
+			{
+				Unlock();
+				return nullptr;
+			}
+
+			block = FindFreeBlock(blockByteSize, flIndex, slIndex);
+			MINT_ASSERT(block != nullptr, "새 page 에서 block 을 찾지 못했습니다!");
+		}
+
+		RemoveFreeBlock(block, flIndex, slIndex);
+
+		// 남는 공간이 충분하면 잘라서 다시 free list 에 넣는다.
+		const uint64 remainingByteSize = GetBlockByteSize(block) - blockByteSize;
+		if (remainingByteSize >= kBlockHeaderByteSize + kMinBlockByteSize)
+		{
+			block->_sizeAndFlags = blockByteSize;
+
+			BlockHeader* const remainingBlock = GetNextPhysicalBlock(block);
+			remainingBlock->_previousPhysicalBlock = block;
+			remainingBlock->_sizeAndFlags = (remainingByteSize - kBlockHeaderByteSize) | kFreeFlag;
+			GetNextPhysicalBlock(remainingBlock)->_previousPhysicalBlock = remainingBlock;
+			InsertFreeBlock(remainingBlock);
+		}
+		else
+		{
+			block->_sizeAndFlags &= ~kFreeFlag;
+		}
+
+		++_allocationCount;
+		_usedByteSize += GetBlockByteSize(block);
+
+		Unlock();
+		return GetPayload(block);
+	}
+
+	void TLSFAllocator::Deallocate(void* const pointer) noexcept
+	{
+		if (pointer == nullptr)
+		{
+			return;
+		}
+
+		Lock();
+
+		BlockHeader* block = GetBlockHeader(pointer);
+		MINT_ASSERT(IsFreeBlock(block) == false, "이미 해제된 메모리입니다!");
+
+		--_allocationCount;
+		_usedByteSize -= GetBlockByteSize(block);
+		block->_sizeAndFlags |= kFreeFlag;
+
+		// 물리적으로 인접한 free block 들과 합친다.
+		BlockHeader* const previousBlock = block->_previousPhysicalBlock;
+		if (previousBlock != nullptr && IsFreeBlock(previousBlock) == true)
+		{
+			RemoveFreeBlock(previousBlock);
+			previousBlock->_sizeAndFlags += kBlockHeaderByteSize + GetBlockByteSize(block);
+			block = previousBlock;
+			GetNextPhysicalBlock(block)->_previousPhysicalBlock = block;
+		}
+
+		BlockHeader* const nextBlock = GetNextPhysicalBlock(block);
+		if (IsFreeBlock(nextBlock) == true)
+		{
+			RemoveFreeBlock(nextBlock);
+			block->_sizeAndFlags += kBlockHeaderByteSize + GetBlockByteSize(nextBlock);
+			GetNextPhysicalBlock(block)->_previousPhysicalBlock = block;
+		}
+
+		// page 전체가 비었다면 (마지막 page 가 아닌 한) 반환한다.
+		const bool isWholePage = (block->_previousPhysicalBlock == nullptr && GetBlockByteSize(GetNextPhysicalBlock(block)) == 0);
+		if (isWholePage == true && _pageCount > 1)
+		{
+			ReleasePage(block);
+		}
+		else
+		{
+			InsertFreeBlock(block);
+		}
+
+		Unlock();
+	}
+
+	uint64 TLSFAllocator::GetAllocationByteSize(const void* const pointer) const noexcept
+	{
+		if (pointer == nullptr)
+		{
+			return 0;
+		}
+		return GetBlockByteSize(GetBlockHeader(pointer));
+	}
+
+	TLSFAllocator::Statistics TLSFAllocator::ComputeStatistics() const noexcept
+	{
+		Lock();
+
+		Statistics statistics;
+		statistics._pageCount = _pageCount;
+		statistics._allocationCount = _allocationCount;
+		statistics._pageByteSize = _totalPageByteSize;
+		statistics._usedByteSize = _usedByteSize;
+		for (uint32 flIndex = 0; flIndex < kFLIndexCount; ++flIndex)
+		{
+			for (uint32 slIndex = 0; slIndex < kSLIndexCount; ++slIndex)
+			{
+				for (BlockHeader* block = _freeBlocks[flIndex][slIndex]; block != nullptr; block = AccessFreeBlockLinks(block)._nextFreeBlock)
+				{
+					const uint64 blockByteSize = GetBlockByteSize(block);
+					++statistics._freeBlockCount;
+					statistics._freeByteSize += blockByteSize;
+					statistics._largestFreeBlockByteSize = Max(statistics._largestFreeBlockByteSize, blockByteSize);
+				}
+			}
+		}
+
+		Unlock();
+		return statistics;
+	}
+
+	bool TLSFAllocator::AddPage(const uint64 minBlockByteSize) noexcept
+	{
+		// FindFreeBlock 은 크기를 다음 SL 경계로 올려서 찾으므로 그만큼 여유를 둔다.
+		const uint64 searchableBlockByteSize = minBlockByteSize + (minBlockByteSize >> kSLIndexCountLog2) + kAlignment;
+		const uint64 pageOverheadByteSize = kPageHeaderByteSize + kBlockHeaderByteSize * 2;
+		const uint64 pageByteSize = Max(_pageByteSize, searchableBlockByteSize + pageOverheadByteSize) & kSizeMask;
+		PageHeader* const page = static_cast<PageHeader*>(::malloc(pageByteSize));
+		if (page == nullptr)
+		{
+			return false;
+		}
+
+		page->_nextPage = _pageHead;
+		page->_previousPage = nullptr;
+		page->_byteSize = pageByteSize;
+		if (_pageHead != nullptr)
+		{
+			_pageHead->_previousPage = page;
+		}
+		_pageHead = page;
+		++_pageCount;
+		_totalPageByteSize += pageByteSize;
+
+		// page 끝에는 크기 0 의 사용 중인 sentinel block 을 두어 병합이 page 를 넘어가지 않게 한다.
+		BlockHeader* const block = reinterpret_cast<BlockHeader*>(reinterpret_cast<byte*>(page) + kPageHeaderByteSize);
+		block->_previousPhysicalBlock = nullptr;
+		block->_sizeAndFlags = (pageByteSize - pageOverheadByteSize) | kFreeFlag;
+
+		BlockHeader* const sentinelBlock = GetNextPhysicalBlock(block);
+		sentinelBlock->_previousPhysicalBlock = block;
+		sentinelBlock->_sizeAndFlags = 0;
+
+		InsertFreeBlock(block);
+		return true;
+	}
+
+	void TLSFAllocator::ReleasePage(BlockHeader* const block) noexcept
+	{
+		PageHeader* const page = reinterpret_cast<PageHeader*>(reinterpret_cast<byte*>(block) - kPageHeaderByteSize);
+		if (page->_previousPage != nullptr)
+		{
+			page->_previousPage->_nextPage = page->_nextPage;
+		}
+		else
+		{
+			_pageHead = page->_nextPage;
+		}
+		if (page->_nextPage != nullptr)
+		{
+			page->_nextPage->_previousPage = page->_previousPage;
+		}
+
+		--_pageCount;
+		_totalPageByteSize -= page->_byteSize;
+		::free(page);
+	}
+
+	TLSFAllocator::BlockHeader* TLSFAllocator::FindFreeBlock(const uint64 blockByteSize, uint32& outFLIndex, uint32& outSLIndex) const noexcept
+	{
+		uint32 flIndex = 0;
+		uint32 slIndex = 0;
+		MapSearch(blockByteSize, flIndex, slIndex);
+		if (flIndex >= kFLIndexCount)
+		{
+			return nullptr;
+		}
+
+		uint32 slBitmap = _slBitmaps[flIndex] & (~0U << slIndex);
+		if (slBitmap == 0)
+		{
+			const uint32 flBitmap = (flIndex + 1 < kFLIndexCount) ? (_flBitmap & (~0U << (flIndex + 1))) : 0;
+			if (flBitmap == 0)
+			{
+				return nullptr;
+			}
+
+			unsigned long bitIndex = 0;
+			_BitScanForward(&bitIndex, flBitmap);
+			flIndex = bitIndex;
+			slBitmap = _slBitmaps[flIndex];
+		}
+
+		unsigned long bitIndex = 0;
+		_BitScanForward(&bitIndex, slBitmap);
+		slIndex = bitIndex;
+
+		outFLIndex = flIndex;
+		outSLIndex = slIndex;
+		return _freeBlocks[flIndex][slIndex];
+	}
+
+	void TLSFAllocator::InsertFreeBlock(BlockHeader* const block) noexcept
+	{
+		uint32 flIndex = 0;
+		uint32 slIndex = 0;
+		MapInsert(GetBlockByteSize(block), flIndex, slIndex);
+
+		BlockHeader* const headBlock = _freeBlocks[flIndex][slIndex];
+		FreeBlockLinks& links = AccessFreeBlockLinks(block);
+		links._nextFreeBlock = headBlock;
+		links._previousFreeBlock = nullptr;
+		if (headBlock != nullptr)
+		{
+			AccessFreeBlockLinks(headBlock)._previousFreeBlock = block;
+		}
+		_freeBlocks[flIndex][slIndex] = block;
+
+		_flBitmap |= (1U << flIndex);
+		_slBitmaps[flIndex] |= (1U << slIndex);
+	}
+
+	void TLSFAllocator::RemoveFreeBlock(BlockHeader* const block, const uint32 flIndex, const uint32 slIndex) noexcept
+	{
+		FreeBlockLinks& links = AccessFreeBlockLinks(block);
+		if (links._previousFreeBlock != nullptr)
+		{
+			AccessFreeBlockLinks(links._previousFreeBlock)._nextFreeBlock = links._nextFreeBlock;
+		}
+		else
+		{
+			_freeBlocks[flIndex][slIndex] = links._nextFreeBlock;
+		}
+		if (links._nextFreeBlock != nullptr)
+		{
+			AccessFreeBlockLinks(links._nextFreeBlock)._previousFreeBlock = links._previousFreeBlock;
+		}
+
+		if (_freeBlocks[flIndex][slIndex] == nullptr)
+		{
+			_slBitmaps[flIndex] &= ~(1U << slIndex);
+			if (_slBitmaps[flIndex] == 0)
+			{
+				_flBitmap &= ~(1U << flIndex);
+			}
+		}
+	}
+
+	void TLSFAllocator::RemoveFreeBlock(BlockHeader* const block) noexcept
+	{
+		uint32 flIndex = 0;
+		uint32 slIndex = 0;
+		MapInsert(GetBlockByteSize(block), flIndex, slIndex);
+		RemoveFreeBlock(block, flIndex, slIndex);
+	}
+
+	void TLSFAllocator::Lock() const noexcept
+	{
+		if (_isThreadSafe == true)
+		{
+			_mutex.lock();
+		}
+	}
+
+	void TLSFAllocator::Unlock() const noexcept
+	{
+		if (_isThreadSafe == true)
+		{
+			_mutex.unlock();
+		}
+	}
+
+	uint64 TLSFAllocator::ComputeBlockByteSize(const uint64 byteSize) noexcept
+	{
+		return Max((byteSize + kAlignment - 1) & kSizeMask, kMinBlockByteSize);
+	}
+
+	void TLSFAllocator::MapInsert(const uint64 blockByteSize, uint32& outFLIndex, uint32& outSLIndex) noexcept
+	{
+		if (blockByteSize < kSmallBlockByteSize)
+		{
+			outFLIndex = 0;
+			outSLIndex = static_cast<uint32>(blockByteSize / (kSmallBlockByteSize / kSLIndexCount));
+			return;
+		}
+
+		unsigned long mostSignificantBit = 0;
+		_BitScanReverse64(&mostSignificantBit, blockByteSize);
+		outSLIndex = static_cast<uint32>(blockByteSize >> (mostSignificantBit - kSLIndexCountLog2)) ^ kSLIndexCount;
+		outFLIndex = mostSignificantBit - (kFLIndexShift - 1);
+	}
+
+	void TLSFAllocator::MapSearch(const uint64 blockByteSize, uint32& outFLIndex, uint32& outSLIndex) noexcept
+	{
+		// 같은 SL 구간 안의 어떤 block 이라도 요청을 만족하도록 다음 SL 경계로 올려서 찾는다.
+		uint64 roundedByteSize = blockByteSize;
+		if (blockByteSize >= kSmallBlockByteSize)
+		{
+			unsigned long mostSignificantBit = 0;
+			_BitScanReverse64(&mostSignificantBit, blockByteSize);
+			roundedByteSize += (1ULL << (mostSignificantBit - kSLIndexCountLog2)) - 1;
+		}
+		MapInsert(roundedByteSize, outFLIndex, outSLIndex);
+	}
+
+	uint64 TLSFAllocator::GetBlockByteSize(const BlockHeader* const block) noexcept
+	{
+		return block->_sizeAndFlags & kSizeMask;
+	}
+
+	bool TLSFAllocator::IsFreeBlock(const BlockHeader* const block) noexcept
+	{
+		return (block->_sizeAndFlags & kFreeFlag) != 0;
+	}
+
+	TLSFAllocator::BlockHeader* TLSFAllocator::GetNextPhysicalBlock(const BlockHeader* const block) noexcept
+	{
+		return reinterpret_cast<BlockHeader*>(const_cast<byte*>(reinterpret_cast<const byte*>(block)) + kBlockHeaderByteSize + GetBlockByteSize(block));
+	}
+
+	TLSFAllocator::FreeBlockLinks& TLSFAllocator::AccessFreeBlockLinks(BlockHeader* const block) noexcept
+	{
+		return *reinterpret_cast<FreeBlockLinks*>(GetPayload(block));
+	}
+
+	void* TLSFAllocator::GetPayload(BlockHeader* const block) noexcept
+	{
+		return reinterpret_cast<byte*>(block) + kBlockHeaderByteSize;
+	}
+
+	TLSFAllocator::BlockHeader* TLSFAllocator::GetBlockHeader(const void* const payload) noexcept
+	{
+		return reinterpret_cast<BlockHeader*>(const_cast<byte*>(static_cast<const byte*>(payload)) - kBlockHeaderByteSize);
+	}
+}
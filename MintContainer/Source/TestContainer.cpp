@@ -148,11 +148,13 @@ namespace mint
 			MINT_ASSURE(Test_StackHolder());
 			MINT_ASSURE(Test_Vector());
 			MINT_ASSURE(Test_HashMap());
+			MINT_ASSURE(Test_FlatMap());
 			MINT_ASSURE(Test_SharedPtr());
 			MINT_ASSURE(Test_StringTypes());
 			MINT_ASSURE(Test_StringUtil());
 			MINT_ASSURE(Test_Queue());
 			MINT_ASSURE(Test_Tree());
+			MINT_ASSURE(Test_TLSFAllocator());
 			return true;
 		}
 
@@ -209,6 +211,43 @@ namespace mint
 			const bool valueAt5 = a.get(5);
 #endif
 
+			{
+				BitVector b;
+				b.ResizeBitCount(200);
+				MINT_ASSURE(b.PopCount() == 0);
+				MINT_ASSURE(b.FindFirstSet() == kUint32Max);
+				b.SetRange(60, 130, true);
+				MINT_ASSURE(b.PopCount() == 70);
+				MINT_ASSURE(b.FindFirstSet() == 60);
+				MINT_ASSURE(b.FindNextSet(129) == kUint32Max);
+				b.SetRange(64, 128, false);
+				MINT_ASSURE(b.FindNextSet(63) == 128);
+				MINT_ASSURE(b.GetByte(7) == 0x0F);
+
+				BitVector c;
+				c.ResizeBitCount(150);
+				c.Set(61, true);
+				c.Set(128, true);
+				c.Set(140, true);
+				BitVector d;
+				d.ResizeBitCount(200);
+				d.Or(b);
+				d.And(c);
+				MINT_ASSURE(d.PopCount() == 2);
+				MINT_ASSURE(d.FindFirstSet() == 61);
+				MINT_ASSURE(d.FindNextSet(61) == 128);
+				d.Xor(c);
+				MINT_ASSURE(d.PopCount() == 1);
+				MINT_ASSURE(d.FindFirstSet() == 140);
+				d.AndNot(c);
+				MINT_ASSURE(d.PopCount() == 0);
+
+				d.Fill(true);
+				d.ResizeBitCount(100);
+				d.ResizeBitCount(300);
+				MINT_ASSURE(d.PopCount() == 100);
+			}
+
 #if defined MINT_TEST_PERFORMANCE
 			{
 #if defined MINT_DEBUG
@@ -278,7 +317,7 @@ namespace mint
 					Profiler::ScopedCPUProfiler profiler{ "3) bit vector raw" };
 					for (uint32 i = 0; i < kCount; ++i)
 					{
-						bitVector.set(i, sourceData[i]);
+						bitVector.Set(i, sourceData[i]);
 					}
 				}
 
@@ -286,7 +325,7 @@ namespace mint
 					Profiler::ScopedCPUProfiler profiler{ "3) bit vector raw copy" };
 					for (uint32 i = 0; i < kCount; ++i)
 					{
-						bitVectorCopy.set(i, bitVector.get(i));
+						bitVectorCopy.Set(i, bitVector.Get(i));
 					}
 				}
 
@@ -298,7 +337,7 @@ namespace mint
 						const uint32 sourceAt = byteAt * kBitsPerByte;
 						for (uint32 bitOffset = 0; bitOffset < kBitsPerByte; ++bitOffset)
 						{
-							bitVector.set(byteAt, bitOffset, sourceData[sourceAt + bitOffset]);
+							bitVector.Set(byteAt, bitOffset, sourceData[sourceAt + bitOffset]);
 						}
 					}
 				}
@@ -311,7 +350,7 @@ namespace mint
 						const uint32 sourceAt = byteAt * kBitsPerByte;
 						for (uint32 bitOffset = 0; bitOffset < kBitsPerByte; ++bitOffset)
 						{
-							bitVectorCopy.set(byteAt, bitOffset, bitVector.get(sourceAt + bitOffset));
+							bitVectorCopy.Set(byteAt, bitOffset, bitVector.Get(sourceAt + bitOffset));
 						}
 					}
 				}
@@ -356,6 +395,43 @@ namespace mint
 					}
 				}
 
+				{
+					Profiler::ScopedCPUProfiler profiler{ "4) bit vector copy per word" };
+					const uint32 kWordCount = BitVector::ComputeWordCount(kCount);
+					for (uint32 wordAt = 0; wordAt < kWordCount; ++wordAt)
+					{
+						bitVectorCopy.SetWord(wordAt, bitVector.GetWord(wordAt));
+					}
+				}
+
+				{
+					Profiler::ScopedCPUProfiler profiler{ "4) bit vector Xor" };
+					bitVectorCopy.Xor(bitVector);
+				}
+
+				{
+					Profiler::ScopedCPUProfiler profiler{ "4) bit vector PopCount" };
+					const uint32 popCount = bitVector.PopCount();
+				}
+
+				{
+					Profiler::ScopedCPUProfiler profiler{ "4) bit vector iterate set bits per bit" };
+					uint32 setBitCount = 0;
+					for (uint32 i = 0; i < kCount; ++i)
+					{
+						setBitCount += (bitVector.Get(i) ? 1 : 0);
+					}
+				}
+
+				{
+					Profiler::ScopedCPUProfiler profiler{ "4) bit vector iterate set bits FindNextSet" };
+					uint32 setBitCount = 0;
+					for (uint32 bitAt = bitVector.FindFirstSet(); bitAt != kUint32Max; bitAt = bitVector.FindNextSet(bitAt))
+					{
+						++setBitCount;
+					}
+				}
+
 				std::vector<Profiler::ScopedCPUProfiler::Log> logArray = Profiler::ScopedCPUProfiler::GetEntireLogData();
 				const bool IsEmpty = logArray.empty();
 			}
@@ -557,7 +633,7 @@ namespace mint
 
 		bool Test_Vector()
 		{
-			// TODO: InlineVector, StackVector 의 move 에 대해 처리 필요!!!
+			// TODO: StackVector 의 move 에 대해 처리 필요!!!
 
 			Vector<int32> vector_move0(4);
 			Vector<int32> vector_move1(20);
@@ -565,6 +641,47 @@ namespace mint
 			// Move semantic 점검!
 			std::swap(vector_move0, vector_move1);
 
+			// InlineVector 는 inline 배열을 쓸 때와 heap 을 쓸 때 모두 복사, 이동 뒤에 자기 메모리를 가리켜야 한다.
+			for (uint32 size = 2; size <= 6; size += 4)
+			{
+				InlineVector<Vector<int32>, 4> inlineVector0;
+				for (uint32 i = 0; i < size; ++i)
+				{
+					inlineVector0.PushBack(Vector<int32>{ static_cast<int32>(i) });
+				}
+				InlineVector<Vector<int32>, 4> inlineVector1 = inlineVector0;
+				MINT_ASSURE(inlineVector1.Size() == size && inlineVector1.Data() != inlineVector0.Data());
+				InlineVector<Vector<int32>, 4> inlineVector2 = std::move(inlineVector0);
+				MINT_ASSURE(inlineVector0.IsEmpty() == true && inlineVector2.Size() == size);
+				inlineVector0 = inlineVector2;
+				std::swap(inlineVector1, inlineVector2);
+				for (uint32 i = 0; i < size; ++i)
+				{
+					MINT_ASSURE(inlineVector0[i][0] == static_cast<int32>(i) && inlineVector1[i][0] == static_cast<int32>(i) && inlineVector2[i][0] == static_cast<int32>(i));
+				}
+			}
+
+			// Vector 가 커질 때 원소를 memmove 로 옮기므로, inline 배열을 쓰는 InlineVector 도 옮겨진 뒤에 그대로 쓸 수 있어야 한다.
+			{
+				Vector<InlineVector<uint32, 2>> inlineVectors;
+				for (uint32 i = 0; i < 64; ++i)
+				{
+					inlineVectors.PushBack(InlineVector<uint32, 2>{});
+					for (uint32 j = 0; j < i % 4; ++j)
+					{
+						inlineVectors[i].PushBack(i * 4 + j);
+					}
+				}
+				for (uint32 i = 0; i < 64; ++i)
+				{
+					MINT_ASSURE(inlineVectors[i].Size() == i % 4);
+					for (uint32 j = 0; j < i % 4; ++j)
+					{
+						MINT_ASSURE(inlineVectors[i][j] == i * 4 + j);
+					}
+				}
+			}
+
 			Test_Vector_Common<VectorWrapper>();
 			Test_Vector_DynamicAllocation<VectorWrapper>();
 			Test_Vector_InsertErase<VectorWrapper>();
@@ -653,6 +770,161 @@ namespace mint
 			hashMap1.Insert(u8"ABC", 1);
 			MINT_ASSURE(hashMap1.Find(u8"ABC").IsValid());
 
+			// 첫 byte 가 0 인 정수 key 와 Clear() 뒤의 재사용
+			HashMap<uint64, Vector<uint32>> hashMap2;
+			for (uint32 round = 0; round < 2; ++round)
+			{
+				hashMap2.Clear();
+				for (uint32 i = 0; i < 2000; ++i)
+				{
+					const uint64 key = static_cast<uint64>(i % 1000) << 8;
+					KeyValuePair found = hashMap2.Find(key);
+					if (found.IsValid() == true)
+					{
+						found._value->PushBack(i);
+					}
+					else
+					{
+						hashMap2.Insert(key, Vector<uint32>{ i });
+					}
+				}
+				MINT_ASSURE(hashMap2.Size() == 1000);
+				MINT_ASSURE(hashMap2.At(static_cast<uint64>(999) << 8).Size() == 2);
+			}
+
+			// 자리가 모자라서 다른 원소를 옮겨도 (displace) 잃어버리는 원소가 없어야 한다.
+			HashMap<uint64, uint32> hashMap3;
+			uint32 seed = 7;
+			Vector<uint64> keys;
+			for (uint32 i = 0; i < 4000; ++i)
+			{
+				seed = seed * 1664525 + 1013904223;
+				const uint64 key = (static_cast<uint64>(seed % 200) << 32) | ((seed >> 16) % 200);
+				if (hashMap3.Contains(key) == false)
+				{
+					hashMap3.Insert(key, i);
+					keys.PushBack(key);
+				}
+			}
+			MINT_ASSURE(hashMap3.Size() == keys.Size());
+			for (const uint64 key : keys)
+			{
+				MINT_ASSURE(hashMap3.Contains(key) == true);
+			}
+
+			return true;
+		}
+
+		bool Test_FlatMap()
+		{
+			{
+				FlatMap<uint64, uint32> flatMap0;
+				flatMap0.Insert(41, 5);
+				flatMap0.Insert(1, 0);
+				flatMap0.Insert(21, 3);
+				flatMap0.Insert(5, 1);
+				flatMap0.Insert(33, 4);
+				flatMap0.Insert(11, 2);
+				flatMap0.Insert(11, 100);
+				MINT_ASSURE(flatMap0.Size() == 6);
+				for (uint32 i = 0; i < flatMap0.Size(); ++i)
+				{
+					MINT_ASSURE(flatMap0.GetValues()[i] == i);
+				}
+				MINT_ASSURE(flatMap0.At(11) == 2);
+				MINT_ASSURE(flatMap0.Find(12).IsValid() == false);
+
+				flatMap0.Erase(21);
+				MINT_ASSURE(flatMap0.Contains(21) == false);
+				MINT_ASSURE(flatMap0.Size() == 5);
+
+				FlatMap<uint64, uint32> flatMap1;
+				flatMap1.Assign(Vector<uint64>{ 50, 11, 3, 50 }, Vector<uint32>{ 7, 8, 9, 10 });
+				MINT_ASSURE(flatMap1.Size() == 3);
+				MINT_ASSURE(flatMap1.At(50) == 7);
+
+				flatMap0.Merge(flatMap1);
+				MINT_ASSURE(flatMap0.Size() == 7);
+				MINT_ASSURE(flatMap0.At(11) == 2);
+				MINT_ASSURE(flatMap0.At(3) == 9);
+				MINT_ASSURE(flatMap0.GetKeys().Front() == 1 && flatMap0.GetKeys().Back() == 50);
+			}
+
+			{
+				FlatSet<uint32> flatSet0;
+				flatSet0.Assign(Vector<uint32>{ 3, 1, 2, 1 });
+				MINT_ASSURE(flatSet0.Size() == 3);
+				MINT_ASSURE(flatSet0.Contains(2) == true);
+				flatSet0.Insert(0);
+				MINT_ASSURE(flatSet0.GetKeys().Front() == 0);
+				flatSet0.Erase(2);
+				MINT_ASSURE(flatSet0.Contains(2) == false);
+
+				FlatSet<uint32> flatSet1;
+				flatSet1.Assign(Vector<uint32>{ 5, 3, 4 });
+				flatSet0.Merge(flatSet1);
+				MINT_ASSURE(flatSet0.Size() == 6);
+			}
+
+			{
+				CharTable<uint32> charTable0;
+				charTable0.Insert('(', 0);
+				charTable0.Insert(')', 1);
+				charTable0.Insert(static_cast<char>(0xFF), 2);
+				MINT_ASSURE(charTable0.Size() == 3);
+				MINT_ASSURE(*charTable0.Find(')') == 1);
+				MINT_ASSURE(*charTable0.Find(static_cast<char>(0xFF)) == 2);
+				MINT_ASSURE(charTable0.Find('[') == nullptr);
+				charTable0.Erase('(');
+				MINT_ASSURE(charTable0.Contains('(') == false);
+				MINT_ASSURE(charTable0.Size() == 2);
+			}
+
+#if defined MINT_TEST_PERFORMANCE
+			{
+				static constexpr uint32 kKeyCount = 32;
+				static constexpr uint32 kLookUpCount = 10'000'000;
+				HashMap<uint64, uint32> hashMap;
+				FlatMap<uint64, uint32> flatMap;
+				CharTable<uint32> charTable;
+				for (uint32 i = 0; i < kKeyCount; ++i)
+				{
+					hashMap.Insert(i * 3, i);
+					flatMap.Insert(i * 3, i);
+					charTable.Insert(static_cast<char>(i * 3), i);
+				}
+
+				{
+					Profiler::ScopedCPUProfiler profiler{ "HashMap Find" };
+					uint32 foundCount = 0;
+					for (uint32 i = 0; i < kLookUpCount; ++i)
+					{
+						foundCount += (hashMap.Find(i % (kKeyCount * 3)).IsValid() == true) ? 1 : 0;
+					}
+				}
+
+				{
+					Profiler::ScopedCPUProfiler profiler{ "FlatMap Find" };
+					uint32 foundCount = 0;
+					for (uint32 i = 0; i < kLookUpCount; ++i)
+					{
+						foundCount += (flatMap.Find(i % (kKeyCount * 3)).IsValid() == true) ? 1 : 0;
+					}
+				}
+
+				{
+					Profiler::ScopedCPUProfiler profiler{ "CharTable Find" };
+					uint32 foundCount = 0;
+					for (uint32 i = 0; i < kLookUpCount; ++i)
+					{
+						foundCount += (charTable.Contains(static_cast<char>(i % (kKeyCount * 3))) == true) ? 1 : 0;
+					}
+				}
+
+				std::vector<Profiler::ScopedCPUProfiler::Log> logArray = Profiler::ScopedCPUProfiler::GetEntireLogData();
+				const bool IsEmpty = logArray.empty();
+			}
+#endif
 			return true;
 		}
 
@@ -1166,6 +1438,132 @@ namespace mint
 
 #if defined MINT_TEST_FAILURES
 			stringTree.MoveToParent(rootNode, d);
+#endif
+			return true;
+		}
+
+		bool Test_TLSFAllocator()
+		{
+			{
+				TLSFAllocator allocator{ 64 * 1024, false };
+				void* const a = allocator.Allocate(1);
+				void* const b = allocator.Allocate(100);
+				void* const c = allocator.Allocate(1000);
+				MINT_ASSURE(a != nullptr && b != nullptr && c != nullptr);
+				MINT_ASSURE((reinterpret_cast<uint64>(a) & 15) == 0);
+				MINT_ASSURE((reinterpret_cast<uint64>(b) & 15) == 0);
+				MINT_ASSURE((reinterpret_cast<uint64>(c) & 15) == 0);
+				MINT_ASSURE(allocator.GetAllocationByteSize(a) == 16);
+				MINT_ASSURE(allocator.GetAllocationByteSize(b) == 112);
+				MINT_ASSURE(allocator.GetAllocationByteSize(c) == 1008);
+				::memset(c, 0xFF, 1000);
+
+				// 가운데 block 을 해제하고 같은 크기를 다시 할당하면 같은 자리가 재사용된다.
+				allocator.Deallocate(b);
+				void* const d = allocator.Allocate(100);
+				MINT_ASSURE(d == b);
+
+				allocator.Deallocate(a);
+				allocator.Deallocate(c);
+				allocator.Deallocate(d);
+				TLSFAllocator::Statistics statistics = allocator.ComputeStatistics();
+				MINT_ASSURE(statistics._allocationCount == 0);
+				MINT_ASSURE(statistics._pageCount == 1);
+				MINT_ASSURE(statistics._freeBlockCount == 1);
+				MINT_ASSURE(statistics.ComputeFragmentation() == 0.0f);
+
+				// page 보다 큰 할당은 새 page 를 만들고, 해제하면 page 를 반환한다.
+				void* const large = allocator.Allocate(256 * 1024);
+				MINT_ASSURE(large != nullptr);
+				MINT_ASSURE(allocator.ComputeStatistics()._pageCount == 2);
+				allocator.Deallocate(large);
+				MINT_ASSURE(allocator.ComputeStatistics()._pageCount == 1);
+			}
+
+			{
+				TLSFAllocator allocator{ 64 * 1024, false };
+				Vector<void*> pointers;
+				uint32 seed = 12345;
+				for (uint32 iteration = 0; iteration < 10000; ++iteration)
+				{
+					seed = seed * 1664525 + 1013904223;
+					if (pointers.IsEmpty() == true || (seed >> 16) % 3 != 0)
+					{
+						void* const pointer = allocator.Allocate((seed >> 8) % 2048 + 1);
+						MINT_ASSURE(pointer != nullptr);
+						pointers.PushBack(pointer);
+					}
+					else
+					{
+						const uint32 index = (seed >> 4) % pointers.Size();
+						allocator.Deallocate(pointers[index]);
+						pointers[index] = pointers.Back();
+						pointers.PopBack();
+					}
+				}
+				MINT_ASSURE(allocator.ComputeStatistics()._allocationCount == pointers.Size());
+
+				for (void* const pointer : pointers)
+				{
+					allocator.Deallocate(pointer);
+				}
+				const TLSFAllocator::Statistics statistics = allocator.ComputeStatistics();
+				MINT_ASSURE(statistics._allocationCount == 0);
+				MINT_ASSURE(statistics._usedByteSize == 0);
+				MINT_ASSURE(statistics._pageCount == 1);
+				MINT_ASSURE(statistics._freeBlockCount == 1);
+			}
+
+#if defined MINT_TEST_PERFORMANCE
+			{
+				static constexpr uint32 kCount = 1'000'000;
+				Vector<uint32> byteSizes;
+				byteSizes.Resize(kCount);
+				uint32 seed = 12345;
+				for (uint32 i = 0; i < kCount; ++i)
+				{
+					seed = seed * 1664525 + 1013904223;
+					byteSizes[i] = (seed >> 8) % 512 + 1;
+				}
+
+				Vector<void*> pointers;
+				pointers.Resize(kCount);
+				{
+					Profiler::ScopedCPUProfiler profiler{ "malloc/free" };
+					for (uint32 i = 0; i < kCount; ++i)
+					{
+						pointers[i] = ::malloc(byteSizes[i]);
+					}
+					for (uint32 i = 0; i < kCount; i += 2)
+					{
+						::free(pointers[i]);
+					}
+					for (uint32 i = 1; i < kCount; i += 2)
+					{
+						::free(pointers[i]);
+					}
+				}
+
+				TLSFAllocator allocator;
+				{
+					Profiler::ScopedCPUProfiler profiler{ "TLSFAllocator" };
+					for (uint32 i = 0; i < kCount; ++i)
+					{
+						pointers[i] = allocator.Allocate(byteSizes[i]);
+					}
+					for (uint32 i = 0; i < kCount; i += 2)
+					{
+						allocator.Deallocate(pointers[i]);
+					}
+					for (uint32 i = 1; i < kCount; i += 2)
+					{
+						allocator.Deallocate(pointers[i]);
+					}
+				}
+
+				std::vector<Profiler::ScopedCPUProfiler::Log> logArray = Profiler::ScopedCPUProfiler::GetEntireLogData();
+				const bool IsEmpty = logArray.empty();
+			}
 #endif
 			return true;
 		}
@@ -1 +1,2 @@
 #include <MintContainer/Source/Color.cpp>
+#include <MintContainer/Source/TLSFAllocator.cpp>
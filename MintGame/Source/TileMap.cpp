@@ -1,8 +1,9 @@
-#include <MintGame/Include/TileMap.h>
+﻿#include <MintGame/Include/TileMap.h>
 #include <MintContainer/Include/Vector.hpp>
 #include <MintContainer/Include/StringUtil.hpp>
 #include <MintMath/Include/Float2.h>
 #include <MintMath/Include/Transform.h>
+#include <MintMath/Include/Geometry.h>
 #include <MintRendering/Include/SpriteRenderer.h>
 #include <MintPlatform/Include/XML.h>
 #include <MintPhysics/Include/CollisionShape.h>
@@ -57,6 +58,9 @@ namespace mint
 				const float halfTileWidth = 0.5f * _tileWidth;
 				const float halfTileHeight = 0.5f * _tileHeight;
 				const Float2 coordsFixer(-halfTileWidth, +halfTileHeight);
+				Vector<uint32> pieceScratchIndices;
+				Vector<uint32> pieceIndices;
+				Vector<uint32> pieceOffsets;
 
 				for (const XML::Node* tileNode = firstTileNode; tileNode != nullptr; tileNode = tileNode->GetNextSiblingNode())
 				{
@@ -96,7 +100,29 @@ namespace mint
 									points[i]._y = -(StringUtil::StringToFloat(coords[1]) - halfTileHeight);
 								}
 							}
-							_tileCollisionShapes[id] = MakeShared<Physics2D::ConvexCollisionShape>(Physics2D::ConvexCollisionShape::MakeFromPoints(points));
+
+							// 오목한 다각형은 볼록 조각들로 나눠야 모양이 유지된다.
+							const uint32 pieceCount = ConvexDecomposition_Compute(points, pieceScratchIndices, pieceIndices, pieceOffsets);
+							if (pieceCount <= 1)
+							{
+								_tileCollisionShapes[id] = MakeShared<Physics2D::ConvexCollisionShape>(Physics2D::ConvexCollisionShape::MakeFromPoints(points));
+							}
+							else
+							{
+								Vector<Physics2D::CompositeCollisionShape::ShapeInstance> shapeInstances;
+								shapeInstances.Resize(pieceCount);
+								Vector<Float2> piecePoints;
+								for (uint32 pieceIndex = 0; pieceIndex < pieceCount; ++pieceIndex)
+								{
+									piecePoints.Clear();
+									for (uint32 i = pieceOffsets[pieceIndex]; i < pieceOffsets[pieceIndex + 1]; ++i)
+									{
+										piecePoints.PushBack(points[pieceIndices[i]]);
+									}
+									shapeInstances[pieceIndex]._shape = MakeShared<Physics2D::ConvexCollisionShape>(Physics2D::ConvexCollisionShape::MakeFromPoints(piecePoints));
+								}
+								_tileCollisionShapes[id] = MakeShared<Physics2D::CompositeCollisionShape>(Physics2D::CompositeCollisionShape(shapeInstances));
+							}
 						}
 						else if (StringUtil::Equals(objectChildNode->GetName(), "polyline") == true)
 						{
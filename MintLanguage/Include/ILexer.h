@@ -6,7 +6,7 @@
 
 
 #include <MintContainer/Include/Vector.h>
-#include <MintContainer/Include/HashMap.h>
+#include <MintContainer/Include/FlatMap.h>
 
 #include <MintLanguage/Include/LanguageCommon.h>
 
@@ -199,32 +199,32 @@ namespace mint
 			SymbolClassifier _defaultSymbolClassifier;
 
 		protected:
-			HashMap<char, int8> _delimiterUmap;
+			CharTable<int8> _delimiterMap;
 
 		protected:
 			Vector<LineSkipperTableItem> _lineSkipperTable;
-			HashMap<uint64, uint32> _lineSkipperUmap;
+			FlatMap<uint64, uint32> _lineSkipperMap;
 			uint16 _lineSkipperNextGroupID;
 
 		protected:
 			Vector<StringA> _keywordTable;
-			HashMap<uint64, uint32> _keywordUmap;
+			FlatMap<uint64, uint32> _keywordMap;
 
 		protected:
 			Vector<GrouperTableItem> _grouperTable;
-			HashMap<char, uint32> _grouperUmap;
-			HashMap<char, char> _grouperOpenToCloseMap;
+			CharTable<uint32> _grouperMap;
+			CharTable<char> _grouperOpenToCloseMap;
 
 		protected:
-			HashMap<char, int8> _stringQuoteUmap;
+			CharTable<int8> _stringQuoteMap;
 
 		protected:
 			Vector<StringA> _punctuatorTable;
-			HashMap<uint64, uint32> _punctuatorUmap;
+			FlatMap<uint64, uint32> _punctuatorMap;
 
 		protected:
 			Vector<OperatorTableItem> _operatorTable;
-			HashMap<uint64, uint32> _operatorUmap;
+			FlatMap<uint64, uint32> _operatorMap;
 
 		protected:
 			Vector<SymbolTableItem> _symbolTable;
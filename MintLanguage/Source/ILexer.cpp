@@ -3,7 +3,7 @@
 #include <MintContainer/Include/Hash.hpp>
 #include <MintContainer/Include/Vector.hpp>
 #include <MintContainer/Include/StringUtil.hpp>
-#include <MintContainer/Include/HashMap.hpp>
+#include <MintContainer/Include/FlatMap.hpp>
 
 
 namespace mint
@@ -86,9 +86,9 @@ namespace mint
 
 		void ILexer::RegisterDelimiter(const char delimiter)
 		{
-			if (_delimiterUmap.Find(delimiter).IsValid() == false)
+			if (_delimiterMap.Contains(delimiter) == false)
 			{
-				_delimiterUmap.Insert(delimiter, 1);
+				_delimiterMap.Insert(delimiter, 1);
 			}
 		}
 
@@ -106,11 +106,11 @@ namespace mint
 			if (StringUtil::Equals(lineSkipperOpen, lineSkipperClose) == true)
 			{
 				const uint64 keyOpenClose = (lengthOpen == 1) ? lineSkipperOpen[0] : static_cast<uint64>(lineSkipperOpen[1]) * 255 + lineSkipperOpen[0];
-				if (_lineSkipperUmap.Find(keyOpenClose).IsValid() == false)
+				if (_lineSkipperMap.Find(keyOpenClose).IsValid() == false)
 				{
 					_lineSkipperTable.PushBack(LineSkipperTableItem(lineSkipperOpen, lineSkipperSemantic, LineSkipperClassifier::OpenCloseMarker, 0));
 					const uint32 lineSkipperIndex = _lineSkipperTable.Size() - 1;
-					_lineSkipperUmap.Insert(keyOpenClose, lineSkipperIndex);
+					_lineSkipperMap.Insert(keyOpenClose, lineSkipperIndex);
 				}
 				return;
 			}
@@ -119,19 +119,19 @@ namespace mint
 			{
 				const uint16 nextGroupID = GetLineSkipperNextGroupID();
 				const uint64 keyOpen = (lengthOpen == 1) ? lineSkipperOpen[0] : static_cast<uint64>(lineSkipperOpen[1]) * 255 + lineSkipperOpen[0];
-				if (_lineSkipperUmap.Find(keyOpen).IsValid() == false)
+				if (_lineSkipperMap.Find(keyOpen).IsValid() == false)
 				{
 					_lineSkipperTable.PushBack(LineSkipperTableItem(lineSkipperOpen, lineSkipperSemantic, LineSkipperClassifier::OpenMarker, nextGroupID));
 					const uint32 lineSkipperIndex = _lineSkipperTable.Size() - 1;
-					_lineSkipperUmap.Insert(keyOpen, lineSkipperIndex);
+					_lineSkipperMap.Insert(keyOpen, lineSkipperIndex);
 				}
 
 				const uint64 keyClose = (lengthClose == 1) ? lineSkipperClose[0] : static_cast<uint64>(lineSkipperClose[1]) * 255 + lineSkipperClose[0];
-				if (_lineSkipperUmap.Find(keyClose).IsValid() == false)
+				if (_lineSkipperMap.Find(keyClose).IsValid() == false)
 				{
 					_lineSkipperTable.PushBack(LineSkipperTableItem(lineSkipperClose, lineSkipperSemantic, LineSkipperClassifier::CloseMarker, nextGroupID));
 					const uint32 lineSkipperIndex = _lineSkipperTable.Size() - 1;
-					_lineSkipperUmap.Insert(keyClose, lineSkipperIndex);
+					_lineSkipperMap.Insert(keyClose, lineSkipperIndex);
 				}
 			}
 		}
@@ -146,28 +146,28 @@ namespace mint
 			}
 
 			const uint64 key = (length == 1) ? lineSkipper[0] : static_cast<uint64>(lineSkipper[1]) * 255 + lineSkipper[0];
-			if (_lineSkipperUmap.Find(key).IsValid() == false)
+			if (_lineSkipperMap.Find(key).IsValid() == false)
 			{
 				_lineSkipperTable.PushBack(LineSkipperTableItem(lineSkipper, lineSkipperSemantic, LineSkipperClassifier::SingleMarker, 0));
 				const uint32 lineSkipperIndex = _lineSkipperTable.Size() - 1;
-				_lineSkipperUmap.Insert(key, lineSkipperIndex);
+				_lineSkipperMap.Insert(key, lineSkipperIndex);
 			}
 		}
 
 		void ILexer::RegisterKeyword(const char* const keyword)
 		{
 			const uint64 hash = ComputeHash(keyword);
-			if (_keywordUmap.Find(hash).IsValid() == false)
+			if (_keywordMap.Find(hash).IsValid() == false)
 			{
 				_keywordTable.PushBack(keyword);
 				const uint32 keywordIndex = _keywordTable.Size() - 1;
-				_keywordUmap.Insert(hash, keywordIndex);
+				_keywordMap.Insert(hash, keywordIndex);
 			}
 		}
 
 		void ILexer::RegisterGrouper(const char grouperOpen, const char grouperClose)
 		{
-			if (_grouperUmap.Find(grouperOpen).IsValid() == false)
+			if (_grouperMap.Contains(grouperOpen) == false)
 			{
 				_grouperTable.PushBack(GrouperTableItem(grouperOpen, GrouperClassifier::Open));
 				const uint32 grouperOpenIndex = _grouperTable.Size() - 1;
@@ -175,8 +175,8 @@ namespace mint
 				_grouperTable.PushBack(GrouperTableItem(grouperClose, GrouperClassifier::Close));
 				const uint32 grouperCloseIndex = _grouperTable.Size() - 1;
 
-				_grouperUmap.Insert(grouperOpen, grouperOpenIndex);
-				_grouperUmap.Insert(grouperClose, grouperCloseIndex);
+				_grouperMap.Insert(grouperOpen, grouperOpenIndex);
+				_grouperMap.Insert(grouperClose, grouperCloseIndex);
 
 				_grouperOpenToCloseMap.Insert(grouperOpen, grouperClose);
 			}
@@ -184,9 +184,9 @@ namespace mint
 
 		void ILexer::RegisterStringQuote(const char stringQuote)
 		{
-			if (_stringQuoteUmap.Find(stringQuote).IsValid() == false)
+			if (_stringQuoteMap.Contains(stringQuote) == false)
 			{
-				_stringQuoteUmap.Insert(stringQuote, 1);
+				_stringQuoteMap.Insert(stringQuote, 1);
 			}
 		}
 
@@ -200,12 +200,12 @@ namespace mint
 			}
 
 			const uint64 key = ComputeHash(punctuator);
-			if (_punctuatorUmap.Find(key).IsValid() == false)
+			if (_punctuatorMap.Find(key).IsValid() == false)
 			{
 				_punctuatorTable.PushBack(punctuator);
 
 				const uint32 punctuatorIndex = _punctuatorTable.Size() - 1;
-				_punctuatorUmap.Insert(key, punctuatorIndex);
+				_punctuatorMap.Insert(key, punctuatorIndex);
 			}
 		}
 
@@ -224,11 +224,11 @@ namespace mint
 			}
 
 			const uint64 key = (length == 1) ? operator_[0] : static_cast<uint64>(operator_[1]) * 255 + operator_[0];
-			if (_operatorUmap.Find(key).IsValid() == false)
+			if (_operatorMap.Find(key).IsValid() == false)
 			{
 				_operatorTable.PushBack(OperatorTableItem(operator_, operatorClassifier));
 				const uint32 operatorIndex = _operatorTable.Size() - 1;
-				_operatorUmap.Insert(key, operatorIndex);
+				_operatorMap.Insert(key, operatorIndex);
 			}
 		}
 
@@ -580,7 +580,7 @@ namespace mint
 
 		bool ILexer::IsDelimiter(const char input) const noexcept
 		{
-			return _delimiterUmap.Find(input).IsValid() == true;
+			return _delimiterMap.Contains(input) == true;
 		}
 
 		bool ILexer::IsLineSkipper(const char ch0, const char ch1, LineSkipperTableItem& out) const noexcept
@@ -588,10 +588,10 @@ namespace mint
 			// 먼저 길이 2 LineSkipper 인지 확인 후
 			// 아니라면 길이 1 LineSkipper 인지 확인
 			const uint64 key = static_cast<uint64>(ch1) * 255 + ch0;
-			auto found = _lineSkipperUmap.Find(key);
+			auto found = _lineSkipperMap.Find(key);
 			if (found.IsValid() == false)
 			{
-				auto found0 = _lineSkipperUmap.Find(ch0);
+				auto found0 = _lineSkipperMap.Find(ch0);
 				if (found0.IsValid() == false)
 				{
 					return false;
@@ -612,26 +612,26 @@ namespace mint
 
 		bool ILexer::IsGrouper(const char input, GrouperTableItem& out) const noexcept
 		{
-			auto found = _grouperUmap.Find(input);
-			if (found.IsValid() == false)
+			const uint32* const grouperIndex = _grouperMap.Find(input);
+			if (grouperIndex == nullptr)
 			{
 				return false;
 			}
 
-			out = _grouperTable[*found._value];
+			out = _grouperTable[*grouperIndex];
 			return true;
 		}
 
 		bool ILexer::IsStringQuote(const char input) const noexcept
 		{
-			return _stringQuoteUmap.Find(input).IsValid() == true;
+			return _stringQuoteMap.Contains(input) == true;
 		}
 
 		bool ILexer::IsPunctuator(const char ch0, const char ch1, const char ch2, uint32& outAdvance) const noexcept
 		{
 			const char keyString3[4]{ ch0, ch1, ch2, '\0' };
 			const uint64 key3 = ComputeHash(keyString3);
-			auto found3 = _punctuatorUmap.Find(key3);
+			auto found3 = _punctuatorMap.Find(key3);
 			if (found3.IsValid() == true)
 			{
 				outAdvance = 3;
@@ -640,7 +640,7 @@ namespace mint
 
 			const char keyString2[3]{ ch0, ch1, '\0' };
 			const uint64 key2 = ComputeHash(keyString2);
-			auto found2 = _punctuatorUmap.Find(key2);
+			auto found2 = _punctuatorMap.Find(key2);
 			if (found2.IsValid() == true)
 			{
 				outAdvance = 2;
@@ -649,7 +649,7 @@ namespace mint
 
 			const char keyString1[2]{ ch0, '\0' };
 			const uint64 key1 = ComputeHash(keyString1);
-			auto found1 = _punctuatorUmap.Find(key1);
+			auto found1 = _punctuatorMap.Find(key1);
 			if (found1.IsValid() == true)
 			{
 				outAdvance = 1;
@@ -665,10 +665,10 @@ namespace mint
 			// 먼저 길이 2 Operator 인지 확인 후
 			// 아니라면 길이 1 Operator 인지 확인
 			const uint64 key = static_cast<uint64>(ch1) * 255 + ch0;
-			auto found = _operatorUmap.Find(key);
+			auto found = _operatorMap.Find(key);
 			if (found.IsValid() == false)
 			{
-				auto found0 = _operatorUmap.Find(ch0);
+				auto found0 = _operatorMap.Find(ch0);
 				if (found0.IsValid() == false)
 				{
 					return false;
@@ -713,7 +713,7 @@ namespace mint
 
 		bool ILexer::IsKeyword(const StringA& input) const noexcept
 		{
-			return _keywordUmap.Find(ComputeHash(input.CString())).IsValid() == true;
+			return _keywordMap.Find(ComputeHash(input.CString())).IsValid() == true;
 		}
 
 		bool ILexer::IsEscaper(const char input) const noexcept
@@ -738,7 +738,8 @@ namespace mint
 
 		char ILexer::GetGrouperClose(const char grouperOpen) const noexcept
 		{
-			return *_grouperOpenToCloseMap.Find(grouperOpen)._value;
+			const char* const grouperClose = _grouperOpenToCloseMap.Find(grouperOpen);
+			return (grouperClose == nullptr) ? 0 : *grouperClose;
 		}
 	}
 }
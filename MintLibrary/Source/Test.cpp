@@ -4,6 +4,9 @@
 #include <MintLibrary/Include/AllHpps.h>
 
 
+//#define MINT_TEST_PERFORMANCE
+
+
 namespace mint
 {
 	namespace TestLibrary
@@ -175,6 +178,162 @@ namespace mint
 			fileNames.PushBack(StringWithComparator("images\\game\\map\\forest\\forest1\\tile\\t_dg_03.pgf"));
 			fileNames.PushBack(StringWithComparator("images\\game\\map\\forest\\forest1\\tile\\t_dg_04.pgf"));
 			MINT_ASSURE(IsValidIndex(BinarySearch(fileNames, StringWithComparator("images\\game\\map\\forest\\forest1\\tile\\t_dg_03.bmp"))) == false);
+
+			uint32 randomSeed = 1;
+			auto GenerateRandom = [&randomSeed]()
+				{
+					randomSeed = randomSeed * 1664525u + 1013904223u;
+					return randomSeed >> 8;
+				};
+
+			{
+				Vector<uint32> t7;
+				Vector<uint32> t8;
+				Vector<uint32> t9;
+				for (uint32 i = 0; i < 1000; ++i)
+				{
+					const uint32 value = GenerateRandom() % 100;
+					t7.PushBack(value);
+					t8.PushBack(value);
+					t9.PushBack(value);
+				}
+				QuickSort(t7, ComparatorAscending<uint32>());
+				RadixSort(t8);
+				HeapSort(t9.Data(), t9.Size(), ComparatorAscending<uint32>());
+				for (uint32 i = 1; i < t7.Size(); ++i)
+				{
+					MINT_ASSURE(t7[i - 1] <= t7[i]);
+				}
+				for (uint32 i = 0; i < t7.Size(); ++i)
+				{
+					MINT_ASSURE(t7[i] == t8[i]);
+					MINT_ASSURE(t7[i] == t9[i]);
+				}
+			}
+
+			{
+				struct KeyOrder
+				{
+					int32 _key;
+					uint32 _order;
+				};
+				Vector<KeyOrder> t10;
+				for (uint32 i = 0; i < 500; ++i)
+				{
+					t10.PushBack(KeyOrder{ static_cast<int32>(GenerateRandom() % 16) - 8, i });
+				}
+				Vector<KeyOrder> t11 = t10;
+				StableSort(t10, [](const KeyOrder& lhs, const KeyOrder& rhs) { return lhs._key < rhs._key; });
+				RadixSort(t11, [](const KeyOrder& entry) { return entry._key; });
+				for (uint32 i = 1; i < t10.Size(); ++i)
+				{
+					MINT_ASSURE(t10[i - 1]._key < t10[i]._key || (t10[i - 1]._key == t10[i]._key && t10[i - 1]._order < t10[i]._order));
+					MINT_ASSURE(t10[i]._order == t11[i]._order);
+				}
+			}
+
+			{
+				Vector<float> t12{ 3.5f, -1.0f, 0.0f, -7.25f, 2.0f, -0.5f };
+				RadixSort(t12);
+				MINT_ASSURE(t12[0] == -7.25f);
+				MINT_ASSURE(t12[1] == -1.0f);
+				MINT_ASSURE(t12[2] == -0.5f);
+				MINT_ASSURE(t12[3] == 0.0f);
+				MINT_ASSURE(t12[4] == 2.0f);
+				MINT_ASSURE(t12[5] == 3.5f);
+			}
+
+			{
+				Vector<int32> t13{ 5, -3, 8, 8, 0, 12, -7, 8, 4 };
+				MINT_ASSURE(Find(t13, 8) == 2);
+				MINT_ASSURE(Find(t13, 4) == 8);
+				MINT_ASSURE(Find(t13, 9) == kInvalidIndexUint32);
+				MINT_ASSURE(Count(t13, 8) == 3);
+				MINT_ASSURE(Sum(t13) == 35);
+				int32 min = 0;
+				int32 max = 0;
+				MINT_ASSURE(MinMax(t13, min, max));
+				MINT_ASSURE(min == -7 && max == 12);
+
+				const uint32 negativeCount = Partition(t13, [](const int32 value) { return value < 0; });
+				MINT_ASSURE(negativeCount == 2);
+				MINT_ASSURE(t13[0] < 0 && t13[1] < 0 && t13[2] >= 0);
+
+				QuickSort(t13, ComparatorAscending<int32>());
+				MINT_ASSURE(LowerBound(t13, 8) == 5);
+				MINT_ASSURE(LowerBound(t13, 6) == 5);
+				MINT_ASSURE(LowerBound(t13, -100) == 0);
+				MINT_ASSURE(LowerBound(t13, 100) == t13.Size());
+
+				Vector<int32> eytzinger;
+				MakeEytzingerLayout(t13, eytzinger);
+				MINT_ASSURE(eytzinger[LowerBoundEytzinger(eytzinger, 6)] == 8);
+				MINT_ASSURE(eytzinger[LowerBoundEytzinger(eytzinger, -100)] == -7);
+				MINT_ASSURE(LowerBoundEytzinger(eytzinger, 100) == kInvalidIndexUint32);
+
+				Vector<Float2> t14{ Float2(1.0f, -2.0f), Float2(-3.0f, 4.0f), Float2(5.0f, 0.5f) };
+				Float2 min2;
+				Float2 max2;
+				MINT_ASSURE(MinMax(t14, min2, max2));
+				MINT_ASSURE(min2 == Float2(-3.0f, -2.0f) && max2 == Float2(5.0f, 4.0f));
+				MINT_ASSURE(Sum(t14) == Float2(3.0f, 2.5f));
+
+				Vector<float> t15;
+				float minF = 0.0f;
+				float maxF = 0.0f;
+				MINT_ASSURE(MinMax(t15, minF, maxF) == false);
+			}
+
+#if defined MINT_TEST_PERFORMANCE
+			{
+#if defined MINT_DEBUG
+				static constexpr uint32 kCount = 100'000;
+#else
+				static constexpr uint32 kCount = 2'000'000;
+#endif
+				Vector<uint32> sortedSource;
+				Vector<uint32> reversedSource;
+				Vector<uint32> randomSource;
+				for (uint32 i = 0; i < kCount; ++i)
+				{
+					sortedSource.PushBack(i);
+					reversedSource.PushBack(kCount - i);
+					randomSource.PushBack(GenerateRandom());
+				}
+
+				const char* const kInputNames[3]{ "sorted", "reversed", "random" };
+				const Vector<uint32>* const kInputs[3]{ &sortedSource, &reversedSource, &randomSource };
+				for (uint32 inputIndex = 0; inputIndex < 3; ++inputIndex)
+				{
+					{
+						Vector<uint32> input = *kInputs[inputIndex];
+						Profiler::ScopedCPUProfiler profiler{ std::string("QuickSort - ") + kInputNames[inputIndex] };
+						QuickSort(input, ComparatorAscending<uint32>());
+					}
+
+					{
+						Vector<uint32> input = *kInputs[inputIndex];
+						Profiler::ScopedCPUProfiler profiler{ std::string("HeapSort - ") + kInputNames[inputIndex] };
+						HeapSort(input.Data(), input.Size(), ComparatorAscending<uint32>());
+					}
+
+					{
+						Vector<uint32> input = *kInputs[inputIndex];
+						Profiler::ScopedCPUProfiler profiler{ std::string("StableSort - ") + kInputNames[inputIndex] };
+						StableSort(input, ComparatorAscending<uint32>());
+					}
+
+					{
+						Vector<uint32> input = *kInputs[inputIndex];
+						Profiler::ScopedCPUProfiler profiler{ std::string("RadixSort - ") + kInputNames[inputIndex] };
+						RadixSort(input);
+					}
+				}
+
+				const std::vector<Profiler::ScopedCPUProfiler::LogData>& logArray = Profiler::ScopedCPUProfiler::GetEntireLogData();
+				const bool IsEmpty = logArray.empty();
+			}
+#endif
 			return true;
 		}
 	}
@@ -647,6 +647,14 @@ bool RunPhysics2DTestWindow()
 		sceneObjectRegistry.AttachComponent(sceneObjectFloor, std::move(rigidBodyComponent));
 	}
 
+	{
+		ParticleDistanceConstraint particleDistanceConstraint;
+		particleDistanceConstraint._bodyAID = sceneObjectRegistry.GetComponentMust<RigidBodyComponent>(sceneObject0)._bodyID;
+		particleDistanceConstraint._bodyBID = sceneObjectRegistry.GetComponentMust<RigidBodyComponent>(sceneObject1)._bodyID;
+		particleDistanceConstraint._distance = 0.5f;
+		physicsWorld.AddParticleDistanceConstraint(particleDistanceConstraint);
+	}
+
 	const InputContext& inputContext = InputContext::GetInstance();
 	float accumulatedTimeForPhysics = 0.0f;
 	while (app.IsRunning() == true)
@@ -672,29 +680,15 @@ bool RunPhysics2DTestWindow()
 			const RigidBodyComponent& rigidBodyComponent0 = sceneObjectRegistry.GetComponentMust<RigidBodyComponent>(sceneObject0);
 			const RigidBodyComponent& rigidBodyComponent1 = sceneObjectRegistry.GetComponentMust<RigidBodyComponent>(sceneObject1);
 			const RigidBodyComponent& rigidBodyComponentFloor = sceneObjectRegistry.GetComponentMust<RigidBodyComponent>(sceneObjectFloor);
-			const Body& bodyA = physicsWorld.GetBody(rigidBodyComponent0._bodyID);
-			const Body& bodyB = physicsWorld.GetBody(rigidBodyComponent1._bodyID);
-			const Body& bodyFloor = physicsWorld.GetBody(rigidBodyComponentFloor._bodyID);
-
-			ParticleDistanceConstraint particleDistanceConstraint;
-			particleDistanceConstraint._bodyAID = bodyA._bodyID;
-			particleDistanceConstraint._bodyBID = bodyB._bodyID;
-			particleDistanceConstraint._distance = 0.5f;
-
-			const uint32 kConstraintSubStepCount = 4;
-			for (uint32 constraintSubStep = 0; constraintSubStep < kConstraintSubStepCount; ++constraintSubStep)
-			{
-				SolveParticleDistanceConstraint(physicsWorld, kTimeStep, particleDistanceConstraint);
-			}
 
 			physicsWorld.Step(kTimeStep);
 
 			Transform& transform0 = sceneObjectRegistry.GetComponentMust<TransformComponent>(sceneObject0)._transform;
 			Transform& transform1 = sceneObjectRegistry.GetComponentMust<TransformComponent>(sceneObject1)._transform;
 			Transform& transformFloor = sceneObjectRegistry.GetComponentMust<TransformComponent>(sceneObjectFloor)._transform;
-			transform0._translation.Set(bodyA._transform2D._translation);
-			transform1._translation.Set(bodyB._transform2D._translation);
-			transformFloor._translation.Set(bodyFloor._transform2D._translation);
+			transform0._translation.Set(physicsWorld.GetTransform(rigidBodyComponent0._bodyID)._translation);
+			transform1._translation.Set(physicsWorld.GetTransform(rigidBodyComponent1._bodyID)._translation);
+			transformFloor._translation.Set(physicsWorld.GetTransform(rigidBodyComponentFloor._bodyID)._translation);
 		}
 
 		// Rendering
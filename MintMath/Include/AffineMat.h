@@ -20,6 +20,29 @@ namespace mint
 	};
 
 
+	// AffineMat<float> 의 행렬 곱셈 구현
+	// 실행 중인 CPU 에 맞는 구현 (SSE / AVX2 + FMA / AVX-512) 을 처음 호출할 때 골라 두므로, 하나의 실행 파일로 여러 CPU 에서 쓸 수 있다.
+	namespace AffineMatKernel
+	{
+		enum class InstructionSet : uint8
+		{
+			SSE,
+			AVX2FMA,
+			AVX512,
+		};
+
+		InstructionSet GetInstructionSet() noexcept;
+		// 구현을 직접 고른다. (비교나 테스트용)
+		// CPU 가 지원하지 않는 명령어 집합이면 바꾸지 않고 false 를 반환한다.
+		bool SetInstructionSet(const InstructionSet instructionSet) noexcept;
+
+		// outRows = lhsRows * rhsRows (outRows 가 lhsRows 나 rhsRows 와 같아도 된다)
+		void MulMatrix(const AffineVec<float>* const lhsRows, const AffineVec<float>* const rhsRows, AffineVec<float>* const outRows) noexcept;
+		// outVectors[i] = rows * vectors[i] (column vector)
+		void MulVectors(const AffineVec<float>* const rows, const AffineVec<float>* const vectors, const uint32 count, AffineVec<float>* const outVectors) noexcept;
+	}
+
+
 #pragma region Free functions
 	template<typename T>
 	AffineMat<T> operator*(const T scalar, const AffineMat<T>& mat) noexcept;
@@ -78,6 +101,10 @@ namespace mint
 	template<>
 	class AffineMat<float>
 	{
+	public:
+		// outVectors[i] = m * vectors[i] (AffineMatKernel 참고)
+		static void Mul(const AffineMat& m, const AffineVecF* const vectors, const uint32 count, AffineVecF* const outVectors) noexcept;
+
 	public:
 		AffineMat();
 		AffineMat(const AffineVecF& row0, const AffineVecF& row1, const AffineVecF& row2, const AffineVecF& row3);
@@ -192,6 +192,11 @@ namespace mint
 #pragma endregion
 
 
+	MINT_INLINE void AffineMat<float>::Mul(const AffineMat& m, const AffineVecF* const vectors, const uint32 count, AffineVecF* const outVectors) noexcept
+	{
+		AffineMatKernel::MulVectors(m._rows, vectors, count, outVectors);
+	}
+
 	inline AffineMat<float>::AffineMat()
 		: _rows{ AffineVecF(1, 0, 0, 0), AffineVecF(0, 1, 0, 0), AffineVecF(0, 0, 1, 0),AffineVecF(0, 0, 0, 1) }
 	{
@@ -248,13 +253,9 @@ namespace mint
 
 	MINT_INLINE AffineMat<float> AffineMat<float>::operator*(const AffineMat& rhs) const noexcept
 	{
-		return AffineMat
-		(
-			_rows[0].Dot(rhs.GetCol(0)), _rows[0].Dot(rhs.GetCol(1)), _rows[0].Dot(rhs.GetCol(2)), _rows[0].Dot(rhs.GetCol(3)),
-			_rows[1].Dot(rhs.GetCol(0)), _rows[1].Dot(rhs.GetCol(1)), _rows[1].Dot(rhs.GetCol(2)), _rows[1].Dot(rhs.GetCol(3)),
-			_rows[2].Dot(rhs.GetCol(0)), _rows[2].Dot(rhs.GetCol(1)), _rows[2].Dot(rhs.GetCol(2)), _rows[2].Dot(rhs.GetCol(3)),
-			_rows[3].Dot(rhs.GetCol(0)), _rows[3].Dot(rhs.GetCol(1)), _rows[3].Dot(rhs.GetCol(2)), _rows[3].Dot(rhs.GetCol(3))
-		);
+		AffineMat result;
+		AffineMatKernel::MulMatrix(_rows, rhs._rows, result._rows);
+		return result;
 	}
 
 	MINT_INLINE AffineMat<float> AffineMat<float>::operator*(const float scalar) const noexcept
@@ -287,7 +288,7 @@ namespace mint
 
 	MINT_INLINE AffineMat<float>& AffineMat<float>::operator*=(const AffineMat& rhs) noexcept
 	{
-		*this = (*this * rhs);
+		AffineMatKernel::MulMatrix(_rows, rhs._rows, _rows);
 		return *this;
 	}
 
@@ -47,11 +47,25 @@ namespace mint
 	MINT_INLINE double Dot(const AffineVec<double>& lhs, const AffineVec<double>& rhs) noexcept
 	{
 		const __m256d result = _mm256_mul_pd(lhs.GetRaw(), rhs.GetRaw());
-		return result.m256d_f64[0] + result.m256d_f64[1] + result.m256d_f64[2] + result.m256d_f64[3];
+		const __m128d halfSum = _mm_add_pd(_mm256_castpd256_pd128(result), _mm256_extractf128_pd(result, 1));
+		return _mm_cvtsd_f64(_mm_add_sd(halfSum, _mm_unpackhi_pd(halfSum, halfSum)));
 	}
 
 	MINT_INLINE AffineVec<double> Cross(const AffineVec<double>& lhs, const AffineVec<double>& rhs) noexcept
 	{
+#if defined __AVX2__ && (defined __FMA__ || defined _MSC_VER)
+		// AVX2 로 빌드하면 (MSVC 의 /arch:AVX2 는 FMA 도 포함한다) register 안에서 성분을 섞고 FMA 로 계산한다.
+		// 벡터 하나를 계산하는 함수라서 AffineMatKernel 처럼 실행 중에 구현을 고르면 함수 포인터 호출이 계산보다 비싸므로, 빌드 옵션으로만 고른다.
+		const __m256d l = lhs.GetRaw();
+		const __m256d r = rhs.GetRaw();
+		const __m256d lYZX = _mm256_permute4x64_pd(l, _MM_SHUFFLE(3, 0, 2, 1));
+		const __m256d rYZX = _mm256_permute4x64_pd(r, _MM_SHUFFLE(3, 0, 2, 1));
+		const __m256d lZXY = _mm256_permute4x64_pd(l, _MM_SHUFFLE(3, 1, 0, 2));
+		const __m256d rZXY = _mm256_permute4x64_pd(r, _MM_SHUFFLE(3, 1, 0, 2));
+		const __m256d result = _mm256_fmsub_pd(lYZX, rZXY, _mm256_mul_pd(lZXY, rYZX));
+		// FMA 는 w 성분에 반올림 오차를 남길 수 있으므로 0 으로 지운다.
+		return AffineVec<double>(_mm256_blend_pd(result, _mm256_setzero_pd(), 0b1000));
+#else
 		double l[4];
 		lhs.Get(l);
 		double r[4];
@@ -62,6 +76,7 @@ namespace mint
 		// y == lz * rx - lx * rz
 		// z == lx * ry - ly * rx
 		return AffineVec<double>(_mm256_sub_pd(a, b));
+#endif
 	}
 #pragma endregion
 
@@ -324,14 +339,14 @@ namespace mint
 
 	MINT_INLINE bool AffineVec<double>::operator==(const AffineVec& rhs) const noexcept
 	{
+		// 비교 결과의 각 성분은 (double 로는 NaN 인) 비트 mask 이므로 부호 비트만 모아서 확인한다.
 		const __m256d cmpResult = _mm256_cmp_pd(_raw, rhs._raw, _CMP_EQ_OQ);
-		return (cmpResult.m256d_f64[0] < 0) && (cmpResult.m256d_f64[1] < 0) && (cmpResult.m256d_f64[2] < 0) && (cmpResult.m256d_f64[3] < 0);
+		return _mm256_movemask_pd(cmpResult) == 0xF;
 	}
 
 	MINT_INLINE bool AffineVec<double>::operator!=(const AffineVec& rhs) const noexcept
 	{
-		const __m256d cmpResult = _mm256_cmp_pd(_raw, rhs._raw, _CMP_EQ_OQ);
-		return (cmpResult.m256d_f64[0] == 0) || (cmpResult.m256d_f64[1] == 0) || (cmpResult.m256d_f64[2] == 0) || (cmpResult.m256d_f64[3] == 0);
+		return !(*this == rhs);
 	}
 
 	MINT_INLINE AffineVec<double>& AffineVec<double>::operator+() noexcept
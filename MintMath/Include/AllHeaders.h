@@ -6,6 +6,7 @@
 
 
 #include <MintMath/Include/MathCommon.h>
+#include <MintMath/Include/FastMath.h>
 
 #include <MintMath/Include/Float2.h>
 #include <MintMath/Include/Float2x2.h>
@@ -24,6 +25,10 @@
 
 #include <MintMath/Include/Easing.h>
 #include <MintMath/Include/Geometry.h>
+#include <MintMath/Include/FloatStream.h>
+#include <MintMath/Include/RectStream.h>
+#include <MintMath/Include/SpaceFillingCurve.h>
+#include <MintMath/Include/FixedPoint.h>
 
 
 #endif // !_MINT_MATH_ALL_HEADERS_H_
@@ -0,0 +1,83 @@
+﻿#pragma once
+
+
+#ifndef _MINT_MATH_FAST_MATH_H_
+#define _MINT_MATH_FAST_MATH_H_
+
+
+#include <MintMath/Include/MathCommon.h>
+
+#include <immintrin.h>
+
+
+namespace mint
+{
+	namespace Math
+	{
+		// libm (::sin, ::exp 등) 대신 쓸 수 있는 다항식 근사 함수들
+		// 모든 함수가 float 하나 / __m128 (4 개) / __m256 (8 개, AVX2 로 빌드할 때만) 버전을 가지며 같은 식으로 계산한다.
+		//
+		// 최대 오차 (double 로 계산한 libm 결과와 비교한 측정값)
+		// Log 와 RSqrt 는 모든 정규화 수를, 나머지는 입력 범위를 촘촘히 훑어서 잰 최댓값이다. (SSE / FMA 빌드 모두)
+		// | 함수                 | Precision::Low   | Precision::High  | 입력 범위
+		// | Sin, Cos, SinCos     | 절대 1.6e-4      | 절대 9.3e-8      | |x| <= 1000 (|x| 가 클수록 범위 축소 오차가 커진다)
+		// | Atan2                | 절대 5.0e-3 rad  | 절대 2.0e-6 rad  | 모든 유한한 값 (Atan2(0, 0) == 0)
+		// | Exp                  | 상대 7.5e-5      | 상대 1.2e-7      | -87 <= x <= 88 (밖은 경계 값으로 자른다)
+		// | Log                  | 4.0e-6           | 1.3e-7           | 0 보다 큰 정규화 수 (0, 음수, 비정규화 수는 정의하지 않는다), 오차 / max(1, |log x|)
+		// | RSqrt                | 상대 3.7e-4      | 상대 2.9e-7      | 0 보다 큰 정규화 수 (Low 는 CPU 의 rsqrt 명령어 사양)
+		namespace Fast
+		{
+			enum class Precision : uint8
+			{
+				Low,	// 가장 빠르다. 화면에 그릴 좌표처럼 오차가 눈에 띄지 않는 곳에 쓴다.
+				High,	// float 정밀도에 가깝다. libm 대신 그대로 쓸 수 있다.
+			};
+
+
+			template<Precision kPrecision = Precision::High>
+			void SinCos(const float x, float& outSin, float& outCos) noexcept;
+			template<Precision kPrecision = Precision::High>
+			float Sin(const float x) noexcept;
+			template<Precision kPrecision = Precision::High>
+			float Cos(const float x) noexcept;
+			template<Precision kPrecision = Precision::High>
+			float Atan2(const float y, const float x) noexcept;
+			template<Precision kPrecision = Precision::High>
+			float Exp(const float x) noexcept;
+			template<Precision kPrecision = Precision::High>
+			float Log(const float x) noexcept;
+			template<Precision kPrecision = Precision::High>
+			float RSqrt(const float x) noexcept;
+
+			template<Precision kPrecision = Precision::High>
+			void SinCos(const __m128 x, __m128& outSin, __m128& outCos) noexcept;
+			template<Precision kPrecision = Precision::High>
+			__m128 Atan2(const __m128 y, const __m128 x) noexcept;
+			template<Precision kPrecision = Precision::High>
+			__m128 Exp(const __m128 x) noexcept;
+			template<Precision kPrecision = Precision::High>
+			__m128 Log(const __m128 x) noexcept;
+			template<Precision kPrecision = Precision::High>
+			__m128 RSqrt(const __m128 x) noexcept;
+
+#if defined __AVX2__
+			template<Precision kPrecision = Precision::High>
+			void SinCos(const __m256 x, __m256& outSin, __m256& outCos) noexcept;
+			template<Precision kPrecision = Precision::High>
+			__m256 Atan2(const __m256 y, const __m256 x) noexcept;
+			template<Precision kPrecision = Precision::High>
+			__m256 Exp(const __m256 x) noexcept;
+			template<Precision kPrecision = Precision::High>
+			__m256 Log(const __m256 x) noexcept;
+			template<Precision kPrecision = Precision::High>
+			__m256 RSqrt(const __m256 x) noexcept;
+#endif
+		}
+	}
+}
+
+
+#include <MintMath/Include/FastMath.inl>
+
+
+#endif // !_MINT_MATH_FAST_MATH_H_
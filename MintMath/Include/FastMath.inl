@@ -0,0 +1,393 @@
+﻿#pragma once
+
+
+#include <cstring>
+
+
+namespace mint
+{
+	namespace Math
+	{
+		namespace Fast
+		{
+			// 같은 근사식을 float / __m128 / __m256 에 쓰기 위한 연산 묶음
+			namespace Lane
+			{
+				struct Scalar
+				{
+					using Type = float;
+					using IntType = int32;
+					using MaskType = bool;
+
+					static MINT_INLINE Type Set(const float value) noexcept { return value; }
+					static MINT_INLINE Type Add(const Type lhs, const Type rhs) noexcept { return lhs + rhs; }
+					static MINT_INLINE Type Sub(const Type lhs, const Type rhs) noexcept { return lhs - rhs; }
+					static MINT_INLINE Type Mul(const Type lhs, const Type rhs) noexcept { return lhs * rhs; }
+					static MINT_INLINE Type Div(const Type lhs, const Type rhs) noexcept { return lhs / rhs; }
+					static MINT_INLINE Type Min(const Type lhs, const Type rhs) noexcept { return (lhs < rhs) ? lhs : rhs; }
+					static MINT_INLINE Type Max(const Type lhs, const Type rhs) noexcept { return (lhs < rhs) ? rhs : lhs; }
+					static MINT_INLINE Type Abs(const Type value) noexcept { return (value < 0.0f) ? -value : value; }
+					static MINT_INLINE MaskType Less(const Type lhs, const Type rhs) noexcept { return lhs < rhs; }
+					static MINT_INLINE Type Select(const MaskType mask, const Type ifTrue, const Type ifFalse) noexcept { return mask ? ifTrue : ifFalse; }
+					static MINT_INLINE IntType RoundToInt(const Type value) noexcept { return static_cast<int32>((value < 0.0f) ? value - 0.5f : value + 0.5f); }
+					static MINT_INLINE Type ToFloat(const IntType value) noexcept { return static_cast<float>(value); }
+					static MINT_INLINE IntType AddInt(const IntType lhs, const int32 rhs) noexcept { return lhs + rhs; }
+					static MINT_INLINE MaskType IsBitSet(const IntType value, const int32 bit) noexcept { return (value & bit) != 0; }
+					// 2^n
+					static MINT_INLINE Type Pow2(const IntType n) noexcept
+					{
+						const uint32 bits = static_cast<uint32>(n + 127) << 23;
+						float result;
+						::memcpy(&result, &bits, sizeof(float));
+						return result;
+					}
+					// value = mantissa * 2^outExponent (1 <= mantissa < 2)
+					static MINT_INLINE Type SplitExponent(const Type value, Type& outExponent) noexcept
+					{
+						uint32 bits;
+						::memcpy(&bits, &value, sizeof(float));
+						outExponent = static_cast<float>(static_cast<int32>(bits >> 23) - 127);
+						bits = (bits & 0x007FFFFF) | 0x3F800000;
+						float mantissa;
+						::memcpy(&mantissa, &bits, sizeof(float));
+						return mantissa;
+					}
+					static MINT_INLINE Type RSqrtEstimate(const Type value) noexcept { return _mm_cvtss_f32(_mm_rsqrt_ss(_mm_set_ss(value))); }
+				};
+
+				struct SSE
+				{
+					using Type = __m128;
+					using IntType = __m128i;
+					using MaskType = __m128;
+
+					static MINT_INLINE Type Set(const float value) noexcept { return _mm_set1_ps(value); }
+					static MINT_INLINE Type Add(const Type lhs, const Type rhs) noexcept { return _mm_add_ps(lhs, rhs); }
+					static MINT_INLINE Type Sub(const Type lhs, const Type rhs) noexcept { return _mm_sub_ps(lhs, rhs); }
+					static MINT_INLINE Type Mul(const Type lhs, const Type rhs) noexcept { return _mm_mul_ps(lhs, rhs); }
+					static MINT_INLINE Type Div(const Type lhs, const Type rhs) noexcept { return _mm_div_ps(lhs, rhs); }
+					static MINT_INLINE Type Min(const Type lhs, const Type rhs) noexcept { return _mm_min_ps(lhs, rhs); }
+					static MINT_INLINE Type Max(const Type lhs, const Type rhs) noexcept { return _mm_max_ps(lhs, rhs); }
+					static MINT_INLINE Type Abs(const Type value) noexcept { return _mm_andnot_ps(_mm_set1_ps(-0.0f), value); }
+					static MINT_INLINE MaskType Less(const Type lhs, const Type rhs) noexcept { return _mm_cmplt_ps(lhs, rhs); }
+					static MINT_INLINE Type Select(const MaskType mask, const Type ifTrue, const Type ifFalse) noexcept { return _mm_or_ps(_mm_and_ps(mask, ifTrue), _mm_andnot_ps(mask, ifFalse)); }
+					static MINT_INLINE IntType RoundToInt(const Type value) noexcept { return _mm_cvtps_epi32(value); }
+					static MINT_INLINE Type ToFloat(const IntType value) noexcept { return _mm_cvtepi32_ps(value); }
+					static MINT_INLINE IntType AddInt(const IntType lhs, const int32 rhs) noexcept { return _mm_add_epi32(lhs, _mm_set1_epi32(rhs)); }
+					static MINT_INLINE MaskType IsBitSet(const IntType value, const int32 bit) noexcept
+					{
+						const __m128i bitMask = _mm_set1_epi32(bit);
+						return _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(value, bitMask), bitMask));
+					}
+					static MINT_INLINE Type Pow2(const IntType n) noexcept { return _mm_castsi128_ps(_mm_slli_epi32(_mm_add_epi32(n, _mm_set1_epi32(127)), 23)); }
+					static MINT_INLINE Type SplitExponent(const Type value, Type& outExponent) noexcept
+					{
+						const __m128i bits = _mm_castps_si128(value);
+						outExponent = _mm_cvtepi32_ps(_mm_sub_epi32(_mm_srli_epi32(bits, 23), _mm_set1_epi32(127)));
+						return _mm_castsi128_ps(_mm_or_si128(_mm_and_si128(bits, _mm_set1_epi32(0x007FFFFF)), _mm_set1_epi32(0x3F800000)));
+					}
+					static MINT_INLINE Type RSqrtEstimate(const Type value) noexcept { return _mm_rsqrt_ps(value); }
+				};
+
+#if defined __AVX2__
+				struct AVX2
+				{
+					using Type = __m256;
+					using IntType = __m256i;
+					using MaskType = __m256;
+
+					static MINT_INLINE Type Set(const float value) noexcept { return _mm256_set1_ps(value); }
+					static MINT_INLINE Type Add(const Type lhs, const Type rhs) noexcept { return _mm256_add_ps(lhs, rhs); }
+					static MINT_INLINE Type Sub(const Type lhs, const Type rhs) noexcept { return _mm256_sub_ps(lhs, rhs); }
+					static MINT_INLINE Type Mul(const Type lhs, const Type rhs) noexcept { return _mm256_mul_ps(lhs, rhs); }
+					static MINT_INLINE Type Div(const Type lhs, const Type rhs) noexcept { return _mm256_div_ps(lhs, rhs); }
+					static MINT_INLINE Type Min(const Type lhs, const Type rhs) noexcept { return _mm256_min_ps(lhs, rhs); }
+					static MINT_INLINE Type Max(const Type lhs, const Type rhs) noexcept { return _mm256_max_ps(lhs, rhs); }
+					static MINT_INLINE Type Abs(const Type value) noexcept { return _mm256_andnot_ps(_mm256_set1_ps(-0.0f), value); }
+					static MINT_INLINE MaskType Less(const Type lhs, const Type rhs) noexcept { return _mm256_cmp_ps(lhs, rhs, _CMP_LT_OQ); }
+					static MINT_INLINE Type Select(const MaskType mask, const Type ifTrue, const Type ifFalse) noexcept { return _mm256_blendv_ps(ifFalse, ifTrue, mask); }
+					static MINT_INLINE IntType RoundToInt(const Type value) noexcept { return _mm256_cvtps_epi32(value); }
+					static MINT_INLINE Type ToFloat(const IntType value) noexcept { return _mm256_cvtepi32_ps(value); }
+					static MINT_INLINE IntType AddInt(const IntType lhs, const int32 rhs) noexcept { return _mm256_add_epi32(lhs, _mm256_set1_epi32(rhs)); }
+					static MINT_INLINE MaskType IsBitSet(const IntType value, const int32 bit) noexcept
+					{
+						const __m256i bitMask = _mm256_set1_epi32(bit);
+						return _mm256_castsi256_ps(_mm256_cmpeq_epi32(_mm256_and_si256(value, bitMask), bitMask));
+					}
+					static MINT_INLINE Type Pow2(const IntType n) noexcept { return _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_add_epi32(n, _mm256_set1_epi32(127)), 23)); }
+					static MINT_INLINE Type SplitExponent(const Type value, Type& outExponent) noexcept
+					{
+						const __m256i bits = _mm256_castps_si256(value);
+						outExponent = _mm256_cvtepi32_ps(_mm256_sub_epi32(_mm256_srli_epi32(bits, 23), _mm256_set1_epi32(127)));
+						return _mm256_castsi256_ps(_mm256_or_si256(_mm256_and_si256(bits, _mm256_set1_epi32(0x007FFFFF)), _mm256_set1_epi32(0x3F800000)));
+					}
+					static MINT_INLINE Type RSqrtEstimate(const Type value) noexcept { return _mm256_rsqrt_ps(value); }
+				};
+#endif
+			}
+
+
+			// 근사식 (L 은 Lane 의 struct)
+			// 계수는 각 구간에서 최대 오차가 가장 작도록 (minimax) 맞춘 값이고, High 는 Cephes 의 계수를 쓴다.
+			template<typename L, Precision kPrecision>
+			MINT_INLINE void SinCosImpl(const typename L::Type x, typename L::Type& outSin, typename L::Type& outCos) noexcept
+			{
+				using Type = typename L::Type;
+
+				// x = q * (pi / 2) + r (|r| <= pi / 4)
+				// pi / 2 를 세 부분으로 나눠서 (Cody-Waite) 빼므로, 첫 두 부분과 q 의 곱은 |q| < 2^16 이면 정확하다.
+				const typename L::IntType q = L::RoundToInt(L::Mul(x, L::Set(0.63661977236f)));
+				const Type qFloat = L::ToFloat(q);
+				Type r = L::Sub(x, L::Mul(qFloat, L::Set(1.5703125f)));
+				r = L::Sub(r, L::Mul(qFloat, L::Set(4.837512969970703125e-4f)));
+				r = L::Sub(r, L::Mul(qFloat, L::Set(7.54978995489188216e-8f)));
+				const Type r2 = L::Mul(r, r);
+
+				Type sinR;
+				Type cosR;
+				if constexpr (kPrecision == Precision::High)
+				{
+					sinR = L::Add(r, L::Mul(L::Mul(r, r2), L::Add(L::Set(-1.6666654611e-1f), L::Mul(r2, L::Add(L::Set(8.3321608736e-3f), L::Mul(r2, L::Set(-1.9515295891e-4f)))))));
+					cosR = L::Add(L::Sub(L::Set(1.0f), L::Mul(r2, L::Set(0.5f))),
+						L::Mul(L::Mul(r2, r2), L::Add(L::Set(4.166664568298827e-2f), L::Mul(r2, L::Add(L::Set(-1.388731625493765e-3f), L::Mul(r2, L::Set(2.443315711809948e-5f)))))));
+				}
+				else
+				{
+					sinR = L::Mul(r, L::Add(L::Set(0.99903142f), L::Mul(r2, L::Set(-0.16034402f))));
+					cosR = L::Add(L::Set(0.99999003f), L::Mul(r2, L::Add(L::Set(-0.49970814f), L::Mul(r2, L::Set(0.040398536f)))));
+				}
+
+				// 사분면에 따라 sin 과 cos 를 바꾸고 부호를 정한다.
+				const typename L::MaskType swap = L::IsBitSet(q, 1);
+				const Type sinValue = L::Select(swap, cosR, sinR);
+				const Type cosValue = L::Select(swap, sinR, cosR);
+				const Type zero = L::Set(0.0f);
+				outSin = L::Select(L::IsBitSet(q, 2), L::Sub(zero, sinValue), sinValue);
+				outCos = L::Select(L::IsBitSet(L::AddInt(q, 1), 2), L::Sub(zero, cosValue), cosValue);
+			}
+
+			template<typename L, Precision kPrecision>
+			MINT_INLINE typename L::Type Atan2Impl(const typename L::Type y, const typename L::Type x) noexcept
+			{
+				using Type = typename L::Type;
+
+				// atan(a) (0 <= a <= 1) 로 줄인 뒤 사분면을 되돌린다.
+				const Type absX = L::Abs(x);
+				const Type absY = L::Abs(y);
+				const Type a = L::Div(L::Min(absX, absY), L::Max(L::Max(absX, absY), L::Set(1.0e-30f)));
+				const Type s = L::Mul(a, a);
+				Type result;
+				if constexpr (kPrecision == Precision::High)
+				{
+					result = L::Add(L::Set(0.052647346f), L::Mul(s, L::Set(-0.011719133f)));
+					result = L::Add(L::Set(-0.11642648f), L::Mul(s, result));
+					result = L::Add(L::Set(0.19354038f), L::Mul(s, result));
+					result = L::Add(L::Set(-0.33262283f), L::Mul(s, result));
+					result = L::Mul(a, L::Add(L::Set(0.99997722f), L::Mul(s, result)));
+				}
+				else
+				{
+					result = L::Mul(a, L::Add(L::Set(0.97239410f), L::Mul(s, L::Set(-0.19194793f))));
+				}
+
+				result = L::Select(L::Less(absX, absY), L::Sub(L::Set(kPiOverTwo), result), result);
+				result = L::Select(L::Less(x, L::Set(0.0f)), L::Sub(L::Set(kPi), result), result);
+				return L::Select(L::Less(y, L::Set(0.0f)), L::Sub(L::Set(0.0f), result), result);
+			}
+
+			template<typename L, Precision kPrecision>
+			MINT_INLINE typename L::Type ExpImpl(const typename L::Type x) noexcept
+			{
+				using Type = typename L::Type;
+
+				// exp(x) = 2^n * exp(f) (n = round(x / ln2), |f| <= ln2 / 2)
+				const Type clampedX = L::Min(L::Max(x, L::Set(-87.0f)), L::Set(88.0f));
+				const typename L::IntType n = L::RoundToInt(L::Mul(clampedX, L::Set(1.44269504088896341f)));
+				const Type nFloat = L::ToFloat(n);
+				const Type f = L::Sub(L::Sub(clampedX, L::Mul(nFloat, L::Set(0.693359375f))), L::Mul(nFloat, L::Set(-2.12194440e-4f)));
+				Type expF;
+				if constexpr (kPrecision == Precision::High)
+				{
+					Type p = L::Add(L::Set(1.3981999507e-3f), L::Mul(f, L::Set(1.9875691500e-4f)));
+					p = L::Add(L::Set(8.3334519073e-3f), L::Mul(f, p));
+					p = L::Add(L::Set(4.1665795894e-2f), L::Mul(f, p));
+					p = L::Add(L::Set(1.6666665459e-1f), L::Mul(f, p));
+					p = L::Add(L::Set(5.0000001201e-1f), L::Mul(f, p));
+					expF = L::Add(L::Add(L::Set(1.0f), f), L::Mul(L::Mul(f, f), p));
+				}
+				else
+				{
+					Type p = L::Add(L::Set(0.50496326f), L::Mul(f, L::Set(0.16566841f)));
+					p = L::Add(L::Set(1.0001642f), L::Mul(f, p));
+					expF = L::Add(L::Set(0.99992807f), L::Mul(f, p));
+				}
+				return L::Mul(expF, L::Pow2(n));
+			}
+
+			template<typename L, Precision kPrecision>
+			MINT_INLINE typename L::Type LogImpl(const typename L::Type x) noexcept
+			{
+				using Type = typename L::Type;
+
+				// x = m * 2^e (sqrt(1/2) <= m < sqrt(2)), log(m) = 2 * atanh(t) (t = (m - 1) / (m + 1))
+				Type e;
+				Type m = L::SplitExponent(x, e);
+				const typename L::MaskType isLarge = L::Less(L::Set(1.41421356f), m);
+				m = L::Select(isLarge, L::Mul(m, L::Set(0.5f)), m);
+				e = L::Select(isLarge, L::Add(e, L::Set(1.0f)), e);
+
+				const Type t = L::Div(L::Sub(m, L::Set(1.0f)), L::Add(m, L::Set(1.0f)));
+				const Type t2 = L::Mul(t, t);
+				Type logM;
+				if constexpr (kPrecision == Precision::High)
+				{
+					Type p = L::Add(L::Set(1.0f / 7.0f), L::Mul(t2, L::Set(1.0f / 9.0f)));
+					p = L::Add(L::Set(1.0f / 5.0f), L::Mul(t2, p));
+					p = L::Add(L::Set(1.0f / 3.0f), L::Mul(t2, p));
+					logM = L::Mul(L::Mul(L::Set(2.0f), t), L::Add(L::Set(1.0f), L::Mul(t2, p)));
+				}
+				else
+				{
+					logM = L::Mul(t, L::Add(L::Set(1.9998880f), L::Mul(t2, L::Set(0.68173417f))));
+				}
+				return L::Add(L::Mul(e, L::Set(0.693359375f)), L::Add(logM, L::Mul(e, L::Set(-2.12194440e-4f))));
+			}
+
+			template<typename L, Precision kPrecision>
+			MINT_INLINE typename L::Type RSqrtImpl(const typename L::Type x) noexcept
+			{
+				using Type = typename L::Type;
+
+				const Type estimate = L::RSqrtEstimate(x);
+				if constexpr (kPrecision == Precision::High)
+				{
+					// Newton-Raphson 한 번: y' = y * (1.5 - 0.5 * x * y^2)
+					return L::Mul(estimate, L::Sub(L::Set(1.5f), L::Mul(L::Mul(L::Set(0.5f), x), L::Mul(estimate, estimate))));
+				}
+				else
+				{
+					return estimate;
+				}
+			}
+
+
+#pragma region Scalar
+			template<Precision kPrecision>
+			MINT_INLINE void SinCos(const float x, float& outSin, float& outCos) noexcept
+			{
+				SinCosImpl<Lane::Scalar, kPrecision>(x, outSin, outCos);
+			}
+
+			template<Precision kPrecision>
+			MINT_INLINE float Sin(const float x) noexcept
+			{
+				float sinValue;
+				float cosValue;
+				SinCosImpl<Lane::Scalar, kPrecision>(x, sinValue, cosValue);
+				return sinValue;
+			}
+
+			template<Precision kPrecision>
+			MINT_INLINE float Cos(const float x) noexcept
+			{
+				float sinValue;
+				float cosValue;
+				SinCosImpl<Lane::Scalar, kPrecision>(x, sinValue, cosValue);
+				return cosValue;
+			}
+
+			template<Precision kPrecision>
+			MINT_INLINE float Atan2(const float y, const float x) noexcept
+			{
+				return Atan2Impl<Lane::Scalar, kPrecision>(y, x);
+			}
+
+			template<Precision kPrecision>
+			MINT_INLINE float Exp(const float x) noexcept
+			{
+				return ExpImpl<Lane::Scalar, kPrecision>(x);
+			}
+
+			template<Precision kPrecision>
+			MINT_INLINE float Log(const float x) noexcept
+			{
+				return LogImpl<Lane::Scalar, kPrecision>(x);
+			}
+
+			template<Precision kPrecision>
+			MINT_INLINE float RSqrt(const float x) noexcept
+			{
+				return RSqrtImpl<Lane::Scalar, kPrecision>(x);
+			}
+#pragma endregion
+
+
+#pragma region SSE
+			template<Precision kPrecision>
+			MINT_INLINE void SinCos(const __m128 x, __m128& outSin, __m128& outCos) noexcept
+			{
+				SinCosImpl<Lane::SSE, kPrecision>(x, outSin, outCos);
+			}
+
+			template<Precision kPrecision>
+			MINT_INLINE __m128 Atan2(const __m128 y, const __m128 x) noexcept
+			{
+				return Atan2Impl<Lane::SSE, kPrecision>(y, x);
+			}
+
+			template<Precision kPrecision>
+			MINT_INLINE __m128 Exp(const __m128 x) noexcept
+			{
+				return ExpImpl<Lane::SSE, kPrecision>(x);
+			}
+
+			template<Precision kPrecision>
+			MINT_INLINE __m128 Log(const __m128 x) noexcept
+			{
+				return LogImpl<Lane::SSE, kPrecision>(x);
+			}
+
+			template<Precision kPrecision>
+			MINT_INLINE __m128 RSqrt(const __m128 x) noexcept
+			{
+				return RSqrtImpl<Lane::SSE, kPrecision>(x);
+			}
+#pragma endregion
+
+
+#if defined __AVX2__
+#pragma region AVX2
+			template<Precision kPrecision>
+			MINT_INLINE void SinCos(const __m256 x, __m256& outSin, __m256& outCos) noexcept
+			{
+				SinCosImpl<Lane::AVX2, kPrecision>(x, outSin, outCos);
+			}
+
+			template<Precision kPrecision>
+			MINT_INLINE __m256 Atan2(const __m256 y, const __m256 x) noexcept
+			{
+				return Atan2Impl<Lane::AVX2, kPrecision>(y, x);
+			}
+
+			template<Precision kPrecision>
+			MINT_INLINE __m256 Exp(const __m256 x) noexcept
+			{
+				return ExpImpl<Lane::AVX2, kPrecision>(x);
+			}
+
+			template<Precision kPrecision>
+			MINT_INLINE __m256 Log(const __m256 x) noexcept
+			{
+				return LogImpl<Lane::AVX2, kPrecision>(x);
+			}
+
+			template<Precision kPrecision>
+			MINT_INLINE __m256 RSqrt(const __m256 x) noexcept
+			{
+				return RSqrtImpl<Lane::AVX2, kPrecision>(x);
+			}
+#pragma endregion
+#endif
+		}
+	}
+}
@@ -0,0 +1,177 @@
+﻿#pragma once
+
+
+#ifndef _MINT_MATH_FIXED_POINT_H_
+#define _MINT_MATH_FIXED_POINT_H_
+
+
+#include <type_traits>
+
+#include <MintCommon/Include/CommonDefinitions.h>
+
+#include <MintMath/Include/MathCommon.h>
+#include <MintMath/Include/Float2.h>
+
+
+namespace mint
+{
+	// 고정 소수점 수. 정수 연산만으로 계산하므로 컴파일러, 최적화 옵션, CPU 가 달라도 결과가 bit 단위로 같다. (lockstep 시뮬레이션, replay 용)
+	// - RawT 의 아래 kFractionBitCount bit 가 소수 부분이다.
+	// - 덧셈, 뺄셈, 곱셈은 범위를 넘으면 정수처럼 wrap 된다. 나눗셈은 범위를 넘거나 0 으로 나누면 양 끝 값으로 자른다.
+	// - 곱셈과 나눗셈은 가장 가까운 값으로 반올림한다.
+	// - float 에서 바꾸는 것도 결정적이지만 같은 float 값이 들어와야 같은 결과가 나온다. 시뮬레이션 도중에는 float 를 거치지 않아야 한다.
+	template<typename RawT, uint32 kFractionBitCountT>
+	class Fixed final
+	{
+		static_assert(sizeof(RawT) == 4 || sizeof(RawT) == 8, "32 bit 나 64 bit 정수만 쓸 수 있다.");
+		static_assert(0 < kFractionBitCountT && kFractionBitCountT < sizeof(RawT) * 8 - 1);
+		static_assert(kFractionBitCountT % 2 == 0, "Sqrt 는 소수 bit 수가 짝수여야 한다.");
+
+	public:
+		using RawType = RawT;
+		static constexpr uint32 kFractionBitCount = kFractionBitCountT;
+		static constexpr RawT kOneRaw = static_cast<RawT>(static_cast<RawT>(1) << kFractionBitCount);
+		static constexpr RawT kMaxRaw = (sizeof(RawT) == 4) ? static_cast<RawT>(kInt32Max) : static_cast<RawT>(kInt64Max);
+		static constexpr RawT kMinRaw = (sizeof(RawT) == 4) ? static_cast<RawT>(kInt32Min) : static_cast<RawT>(kInt64Min);
+
+	public:
+		static constexpr Fixed FromRaw(const RawT raw) noexcept;
+
+	public:
+		constexpr Fixed() noexcept;
+		// 정수 부분의 범위를 넘는 값 (Fixed32 는 |value| >= 32768) 은 덧셈처럼 wrap 된다.
+		constexpr explicit Fixed(const int32 value) noexcept;
+		explicit Fixed(const float value) noexcept;
+		explicit Fixed(const double value) noexcept;
+		constexpr Fixed(const Fixed& rhs) = default;
+		constexpr Fixed(Fixed&& rhs) noexcept = default;
+		~Fixed() = default;
+
+	public:
+		Fixed& operator=(const Fixed& rhs) = default;
+		Fixed& operator=(Fixed&& rhs) noexcept = default;
+
+	public:
+		Fixed& operator+=(const Fixed& rhs) noexcept;
+		Fixed& operator-=(const Fixed& rhs) noexcept;
+		Fixed& operator*=(const Fixed& rhs) noexcept;
+		Fixed& operator/=(const Fixed& rhs) noexcept;
+
+	public:
+		constexpr Fixed operator+() const noexcept;
+		constexpr Fixed operator-() const noexcept;
+
+	public:
+		constexpr Fixed operator+(const Fixed& rhs) const noexcept;
+		constexpr Fixed operator-(const Fixed& rhs) const noexcept;
+		Fixed operator*(const Fixed& rhs) const noexcept;
+		Fixed operator/(const Fixed& rhs) const noexcept;
+
+	public:
+		constexpr bool operator==(const Fixed& rhs) const noexcept;
+		constexpr bool operator!=(const Fixed& rhs) const noexcept;
+		constexpr bool operator<(const Fixed& rhs) const noexcept;
+		constexpr bool operator<=(const Fixed& rhs) const noexcept;
+		constexpr bool operator>(const Fixed& rhs) const noexcept;
+		constexpr bool operator>=(const Fixed& rhs) const noexcept;
+
+	public:
+		constexpr RawT GetRaw() const noexcept { return _raw; }
+		// 소수 부분을 버린다. (-inf 쪽)
+		constexpr int32 ToInt() const noexcept;
+		float ToFloat() const noexcept;
+		double ToDouble() const noexcept;
+
+	private:
+		RawT _raw;
+	};
+
+	using Fixed32 = Fixed<int32, 16>;	// Q16.16: [-32768, 32768), 해상도 1.5e-5
+	using Fixed64 = Fixed<int64, 32>;	// Q32.32: [-2147483648, 2147483648), 해상도 2.3e-10
+
+
+	// Float2 와 같은 쓰임새의 고정 소수점 2D 벡터
+	template<typename FixedT>
+	class FixedVec2 final
+	{
+	public:
+		using ScalarType = FixedT;
+
+	public:
+		constexpr FixedVec2() noexcept = default;
+		constexpr explicit FixedVec2(const FixedT& x, const FixedT& y) noexcept;
+		explicit FixedVec2(const Float2& rhs) noexcept;
+		constexpr FixedVec2(const FixedVec2& rhs) = default;
+		constexpr FixedVec2(FixedVec2&& rhs) noexcept = default;
+		~FixedVec2() = default;
+
+	public:
+		FixedVec2& operator=(const FixedVec2& rhs) = default;
+		FixedVec2& operator=(FixedVec2&& rhs) noexcept = default;
+
+	public:
+		FixedVec2& operator+=(const FixedVec2& rhs) noexcept;
+		FixedVec2& operator-=(const FixedVec2& rhs) noexcept;
+		FixedVec2& operator*=(const FixedT& scalar) noexcept;
+		FixedVec2& operator/=(const FixedT& scalar) noexcept;
+
+	public:
+		constexpr FixedVec2 operator-() const noexcept;
+
+	public:
+		constexpr FixedVec2 operator+(const FixedVec2& rhs) const noexcept;
+		constexpr FixedVec2 operator-(const FixedVec2& rhs) const noexcept;
+		FixedVec2 operator*(const FixedT& scalar) const noexcept;
+		FixedVec2 operator/(const FixedT& scalar) const noexcept;
+
+	public:
+		constexpr bool operator==(const FixedVec2& rhs) const noexcept;
+		constexpr bool operator!=(const FixedVec2& rhs) const noexcept;
+
+	public:
+		FixedT Dot(const FixedVec2& rhs) const noexcept;
+		// z 성분 (this x rhs)
+		FixedT Cross(const FixedVec2& rhs) const noexcept;
+		FixedT LengthSqaure() const noexcept;
+		FixedT Length() const noexcept;
+		// 길이가 0 이면 그대로 둔다.
+		void Normalize() noexcept;
+
+	public:
+		void Set(const FixedT& x, const FixedT& y) noexcept;
+		void SetZero() noexcept;
+		constexpr bool IsZero() const noexcept;
+		Float2 ToFloat2() const noexcept;
+
+	public:
+		FixedT _x;
+		FixedT _y;
+	};
+
+	using Fixed32Vec2 = FixedVec2<Fixed32>;
+	using Fixed64Vec2 = FixedVec2<Fixed64>;
+
+
+	namespace Math
+	{
+		// 음수는 0 을 반환한다. 결과는 내림한다.
+		template<typename RawT, uint32 kFractionBitCount>
+		Fixed<RawT, kFractionBitCount> Sqrt(const Fixed<RawT, kFractionBitCount>& x) noexcept;
+		template<typename RawT, uint32 kFractionBitCount>
+		Fixed<RawT, kFractionBitCount> Abs(const Fixed<RawT, kFractionBitCount>& x) noexcept;
+
+		// 1/4 주기 sin 표 (257 개) 와 정수 연산만으로 계산한다. 최대 오차 4e-9 (Fixed32 는 해상도 이하)
+		template<typename RawT, uint32 kFractionBitCount>
+		void SinCos(const Fixed<RawT, kFractionBitCount>& angle, Fixed<RawT, kFractionBitCount>& outSin, Fixed<RawT, kFractionBitCount>& outCos) noexcept;
+		template<typename RawT, uint32 kFractionBitCount>
+		Fixed<RawT, kFractionBitCount> Sin(const Fixed<RawT, kFractionBitCount>& angle) noexcept;
+		template<typename RawT, uint32 kFractionBitCount>
+		Fixed<RawT, kFractionBitCount> Cos(const Fixed<RawT, kFractionBitCount>& angle) noexcept;
+	}
+}
+
+
+#include <MintMath/Include/FixedPoint.inl>
+
+
+#endif // !_MINT_MATH_FIXED_POINT_H_
@@ -0,0 +1,550 @@
+﻿#pragma once
+
+
+#if defined _MSC_VER
+#include <intrin.h>
+#endif
+
+
+namespace mint
+{
+	namespace Math
+	{
+		namespace FixedPointInternal
+		{
+			struct Int128
+			{
+				uint64 _low;
+				int64 _high;
+			};
+
+			MINT_INLINE Int128 Multiply128(const int64 lhs, const int64 rhs) noexcept
+			{
+#if defined __SIZEOF_INT128__
+				const __int128 product = static_cast<__int128>(lhs) * rhs;
+				return Int128{ static_cast<uint64>(product), static_cast<int64>(product >> 64) };
+#elif defined _M_X64
+				int64 high = 0;
+				const int64 low = _mul128(lhs, rhs, &high);
+				return Int128{ static_cast<uint64>(low), high };
+#else
+				const uint64 a = static_cast<uint64>(lhs);
+				const uint64 b = static_cast<uint64>(rhs);
+				const uint64 aLow = a & 0xFFFFFFFF;
+				const uint64 aHigh = a >> 32;
+				const uint64 bLow = b & 0xFFFFFFFF;
+				const uint64 bHigh = b >> 32;
+				const uint64 lowLow = aLow * bLow;
+				const uint64 highLow = aHigh * bLow;
+				const uint64 lowHigh = aLow * bHigh;
+				const uint64 middle = (lowLow >> 32) + (highLow & 0xFFFFFFFF) + (lowHigh & 0xFFFFFFFF);
+				uint64 high = aHigh * bHigh + (highLow >> 32) + (lowHigh >> 32) + (middle >> 32);
+				// 부호 없는 곱에서 부호 있는 곱으로
+				high -= (lhs < 0) ? b : 0;
+				high -= (rhs < 0) ? a : 0;
+				return Int128{ (middle << 32) | (lowLow & 0xFFFFFFFF), static_cast<int64>(high) };
+#endif
+			}
+
+			MINT_INLINE Int128 Add128(const Int128& lhs, const uint64 rhs) noexcept
+			{
+				const uint64 low = lhs._low + rhs;
+				return Int128{ low, lhs._high + ((low < rhs) ? 1 : 0) };
+			}
+
+			// (value >> kShift) 의 아래 64 bit
+			template<uint32 kShift>
+			MINT_INLINE int64 ShiftRight128(const Int128& value) noexcept
+			{
+				static_assert(0 < kShift && kShift < 128);
+				if constexpr (kShift < 64)
+				{
+					return static_cast<int64>((value._low >> kShift) | (static_cast<uint64>(value._high) << (64 - kShift)));
+				}
+				else if constexpr (kShift == 64)
+				{
+					return value._high;
+				}
+				else
+				{
+					return value._high >> (kShift - 64);
+				}
+			}
+
+			// (high * 2^64 + low) / divisor. high < divisor 여야 한다.
+			MINT_INLINE uint64 DivideUnsigned128(const uint64 high, const uint64 low, const uint64 divisor) noexcept
+			{
+				MINT_ASSERT(high < divisor, "몫이 64 bit 를 넘습니다!");
+#if defined __SIZEOF_INT128__
+				return static_cast<uint64>(((static_cast<unsigned __int128>(high) << 64) | low) / divisor);
+#elif defined _M_X64 && _MSC_VER >= 1920
+				uint64 remainder = 0;
+				return _udiv128(high, low, divisor, &remainder);
+#else
+				uint64 remainder = high;
+				uint64 quotient = 0;
+				for (int32 i = 63; i >= 0; --i)
+				{
+					const bool carry = (remainder >> 63) != 0;
+					remainder = (remainder << 1) | ((low >> i) & 1);
+					quotient <<= 1;
+					if (carry == true || remainder >= divisor)
+					{
+						remainder -= divisor;
+						quotient |= 1;
+					}
+				}
+				return quotient;
+#endif
+			}
+
+			MINT_INLINE constexpr uint64 AbsToUnsigned(const int64 value) noexcept
+			{
+				return (value < 0) ? (0 - static_cast<uint64>(value)) : static_cast<uint64>(value);
+			}
+
+			// 2^32 == 한 바퀴인 각도. 2^64 / (2 * pi) 를 곱한다.
+			template<uint32 kFractionBitCount>
+			MINT_INLINE uint32 ComputeTurn(const int64 angleRaw) noexcept
+			{
+				static constexpr int64 kTurnPerRadianQ64 = 2935890503282001226;
+				static constexpr uint32 kShift = 32 + kFractionBitCount;
+				static_assert(kShift <= 64);
+				const Int128 product = Add128(Multiply128(angleRaw, kTurnPerRadianQ64), static_cast<uint64>(1) << (kShift - 1));
+				return static_cast<uint32>(ShiftRight128<kShift>(product));
+			}
+
+			// 결과는 Q2.30 (1 == 2^30)
+			void SinCosTurn(const uint32 turn, int32& outSinQ30, int32& outCosQ30) noexcept;
+			// floor(sqrt(value * 2^appendedBitCount)), appendedBitCount 는 64 보다 작은 짝수
+			uint64 SqrtShifted(const uint64 value, const uint32 appendedBitCount) noexcept;
+
+			template<typename FixedT>
+			MINT_INLINE FixedT FromQ30(const int32 valueQ30) noexcept
+			{
+				using RawT = typename FixedT::RawType;
+				static constexpr uint32 kFractionBitCount = FixedT::kFractionBitCount;
+				if constexpr (kFractionBitCount < 30)
+				{
+					static constexpr uint32 kShift = 30 - kFractionBitCount;
+					return FixedT::FromRaw(static_cast<RawT>((valueQ30 + (1 << (kShift - 1))) >> kShift));
+				}
+				else
+				{
+					return FixedT::FromRaw(static_cast<RawT>(static_cast<int64>(valueQ30) * (static_cast<int64>(1) << (kFractionBitCount - 30))));
+				}
+			}
+		}
+	}
+
+
+#pragma region Fixed
+	template<typename RawT, uint32 kFractionBitCountT>
+	MINT_INLINE constexpr Fixed<RawT, kFractionBitCountT> Fixed<RawT, kFractionBitCountT>::FromRaw(const RawT raw) noexcept
+	{
+		Fixed result;
+		result._raw = raw;
+		return result;
+	}
+
+	template<typename RawT, uint32 kFractionBitCountT>
+	MINT_INLINE constexpr Fixed<RawT, kFractionBitCountT>::Fixed() noexcept
+		: _raw{ 0 }
+	{
+		__noop;
+	}
+
+	template<typename RawT, uint32 kFractionBitCountT>
+	MINT_INLINE constexpr Fixed<RawT, kFractionBitCountT>::Fixed(const int32 value) noexcept
+		: _raw{ static_cast<RawT>(static_cast<std::make_unsigned_t<RawT>>(static_cast<RawT>(value)) << kFractionBitCount) }
+	{
+		__noop;
+	}
+
+	template<typename RawT, uint32 kFractionBitCountT>
+	MINT_INLINE Fixed<RawT, kFractionBitCountT>::Fixed(const float value) noexcept
+		: Fixed(static_cast<double>(value))
+	{
+		__noop;
+	}
+
+	template<typename RawT, uint32 kFractionBitCountT>
+	MINT_INLINE Fixed<RawT, kFractionBitCountT>::Fixed(const double value) noexcept
+	{
+		// 2 의 거듭제곱을 곱하는 것은 정확하고, 반올림도 IEEE 754 의 덧셈 한 번이라 어디서나 같다.
+		const double scaled = value * static_cast<double>(kOneRaw);
+		MINT_ASSERT(static_cast<double>(kMinRaw) <= scaled && scaled < static_cast<double>(kMaxRaw), "범위를 벗어났습니다!");
+		_raw = static_cast<RawT>((scaled < 0.0) ? (scaled - 0.5) : (scaled + 0.5));
+	}
+
+	template<typename RawT, uint32 kFractionBitCountT>
+	MINT_INLINE Fixed<RawT, kFractionBitCountT>& Fixed<RawT, kFractionBitCountT>::operator+=(const Fixed& rhs) noexcept
+	{
+		*this = *this + rhs;
+		return *this;
+	}
+
+	template<typename RawT, uint32 kFractionBitCountT>
+	MINT_INLINE Fixed<RawT, kFractionBitCountT>& Fixed<RawT, kFractionBitCountT>::operator-=(const Fixed& rhs) noexcept
+	{
+		*this = *this - rhs;
+		return *this;
+	}
+
+	template<typename RawT, uint32 kFractionBitCountT>
+	MINT_INLINE Fixed<RawT, kFractionBitCountT>& Fixed<RawT, kFractionBitCountT>::operator*=(const Fixed& rhs) noexcept
+	{
+		*this = *this * rhs;
+		return *this;
+	}
+
+	template<typename RawT, uint32 kFractionBitCountT>
+	MINT_INLINE Fixed<RawT, kFractionBitCountT>& Fixed<RawT, kFractionBitCountT>::operator/=(const Fixed& rhs) noexcept
+	{
+		*this = *this / rhs;
+		return *this;
+	}
+
+	template<typename RawT, uint32 kFractionBitCountT>
+	MINT_INLINE constexpr Fixed<RawT, kFractionBitCountT> Fixed<RawT, kFractionBitCountT>::operator+() const noexcept
+	{
+		return *this;
+	}
+
+	template<typename RawT, uint32 kFractionBitCountT>
+	MINT_INLINE constexpr Fixed<RawT, kFractionBitCountT> Fixed<RawT, kFractionBitCountT>::operator-() const noexcept
+	{
+		using UnsignedRawT = std::make_unsigned_t<RawT>;
+		return FromRaw(static_cast<RawT>(0 - static_cast<UnsignedRawT>(_raw)));
+	}
+
+	template<typename RawT, uint32 kFractionBitCountT>
+	MINT_INLINE constexpr Fixed<RawT, kFractionBitCountT> Fixed<RawT, kFractionBitCountT>::operator+(const Fixed& rhs) const noexcept
+	{
+		// 부호 있는 정수의 overflow 는 정의되지 않으므로 부호 없는 정수로 계산한다.
+		using UnsignedRawT = std::make_unsigned_t<RawT>;
+		return FromRaw(static_cast<RawT>(static_cast<UnsignedRawT>(_raw) + static_cast<UnsignedRawT>(rhs._raw)));
+	}
+
+	template<typename RawT, uint32 kFractionBitCountT>
+	MINT_INLINE constexpr Fixed<RawT, kFractionBitCountT> Fixed<RawT, kFractionBitCountT>::operator-(const Fixed& rhs) const noexcept
+	{
+		using UnsignedRawT = std::make_unsigned_t<RawT>;
+		return FromRaw(static_cast<RawT>(static_cast<UnsignedRawT>(_raw) - static_cast<UnsignedRawT>(rhs._raw)));
+	}
+
+	template<typename RawT, uint32 kFractionBitCountT>
+	MINT_INLINE Fixed<RawT, kFractionBitCountT> Fixed<RawT, kFractionBitCountT>::operator*(const Fixed& rhs) const noexcept
+	{
+		static constexpr uint32 kF = kFractionBitCount;
+		if constexpr (sizeof(RawT) == 4)
+		{
+			const int64 product = static_cast<int64>(_raw) * rhs._raw + (static_cast<int64>(1) << (kF - 1));
+			return FromRaw(static_cast<RawT>(product >> kF));
+		}
+		else
+		{
+			const Math::FixedPointInternal::Int128 product = Math::FixedPointInternal::Add128(Math::FixedPointInternal::Multiply128(_raw, rhs._raw), static_cast<uint64>(1) << (kF - 1));
+			return FromRaw(static_cast<RawT>(Math::FixedPointInternal::ShiftRight128<kF>(product)));
+		}
+	}
+
+	template<typename RawT, uint32 kFractionBitCountT>
+	MINT_INLINE Fixed<RawT, kFractionBitCountT> Fixed<RawT, kFractionBitCountT>::operator/(const Fixed& rhs) const noexcept
+	{
+		static constexpr uint32 kF = kFractionBitCount;
+		const bool isNegative = (_raw < 0) != (rhs._raw < 0);
+		if (rhs._raw == 0)
+		{
+			return FromRaw((_raw < 0) ? kMinRaw : kMaxRaw);
+		}
+
+		// 크기끼리 나누고 부호를 붙인다. 0.5 는 0 에서 먼 쪽으로 반올림한다.
+		const uint64 numerator = Math::FixedPointInternal::AbsToUnsigned(_raw);
+		const uint64 denominator = Math::FixedPointInternal::AbsToUnsigned(rhs._raw);
+		uint64 quotient = 0;
+		if constexpr (sizeof(RawT) == 4)
+		{
+			quotient = ((numerator << kF) + (denominator >> 1)) / denominator;
+		}
+		else
+		{
+			uint64 low = numerator << kF;
+			uint64 high = numerator >> (64 - kF);
+			low += (denominator >> 1);
+			high += (low < (denominator >> 1)) ? 1 : 0;
+			if (high >= denominator)
+			{
+				return FromRaw(isNegative ? kMinRaw : kMaxRaw);
+			}
+			quotient = Math::FixedPointInternal::DivideUnsigned128(high, low, denominator);
+		}
+
+		const uint64 limit = static_cast<uint64>(kMaxRaw) + (isNegative ? 1 : 0);
+		if (quotient > limit)
+		{
+			return FromRaw(isNegative ? kMinRaw : kMaxRaw);
+		}
+		return FromRaw(static_cast<RawT>(isNegative ? (0 - quotient) : quotient));
+	}
+
+	template<typename RawT, uint32 kFractionBitCountT>
+	MINT_INLINE constexpr bool Fixed<RawT, kFractionBitCountT>::operator==(const Fixed& rhs) const noexcept
+	{
+		return _raw == rhs._raw;
+	}
+
+	template<typename RawT, uint32 kFractionBitCountT>
+	MINT_INLINE constexpr bool Fixed<RawT, kFractionBitCountT>::operator!=(const Fixed& rhs) const noexcept
+	{
+		return _raw != rhs._raw;
+	}
+
+	template<typename RawT, uint32 kFractionBitCountT>
+	MINT_INLINE constexpr bool Fixed<RawT, kFractionBitCountT>::operator<(const Fixed& rhs) const noexcept
+	{
+		return _raw < rhs._raw;
+	}
+
+	template<typename RawT, uint32 kFractionBitCountT>
+	MINT_INLINE constexpr bool Fixed<RawT, kFractionBitCountT>::operator<=(const Fixed& rhs) const noexcept
+	{
+		return _raw <= rhs._raw;
+	}
+
+	template<typename RawT, uint32 kFractionBitCountT>
+	MINT_INLINE constexpr bool Fixed<RawT, kFractionBitCountT>::operator>(const Fixed& rhs) const noexcept
+	{
+		return _raw > rhs._raw;
+	}
+
+	template<typename RawT, uint32 kFractionBitCountT>
+	MINT_INLINE constexpr bool Fixed<RawT, kFractionBitCountT>::operator>=(const Fixed& rhs) const noexcept
+	{
+		return _raw >= rhs._raw;
+	}
+
+	template<typename RawT, uint32 kFractionBitCountT>
+	MINT_INLINE constexpr int32 Fixed<RawT, kFractionBitCountT>::ToInt() const noexcept
+	{
+		return static_cast<int32>(_raw >> kFractionBitCount);
+	}
+
+	template<typename RawT, uint32 kFractionBitCountT>
+	MINT_INLINE float Fixed<RawT, kFractionBitCountT>::ToFloat() const noexcept
+	{
+		return static_cast<float>(_raw) * (1.0f / static_cast<float>(kOneRaw));
+	}
+
+	template<typename RawT, uint32 kFractionBitCountT>
+	MINT_INLINE double Fixed<RawT, kFractionBitCountT>::ToDouble() const noexcept
+	{
+		return static_cast<double>(_raw) * (1.0 / static_cast<double>(kOneRaw));
+	}
+#pragma endregion
+
+
+#pragma region FixedVec2
+	template<typename FixedT>
+	MINT_INLINE constexpr FixedVec2<FixedT>::FixedVec2(const FixedT& x, const FixedT& y) noexcept
+		: _x{ x }
+		, _y{ y }
+	{
+		__noop;
+	}
+
+	template<typename FixedT>
+	MINT_INLINE FixedVec2<FixedT>::FixedVec2(const Float2& rhs) noexcept
+		: _x{ rhs._x }
+		, _y{ rhs._y }
+	{
+		__noop;
+	}
+
+	template<typename FixedT>
+	MINT_INLINE FixedVec2<FixedT>& FixedVec2<FixedT>::operator+=(const FixedVec2& rhs) noexcept
+	{
+		_x += rhs._x;
+		_y += rhs._y;
+		return *this;
+	}
+
+	template<typename FixedT>
+	MINT_INLINE FixedVec2<FixedT>& FixedVec2<FixedT>::operator-=(const FixedVec2& rhs) noexcept
+	{
+		_x -= rhs._x;
+		_y -= rhs._y;
+		return *this;
+	}
+
+	template<typename FixedT>
+	MINT_INLINE FixedVec2<FixedT>& FixedVec2<FixedT>::operator*=(const FixedT& scalar) noexcept
+	{
+		_x *= scalar;
+		_y *= scalar;
+		return *this;
+	}
+
+	template<typename FixedT>
+	MINT_INLINE FixedVec2<FixedT>& FixedVec2<FixedT>::operator/=(const FixedT& scalar) noexcept
+	{
+		_x /= scalar;
+		_y /= scalar;
+		return *this;
+	}
+
+	template<typename FixedT>
+	MINT_INLINE constexpr FixedVec2<FixedT> FixedVec2<FixedT>::operator-() const noexcept
+	{
+		return FixedVec2(-_x, -_y);
+	}
+
+	template<typename FixedT>
+	MINT_INLINE constexpr FixedVec2<FixedT> FixedVec2<FixedT>::operator+(const FixedVec2& rhs) const noexcept
+	{
+		return FixedVec2(_x + rhs._x, _y + rhs._y);
+	}
+
+	template<typename FixedT>
+	MINT_INLINE constexpr FixedVec2<FixedT> FixedVec2<FixedT>::operator-(const FixedVec2& rhs) const noexcept
+	{
+		return FixedVec2(_x - rhs._x, _y - rhs._y);
+	}
+
+	template<typename FixedT>
+	MINT_INLINE FixedVec2<FixedT> FixedVec2<FixedT>::operator*(const FixedT& scalar) const noexcept
+	{
+		return FixedVec2(_x * scalar, _y * scalar);
+	}
+
+	template<typename FixedT>
+	MINT_INLINE FixedVec2<FixedT> FixedVec2<FixedT>::operator/(const FixedT& scalar) const noexcept
+	{
+		return FixedVec2(_x / scalar, _y / scalar);
+	}
+
+	template<typename FixedT>
+	MINT_INLINE constexpr bool FixedVec2<FixedT>::operator==(const FixedVec2& rhs) const noexcept
+	{
+		return _x == rhs._x && _y == rhs._y;
+	}
+
+	template<typename FixedT>
+	MINT_INLINE constexpr bool FixedVec2<FixedT>::operator!=(const FixedVec2& rhs) const noexcept
+	{
+		return !(*this == rhs);
+	}
+
+	template<typename FixedT>
+	MINT_INLINE FixedT FixedVec2<FixedT>::Dot(const FixedVec2& rhs) const noexcept
+	{
+		return _x * rhs._x + _y * rhs._y;
+	}
+
+	template<typename FixedT>
+	MINT_INLINE FixedT FixedVec2<FixedT>::Cross(const FixedVec2& rhs) const noexcept
+	{
+		return _x * rhs._y - _y * rhs._x;
+	}
+
+	template<typename FixedT>
+	MINT_INLINE FixedT FixedVec2<FixedT>::LengthSqaure() const noexcept
+	{
+		return Dot(*this);
+	}
+
+	template<typename FixedT>
+	MINT_INLINE FixedT FixedVec2<FixedT>::Length() const noexcept
+	{
+		return Math::Sqrt(LengthSqaure());
+	}
+
+	template<typename FixedT>
+	MINT_INLINE void FixedVec2<FixedT>::Normalize() noexcept
+	{
+		const FixedT length = Length();
+		if (length == FixedT())
+		{
+			return;
+		}
+		_x /= length;
+		_y /= length;
+	}
+
+	template<typename FixedT>
+	MINT_INLINE void FixedVec2<FixedT>::Set(const FixedT& x, const FixedT& y) noexcept
+	{
+		_x = x;
+		_y = y;
+	}
+
+	template<typename FixedT>
+	MINT_INLINE void FixedVec2<FixedT>::SetZero() noexcept
+	{
+		_x = FixedT();
+		_y = FixedT();
+	}
+
+	template<typename FixedT>
+	MINT_INLINE constexpr bool FixedVec2<FixedT>::IsZero() const noexcept
+	{
+		return _x == FixedT() && _y == FixedT();
+	}
+
+	template<typename FixedT>
+	MINT_INLINE Float2 FixedVec2<FixedT>::ToFloat2() const noexcept
+	{
+		return Float2(_x.ToFloat(), _y.ToFloat());
+	}
+#pragma endregion
+
+
+	namespace Math
+	{
+		template<typename RawT, uint32 kFractionBitCount>
+		MINT_INLINE Fixed<RawT, kFractionBitCount> Sqrt(const Fixed<RawT, kFractionBitCount>& x) noexcept
+		{
+			using FixedT = Fixed<RawT, kFractionBitCount>;
+			if (x.GetRaw() <= 0)
+			{
+				return FixedT();
+			}
+			return FixedT::FromRaw(static_cast<RawT>(FixedPointInternal::SqrtShifted(static_cast<uint64>(x.GetRaw()), kFractionBitCount)));
+		}
+
+		template<typename RawT, uint32 kFractionBitCount>
+		MINT_INLINE Fixed<RawT, kFractionBitCount> Abs(const Fixed<RawT, kFractionBitCount>& x) noexcept
+		{
+			return (x.GetRaw() < 0) ? -x : x;
+		}
+
+		template<typename RawT, uint32 kFractionBitCount>
+		MINT_INLINE void SinCos(const Fixed<RawT, kFractionBitCount>& angle, Fixed<RawT, kFractionBitCount>& outSin, Fixed<RawT, kFractionBitCount>& outCos) noexcept
+		{
+			using FixedT = Fixed<RawT, kFractionBitCount>;
+			int32 sinQ30 = 0;
+			int32 cosQ30 = 0;
+			FixedPointInternal::SinCosTurn(FixedPointInternal::ComputeTurn<kFractionBitCount>(angle.GetRaw()), sinQ30, cosQ30);
+			outSin = FixedPointInternal::FromQ30<FixedT>(sinQ30);
+			outCos = FixedPointInternal::FromQ30<FixedT>(cosQ30);
+		}
+
+		template<typename RawT, uint32 kFractionBitCount>
+		MINT_INLINE Fixed<RawT, kFractionBitCount> Sin(const Fixed<RawT, kFractionBitCount>& angle) noexcept
+		{
+			Fixed<RawT, kFractionBitCount> sin;
+			Fixed<RawT, kFractionBitCount> cos;
+			SinCos(angle, sin, cos);
+			return sin;
+		}
+
+		template<typename RawT, uint32 kFractionBitCount>
+		MINT_INLINE Fixed<RawT, kFractionBitCount> Cos(const Fixed<RawT, kFractionBitCount>& angle) noexcept
+		{
+			Fixed<RawT, kFractionBitCount> sin;
+			Fixed<RawT, kFractionBitCount> cos;
+			SinCos(angle, sin, cos);
+			return cos;
+		}
+	}
+}
@@ -19,6 +19,7 @@ namespace mint
 
 	// Right-handed system
 	// Mostly for column vector
+	// Mul, Transpose, Inverse, Determinant 는 SSE 로 계산한다. (MINT_NO_SIMD 를 정의하면 scalar 로 계산한다)
 	class Float4x4 final
 	{
 	public:
@@ -29,6 +30,10 @@ namespace mint
 		static Float4 Mul(const Float4x4& m, const Float4& v) noexcept;
 		static Float3 Mul(const Float4x4& m, const Float3& v) noexcept;
 		static Float4x4 Mul(const Float4x4& l, const Float4x4& r) noexcept;
+		// outVectors[i] = m * vectors[i] (column 들을 한 번만 load 한다)
+		static void Mul(const Float4x4& m, const Float4* const vectors, const uint32 count, Float4* const outVectors) noexcept;
+		// outPoints[i] = m * (points[i], 1)
+		static void Mul(const Float4x4& m, const Float3* const points, const uint32 count, Float3* const outPoints) noexcept;
 
 		static Float4x4 TranslationMatrix(const float x, const float y, const float z) noexcept;
 		static Float4x4 TranslationMatrix(const Float3& translation) noexcept;
@@ -116,6 +121,8 @@ namespace mint
 		float Determinant() const noexcept;
 		Float4x4 Transpose() const noexcept;
 		Float4x4 Inverse() const noexcept;
+		// 마지막 row 가 (0, 0, 0, 1) 인 경우에만 쓸 수 있고, Inverse() 보다 빠르다.
+		Float4x4 InverseAffine() const noexcept;
 
 	public:
 		Float4x4 Mul(const Float4x4& rhs) const noexcept;
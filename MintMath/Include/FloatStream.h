@@ -0,0 +1,114 @@
+﻿#pragma once
+
+
+#ifndef _MINT_MATH_FLOAT_STREAM_H_
+#define _MINT_MATH_FLOAT_STREAM_H_
+
+
+#include <MintCommon/Include/CommonDefinitions.h>
+
+#include <MintContainer/Include/Vector.h>
+
+#include <MintMath/Include/Float2.h>
+#include <MintMath/Include/Float3.h>
+#include <MintMath/Include/Float4.h>
+
+#include <type_traits>
+
+
+namespace mint
+{
+#pragma region Forward declaration
+	class Float3x3;
+	class Float4x4;
+	template<typename T>
+	class Quaternion;
+	using QuaternionF = Quaternion<float>;
+#pragma endregion
+
+
+	// Float2 / Float3 / Float4 의 배열을 성분별로 나누어 (SoA) 저장한다.
+	// 같은 연산을 많은 vector 에 할 때 SIMD lane 을 모두 채워서 쓸 수 있다. (Math::TransformPoints 등 참고)
+	template<uint32 ComponentCount>
+	class FloatStream final
+	{
+		static_assert(2 <= ComponentCount && ComponentCount <= 4, "FloatStream supports 2 to 4 components only!");
+
+	public:
+		using ElementType = std::conditional_t<ComponentCount == 2, Float2, std::conditional_t<ComponentCount == 3, Float3, Float4>>;
+
+	public:
+		FloatStream();
+		explicit FloatStream(const uint32 size);
+		FloatStream(const FloatStream& rhs);
+		FloatStream(FloatStream&& rhs) noexcept;
+		~FloatStream();
+
+	public:
+		FloatStream& operator=(const FloatStream& rhs);
+		FloatStream& operator=(FloatStream&& rhs) noexcept;
+
+	public:
+		void Resize(const uint32 size);
+		void Reserve(const uint32 capacity);
+		void Clear() noexcept;
+		void PushBack(const ElementType& value);
+		void Set(const uint32 index, const ElementType& value) noexcept;
+		ElementType Get(const uint32 index) const noexcept;
+		// AoS 배열로부터 채운다.
+		void Assign(const ElementType* const values, const uint32 count);
+		// AoS 배열로 내보낸다. outValues 는 Size() 개 이상이어야 한다.
+		void CopyTo(ElementType* const outValues) const noexcept;
+
+	public:
+		MINT_INLINE uint32 Size() const noexcept { return _size; }
+		MINT_INLINE bool IsEmpty() const noexcept { return _size == 0; }
+		MINT_INLINE float* GetComponentData(const uint32 componentIndex) noexcept { return _components[componentIndex].Data(); }
+		MINT_INLINE const float* GetComponentData(const uint32 componentIndex) const noexcept { return _components[componentIndex].Data(); }
+
+	private:
+		Vector<float> _components[ComponentCount];
+		uint32 _size;
+	};
+
+	using Float2Stream = FloatStream<2>;
+	using Float3Stream = FloatStream<3>;
+	using Float4Stream = FloatStream<4>;
+
+
+	// SSE (AVX 로 빌드하면 AVX) 로 한 번에 4 (8) 개씩 계산하고, 나머지는 scalar 로 계산한다.
+	// in/out 에 같은 stream 을 넘겨도 된다.
+	namespace Math
+	{
+		// outPoints[i] = m * (points[i], 1)
+		void TransformPoints(const Float3x3& m, const Float2Stream& points, Float2Stream& outPoints);
+		// outPoints[i] = m * (points[i], 1)
+		void TransformPoints(const Float4x4& m, const Float3Stream& points, Float3Stream& outPoints);
+		// outVectors[i] = m * vectors[i]
+		void TransformVectors(const Float4x4& m, const Float4Stream& vectors, Float4Stream& outVectors);
+		// rotation 은 단위 quaternion 이어야 한다.
+		void RotateVectors(const QuaternionF& rotation, const Float3Stream& vectors, Float3Stream& outVectors);
+
+		void Dot(const Float2Stream& lhs, const Float2Stream& rhs, Vector<float>& outDots);
+		void Dot(const Float3Stream& lhs, const Float3Stream& rhs, Vector<float>& outDots);
+		void Dot(const Float4Stream& lhs, const Float4Stream& rhs, Vector<float>& outDots);
+
+		// 길이가 0 인 vector 는 0 으로 둔다.
+		void Normalize(Float2Stream& inoutVectors) noexcept;
+		void Normalize(Float3Stream& inoutVectors) noexcept;
+		void Normalize(Float4Stream& inoutVectors) noexcept;
+
+		// out[i] = a[i] * (1 - t) + b[i] * t
+		void Lerp(const Float2Stream& a, const Float2Stream& b, const float t, Float2Stream& out);
+		void Lerp(const Float3Stream& a, const Float3Stream& b, const float t, Float3Stream& out);
+		void Lerp(const Float4Stream& a, const Float4Stream& b, const float t, Float4Stream& out);
+
+		// 성분별 최솟값과 최댓값. stream 이 비어 있으면 false 를 반환한다.
+		bool MinMax(const Float2Stream& vectors, Float2& outMin, Float2& outMax) noexcept;
+		bool MinMax(const Float3Stream& vectors, Float3& outMin, Float3& outMax) noexcept;
+		bool MinMax(const Float4Stream& vectors, Float4& outMin, Float4& outMax) noexcept;
+	}
+}
+
+
+#endif // !_MINT_MATH_FLOAT_STREAM_H_
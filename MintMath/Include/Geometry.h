@@ -1,4 +1,4 @@
-#pragma once
+﻿#pragma once
 
 
 #ifndef _MINT_MATH_GEOMETRY_H_
@@ -12,9 +12,38 @@
 
 namespace mint
 {
+	namespace Math
+	{
+		// a => b => c 가 CCW 면 양수, CW 면 음수, 한 직선 위에 있으면 0 을 반환한다.
+		// double 로 먼저 계산하고 반올림 오차 범위 안에 들 때만 정확한 계산 (expansion 합) 으로 넘어가므로 부호는 항상 정확하다.
+		double Orient2D(const Float2& a, const Float2& b, const Float2& c) noexcept;
+		// 다각형 넓이의 두 배 (CCW 면 양수)
+		double ComputeSignedDoubleArea(const Float2* const points, const uint32 pointCount) noexcept;
+	}
+
 	uint32 GrahamScan_FindStartPoint(const Vector<Float2>& points);
 	void GrahamScan_SortPoints(Vector<Float2>& inoutPoints);
 	void GrahamScan_Convexify(Vector<Float2>& inoutPoints);
+
+	// Andrew's monotone chain.
+	// 결과는 CCW 순서이고 한 직선 위의 점은 제외된다. 결과 점 개수를 반환한다.
+	// scratch 는 pointCount 개, outHull 은 pointCount + 1 개 이상이어야 한다.
+	// scratch 에 points 를 넘기면 복사하지 않고 points 자체를 정렬한다.
+	uint32 ConvexHull_Compute(const Float2* const points, const uint32 pointCount, Float2* const scratch, Float2* const outHull);
+	// inoutPoints 를 볼록 껍질로 바꾼다. scratch 를 계속 재사용하면 메모리 할당이 일어나지 않는다.
+	void ConvexHull_Compute(Vector<Float2>& inoutPoints, Vector<Float2>& scratch);
+	// CCW 볼록 껍질의 (edgeEndIndex - 1) => edgeEndIndex 변 바깥에 있는 점을 끼워 넣고, 그 때문에 더 이상 껍질이 아니게 된 꼭짓점들을 제거한다.
+	// 점이 해당 변의 바깥에 있지 않으면 아무것도 하지 않고 false 를 반환한다.
+	bool ConvexHull_InsertPoint(Vector<Float2>& inoutHull, const Float2& point, const uint32 edgeEndIndex);
+	// 점이 바깥에 있는 변을 직접 찾는다. 점이 껍질 안에 있으면 false 를 반환한다.
+	bool ConvexHull_InsertPoint(Vector<Float2>& inoutHull, const Float2& point);
+
+	// 단순 다각형 (변끼리 교차하지 않는 다각형, CW/CCW 무관) 을 볼록 다각형 조각들로 나눈다.
+	// Ear clipping 으로 귀를 찾은 뒤, 볼록함이 유지되는 동안 귀를 넓혀서 잘라낸다. 조각 개수를 반환한다.
+	// i 번째 조각은 outIndices[outPieceOffsets[i]] ~ outIndices[outPieceOffsets[i + 1] - 1] 이고, 각 조각은 CCW 순서다.
+	// scratchIndices 는 pointCount 개, outIndices 는 (pointCount - 2) * 3 개, outPieceOffsets 는 pointCount - 1 개 이상이어야 한다.
+	uint32 ConvexDecomposition_Compute(const Float2* const polygon, const uint32 pointCount, uint32* const scratchIndices, uint32* const outIndices, uint32* const outPieceOffsets);
+	uint32 ConvexDecomposition_Compute(const Vector<Float2>& polygon, Vector<uint32>& scratchIndices, Vector<uint32>& outIndices, Vector<uint32>& outPieceOffsets);
 }
 
 
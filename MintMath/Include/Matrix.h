@@ -25,78 +25,98 @@ namespace mint
 		bool Equals(const T(&lhs)[M][N], const T(&rhs)[M][N], const T epsilon = 0) noexcept;
 
 		template <int32 M, int32 N, typename T>
-		void CopyMat(const T(&src)[M][N], T(&dest)[M][N]) noexcept;
+		constexpr void CopyMat(const T(&src)[M][N], T(&dest)[M][N]) noexcept;
 
 		template <int32 M, int32 N, typename T>
-		void SetAddMat(T(&lhs)[M][N], const T(&rhs)[M][N]) noexcept;
+		constexpr void SetAddMat(T(&lhs)[M][N], const T(&rhs)[M][N]) noexcept;
 
 		template <int32 M, int32 N, typename T>
-		void SetSubMat(T(&lhs)[M][N], const T(&rhs)[M][N]) noexcept;
+		constexpr void SetSubMat(T(&lhs)[M][N], const T(&rhs)[M][N]) noexcept;
 
 		template <int32 M, int32 N, typename T>
-		void SetMulMat(T(&mat)[M][N], const T scalar) noexcept;
+		constexpr void SetMulMat(T(&mat)[M][N], const T scalar) noexcept;
 
 		template <int32 M, int32 N, typename T>
-		void SetDivMat(T(&mat)[M][N], const T scalar) noexcept;
+		constexpr void SetDivMat(T(&mat)[M][N], const T scalar) noexcept;
 
 		template <int32 M, int32 N, typename T>
-		void SetNeg(T(&mat)[M][N]) noexcept;
+		constexpr void SetNeg(T(&mat)[M][N]) noexcept;
 
 		template <int32 M, int32 N, typename T>
-		void SetRow(const T(&src)[N], T(&dest)[M][N], const int32 destRow) noexcept;
+		constexpr void SetRow(const T(&src)[N], T(&dest)[M][N], const int32 destRow) noexcept;
 
 		template <int32 M, int32 N, typename T>
-		void GetRow(const T(&mat)[M][N], const int32 row, T(&out)[N]) noexcept;
+		constexpr void GetRow(const T(&mat)[M][N], const int32 row, T(&out)[N]) noexcept;
 
 		template <int32 M, int32 N, typename T>
-		void SetCol(const T(&src)[M], T(&dest)[M][N], const int32 destCol) noexcept;
+		constexpr void SetCol(const T(&src)[M], T(&dest)[M][N], const int32 destCol) noexcept;
 
 		template <int32 M, int32 N, typename T>
-		void GetCol(const T(&mat)[M][N], const int32 col, T(&out)[M]) noexcept;
+		constexpr void GetCol(const T(&mat)[M][N], const int32 col, T(&out)[M]) noexcept;
 
 		template <int32 M, int32 N, int32 P, typename T>
-		void Mul(const T(&lhs)[M][N], const T(&rhs)[N][P], T(&out)[M][P]) noexcept;
+		constexpr void Mul(const T(&lhs)[M][N], const T(&rhs)[N][P], T(&out)[M][P]) noexcept;
 
 		// mat * vec
 		template <int32 M, int32 N, typename T>
-		void Mul(const T(&lhsMat)[M][N], const T(&rhsVec)[N], T(&outVec)[M]) noexcept;
+		constexpr void Mul(const T(&lhsMat)[M][N], const T(&rhsVec)[N], T(&outVec)[M]) noexcept;
 
 		// vec * mat
 		template <int32 M, int32 N, typename T>
-		void Mul(const T(&lhsVec)[M], const T(&rhsMat)[M][N], T(&outVec)[N]) noexcept;
+		constexpr void Mul(const T(&lhsVec)[M], const T(&rhsMat)[M][N], T(&outVec)[N]) noexcept;
 
 		template <int32 N, typename T>
-		void SetIdentity(T(&inOut)[N][N]) noexcept;
+		constexpr void SetIdentity(T(&inOut)[N][N]) noexcept;
 
 		template <int32 M, int32 N, typename T>
-		void SetZeroMat(T(&inOut)[M][N]) noexcept;
+		constexpr void SetZeroMat(T(&inOut)[M][N]) noexcept;
 
 		template <int32 M, int32 N, typename T>
-		void Transpose(const T(&in)[M][N], T(&out)[N][M]) noexcept;
+		constexpr void Transpose(const T(&in)[M][N], T(&out)[N][M]) noexcept;
 
 		template <int32 M, int32 N, typename T>
-		void Minor(const T(&in)[M][N], const int32 row, const int32 col, T(&out)[M - 1][N - 1]) noexcept;
+		constexpr void Minor(const T(&in)[M][N], const int32 row, const int32 col, T(&out)[M - 1][N - 1]) noexcept;
 
 		template <int32 N, typename T>
-		T Trace(const T(&mat)[N][N]) noexcept;
+		constexpr T Trace(const T(&mat)[N][N]) noexcept;
 
-		template <typename T>
-		T Determinant(const T(&mat)[2][2]) noexcept;
-
-		template <typename T>
-		T Determinant(const T(&mat)[3][3]) noexcept;
+		// 4x4 까지는 닫힌 식으로, 그보다 크면 LU 분해로 계산한다.
+		template <int32 N, typename T>
+		constexpr T Determinant(const T(&mat)[N][N]) noexcept;
 
 		template <typename T>
-		T Determinant(T _11, T _12, T _13, T _21, T _22, T _23, T _31, T _32, T _33) noexcept;
+		constexpr T Determinant(T _11, T _12, T _13, T _21, T _22, T _23, T _31, T _32, T _33) noexcept;
 
-		template <typename T>
-		T Determinant(const T(&mat)[4][4]) noexcept;
+		template<typename T>
+		constexpr void Adjugate(const T(&in)[2][2], T(&out)[2][2]) noexcept;
 
 		template<typename T>
-		void Adjugate(const T(&in)[3][3], T(&out)[3][3]) noexcept;
+		constexpr void Adjugate(const T(&in)[3][3], T(&out)[3][3]) noexcept;
 
 		template<typename T>
-		void Adjugate(const T(&in)[4][4], T(&out)[4][4]) noexcept;
+		constexpr void Adjugate(const T(&in)[4][4], T(&out)[4][4]) noexcept;
+
+		// 4x4 까지는 adjugate 로, 그보다 크면 LU 분해로 계산한다.
+		// 역행렬이 없으면 out 을 영행렬로 두고 false 를 반환한다.
+		template <int32 N, typename T>
+		constexpr bool Inverse(const T(&in)[N][N], T(&out)[N][N]) noexcept;
+
+		// 부분 pivoting 을 하는 LU 분해 (P * in = L * U)
+		// outLU 의 대각선 아래가 L (대각 성분은 1 이라 저장하지 않는다), 대각선부터 위가 U 이다.
+		// outPermutation[i] 는 i 번째 행이 원래 몇 번째 행이었는지이고, outPermutationSign 은 P 의 행렬식 (+1 또는 -1) 이다.
+		// 특이 행렬이면 false 를 반환한다.
+		template <int32 N, typename T>
+		constexpr bool DecomposeLU(const T(&in)[N][N], T(&outLU)[N][N], int32(&outPermutation)[N], T& outPermutationSign) noexcept;
+
+		// DecomposeLU 의 결과로 in * outX = b 를 푼다.
+		template <int32 N, typename T>
+		constexpr void SolveLU(const T(&lu)[N][N], const int32(&permutation)[N], const T(&b)[N], T(&outX)[N]) noexcept;
+
+		template <int32 N, typename T>
+		constexpr T DeterminantLU(const T(&mat)[N][N]) noexcept;
+
+		template <int32 N, typename T>
+		constexpr bool InverseLU(const T(&in)[N][N], T(&out)[N][N]) noexcept;
 	}
 
 
@@ -130,46 +150,47 @@ namespace mint
 		static_assert(N > 0, "N must be greater than 0!");
 
 	public:
-		Matrix();
-		Matrix(const std::initializer_list<T>& initializerList);
-		Matrix(const Matrix& rhs) = default;
-		Matrix(Matrix&& rhs) noexcept = default;
-		~Matrix();
+		constexpr Matrix();
+		// 행 우선 순서로 채운다.
+		constexpr Matrix(const std::initializer_list<T>& initializerList);
+		constexpr Matrix(const Matrix& rhs) = default;
+		constexpr Matrix(Matrix&& rhs) noexcept = default;
+		constexpr ~Matrix() = default;
 
 	public:
 		operator float() const requires (M == 1 && N == 1);
 
 	public:
-		Matrix& operator=(const Matrix& rhs) = default;
-		Matrix& operator=(Matrix&& rhs) noexcept = default;
+		constexpr Matrix& operator=(const Matrix& rhs) = default;
+		constexpr Matrix& operator=(Matrix&& rhs) noexcept = default;
 
 	public:
 		bool operator==(const Matrix& rhs) const noexcept;
 		bool operator!=(const Matrix& rhs) const noexcept;
 
 	public:
-		Matrix& operator*=(const T scalar) noexcept;
-		Matrix& operator/=(const T scalar) noexcept;
-		Matrix& operator+=(const Matrix& rhs) noexcept;
-		Matrix& operator-=(const Matrix& rhs) noexcept;
-		Matrix& operator*=(const Matrix<N, N, T>& rhs) noexcept;
+		constexpr Matrix& operator*=(const T scalar) noexcept;
+		constexpr Matrix& operator/=(const T scalar) noexcept;
+		constexpr Matrix& operator+=(const Matrix& rhs) noexcept;
+		constexpr Matrix& operator-=(const Matrix& rhs) noexcept;
+		constexpr Matrix& operator*=(const Matrix<N, N, T>& rhs) noexcept;
 
 	public:
-		Matrix operator*(const T scalar) const noexcept;
-		Matrix operator/(const T scalar) const noexcept;
-		Matrix operator+(const Matrix& rhs) const noexcept;
-		Matrix operator-(const Matrix& rhs) const noexcept;
-		Matrix operator-() const noexcept;
+		constexpr Matrix operator*(const T scalar) const noexcept;
+		constexpr Matrix operator/(const T scalar) const noexcept;
+		constexpr Matrix operator+(const Matrix& rhs) const noexcept;
+		constexpr Matrix operator-(const Matrix& rhs) const noexcept;
+		constexpr Matrix operator-() const noexcept;
 
 	public:
 		template <int32 P>
-		Matrix<M, P, T> operator*(const Matrix<N, P, T>& rhs) const noexcept;
+		constexpr Matrix<M, P, T> operator*(const Matrix<N, P, T>& rhs) const noexcept;
 
 	public:
-		void SetElement(const uint32 rowIndex, const uint32 columnIndex, const T value) noexcept;
-		void AddElement(const uint32 rowIndex, const uint32 columnIndex, const T value) noexcept;
-		void MulElement(const uint32 rowIndex, const uint32 columnIndex, const T value) noexcept;
-		T GetElement(const uint32 rowIndex, const uint32 columnIndex) const noexcept;
+		constexpr void SetElement(const uint32 rowIndex, const uint32 columnIndex, const T value) noexcept;
+		constexpr void AddElement(const uint32 rowIndex, const uint32 columnIndex, const T value) noexcept;
+		constexpr void MulElement(const uint32 rowIndex, const uint32 columnIndex, const T value) noexcept;
+		constexpr T GetElement(const uint32 rowIndex, const uint32 columnIndex) const noexcept;
 
 	public:
 		void SetRow(const uint32 rowIndex, const Vec<N, T>& row) noexcept;
@@ -182,9 +203,13 @@ namespace mint
 		Vec<M, T> MultiplyColumnVector(const Vec<N, T>& columnVector) const noexcept;
 
 	public:
-		Matrix<N, M, T> Transpose() const noexcept;
-		T Trace() const noexcept;
-		Matrix<M - 1, N - 1, T> Minor(const uint32 row, const uint32 col) const noexcept;
+		constexpr Matrix<N, M, T> Transpose() const noexcept;
+		constexpr T Trace() const noexcept;
+		constexpr Matrix<M - 1, N - 1, T> Minor(const uint32 row, const uint32 col) const noexcept;
+		constexpr T Determinant() const noexcept requires (M == N);
+		constexpr Matrix Adjugate() const noexcept requires (M == N && 2 <= M && M <= 4);
+		// 역행렬이 없으면 영행렬을 반환한다.
+		constexpr Matrix Inverse() const noexcept requires (M == N);
 
 	public:
 		constexpr bool IsSquareMatrix() const noexcept;
@@ -197,8 +222,8 @@ namespace mint
 		bool IsUpperTriangularMatrix() const noexcept;
 		bool IsIdempotentMatrix() const noexcept;
 
-		void SetIdentity() noexcept;
-		void SetZero() noexcept;
+		constexpr void SetIdentity() noexcept;
+		constexpr void SetZero() noexcept;
 
 	public:
 		T _m[M][N];
@@ -7,6 +7,7 @@
 #include <MintMath/Include/Quaternion.h>
 
 #include <initializer_list>
+#include <utility>
 
 
 namespace mint
@@ -28,7 +29,7 @@ namespace mint
 		}
 
 		template<int32 M, int32 N, typename T>
-		void CopyMat(const T(&src)[M][N], T(&dest)[M][N]) noexcept
+		constexpr void CopyMat(const T(&src)[M][N], T(&dest)[M][N]) noexcept
 		{
 			for (int32 row = 0; row < M; ++row)
 			{
@@ -40,7 +41,7 @@ namespace mint
 		}
 
 		template<int32 M, int32 N, typename T>
-		void SetAddMat(T(&lhs)[M][N], const T(&rhs)[M][N]) noexcept
+		constexpr void SetAddMat(T(&lhs)[M][N], const T(&rhs)[M][N]) noexcept
 		{
 			for (int32 row = 0; row < M; ++row)
 			{
@@ -52,7 +53,7 @@ namespace mint
 		}
 
 		template<int32 M, int32 N, typename T>
-		void SetSubMat(T(&lhs)[M][N], const T(&rhs)[M][N]) noexcept
+		constexpr void SetSubMat(T(&lhs)[M][N], const T(&rhs)[M][N]) noexcept
 		{
 			for (int32 row = 0; row < M; ++row)
 			{
@@ -64,7 +65,7 @@ namespace mint
 		}
 
 		template<int32 M, int32 N, typename T>
-		void SetMulMat(T(&mat)[M][N], const T scalar) noexcept
+		constexpr void SetMulMat(T(&mat)[M][N], const T scalar) noexcept
 		{
 			for (int32 row = 0; row < M; ++row)
 			{
@@ -76,7 +77,7 @@ namespace mint
 		}
 
 		template<int32 M, int32 N, typename T>
-		void SetDivMat(T(&mat)[M][N], const T scalar) noexcept
+		constexpr void SetDivMat(T(&mat)[M][N], const T scalar) noexcept
 		{
 			MINT_ASSERT(scalar != 0.0, "0 으로 나누려 합니다!");
 			for (int32 row = 0; row < M; ++row)
@@ -89,7 +90,7 @@ namespace mint
 		}
 
 		template<int32 M, int32 N, typename T>
-		void SetNeg(T(&mat)[M][N]) noexcept
+		constexpr void SetNeg(T(&mat)[M][N]) noexcept
 		{
 			for (int32 row = 0; row < M; ++row)
 			{
@@ -101,7 +102,7 @@ namespace mint
 		}
 
 		template<int32 M, int32 N, typename T>
-		void SetRow(const T(&src)[N], T(&dest)[M][N], const int32 destRow) noexcept
+		constexpr void SetRow(const T(&src)[N], T(&dest)[M][N], const int32 destRow) noexcept
 		{
 			for (int32 col = 0; col < N; ++col)
 			{
@@ -110,7 +111,7 @@ namespace mint
 		}
 
 		template<int32 M, int32 N, typename T>
-		void GetRow(const T(&mat)[M][N], const int32 row, T(&out)[N]) noexcept
+		constexpr void GetRow(const T(&mat)[M][N], const int32 row, T(&out)[N]) noexcept
 		{
 			for (int32 col = 0; col < N; ++col)
 			{
@@ -119,7 +120,7 @@ namespace mint
 		}
 
 		template<int32 M, int32 N, typename T>
-		void SetCol(const T(&src)[M], T(&dest)[M][N], const int32 destCol) noexcept
+		constexpr void SetCol(const T(&src)[M], T(&dest)[M][N], const int32 destCol) noexcept
 		{
 			for (int32 row = 0; row < M; ++row)
 			{
@@ -128,7 +129,7 @@ namespace mint
 		}
 
 		template<int32 M, int32 N, typename T>
-		void GetCol(const T(&mat)[M][N], const int32 col, T(&out)[M]) noexcept
+		constexpr void GetCol(const T(&mat)[M][N], const int32 col, T(&out)[M]) noexcept
 		{
 			for (int32 row = 0; row < M; ++row)
 			{
@@ -137,54 +138,51 @@ namespace mint
 		}
 
 		template<int32 M, int32 N, int32 P, typename T>
-		void Mul(const T(&lhs)[M][N], const T(&rhs)[N][P], T(&out)[M][P]) noexcept
+		constexpr void Mul(const T(&lhs)[M][N], const T(&rhs)[N][P], T(&out)[M][P]) noexcept
 		{
-			T lhsRowVec[N];
-			T rhsColVec[N];
-			T rhsCopy[N][P];
-			CopyMat(rhs, rhsCopy);
+			// 내적을 fold expression 으로 펼쳐서 크기가 작으면 loop 와 분기가 남지 않는다.
+			// out 이 lhs 나 rhs 와 같아도 되도록 임시 행렬에 계산한다.
+			T result[M][P];
 			for (int32 row = 0; row < M; ++row)
 			{
-				Math::GetRow(lhs, row, lhsRowVec);
-
 				for (int32 col = 0; col < P; ++col)
 				{
-					Math::GetCol(rhsCopy, col, rhsColVec);
-
-					out[row][col] = Math::Dot(lhsRowVec, rhsColVec);
+					result[row][col] = [&]<size_t... K>(std::index_sequence<K...>) { return ((lhs[row][K] * rhs[K][col]) + ...); }(std::make_index_sequence<N>{});
 				}
 			}
+			CopyMat(result, out);
 		}
 
 		template<int32 M, int32 N, typename T>
-		void Mul(const T(&mat)[M][N], const T(&vec)[N], T(&outVec)[M]) noexcept
+		constexpr void Mul(const T(&mat)[M][N], const T(&vec)[N], T(&outVec)[M]) noexcept
 		{
-			T vecCopy[N];
-			CopyVec(vec, vecCopy);
-
+			T result[M];
+			for (int32 row = 0; row < M; ++row)
+			{
+				result[row] = [&]<size_t... K>(std::index_sequence<K...>) { return ((mat[row][K] * vec[K]) + ...); }(std::make_index_sequence<N>{});
+			}
 			for (int32 row = 0; row < M; ++row)
 			{
-				outVec[row] = Math::Dot(mat[row], vecCopy);
+				outVec[row] = result[row];
 			}
 		}
 
 		template<int32 M, int32 N, typename T>
-		void Mul(const T(&vec)[M], const T(&mat)[M][N], T(&outVec)[N]) noexcept
+		constexpr void Mul(const T(&vec)[M], const T(&mat)[M][N], T(&outVec)[N]) noexcept
 		{
-			T vecCopy[M];
-			CopyVec(vec, vecCopy);
-
-			T matCol[M];
+			T result[N];
 			for (int32 col = 0; col < N; ++col)
 			{
-				Math::GetCol(mat, col, matCol);
-
-				outVec[col] = Math::Dot(vecCopy, matCol);
+				result[col] = [&]<size_t... K>(std::index_sequence<K...>) { return ((vec[K] * mat[K][col]) + ...); }(std::make_index_sequence<M>{});
+			}
+			for (int32 col = 0; col < N; ++col)
+			{
+				outVec[col] = result[col];
 			}
 		}
 
 		template<int32 N, typename T>
-		void SetIdentity(T(&inOut)[N][N]) noexcept
+		constexpr void SetIdentity(T(&inOut)[N][N]) noexcept
 		{
 			for (int32 row = 0; row < N; ++row)
 			{
@@ -196,7 +194,7 @@ namespace mint
 		}
 
 		template<int32 M, int32 N, typename T>
-		void SetZeroMat(T(&inOut)[M][N]) noexcept
+		constexpr void SetZeroMat(T(&inOut)[M][N]) noexcept
 		{
 			for (int32 row = 0; row < M; ++row)
 			{
@@ -208,7 +206,7 @@ namespace mint
 		}
 
 		template<int32 M, int32 N, typename T>
-		void Transpose(const T(&in)[M][N], T(&out)[N][M]) noexcept
+		constexpr void Transpose(const T(&in)[M][N], T(&out)[N][M]) noexcept
 		{
 			for (int32 row = 0; row < M; ++row)
 			{
@@ -220,7 +218,7 @@ namespace mint
 		}
 
 		template<int32 M, int32 N, typename T>
-		void Minor(const T(&in)[M][N], const int32 row, const int32 col, T(&out)[M - 1][N - 1]) noexcept
+		constexpr void Minor(const T(&in)[M][N], const int32 row, const int32 col, T(&out)[M - 1][N - 1]) noexcept
 		{
 			int32 destRow = 0;
 			for (int32 srcRow = 0; srcRow < M; ++srcRow)
@@ -228,7 +226,7 @@ namespace mint
 				if (row != srcRow)
 				{
 					int32 destCol = 0;
-					for (int32 srcCol = 0; srcCol < M; ++srcCol)
+					for (int32 srcCol = 0; srcCol < N; ++srcCol)
 					{
 						if (col != srcCol)
 						{
@@ -244,100 +242,316 @@ namespace mint
 		}
 
 		template<int32 N, typename T>
-		T Trace(const T(&mat)[N][N]) noexcept
+		constexpr T Trace(const T(&mat)[N][N]) noexcept
 		{
 			T result{};
-			for (int32 row = 0; row < N; ++row)
+			for (int32 index = 0; index < N; ++index)
 			{
-				for (int32 col = 0; col < N; ++col)
-				{
-					result += mat[row][col];
-				}
+				result += mat[index][index];
 			}
 			return result;
 		}
 
 		template<typename T>
-		MINT_INLINE T Determinant(const T(&mat)[2][2]) noexcept
+		MINT_INLINE constexpr T Determinant(T _11, T _12, T _21, T _22) noexcept
 		{
-			return mat[0][0] * mat[1][1] - mat[0][1] * mat[1][0];
+			return _11 * _22 - _12 * _21;
 		}
 
 		template<typename T>
-		MINT_INLINE T Determinant(T _11, T _12, T _21, T _22) noexcept
+		MINT_INLINE constexpr T Determinant(T _11, T _12, T _13, T _21, T _22, T _23, T _31, T _32, T _33) noexcept
 		{
-			return _11 * _22 - _12 * _21;
+			return _11 * (_22 * _33 - _23 * _32)
+				- _12 * (_21 * _33 - _23 * _31)
+				+ _13 * (_21 * _32 - _22 * _31);
 		}
 
+		// 4x4 행렬의 위 두 행과 아래 두 행에서 나오는 2x2 소행렬식들
+		// Determinant 와 Adjugate 가 함께 쓴다.
 		template<typename T>
-		MINT_INLINE T Determinant(const T(&mat)[3][3]) noexcept
+		struct SubDeterminants4x4
 		{
-			return mat[0][0] * (mat[1][1] * mat[2][2] - mat[1][2] * mat[2][1])
-				- mat[0][1] * (mat[1][0] * mat[2][2] - mat[1][2] * mat[2][0])
-				+ mat[0][2] * (mat[1][0] * mat[2][1] - mat[1][1] * mat[2][0]);
-		}
+			constexpr explicit SubDeterminants4x4(const T(&mat)[4][4]) noexcept
+				: _s0{ mat[0][0] * mat[1][1] - mat[1][0] * mat[0][1] }
+				, _s1{ mat[0][0] * mat[1][2] - mat[1][0] * mat[0][2] }
+				, _s2{ mat[0][0] * mat[1][3] - mat[1][0] * mat[0][3] }
+				, _s3{ mat[0][1] * mat[1][2] - mat[1][1] * mat[0][2] }
+				, _s4{ mat[0][1] * mat[1][3] - mat[1][1] * mat[0][3] }
+				, _s5{ mat[0][2] * mat[1][3] - mat[1][2] * mat[0][3] }
+				, _c0{ mat[2][0] * mat[3][1] - mat[3][0] * mat[2][1] }
+				, _c1{ mat[2][0] * mat[3][2] - mat[3][0] * mat[2][2] }
+				, _c2{ mat[2][0] * mat[3][3] - mat[3][0] * mat[2][3] }
+				, _c3{ mat[2][1] * mat[3][2] - mat[3][1] * mat[2][2] }
+				, _c4{ mat[2][1] * mat[3][3] - mat[3][1] * mat[2][3] }
+				, _c5{ mat[2][2] * mat[3][3] - mat[3][2] * mat[2][3] }
+			{
+				__noop;
+			}
+
+			constexpr T Determinant() const noexcept
+			{
+				return _s0 * _c5 - _s1 * _c4 + _s2 * _c3 + _s3 * _c2 - _s4 * _c1 + _s5 * _c0;
+			}
+
+			T _s0;
+			T _s1;
+			T _s2;
+			T _s3;
+			T _s4;
+			T _s5;
+			T _c0;
+			T _c1;
+			T _c2;
+			T _c3;
+			T _c4;
+			T _c5;
+		};
 
+		// transpose of cofactor
 		template<typename T>
-		MINT_INLINE T Determinant(T _11, T _12, T _13, T _21, T _22, T _23, T _31, T _32, T _33) noexcept
+		MINT_INLINE constexpr void Adjugate(const T(&in)[2][2], T(&out)[2][2]) noexcept
 		{
-			return _11 * (_22 * _33 - _23 * _32)
-				- _12 * (_21 * _33 - _23 * _31)
-				+ _13 * (_21 * _32 - _22 * _31);
+			const T result[2][2]
+			{
+				{ +in[1][1], -in[0][1] },
+				{ -in[1][0], +in[0][0] },
+			};
+			CopyMat(result, out);
 		}
 
+		// transpose of cofactor
 		template<typename T>
-		MINT_INLINE T DeterminantOfMinor(const T(&mat)[3][3], const int32 row, const int32 col) noexcept
+		MINT_INLINE constexpr void Adjugate(const T(&in)[3][3], T(&out)[3][3]) noexcept
 		{
-			// 0 => 1 2
-			// 1 => 0 2
-			// 2 => 0 1
-			const int32 r0 = (row ^ 1) & 1;
-			const int32 r1 = (r0 ^ 1) & 1;
-			const int32 c0 = (col ^ 1) & 1;
-			const int32 c1 = (c0 ^ 1) & 1;
-			return Determinant(mat[r0][c0], mat[r0][c1], mat[r1][c0], mat[r1][c1]);
+			const T result[3][3]
+			{
+				{ in[1][1] * in[2][2] - in[1][2] * in[2][1], in[0][2] * in[2][1] - in[0][1] * in[2][2], in[0][1] * in[1][2] - in[0][2] * in[1][1] },
+				{ in[1][2] * in[2][0] - in[1][0] * in[2][2], in[0][0] * in[2][2] - in[0][2] * in[2][0], in[0][2] * in[1][0] - in[0][0] * in[1][2] },
+				{ in[1][0] * in[2][1] - in[1][1] * in[2][0], in[0][1] * in[2][0] - in[0][0] * in[2][1], in[0][0] * in[1][1] - in[0][1] * in[1][0] },
+			};
+			CopyMat(result, out);
 		}
 
+		// transpose of cofactor
 		template<typename T>
-		MINT_INLINE T DeterminantOfMinor(const T(&mat)[4][4], const int32 row, const int32 col) noexcept
+		MINT_INLINE constexpr void Adjugate(const T(&in)[4][4], T(&out)[4][4]) noexcept
 		{
-			// 0 => 1 2 3
-			// 1 => 0 2 3
-			// 2 => 0 1 3
-			// 3 => 0 1 2
-			const int32 r0 = (row == 0) ? 1 : 0;
-			const int32 r1 = ((row & 2) == 0) ? 2 : 1;
-			const int32 r2 = (row == 3) ? 2 : 3;
-			const int32 c0 = (col == 0) ? 1 : 0;
-			const int32 c1 = ((col & 2) == 0) ? 2 : 1;
-			const int32 c2 = (col == 3) ? 2 : 3;
-			return Determinant(mat[r0][c0], mat[r0][c1], mat[r0][c2], mat[r1][c0], mat[r1][c1], mat[r1][c2], mat[r2][c0], mat[r2][c1], mat[r2][c2]);
+			const SubDeterminants4x4<T> sub(in);
+			const T result[4][4]
+			{
+				{
+					+in[1][1] * sub._c5 - in[1][2] * sub._c4 + in[1][3] * sub._c3,
+					-in[0][1] * sub._c5 + in[0][2] * sub._c4 - in[0][3] * sub._c3,
+					+in[3][1] * sub._s5 - in[3][2] * sub._s4 + in[3][3] * sub._s3,
+					-in[2][1] * sub._s5 + in[2][2] * sub._s4 - in[2][3] * sub._s3,
+				},
+				{
+					-in[1][0] * sub._c5 + in[1][2] * sub._c2 - in[1][3] * sub._c1,
+					+in[0][0] * sub._c5 - in[0][2] * sub._c2 + in[0][3] * sub._c1,
+					-in[3][0] * sub._s5 + in[3][2] * sub._s2 - in[3][3] * sub._s1,
+					+in[2][0] * sub._s5 - in[2][2] * sub._s2 + in[2][3] * sub._s1,
+				},
+				{
+					+in[1][0] * sub._c4 - in[1][1] * sub._c2 + in[1][3] * sub._c0,
+					-in[0][0] * sub._c4 + in[0][1] * sub._c2 - in[0][3] * sub._c0,
+					+in[3][0] * sub._s4 - in[3][1] * sub._s2 + in[3][3] * sub._s0,
+					-in[2][0] * sub._s4 + in[2][1] * sub._s2 - in[2][3] * sub._s0,
+				},
+				{
+					-in[1][0] * sub._c3 + in[1][1] * sub._c1 - in[1][2] * sub._c0,
+					+in[0][0] * sub._c3 - in[0][1] * sub._c1 + in[0][2] * sub._c0,
+					-in[3][0] * sub._s3 + in[3][1] * sub._s1 - in[3][2] * sub._s0,
+					+in[2][0] * sub._s3 - in[2][1] * sub._s1 + in[2][2] * sub._s0,
+				},
+			};
+			CopyMat(result, out);
 		}
 
-		template<typename T>
-		MINT_INLINE T Determinant(const T(&mat)[4][4]) noexcept
+		template<int32 N, typename T>
+		constexpr bool DecomposeLU(const T(&in)[N][N], T(&outLU)[N][N], int32(&outPermutation)[N], T& outPermutationSign) noexcept
 		{
-			return mat[0][0] * DeterminantOfMinor(mat, 0, 0) - mat[0][1] * DeterminantOfMinor(mat, 0, 1)
-				+ mat[0][2] * DeterminantOfMinor(mat, 0, 2) - mat[0][3] * DeterminantOfMinor(mat, 0, 3);
+			CopyMat(in, outLU);
+			outPermutationSign = static_cast<T>(1);
+			for (int32 index = 0; index < N; ++index)
+			{
+				outPermutation[index] = index;
+			}
+
+			for (int32 k = 0; k < N; ++k)
+			{
+				// 부분 pivoting: 절댓값이 가장 큰 성분을 pivot 으로 쓴다.
+				int32 pivotRow = k;
+				T pivotAbs = (outLU[k][k] < static_cast<T>(0)) ? -outLU[k][k] : outLU[k][k];
+				for (int32 row = k + 1; row < N; ++row)
+				{
+					const T candidateAbs = (outLU[row][k] < static_cast<T>(0)) ? -outLU[row][k] : outLU[row][k];
+					if (pivotAbs < candidateAbs)
+					{
+						pivotAbs = candidateAbs;
+						pivotRow = row;
+					}
+				}
+
+				if (pivotAbs == static_cast<T>(0))
+				{
+					return false;
+				}
+
+				if (pivotRow != k)
+				{
+					for (int32 col = 0; col < N; ++col)
+					{
+						const T temp = outLU[k][col];
+						outLU[k][col] = outLU[pivotRow][col];
+						outLU[pivotRow][col] = temp;
+					}
+					const int32 tempIndex = outPermutation[k];
+					outPermutation[k] = outPermutation[pivotRow];
+					outPermutation[pivotRow] = tempIndex;
+					outPermutationSign = -outPermutationSign;
+				}
+
+				const T inversePivot = static_cast<T>(1) / outLU[k][k];
+				for (int32 row = k + 1; row < N; ++row)
+				{
+					const T factor = outLU[row][k] * inversePivot;
+					outLU[row][k] = factor;
+					for (int32 col = k + 1; col < N; ++col)
+					{
+						outLU[row][col] -= factor * outLU[k][col];
+					}
+				}
+			}
+			return true;
 		}
 
-		// transpose of cofactor
-		template<typename T>
-		MINT_INLINE void Adjugate(const T(&in)[3][3], T(&out)[3][3]) noexcept
+		template<int32 N, typename T>
+		constexpr void SolveLU(const T(&lu)[N][N], const int32(&permutation)[N], const T(&b)[N], T(&outX)[N]) noexcept
 		{
-			out[0][0] = +DeterminantOfMinor(in, 0, 0); out[1][0] = -DeterminantOfMinor(in, 0, 1); out[2][0] = +DeterminantOfMinor(in, 0, 2);
-			out[0][1] = -DeterminantOfMinor(in, 1, 0); out[1][1] = +DeterminantOfMinor(in, 1, 1); out[2][1] = -DeterminantOfMinor(in, 1, 2);
-			out[0][2] = +DeterminantOfMinor(in, 2, 0); out[1][2] = -DeterminantOfMinor(in, 2, 1); out[2][2] = +DeterminantOfMinor(in, 2, 2);
+			// L y = P b
+			T y[N];
+			for (int32 row = 0; row < N; ++row)
+			{
+				T sum = b[permutation[row]];
+				for (int32 col = 0; col < row; ++col)
+				{
+					sum -= lu[row][col] * y[col];
+				}
+				y[row] = sum;
+			}
+
+			// U x = y
+			for (int32 row = N - 1; row >= 0; --row)
+			{
+				T sum = y[row];
+				for (int32 col = row + 1; col < N; ++col)
+				{
+					sum -= lu[row][col] * y[col];
+				}
+				y[row] = sum / lu[row][row];
+			}
+
+			for (int32 row = 0; row < N; ++row)
+			{
+				outX[row] = y[row];
+			}
 		}
 
-		// transpose of cofactor
-		template<typename T>
-		MINT_INLINE void Adjugate(const T(&in)[4][4], T(&out)[4][4]) noexcept
+		template<int32 N, typename T>
+		constexpr T DeterminantLU(const T(&mat)[N][N]) noexcept
+		{
+			T lu[N][N];
+			int32 permutation[N];
+			T result = static_cast<T>(0);
+			if (DecomposeLU(mat, lu, permutation, result) == false)
+			{
+				return static_cast<T>(0);
+			}
+
+			for (int32 index = 0; index < N; ++index)
+			{
+				result *= lu[index][index];
+			}
+			return result;
+		}
+
+		template<int32 N, typename T>
+		constexpr bool InverseLU(const T(&in)[N][N], T(&out)[N][N]) noexcept
+		{
+			T lu[N][N];
+			int32 permutation[N];
+			T permutationSign = static_cast<T>(0);
+			if (DecomposeLU(in, lu, permutation, permutationSign) == false)
+			{
+				SetZeroMat(out);
+				return false;
+			}
+
+			T column[N];
+			for (int32 col = 0; col < N; ++col)
+			{
+				T unitVector[N]{};
+				unitVector[col] = static_cast<T>(1);
+				SolveLU(lu, permutation, unitVector, column);
+				SetCol(column, out, col);
+			}
+			return true;
+		}
+
+		template<int32 N, typename T>
+		MINT_INLINE constexpr T Determinant(const T(&mat)[N][N]) noexcept
+		{
+			if constexpr (N == 1)
+			{
+				return mat[0][0];
+			}
+			else if constexpr (N == 2)
+			{
+				return Determinant(mat[0][0], mat[0][1], mat[1][0], mat[1][1]);
+			}
+			else if constexpr (N == 3)
+			{
+				return Determinant(mat[0][0], mat[0][1], mat[0][2], mat[1][0], mat[1][1], mat[1][2], mat[2][0], mat[2][1], mat[2][2]);
+			}
+			else if constexpr (N == 4)
+			{
+				return SubDeterminants4x4<T>(mat).Determinant();
+			}
+			else
+			{
+				return DeterminantLU(mat);
+			}
+		}
+
+		template<int32 N, typename T>
+		constexpr bool Inverse(const T(&in)[N][N], T(&out)[N][N]) noexcept
 		{
-			out[0][0] = +DeterminantOfMinor(in, 0, 0); out[1][0] = -DeterminantOfMinor(in, 0, 1); out[2][0] = +DeterminantOfMinor(in, 0, 2); out[3][0] = -DeterminantOfMinor(in, 0, 3);
-			out[0][1] = -DeterminantOfMinor(in, 1, 0); out[1][1] = +DeterminantOfMinor(in, 1, 1); out[2][1] = -DeterminantOfMinor(in, 1, 2); out[3][1] = +DeterminantOfMinor(in, 1, 3);
-			out[0][2] = +DeterminantOfMinor(in, 2, 0); out[1][2] = -DeterminantOfMinor(in, 2, 1); out[2][2] = +DeterminantOfMinor(in, 2, 2); out[3][2] = -DeterminantOfMinor(in, 2, 3);
-			out[0][3] = -DeterminantOfMinor(in, 3, 0); out[1][3] = +DeterminantOfMinor(in, 3, 1); out[2][3] = -DeterminantOfMinor(in, 3, 2); out[3][3] = +DeterminantOfMinor(in, 3, 3);
+			if constexpr (N == 1)
+			{
+				if (in[0][0] == static_cast<T>(0))
+				{
+					out[0][0] = static_cast<T>(0);
+					return false;
+				}
+				out[0][0] = static_cast<T>(1) / in[0][0];
+				return true;
+			}
+			else if constexpr (N <= 4)
+			{
+				const T determinant = Determinant(in);
+				if (determinant == static_cast<T>(0))
+				{
+					SetZeroMat(out);
+					return false;
+				}
+				Adjugate(in, out);
+				SetMulMat(out, static_cast<T>(1) / determinant);
+				return true;
+			}
+			else
+			{
+				return InverseLU(in, out);
+			}
 		}
 	}
 
@@ -382,31 +596,27 @@ namespace mint
 
 
 	template<int32 M, int32 N, typename T>
-	inline Matrix<M, N, T>::Matrix()
+	inline constexpr Matrix<M, N, T>::Matrix()
 		: _m{}
 	{
 		__noop;
 	}
 
 	template<int32 M, int32 N, typename T>
-	inline Matrix<M, N, T>::Matrix(const std::initializer_list<T>& initializerList)
+	inline constexpr Matrix<M, N, T>::Matrix(const std::initializer_list<T>& initializerList)
+		: _m{}
 	{
-		const int32 count = min(static_cast<int32>(initializerList.size()), M * N);
+		const int32 size = static_cast<int32>(initializerList.size());
+		const int32 count = (size < M * N) ? size : M * N;
 		const T* const first = initializerList.begin();
 		for (int32 index = 0; index < count; ++index)
 		{
-			const int32 col = index % M;
-			const int32 row = index / M;
+			const int32 col = index % N;
+			const int32 row = index / N;
 			_m[row][col] = *(first + index);
 		}
 	}
 
-	template<int32 M, int32 N, typename T>
-	inline Matrix<M, N, T>::~Matrix()
-	{
-		__noop;
-	}
-
 	template<int32 M, int32 N, typename T>
 	Matrix<M, N, T>::operator float() const requires (M == 1 && N == 1)
 	{
@@ -426,35 +636,35 @@ namespace mint
 	}
 
 	template<int32 M, int32 N, typename T>
-	MINT_INLINE Matrix<M, N, T>& Matrix<M, N, T>::operator*=(const T scalar) noexcept
+	MINT_INLINE constexpr Matrix<M, N, T>& Matrix<M, N, T>::operator*=(const T scalar) noexcept
 	{
 		Math::SetMulMat(_m, scalar);
 		return *this;
 	}
 
 	template<int32 M, int32 N, typename T>
-	MINT_INLINE Matrix<M, N, T>& Matrix<M, N, T>::operator/=(const T scalar) noexcept
+	MINT_INLINE constexpr Matrix<M, N, T>& Matrix<M, N, T>::operator/=(const T scalar) noexcept
 	{
 		Math::SetDivMat(_m, scalar);
 		return *this;
 	}
 
 	template<int32 M, int32 N, typename T>
-	MINT_INLINE Matrix<M, N, T>& Matrix<M, N, T>::operator+=(const Matrix& rhs) noexcept
+	MINT_INLINE constexpr Matrix<M, N, T>& Matrix<M, N, T>::operator+=(const Matrix& rhs) noexcept
 	{
 		Math::SetAddMat(_m, rhs._m);
 		return *this;
 	}
 
 	template<int32 M, int32 N, typename T>
-	MINT_INLINE Matrix<M, N, T>& Matrix<M, N, T>::operator-=(const Matrix& rhs) noexcept
+	MINT_INLINE constexpr Matrix<M, N, T>& Matrix<M, N, T>::operator-=(const Matrix& rhs) noexcept
 	{
 		Math::SetSubMat(_m, rhs._m);
 		return *this;
 	}
 
 	template<int32 M, int32 N, typename T>
-	inline Matrix<M, N, T>& Matrix<M, N, T>::operator*=(const Matrix<N, N, T>& rhs) noexcept
+	inline constexpr Matrix<M, N, T>& Matrix<M, N, T>::operator*=(const Matrix<N, N, T>& rhs) noexcept
 	{
 		static_assert(M == N, "Power of non-square matrix!!!");
 		Math::Mul(_m, rhs._m, _m);
@@ -462,7 +672,7 @@ namespace mint
 	}
 
 	template<int32 M, int32 N, typename T>
-	MINT_INLINE Matrix<M, N, T> Matrix<M, N, T>::operator*(const T scalar) const noexcept
+	MINT_INLINE constexpr Matrix<M, N, T> Matrix<M, N, T>::operator*(const T scalar) const noexcept
 	{
 		Matrix result = *this;
 		result *= scalar;
@@ -470,7 +680,7 @@ namespace mint
 	}
 
 	template<int32 M, int32 N, typename T>
-	MINT_INLINE Matrix<M, N, T> Matrix<M, N, T>::operator/(const T scalar) const noexcept
+	MINT_INLINE constexpr Matrix<M, N, T> Matrix<M, N, T>::operator/(const T scalar) const noexcept
 	{
 		Matrix result = *this;
 		result /= scalar;
@@ -478,7 +688,7 @@ namespace mint
 	}
 
 	template<int32 M, int32 N, typename T>
-	MINT_INLINE Matrix<M, N, T> Matrix<M, N, T>::operator+(const Matrix& rhs) const noexcept
+	MINT_INLINE constexpr Matrix<M, N, T> Matrix<M, N, T>::operator+(const Matrix& rhs) const noexcept
 	{
 		Matrix result = *this;
 		result += rhs;
@@ -486,7 +696,7 @@ namespace mint
 	}
 
 	template<int32 M, int32 N, typename T>
-	MINT_INLINE Matrix<M, N, T> Matrix<M, N, T>::operator-(const Matrix& rhs) const noexcept
+	MINT_INLINE constexpr Matrix<M, N, T> Matrix<M, N, T>::operator-(const Matrix& rhs) const noexcept
 	{
 		Matrix result = *this;
 		result -= rhs;
@@ -494,7 +704,7 @@ namespace mint
 	}
 
 	template<int32 M, int32 N, typename T>
-	MINT_INLINE Matrix<M, N, T> Matrix<M, N, T>::operator-() const noexcept
+	MINT_INLINE constexpr Matrix<M, N, T> Matrix<M, N, T>::operator-() const noexcept
 	{
 		Matrix result = *this;
 		Math::SetNeg(result._m);
@@ -503,7 +713,7 @@ namespace mint
 
 	template<int32 M, int32 N, typename T>
 	template<int32 P>
-	MINT_INLINE Matrix<M, P, T> Matrix<M, N, T>::operator*(const Matrix<N, P, T>& rhs) const noexcept
+	MINT_INLINE constexpr Matrix<M, P, T> Matrix<M, N, T>::operator*(const Matrix<N, P, T>& rhs) const noexcept
 	{
 		Matrix<M, P, T> result;
 		Math::Mul(_m, rhs._m, result._m);
@@ -511,28 +721,28 @@ namespace mint
 	}
 
 	template<int32 M, int32 N, typename T>
-	MINT_INLINE void Matrix<M, N, T>::SetElement(const uint32 rowIndex, const uint32 columnIndex, const T value) noexcept
+	MINT_INLINE constexpr void Matrix<M, N, T>::SetElement(const uint32 rowIndex, const uint32 columnIndex, const T value) noexcept
 	{
 		MINT_ASSERT((rowIndex < static_cast<uint32>(M) && columnIndex < static_cast<uint32>(N)), "범위를 벗어난 접근입니다!");
 		_m[rowIndex][columnIndex] = value;
 	}
 
 	template<int32 M, int32 N, typename T>
-	MINT_INLINE void Matrix<M, N, T>::AddElement(const uint32 rowIndex, const uint32 columnIndex, const T value) noexcept
+	MINT_INLINE constexpr void Matrix<M, N, T>::AddElement(const uint32 rowIndex, const uint32 columnIndex, const T value) noexcept
 	{
 		MINT_ASSERT((rowIndex < static_cast<uint32>(M) && columnIndex < static_cast<uint32>(N)), "범위를 벗어난 접근입니다!");
 		_m[rowIndex][columnIndex] += value;
 	}
 
 	template<int32 M, int32 N, typename T>
-	MINT_INLINE void Matrix<M, N, T>::MulElement(const uint32 rowIndex, const uint32 columnIndex, const T value) noexcept
+	MINT_INLINE constexpr void Matrix<M, N, T>::MulElement(const uint32 rowIndex, const uint32 columnIndex, const T value) noexcept
 	{
 		MINT_ASSERT((rowIndex < static_cast<uint32>(M) && columnIndex < static_cast<uint32>(N)), "범위를 벗어난 접근입니다!");
 		_m[rowIndex][columnIndex] *= value;
 	}
 
 	template<int32 M, int32 N, typename T>
-	MINT_INLINE T Matrix<M, N, T>::GetElement(const uint32 rowIndex, const uint32 columnIndex) const noexcept
+	MINT_INLINE constexpr T Matrix<M, N, T>::GetElement(const uint32 rowIndex, const uint32 columnIndex) const noexcept
 	{
 		MINT_ASSERT((rowIndex < static_cast<uint32>(M) && columnIndex < static_cast<uint32>(N)), "범위를 벗어난 접근입니다!");
 		return _m[rowIndex][columnIndex];
@@ -593,7 +803,7 @@ namespace mint
 	}
 
 	template<int32 M, int32 N, typename T>
-	MINT_INLINE Matrix<N, M, T> Matrix<M, N, T>::Transpose() const noexcept
+	MINT_INLINE constexpr Matrix<N, M, T> Matrix<M, N, T>::Transpose() const noexcept
 	{
 		Matrix<N, M, T> result;
 		Math::Transpose(_m, result._m);
@@ -601,7 +811,7 @@ namespace mint
 	}
 
 	template<int32 M, int32 N, typename T>
-	MINT_INLINE T Matrix<M, N, T>::Trace() const noexcept
+	MINT_INLINE constexpr T Matrix<M, N, T>::Trace() const noexcept
 	{
 		if (IsSquareMatrix() == false)
 		{
@@ -612,13 +822,35 @@ namespace mint
 	}
 
 	template<int32 M, int32 N, typename T>
-	MINT_INLINE Matrix<M - 1, N - 1, T> Matrix<M, N, T>::Minor(const uint32 row, const uint32 col) const noexcept
+	MINT_INLINE constexpr Matrix<M - 1, N - 1, T> Matrix<M, N, T>::Minor(const uint32 row, const uint32 col) const noexcept
 	{
 		Matrix<M - 1, N - 1, T> result;
 		Math::Minor(_m, row, col, result._m);
 		return result;
 	}
 
+	template<int32 M, int32 N, typename T>
+	MINT_INLINE constexpr T Matrix<M, N, T>::Determinant() const noexcept requires (M == N)
+	{
+		return Math::Determinant(_m);
+	}
+
+	template<int32 M, int32 N, typename T>
+	MINT_INLINE constexpr Matrix<M, N, T> Matrix<M, N, T>::Adjugate() const noexcept requires (M == N && 2 <= M && M <= 4)
+	{
+		Matrix result;
+		Math::Adjugate(_m, result._m);
+		return result;
+	}
+
+	template<int32 M, int32 N, typename T>
+	MINT_INLINE constexpr Matrix<M, N, T> Matrix<M, N, T>::Inverse() const noexcept requires (M == N)
+	{
+		Matrix result;
+		Math::Inverse(_m, result._m);
+		return result;
+	}
+
 	template<int32 M, int32 N, typename T>
 	MINT_INLINE constexpr bool Matrix<M, N, T>::IsSquareMatrix() const noexcept
 	{
@@ -791,7 +1023,7 @@ namespace mint
 	}
 
 	template<int32 M, int32 N, typename T>
-	MINT_INLINE void Matrix<M, N, T>::SetIdentity() noexcept
+	MINT_INLINE constexpr void Matrix<M, N, T>::SetIdentity() noexcept
 	{
 		if (IsSquareMatrix() == false)
 		{
@@ -802,7 +1034,7 @@ namespace mint
 	}
 
 	template<int32 M, int32 N, typename T>
-	MINT_INLINE void Matrix<M, N, T>::SetZero() noexcept
+	MINT_INLINE constexpr void Matrix<M, N, T>::SetZero() noexcept
 	{
 		Math::SetZeroMat(_m);
 	}
@@ -29,6 +29,11 @@ namespace mint
 
 		// q^(-1)
 		static Quaternion Reciprocal(const Quaternion& q) noexcept;
+
+		// 짧은 쪽 경로로 보간하고 정규화한다. (여러 개를 한 번에 하려면 Math::Nlerp(Float4Stream) 참고)
+		static Quaternion Nlerp(const Quaternion& a, const Quaternion& b, const T t) noexcept;
+		// 짧은 쪽 경로로 보간한다. 두 quaternion 이 거의 같으면 Nlerp 로 계산한다. (여러 개를 한 번에 하려면 Math::Slerp(Float4Stream) 참고)
+		static Quaternion Slerp(const Quaternion& a, const Quaternion& b, const T t) noexcept;
 #pragma endregion
 
 	public:
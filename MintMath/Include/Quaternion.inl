@@ -19,11 +19,45 @@ namespace mint
 	template<typename T>
 	MINT_INLINE Quaternion<T> Quaternion<T>::Reciprocal(const Quaternion& q) noexcept
 	{
-		const Quaternion conjugate = Quaternion::conjugate(q);
+		const Quaternion conjugate = Quaternion::Conjugate(q);
 		const T Norm = Quaternion::Norm(q);
 		return Quaternion(conjugate / (Norm * Norm));
 	}
 
+	template<typename T>
+	MINT_INLINE Quaternion<T> Quaternion<T>::Nlerp(const Quaternion& a, const Quaternion& b, const T t) noexcept
+	{
+		const T dot = a._x * b._x + a._y * b._y + a._z * b._z + a._w * b._w;
+		const T ta = static_cast<T>(1) - t;
+		const T tb = (dot < static_cast<T>(0)) ? -t : t;
+		const Quaternion result(ta * a._w + tb * b._w, ta * a._x + tb * b._x, ta * a._y + tb * b._y, ta * a._z + tb * b._z);
+		return result / Quaternion::Norm(result);
+	}
+
+	template<typename T>
+	MINT_INLINE Quaternion<T> Quaternion<T>::Slerp(const Quaternion& a, const Quaternion& b, const T t) noexcept
+	{
+		T dot = a._x * b._x + a._y * b._y + a._z * b._z + a._w * b._w;
+		T sign = static_cast<T>(1);
+		if (dot < static_cast<T>(0))
+		{
+			dot = -dot;
+			sign = static_cast<T>(-1);
+		}
+
+		// sin(theta) 가 0 에 가까우면 나눗셈이 불안정하다.
+		if (dot > static_cast<T>(0.9995))
+		{
+			return Nlerp(a, b, t);
+		}
+
+		const T theta = ::acos(dot);
+		const T inverseSinTheta = static_cast<T>(1) / ::sin(theta);
+		const T wa = ::sin((static_cast<T>(1) - t) * theta) * inverseSinTheta;
+		const T wb = sign * ::sin(t * theta) * inverseSinTheta;
+		return Quaternion(wa * a._w + wb * b._w, wa * a._x + wb * b._x, wa * a._y + wb * b._y, wa * a._z + wb * b._z);
+	}
+
 	template<typename T>
 	MINT_INLINE Quaternion<T> Quaternion<T>::MakeRotationQuaternion(const Float3& axis, const T angle) noexcept
 	{
@@ -155,13 +189,13 @@ namespace mint
 	template<typename T>
 	MINT_INLINE Quaternion<T> Quaternion<T>::Conjugate() const noexcept
 	{
-		return Quaternion::conjugate(*this);
+		return Quaternion::Conjugate(*this);
 	}
 
 	template<typename T>
 	MINT_INLINE Quaternion<T> Quaternion<T>::Reciprocal() const noexcept
 	{
-		return Quaternion::reciprocal(*this);
+		return Quaternion::Reciprocal(*this);
 	}
 
 	template<typename T>
@@ -188,7 +222,7 @@ namespace mint
 		const Float3 normalizedAxis = Float3::Normalize(axis);
 		const T halfAngle = static_cast<T>(angle * 0.5);
 		const T cosHalfAngle = ::cos(halfAngle);
-		const T sinHalfAngle = static_cast<T>(1.0 - cosHalfAngle * cosHalfAngle);
+		const T sinHalfAngle = ::sin(halfAngle);
 		_x = sinHalfAngle * normalizedAxis._x;
 		_y = sinHalfAngle * normalizedAxis._y;
 		_z = sinHalfAngle * normalizedAxis._z;
@@ -201,7 +235,7 @@ namespace mint
 		const Vec3<T>& normalizedAxis = axis.Normalize();
 		const T halfAngle = static_cast<T>(angle * 0.5);
 		const T cosHalfAngle = ::cos(halfAngle);
-		const T sinHalfAngle = static_cast<T>(1.0 - cosHalfAngle * cosHalfAngle);
+		const T sinHalfAngle = ::sin(halfAngle);
 		_x = sinHalfAngle * normalizedAxis.GetComponent(0);
 		_y = sinHalfAngle * normalizedAxis.GetComponent(1);
 		_z = sinHalfAngle * normalizedAxis.GetComponent(2);
@@ -69,6 +69,8 @@ namespace mint
 		constexpr Float2 Bound(const Float2& position) const noexcept;
 		constexpr bool Contains(const Float2& position) const noexcept;
 		constexpr bool Contains(const Rect& rhs) const noexcept;
+		// 경계가 닿기만 해도 true
+		constexpr bool Intersects(const Rect& rhs) const noexcept;
 
 	public:
 		bool IsNAN() const noexcept;
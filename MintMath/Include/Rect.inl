@@ -220,6 +220,11 @@ namespace mint
 		return (Left() <= rhs.Left()) && (rhs.Right() <= Right()) && (Top() >= rhs.Top()) && (rhs.Bottom() >= Bottom());
 	}
 
+	MINT_INLINE constexpr bool Rect::Intersects(const Rect& rhs) const noexcept
+	{
+		return (Left() <= rhs.Right()) && (rhs.Left() <= Right()) && (Top() <= rhs.Bottom()) && (rhs.Top() <= Bottom());
+	}
+
 	MINT_INLINE bool Rect::IsNAN() const noexcept
 	{
 		return _raw.IsNAN();
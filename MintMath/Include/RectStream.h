@@ -0,0 +1,91 @@
+﻿#pragma once
+
+
+#ifndef _MINT_MATH_RECT_STREAM_H_
+#define _MINT_MATH_RECT_STREAM_H_
+
+
+#include <MintCommon/Include/CommonDefinitions.h>
+
+#include <MintContainer/Include/Vector.h>
+
+#include <MintMath/Include/Rect.h>
+#include <MintMath/Include/FloatStream.h>
+
+
+namespace mint
+{
+	// Rect 의 배열을 left / right / top / bottom 별로 나누어 (SoA) 저장한다.
+	// 많은 Rect 에 대한 hit test, culling, clipping 을 SIMD 로 한 번에 할 수 있다. (FloatStream 참고)
+	class RectStream final
+	{
+	public:
+		RectStream();
+		explicit RectStream(const uint32 size);
+		RectStream(const RectStream& rhs) = default;
+		RectStream(RectStream&& rhs) noexcept;
+		~RectStream() = default;
+
+	public:
+		RectStream& operator=(const RectStream& rhs) = default;
+		RectStream& operator=(RectStream&& rhs) noexcept;
+
+	public:
+		void Resize(const uint32 size);
+		void Reserve(const uint32 capacity);
+		void Clear() noexcept;
+		void PushBack(const Rect& rect);
+		void Set(const uint32 index, const Rect& rect) noexcept;
+		Rect Get(const uint32 index) const noexcept;
+		// AoS 배열로부터 채운다.
+		void Assign(const Rect* const rects, const uint32 count);
+
+	public:
+		MINT_INLINE uint32 Size() const noexcept { return _size; }
+		MINT_INLINE bool IsEmpty() const noexcept { return _size == 0; }
+		MINT_INLINE float* GetLeftData() noexcept { return _lefts.Data(); }
+		MINT_INLINE const float* GetLeftData() const noexcept { return _lefts.Data(); }
+		MINT_INLINE float* GetRightData() noexcept { return _rights.Data(); }
+		MINT_INLINE const float* GetRightData() const noexcept { return _rights.Data(); }
+		MINT_INLINE float* GetTopData() noexcept { return _tops.Data(); }
+		MINT_INLINE const float* GetTopData() const noexcept { return _tops.Data(); }
+		MINT_INLINE float* GetBottomData() noexcept { return _bottoms.Data(); }
+		MINT_INLINE const float* GetBottomData() const noexcept { return _bottoms.Data(); }
+
+	private:
+		Vector<float> _lefts;
+		Vector<float> _rights;
+		Vector<float> _tops;
+		Vector<float> _bottoms;
+		uint32 _size;
+	};
+
+
+	// SSE (AVX 로 빌드하면 AVX) 로 한 번에 4 (8) 개씩 계산하고, 나머지는 scalar 로 계산한다.
+	// 결과 bitmask 는 (Size() + 63) / 64 개의 uint64 이고, i 번째 Rect 의 결과는 outMasks[i / 64] 의 (i % 64) 번째 bit (LSB 부터) 이다.
+	// 마지막 word 의 남는 bit 는 0 이다.
+	namespace Math
+	{
+		// Rect::Contains(const Float2&) 와 같은 결과. (경계 포함, 넓이가 0 인 Rect 는 false)
+		void Contains(const RectStream& rects, const Float2& point, Vector<uint64>& outMasks);
+		// Rect::Intersects() 와 같은 결과. (경계가 닿기만 해도 true)
+		// 화면이나 clip rect 를 query 로 넘기면 culling 결과 (보이는 Rect 의 bit 가 1) 가 된다.
+		void Intersects(const RectStream& rects, const Rect& query, Vector<uint64>& outMasks);
+		// 모든 Rect 에 Rect::ClipBy() 를 한다.
+		void ClipBy(RectStream& inoutRects, const Rect& outerRect) noexcept;
+
+		// viewProjection 으로 그려지는 view frustum 의 평면 6 개 (left, right, bottom, top, near, far)
+		// 평면 (a, b, c, d) 는 a * x + b * y + c * z + d >= 0 인 쪽이 안쪽이고, 정규화하지 않는다.
+		// clip space 의 z 범위는 [0, 1] 이다. (Float4x4::ProjectionMatrixPerspectiveYUP 참고)
+		void ComputeFrustumPlanes(const Float4x4& viewProjection, Float4 (&outPlanes)[6]) noexcept;
+		// frustum 과 겹치는 (보이는) AABB 의 bit 가 1 이다. AABB 는 중심과 반지름 (halfSize) 으로 넘긴다.
+		// 평면마다 따로 검사하므로 frustum 모서리 바깥에 걸친 AABB 도 보인다고 할 수 있다. (보수적)
+		void CullAABBs(const Float4 (&frustumPlanes)[6], const Float3Stream& centers, const Float3Stream& halfSizes, Vector<uint64>& outVisibleMasks);
+
+		// masks 에서 1 인 bit 의 개수
+		uint32 CountSetBits(const Vector<uint64>& masks) noexcept;
+	}
+}
+
+
+#endif // !_MINT_MATH_RECT_STREAM_H_
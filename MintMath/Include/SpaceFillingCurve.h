@@ -0,0 +1,82 @@
+﻿#pragma once
+
+
+#ifndef _MINT_MATH_SPACE_FILLING_CURVE_H_
+#define _MINT_MATH_SPACE_FILLING_CURVE_H_
+
+
+#include <MintCommon/Include/CommonDefinitions.h>
+
+#include <MintContainer/Include/Vector.h>
+
+#include <MintMath/Include/FloatStream.h>
+
+
+namespace mint
+{
+	// 정수 격자 좌표를 공간 채움 곡선 (Morton = Z-order, Hilbert) 위의 위치 (code) 로 바꾼다.
+	// code 로 정렬하면 (RadixSort 등) 공간에서 가까운 물체들이 메모리에서도 가까이 놓인다.
+	// - 2D 는 축마다 16 bit 를 써서 uint32 code 를, 3D 는 축마다 21 bit 를 써서 uint64 code 를 만든다. 입력의 그보다 높은 bit 는 무시한다.
+	// - Morton 은 bit 를 번갈아 놓기만 하므로 빠르지만 곡선이 크게 건너뛰는 곳이 있다.
+	//   Hilbert 는 이웃한 code 가 항상 이웃한 칸이라 지역성이 더 좋지만 계산이 더 비싸다.
+	// - 더 작은 격자 (축마다 n bit) 에서의 순서가 필요하면 좌표를 (16 - n) bit 만큼 왼쪽으로 밀어서 넣으면 된다.
+	namespace Math
+	{
+		static constexpr uint32 kSpaceFillingCurve2DAxisBitCount = 16;
+		static constexpr uint32 kSpaceFillingCurve3DAxisBitCount = 21;
+
+		// x 가 가장 낮은 bit 에 온다.
+		constexpr uint32 EncodeMorton2D(const uint32 x, const uint32 y) noexcept;
+		constexpr void DecodeMorton2D(const uint32 code, uint32& outX, uint32& outY) noexcept;
+		constexpr uint64 EncodeMorton3D(const uint32 x, const uint32 y, const uint32 z) noexcept;
+		constexpr void DecodeMorton3D(const uint64 code, uint32& outX, uint32& outY, uint32& outZ) noexcept;
+
+		// (0, 0) 에서 시작해서 (65535, 0) 에서 끝난다.
+		uint32 EncodeHilbert2D(const uint32 x, const uint32 y) noexcept;
+		void DecodeHilbert2D(const uint32 code, uint32& outX, uint32& outY) noexcept;
+		uint64 EncodeHilbert3D(const uint32 x, const uint32 y, const uint32 z) noexcept;
+		void DecodeHilbert3D(const uint64 code, uint32& outX, uint32& outY, uint32& outZ) noexcept;
+
+		// [min, max] 를 2^bitCount 칸으로 나눴을 때 value 가 들어가는 칸. 범위 밖의 값은 양 끝 칸으로 자른다.
+		uint32 QuantizeToGrid(const float value, const float min, const float max, const uint32 bitCount) noexcept;
+		// float 좌표를 bounds 안의 격자로 양자화한 뒤 code 로 바꾼다.
+		uint32 EncodeMorton2D(const Float2& position, const Float2& boundsMin, const Float2& boundsMax) noexcept;
+		uint64 EncodeMorton3D(const Float3& position, const Float3& boundsMin, const Float3& boundsMax) noexcept;
+		uint32 EncodeHilbert2D(const Float2& position, const Float2& boundsMin, const Float2& boundsMax) noexcept;
+		uint64 EncodeHilbert3D(const Float3& position, const Float3& boundsMin, const Float3& boundsMax) noexcept;
+
+		// 여러 좌표를 한 번에 바꾼다. outCodes / outXs 등은 count 개 이상이어야 한다.
+		// 2D 는 SSE (AVX2 로 빌드하면 AVX2) 로 4 (8) 개씩, 3D Morton 은 CPU 가 지원하면 BMI2 (PDEP / PEXT) 로 계산한다.
+		void EncodeMorton2D(const uint32* const xs, const uint32* const ys, const uint32 count, uint32* const outCodes) noexcept;
+		void DecodeMorton2D(const uint32* const codes, const uint32 count, uint32* const outXs, uint32* const outYs) noexcept;
+		void EncodeMorton3D(const uint32* const xs, const uint32* const ys, const uint32* const zs, const uint32 count, uint64* const outCodes) noexcept;
+		void DecodeMorton3D(const uint64* const codes, const uint32 count, uint32* const outXs, uint32* const outYs, uint32* const outZs) noexcept;
+		void EncodeHilbert2D(const uint32* const xs, const uint32* const ys, const uint32 count, uint32* const outCodes) noexcept;
+		void EncodeMorton2D(const Float2Stream& positions, const Float2& boundsMin, const Float2& boundsMax, Vector<uint32>& outCodes);
+		void EncodeMorton3D(const Float3Stream& positions, const Float3& boundsMin, const Float3& boundsMax, Vector<uint64>& outCodes);
+		void EncodeHilbert2D(const Float2Stream& positions, const Float2& boundsMin, const Float2& boundsMax, Vector<uint32>& outCodes);
+	}
+
+
+	// 3D Morton 의 여러 개 버전은 실행 중인 CPU 에 맞는 구현을 처음 호출할 때 고른다. (AffineMatKernel 참고)
+	namespace SpaceFillingCurveKernel
+	{
+		enum class InstructionSet : uint8
+		{
+			Portable,	// bit 를 magic number 로 벌리고 모은다.
+			BMI2,		// PDEP / PEXT. 64 bit 빌드에서만 쓸 수 있다.
+		};
+
+		// PDEP / PEXT 가 느린 CPU 에서는 BMI2 를 지원해도 Portable 을 고른다.
+		InstructionSet GetInstructionSet() noexcept;
+		// 구현을 직접 고른다. (비교나 테스트용)
+		// CPU 가 지원하지 않는 명령어 집합이면 바꾸지 않고 false 를 반환한다.
+		bool SetInstructionSet(const InstructionSet instructionSet) noexcept;
+	}
+}
+
+
+#include <MintMath/Include/SpaceFillingCurve.inl>
+
+
+#endif // !_MINT_MATH_SPACE_FILLING_CURVE_H_
@@ -0,0 +1,314 @@
+﻿#pragma once
+
+
+#include <immintrin.h>
+
+
+namespace mint
+{
+	namespace Math
+	{
+		namespace SpaceFillingCurveInternal
+		{
+			// 0b1111 => 0b01010101
+			MINT_INLINE constexpr uint32 SpreadBits1(uint32 value) noexcept
+			{
+				value &= 0x0000FFFF;
+				value = (value | (value << 8)) & 0x00FF00FF;
+				value = (value | (value << 4)) & 0x0F0F0F0F;
+				value = (value | (value << 2)) & 0x33333333;
+				value = (value | (value << 1)) & 0x55555555;
+				return value;
+			}
+
+			MINT_INLINE constexpr uint32 CompactBits1(uint32 value) noexcept
+			{
+				value &= 0x55555555;
+				value = (value ^ (value >> 1)) & 0x33333333;
+				value = (value ^ (value >> 2)) & 0x0F0F0F0F;
+				value = (value ^ (value >> 4)) & 0x00FF00FF;
+				value = (value ^ (value >> 8)) & 0x0000FFFF;
+				return value;
+			}
+
+			// 0b1111 => 0b001001001001
+			MINT_INLINE constexpr uint64 SpreadBits2(const uint32 value) noexcept
+			{
+				uint64 result = value & 0x001FFFFF;
+				result = (result | (result << 32)) & 0x001F00000000FFFFull;
+				result = (result | (result << 16)) & 0x001F0000FF0000FFull;
+				result = (result | (result << 8)) & 0x100F00F00F00F00Full;
+				result = (result | (result << 4)) & 0x10C30C30C30C30C3ull;
+				result = (result | (result << 2)) & 0x1249249249249249ull;
+				return result;
+			}
+
+			MINT_INLINE constexpr uint32 CompactBits2(uint64 value) noexcept
+			{
+				value &= 0x1249249249249249ull;
+				value = (value ^ (value >> 2)) & 0x10C30C30C30C30C3ull;
+				value = (value ^ (value >> 4)) & 0x100F00F00F00F00Full;
+				value = (value ^ (value >> 8)) & 0x001F0000FF0000FFull;
+				value = (value ^ (value >> 16)) & 0x001F00000000FFFFull;
+				value = (value ^ (value >> 32)) & 0x00000000001FFFFFull;
+				return static_cast<uint32>(value);
+			}
+
+			// 같은 bit 연산을 uint32 / __m128i 에 쓰기 위한 연산 묶음
+			namespace Lane
+			{
+				struct Scalar
+				{
+					using Type = uint32;
+
+					static MINT_INLINE Type Set(const uint32 value) noexcept { return value; }
+					static MINT_INLINE Type And(const Type lhs, const Type rhs) noexcept { return lhs & rhs; }
+					static MINT_INLINE Type Or(const Type lhs, const Type rhs) noexcept { return lhs | rhs; }
+					static MINT_INLINE Type Xor(const Type lhs, const Type rhs) noexcept { return lhs ^ rhs; }
+					template<int32 kShift>
+					static MINT_INLINE Type ShiftLeft(const Type value) noexcept { return value << kShift; }
+					template<int32 kShift>
+					static MINT_INLINE Type ShiftRight(const Type value) noexcept { return value >> kShift; }
+				};
+
+				struct SSE
+				{
+					using Type = __m128i;
+
+					static MINT_INLINE Type Set(const uint32 value) noexcept { return _mm_set1_epi32(static_cast<int32>(value)); }
+					static MINT_INLINE Type And(const Type lhs, const Type rhs) noexcept { return _mm_and_si128(lhs, rhs); }
+					static MINT_INLINE Type Or(const Type lhs, const Type rhs) noexcept { return _mm_or_si128(lhs, rhs); }
+					static MINT_INLINE Type Xor(const Type lhs, const Type rhs) noexcept { return _mm_xor_si128(lhs, rhs); }
+					template<int32 kShift>
+					static MINT_INLINE Type ShiftLeft(const Type value) noexcept { return _mm_slli_epi32(value, kShift); }
+					template<int32 kShift>
+					static MINT_INLINE Type ShiftRight(const Type value) noexcept { return _mm_srli_epi32(value, kShift); }
+				};
+
+#if defined __AVX2__
+				struct AVX2
+				{
+					using Type = __m256i;
+
+					static MINT_INLINE Type Set(const uint32 value) noexcept { return _mm256_set1_epi32(static_cast<int32>(value)); }
+					static MINT_INLINE Type And(const Type lhs, const Type rhs) noexcept { return _mm256_and_si256(lhs, rhs); }
+					static MINT_INLINE Type Or(const Type lhs, const Type rhs) noexcept { return _mm256_or_si256(lhs, rhs); }
+					static MINT_INLINE Type Xor(const Type lhs, const Type rhs) noexcept { return _mm256_xor_si256(lhs, rhs); }
+					template<int32 kShift>
+					static MINT_INLINE Type ShiftLeft(const Type value) noexcept { return _mm256_slli_epi32(value, kShift); }
+					template<int32 kShift>
+					static MINT_INLINE Type ShiftRight(const Type value) noexcept { return _mm256_srli_epi32(value, kShift); }
+				};
+#endif
+			}
+
+			template<typename L>
+			MINT_INLINE typename L::Type SpreadBits1Impl(typename L::Type value) noexcept
+			{
+				value = L::And(value, L::Set(0x0000FFFF));
+				value = L::And(L::Or(value, L::template ShiftLeft<8>(value)), L::Set(0x00FF00FF));
+				value = L::And(L::Or(value, L::template ShiftLeft<4>(value)), L::Set(0x0F0F0F0F));
+				value = L::And(L::Or(value, L::template ShiftLeft<2>(value)), L::Set(0x33333333));
+				value = L::And(L::Or(value, L::template ShiftLeft<1>(value)), L::Set(0x55555555));
+				return value;
+			}
+
+			template<typename L>
+			MINT_INLINE typename L::Type CompactBits1Impl(typename L::Type value) noexcept
+			{
+				value = L::And(value, L::Set(0x55555555));
+				value = L::And(L::Xor(value, L::template ShiftRight<1>(value)), L::Set(0x33333333));
+				value = L::And(L::Xor(value, L::template ShiftRight<2>(value)), L::Set(0x0F0F0F0F));
+				value = L::And(L::Xor(value, L::template ShiftRight<4>(value)), L::Set(0x00FF00FF));
+				value = L::And(L::Xor(value, L::template ShiftRight<8>(value)), L::Set(0x0000FFFF));
+				return value;
+			}
+
+			template<typename L>
+			MINT_INLINE typename L::Type EncodeMorton2DImpl(const typename L::Type x, const typename L::Type y) noexcept
+			{
+				return L::Or(SpreadBits1Impl<L>(x), L::template ShiftLeft<1>(SpreadBits1Impl<L>(y)));
+			}
+
+			// 분기 없는 Hilbert 변환. bit 마다 돌면서 사분면을 회전하는 대신, 회전 상태를 prefix scan 으로 한꺼번에 구한다.
+			// (http://threadlocalmutex.com/?p=126)
+			template<typename L>
+			MINT_INLINE typename L::Type EncodeHilbert2DImpl(typename L::Type x, typename L::Type y) noexcept
+			{
+				using Type = typename L::Type;
+				const Type kMask = L::Set(0xFFFF);
+				x = L::And(x, kMask);
+				y = L::And(y, kMask);
+
+				Type A;
+				Type B;
+				Type C;
+				Type D;
+				{
+					const Type a = L::Xor(x, y);
+					const Type b = L::Xor(kMask, a);
+					const Type c = L::Xor(kMask, L::Or(x, y));
+					const Type d = L::And(x, L::Xor(y, kMask));
+					A = L::Or(a, L::template ShiftRight<1>(b));
+					B = L::Xor(L::template ShiftRight<1>(a), a);
+					C = L::Xor(L::Xor(L::template ShiftRight<1>(c), L::And(b, L::template ShiftRight<1>(d))), c);
+					D = L::Xor(L::Xor(L::And(a, L::template ShiftRight<1>(c)), L::template ShiftRight<1>(d)), d);
+				}
+				{
+					const Type a = A;
+					const Type b = B;
+					const Type c = C;
+					const Type d = D;
+					A = L::Xor(L::And(a, L::template ShiftRight<2>(a)), L::And(b, L::template ShiftRight<2>(b)));
+					B = L::Xor(L::And(a, L::template ShiftRight<2>(b)), L::And(b, L::template ShiftRight<2>(L::Xor(a, b))));
+					C = L::Xor(C, L::Xor(L::And(a, L::template ShiftRight<2>(c)), L::And(b, L::template ShiftRight<2>(d))));
+					D = L::Xor(D, L::Xor(L::And(b, L::template ShiftRight<2>(c)), L::And(L::Xor(a, b), L::template ShiftRight<2>(d))));
+				}
+				{
+					const Type a = A;
+					const Type b = B;
+					const Type c = C;
+					const Type d = D;
+					A = L::Xor(L::And(a, L::template ShiftRight<4>(a)), L::And(b, L::template ShiftRight<4>(b)));
+					B = L::Xor(L::And(a, L::template ShiftRight<4>(b)), L::And(b, L::template ShiftRight<4>(L::Xor(a, b))));
+					C = L::Xor(C, L::Xor(L::And(a, L::template ShiftRight<4>(c)), L::And(b, L::template ShiftRight<4>(d))));
+					D = L::Xor(D, L::Xor(L::And(b, L::template ShiftRight<4>(c)), L::And(L::Xor(a, b), L::template ShiftRight<4>(d))));
+				}
+				{
+					const Type a = A;
+					const Type b = B;
+					const Type c = C;
+					const Type d = D;
+					C = L::Xor(C, L::Xor(L::And(a, L::template ShiftRight<8>(c)), L::And(b, L::template ShiftRight<8>(d))));
+					D = L::Xor(D, L::Xor(L::And(b, L::template ShiftRight<8>(c)), L::And(L::Xor(a, b), L::template ShiftRight<8>(d))));
+				}
+
+				const Type a = L::Xor(C, L::template ShiftRight<1>(C));
+				const Type b = L::Xor(D, L::template ShiftRight<1>(D));
+				const Type i0 = L::Xor(x, y);
+				const Type i1 = L::Or(b, L::Xor(kMask, L::Or(i0, a)));
+				return EncodeMorton2DImpl<L>(i0, i1);
+			}
+
+			MINT_INLINE constexpr uint32 PrefixXor16(uint32 value) noexcept
+			{
+				value ^= (value >> 8);
+				value ^= (value >> 4);
+				value ^= (value >> 2);
+				value ^= (value >> 1);
+				return value;
+			}
+
+			// John Skilling, "Programming the Hilbert curve" (2004) 의 transpose 표현.
+			// axes[0] 이 가장 높은 bit 를 가진다.
+			// 원래 알고리즘의 bit 마다의 분기는 예측이 안 되므로 mask 로 바꿔서 계산한다.
+			MINT_INLINE void AxesToHilbertTranspose3D(uint32(&inoutAxes)[3]) noexcept
+			{
+				for (uint32 bitIndex = kSpaceFillingCurve3DAxisBitCount - 1; bitIndex > 0; --bitIndex)
+				{
+					const uint32 lowerBits = (1u << bitIndex) - 1;
+					for (uint32 i = 0; i < 3; ++i)
+					{
+						// bit 가 켜져 있으면 axes[0] 의 아래 bit 들을 뒤집고, 아니면 axes[0] 과 axes[i] 의 아래 bit 들을 맞바꾼다.
+						const uint32 isSet = 0u - ((inoutAxes[i] >> bitIndex) & 1);
+						const uint32 swapBits = (inoutAxes[0] ^ inoutAxes[i]) & lowerBits & ~isSet;
+						inoutAxes[0] ^= (lowerBits & isSet) ^ swapBits;
+						inoutAxes[i] ^= swapBits;
+					}
+				}
+
+				inoutAxes[1] ^= inoutAxes[0];
+				inoutAxes[2] ^= inoutAxes[1];
+				uint32 t = 0;
+				for (uint32 bitIndex = kSpaceFillingCurve3DAxisBitCount - 1; bitIndex > 0; --bitIndex)
+				{
+					const uint32 isSet = 0u - ((inoutAxes[2] >> bitIndex) & 1);
+					t ^= ((1u << bitIndex) - 1) & isSet;
+				}
+				inoutAxes[0] ^= t;
+				inoutAxes[1] ^= t;
+				inoutAxes[2] ^= t;
+			}
+
+			MINT_INLINE void HilbertTransposeToAxes3D(uint32(&inoutAxes)[3]) noexcept
+			{
+				const uint32 t = inoutAxes[2] >> 1;
+				inoutAxes[2] ^= inoutAxes[1];
+				inoutAxes[1] ^= inoutAxes[0];
+				inoutAxes[0] ^= t;
+				for (uint32 bitIndex = 1; bitIndex < kSpaceFillingCurve3DAxisBitCount; ++bitIndex)
+				{
+					const uint32 lowerBits = (1u << bitIndex) - 1;
+					for (uint32 i = 3; i > 0; --i)
+					{
+						const uint32 isSet = 0u - ((inoutAxes[i - 1] >> bitIndex) & 1);
+						const uint32 swapBits = (inoutAxes[0] ^ inoutAxes[i - 1]) & lowerBits & ~isSet;
+						inoutAxes[0] ^= (lowerBits & isSet) ^ swapBits;
+						inoutAxes[i - 1] ^= swapBits;
+					}
+				}
+			}
+		}
+
+
+		MINT_INLINE constexpr uint32 EncodeMorton2D(const uint32 x, const uint32 y) noexcept
+		{
+			return SpaceFillingCurveInternal::SpreadBits1(x) | (SpaceFillingCurveInternal::SpreadBits1(y) << 1);
+		}
+
+		MINT_INLINE constexpr void DecodeMorton2D(const uint32 code, uint32& outX, uint32& outY) noexcept
+		{
+			outX = SpaceFillingCurveInternal::CompactBits1(code);
+			outY = SpaceFillingCurveInternal::CompactBits1(code >> 1);
+		}
+
+		MINT_INLINE constexpr uint64 EncodeMorton3D(const uint32 x, const uint32 y, const uint32 z) noexcept
+		{
+			return SpaceFillingCurveInternal::SpreadBits2(x) | (SpaceFillingCurveInternal::SpreadBits2(y) << 1) | (SpaceFillingCurveInternal::SpreadBits2(z) << 2);
+		}
+
+		MINT_INLINE constexpr void DecodeMorton3D(const uint64 code, uint32& outX, uint32& outY, uint32& outZ) noexcept
+		{
+			outX = SpaceFillingCurveInternal::CompactBits2(code);
+			outY = SpaceFillingCurveInternal::CompactBits2(code >> 1);
+			outZ = SpaceFillingCurveInternal::CompactBits2(code >> 2);
+		}
+
+		MINT_INLINE uint32 EncodeHilbert2D(const uint32 x, const uint32 y) noexcept
+		{
+			return SpaceFillingCurveInternal::EncodeHilbert2DImpl<SpaceFillingCurveInternal::Lane::Scalar>(x, y);
+		}
+
+		MINT_INLINE void DecodeHilbert2D(const uint32 code, uint32& outX, uint32& outY) noexcept
+		{
+			using namespace SpaceFillingCurveInternal;
+			const uint32 i0 = CompactBits1(code);
+			const uint32 i1 = CompactBits1(code >> 1);
+			const uint32 t0 = (i0 | i1) ^ 0xFFFF;
+			const uint32 t1 = i0 & i1;
+			const uint32 prefixT0 = PrefixXor16(t0);
+			const uint32 prefixT1 = PrefixXor16(t1);
+			const uint32 a = ((i0 ^ 0xFFFF) & prefixT1) | (i0 & prefixT0);
+			outX = (a ^ i1) & 0xFFFF;
+			outY = (a ^ i0 ^ i1) & 0xFFFF;
+		}
+
+		MINT_INLINE uint64 EncodeHilbert3D(const uint32 x, const uint32 y, const uint32 z) noexcept
+		{
+			static constexpr uint32 kMask = (1u << kSpaceFillingCurve3DAxisBitCount) - 1;
+			uint32 axes[3]{ x & kMask, y & kMask, z & kMask };
+			SpaceFillingCurveInternal::AxesToHilbertTranspose3D(axes);
+			return EncodeMorton3D(axes[2], axes[1], axes[0]);
+		}
+
+		MINT_INLINE void DecodeHilbert3D(const uint64 code, uint32& outX, uint32& outY, uint32& outZ) noexcept
+		{
+			uint32 axes[3]{};
+			DecodeMorton3D(code, axes[2], axes[1], axes[0]);
+			SpaceFillingCurveInternal::HilbertTransposeToAxes3D(axes);
+			outX = axes[0];
+			outY = axes[1];
+			outZ = axes[2];
+		}
+	}
+}
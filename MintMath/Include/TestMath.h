@@ -18,6 +18,12 @@ namespace mint
 		bool Test_FloatTypes();
 		bool Test_Transforms();
 		bool Test_LinearAlgebra();
+		bool Test_FloatStreams();
+		bool Test_FastMath();
+		bool Test_Geometry();
+		bool Test_SpaceFillingCurves();
+		bool Test_FixedPoint();
+		bool Test_RectStreams();
 	}
 }
 
@@ -8,6 +8,7 @@
 #include <MintMath/Include/Float3x3.h>
 #include <MintMath/Include/Float4x4.h>
 #include <MintMath/Include/Quaternion.h>
+#include <MintMath/Include/FloatStream.h>
 
 
 namespace mint
@@ -30,6 +31,39 @@ namespace mint
 	};
 #pragma endregion
 
+#pragma region TransformStream
+	// Transform 배열을 성분별로 나누어 (SoA) 저장한다. (Math::ToMatrices 참고)
+	// rotation 은 Float4(x, y, z, w) 로 저장한다.
+	class TransformStream final
+	{
+	public:
+		TransformStream() = default;
+		explicit TransformStream(const uint32 size);
+
+	public:
+		void Resize(const uint32 size);
+		void Reserve(const uint32 capacity);
+		void Clear() noexcept;
+		void PushBack(const Transform& transform);
+		void Set(const uint32 index, const Transform& transform) noexcept;
+		Transform Get(const uint32 index) const noexcept;
+
+	public:
+		MINT_INLINE uint32 Size() const noexcept { return _translations.Size(); }
+		MINT_INLINE Float3Stream& GetScales() noexcept { return _scales; }
+		MINT_INLINE const Float3Stream& GetScales() const noexcept { return _scales; }
+		MINT_INLINE Float4Stream& GetRotations() noexcept { return _rotations; }
+		MINT_INLINE const Float4Stream& GetRotations() const noexcept { return _rotations; }
+		MINT_INLINE Float3Stream& GetTranslations() noexcept { return _translations; }
+		MINT_INLINE const Float3Stream& GetTranslations() const noexcept { return _translations; }
+
+	private:
+		Float3Stream _scales;
+		Float4Stream _rotations;
+		Float3Stream _translations;
+	};
+#pragma endregion
+
 #pragma region Transform2D
 	struct Transform2D
 	{
@@ -62,6 +96,23 @@ namespace mint
 	namespace Math
 	{
 		bool Equals(const Transform2D& lhs, const Transform2D& rhs, float epsilon = 0) noexcept;
+
+		// 아래 함수들은 SSE 로 한 번에 4 개씩 계산하고, 나머지는 scalar 로 계산한다.
+
+		// outMatrices[i] = transforms[i].ToMatrix()
+		void ToMatrices(const Transform* const transforms, const uint32 count, Float4x4* const outMatrices) noexcept;
+		// outMatrices 는 transforms.Size() 개 이상이어야 한다.
+		void ToMatrices(const TransformStream& transforms, Float4x4* const outMatrices) noexcept;
+		// outMatrices[i] = parentMatrices[i] * localMatrices[i]
+		void ComposeMatrices(const Float4x4* const parentMatrices, const Float4x4* const localMatrices, const uint32 count, Float4x4* const outMatrices) noexcept;
+		// outWorldMatrices[i] = outWorldMatrices[parentIndices[i]] * localMatrices[i]
+		// 부모가 먼저 나오도록 정렬되어 있어야 한다. (parentIndices[i] < i, 부모가 없으면 -1)
+		void ComposeHierarchy(const int32* const parentIndices, const Float4x4* const localMatrices, const uint32 count, Float4x4* const outWorldMatrices) noexcept;
+
+		// quaternion 을 Float4(x, y, z, w) 로 담은 stream 을 보간한다. (QuaternionF::Nlerp, QuaternionF::Slerp 와 같은 결과)
+		// in/out 에 같은 stream 을 넘겨도 된다.
+		void Nlerp(const Float4Stream& a, const Float4Stream& b, const float t, Float4Stream& out);
+		void Slerp(const Float4Stream& a, const Float4Stream& b, const float t, Float4Stream& out);
 	}
 }
 
@@ -0,0 +1,246 @@
+﻿#include <MintMath/Include/AffineMat.h>
+
+#include <MintCommon/Include/CPUFeatures.h>
+
+#include <immintrin.h>
+
+
+namespace mint
+{
+	namespace AffineMatKernel
+	{
+		// row-major 4x4 행렬의 row 하나를 lhs 의 각 성분으로 rhs row 들을 섞어서 만든다.
+		// result[i] = l[i][0] * r[0] + l[i][1] * r[1] + l[i][2] * r[2] + l[i][3] * r[3]
+		namespace SSE
+		{
+			static void MulMatrix(const AffineVecF* const lhsRows, const AffineVecF* const rhsRows, AffineVecF* const outRows) noexcept
+			{
+				const __m128 r0 = rhsRows[0].GetRaw();
+				const __m128 r1 = rhsRows[1].GetRaw();
+				const __m128 r2 = rhsRows[2].GetRaw();
+				const __m128 r3 = rhsRows[3].GetRaw();
+				__m128 result[4];
+				for (uint32 row = 0; row < 4; ++row)
+				{
+					const __m128 l = lhsRows[row].GetRaw();
+					result[row] = _mm_add_ps(
+						_mm_add_ps(_mm_mul_ps(_mm_shuffle_ps(l, l, _MM_SHUFFLE(0, 0, 0, 0)), r0), _mm_mul_ps(_mm_shuffle_ps(l, l, _MM_SHUFFLE(1, 1, 1, 1)), r1)),
+						_mm_add_ps(_mm_mul_ps(_mm_shuffle_ps(l, l, _MM_SHUFFLE(2, 2, 2, 2)), r2), _mm_mul_ps(_mm_shuffle_ps(l, l, _MM_SHUFFLE(3, 3, 3, 3)), r3)));
+				}
+				for (uint32 row = 0; row < 4; ++row)
+				{
+					outRows[row] = AffineVecF(result[row]);
+				}
+			}
+
+			static void MulVectors(const AffineVecF* const rows, const AffineVecF* const vectors, const uint32 count, AffineVecF* const outVectors) noexcept
+			{
+				__m128 c0 = rows[0].GetRaw();
+				__m128 c1 = rows[1].GetRaw();
+				__m128 c2 = rows[2].GetRaw();
+				__m128 c3 = rows[3].GetRaw();
+				_MM_TRANSPOSE4_PS(c0, c1, c2, c3);
+				for (uint32 index = 0; index < count; ++index)
+				{
+					const __m128 v = vectors[index].GetRaw();
+					outVectors[index] = AffineVecF(_mm_add_ps(
+						_mm_add_ps(_mm_mul_ps(c0, _mm_shuffle_ps(v, v, _MM_SHUFFLE(0, 0, 0, 0))), _mm_mul_ps(c1, _mm_shuffle_ps(v, v, _MM_SHUFFLE(1, 1, 1, 1)))),
+						_mm_add_ps(_mm_mul_ps(c2, _mm_shuffle_ps(v, v, _MM_SHUFFLE(2, 2, 2, 2))), _mm_mul_ps(c3, _mm_shuffle_ps(v, v, _MM_SHUFFLE(3, 3, 3, 3))))));
+				}
+			}
+		}
+
+		namespace AVX2FMA
+		{
+			MINT_TARGET_AVX2_FMA static void MulMatrix(const AffineVecF* const lhsRows, const AffineVecF* const rhsRows, AffineVecF* const outRows) noexcept
+			{
+				const __m128 r0 = rhsRows[0].GetRaw();
+				const __m128 r1 = rhsRows[1].GetRaw();
+				const __m128 r2 = rhsRows[2].GetRaw();
+				const __m128 r3 = rhsRows[3].GetRaw();
+				__m128 result[4];
+				for (uint32 row = 0; row < 4; ++row)
+				{
+					const __m128 l = lhsRows[row].GetRaw();
+					__m128 sum = _mm_mul_ps(_mm_permute_ps(l, _MM_SHUFFLE(0, 0, 0, 0)), r0);
+					sum = _mm_fmadd_ps(_mm_permute_ps(l, _MM_SHUFFLE(1, 1, 1, 1)), r1, sum);
+					sum = _mm_fmadd_ps(_mm_permute_ps(l, _MM_SHUFFLE(2, 2, 2, 2)), r2, sum);
+					result[row] = _mm_fmadd_ps(_mm_permute_ps(l, _MM_SHUFFLE(3, 3, 3, 3)), r3, sum);
+				}
+				for (uint32 row = 0; row < 4; ++row)
+				{
+					outRows[row] = AffineVecF(result[row]);
+				}
+			}
+
+			MINT_TARGET_AVX2_FMA static void MulVectors(const AffineVecF* const rows, const AffineVecF* const vectors, const uint32 count, AffineVecF* const outVectors) noexcept
+			{
+				__m128 c0 = rows[0].GetRaw();
+				__m128 c1 = rows[1].GetRaw();
+				__m128 c2 = rows[2].GetRaw();
+				__m128 c3 = rows[3].GetRaw();
+				_MM_TRANSPOSE4_PS(c0, c1, c2, c3);
+
+				// 두 vector 를 __m256 하나로 처리한다.
+				const __m256 c00 = _mm256_set_m128(c0, c0);
+				const __m256 c11 = _mm256_set_m128(c1, c1);
+				const __m256 c22 = _mm256_set_m128(c2, c2);
+				const __m256 c33 = _mm256_set_m128(c3, c3);
+				const float* const source = reinterpret_cast<const float*>(vectors);
+				float* const destination = reinterpret_cast<float*>(outVectors);
+				uint32 index = 0;
+				for (; index + 2 <= count; index += 2)
+				{
+					const __m256 v = _mm256_loadu_ps(source + index * 4);
+					__m256 sum = _mm256_mul_ps(c00, _mm256_permute_ps(v, _MM_SHUFFLE(0, 0, 0, 0)));
+					sum = _mm256_fmadd_ps(c11, _mm256_permute_ps(v, _MM_SHUFFLE(1, 1, 1, 1)), sum);
+					sum = _mm256_fmadd_ps(c22, _mm256_permute_ps(v, _MM_SHUFFLE(2, 2, 2, 2)), sum);
+					sum = _mm256_fmadd_ps(c33, _mm256_permute_ps(v, _MM_SHUFFLE(3, 3, 3, 3)), sum);
+					_mm256_storeu_ps(destination + index * 4, sum);
+				}
+				for (; index < count; ++index)
+				{
+					const __m128 v = vectors[index].GetRaw();
+					__m128 sum = _mm_mul_ps(c0, _mm_permute_ps(v, _MM_SHUFFLE(0, 0, 0, 0)));
+					sum = _mm_fmadd_ps(c1, _mm_permute_ps(v, _MM_SHUFFLE(1, 1, 1, 1)), sum);
+					sum = _mm_fmadd_ps(c2, _mm_permute_ps(v, _MM_SHUFFLE(2, 2, 2, 2)), sum);
+					outVectors[index] = AffineVecF(_mm_fmadd_ps(c3, _mm_permute_ps(v, _MM_SHUFFLE(3, 3, 3, 3)), sum));
+				}
+			}
+		}
+
+		// 4x4 float 행렬 전체 (16 개) 가 __m512 하나에 들어간다.
+		namespace AVX512
+		{
+			MINT_TARGET_AVX512 static void MulMatrix(const AffineVecF* const lhsRows, const AffineVecF* const rhsRows, AffineVecF* const outRows) noexcept
+			{
+				const __m512 l = _mm512_loadu_ps(reinterpret_cast<const float*>(lhsRows));
+				// 128-bit lane i 에 row i 가 들어 있으므로 lane 안에서 성분 하나를 퍼뜨리면 l[i][k] 가 된다.
+				__m512 result = _mm512_mul_ps(_mm512_permute_ps(l, _MM_SHUFFLE(0, 0, 0, 0)), _mm512_broadcast_f32x4(rhsRows[0].GetRaw()));
+				result = _mm512_fmadd_ps(_mm512_permute_ps(l, _MM_SHUFFLE(1, 1, 1, 1)), _mm512_broadcast_f32x4(rhsRows[1].GetRaw()), result);
+				result = _mm512_fmadd_ps(_mm512_permute_ps(l, _MM_SHUFFLE(2, 2, 2, 2)), _mm512_broadcast_f32x4(rhsRows[2].GetRaw()), result);
+				result = _mm512_fmadd_ps(_mm512_permute_ps(l, _MM_SHUFFLE(3, 3, 3, 3)), _mm512_broadcast_f32x4(rhsRows[3].GetRaw()), result);
+				_mm512_storeu_ps(reinterpret_cast<float*>(outRows), result);
+			}
+
+			MINT_TARGET_AVX512 static void MulVectors(const AffineVecF* const rows, const AffineVecF* const vectors, const uint32 count, AffineVecF* const outVectors) noexcept
+			{
+				__m128 c0 = rows[0].GetRaw();
+				__m128 c1 = rows[1].GetRaw();
+				__m128 c2 = rows[2].GetRaw();
+				__m128 c3 = rows[3].GetRaw();
+				_MM_TRANSPOSE4_PS(c0, c1, c2, c3);
+
+				// 네 vector 를 __m512 하나로 처리한다.
+				const __m512 c0000 = _mm512_broadcast_f32x4(c0);
+				const __m512 c1111 = _mm512_broadcast_f32x4(c1);
+				const __m512 c2222 = _mm512_broadcast_f32x4(c2);
+				const __m512 c3333 = _mm512_broadcast_f32x4(c3);
+				const float* const source = reinterpret_cast<const float*>(vectors);
+				float* const destination = reinterpret_cast<float*>(outVectors);
+				uint32 index = 0;
+				for (; index + 4 <= count; index += 4)
+				{
+					const __m512 v = _mm512_loadu_ps(source + index * 4);
+					__m512 sum = _mm512_mul_ps(c0000, _mm512_permute_ps(v, _MM_SHUFFLE(0, 0, 0, 0)));
+					sum = _mm512_fmadd_ps(c1111, _mm512_permute_ps(v, _MM_SHUFFLE(1, 1, 1, 1)), sum);
+					sum = _mm512_fmadd_ps(c2222, _mm512_permute_ps(v, _MM_SHUFFLE(2, 2, 2, 2)), sum);
+					sum = _mm512_fmadd_ps(c3333, _mm512_permute_ps(v, _MM_SHUFFLE(3, 3, 3, 3)), sum);
+					_mm512_storeu_ps(destination + index * 4, sum);
+				}
+				if (index < count)
+				{
+					AVX2FMA::MulVectors(rows, vectors + index, count - index, outVectors + index);
+				}
+			}
+		}
+
+
+		using MulMatrixFunction = void(*)(const AffineVecF* const, const AffineVecF* const, AffineVecF* const) noexcept;
+		using MulVectorsFunction = void(*)(const AffineVecF* const, const AffineVecF* const, const uint32, AffineVecF* const) noexcept;
+
+		struct DispatchTable
+		{
+			InstructionSet _instructionSet = InstructionSet::SSE;
+			MulMatrixFunction _mulMatrix = SSE::MulMatrix;
+			MulVectorsFunction _mulVectors = SSE::MulVectors;
+		};
+
+		static bool IsSupported(const InstructionSet instructionSet) noexcept
+		{
+			const CPUFeatures& cpuFeatures = CPUFeatures::GetInstance();
+			const bool hasAVX2FMA = cpuFeatures.HasAVX2() && cpuFeatures.HasFMA();
+			switch (instructionSet)
+			{
+			case InstructionSet::SSE:
+				return true;
+			case InstructionSet::AVX2FMA:
+				return hasAVX2FMA;
+			case InstructionSet::AVX512:
+				return hasAVX2FMA && cpuFeatures.HasAVX512F();
+			default:
+				break;
+			}
+			return false;
+		}
+
+		static void SetDispatchTable(const InstructionSet instructionSet, DispatchTable& outDispatchTable) noexcept
+		{
+			outDispatchTable._instructionSet = instructionSet;
+			switch (instructionSet)
+			{
+			case InstructionSet::AVX2FMA:
+				outDispatchTable._mulMatrix = AVX2FMA::MulMatrix;
+				outDispatchTable._mulVectors = AVX2FMA::MulVectors;
+				break;
+			case InstructionSet::AVX512:
+				outDispatchTable._mulMatrix = AVX512::MulMatrix;
+				outDispatchTable._mulVectors = AVX512::MulVectors;
+				break;
+			default:
+				outDispatchTable._mulMatrix = SSE::MulMatrix;
+				outDispatchTable._mulVectors = SSE::MulVectors;
+				break;
+			}
+		}
+
+		static DispatchTable& GetDispatchTable() noexcept
+		{
+			static DispatchTable dispatchTable = []()
+			{
+				DispatchTable result;
+				const InstructionSet best = IsSupported(InstructionSet::AVX512) ? InstructionSet::AVX512
+					: IsSupported(InstructionSet::AVX2FMA) ? InstructionSet::AVX2FMA : InstructionSet::SSE;
+				SetDispatchTable(best, result);
+				return result;
+			}();
+			return dispatchTable;
+		}
+
+		InstructionSet GetInstructionSet() noexcept
+		{
+			return GetDispatchTable()._instructionSet;
+		}
+
+		bool SetInstructionSet(const InstructionSet instructionSet) noexcept
+		{
+			if (IsSupported(instructionSet) == false)
+			{
+				return false;
+			}
+
+			SetDispatchTable(instructionSet, GetDispatchTable());
+			return true;
+		}
+
+		void MulMatrix(const AffineVecF* const lhsRows, const AffineVecF* const rhsRows, AffineVecF* const outRows) noexcept
+		{
+			GetDispatchTable()._mulMatrix(lhsRows, rhsRows, outRows);
+		}
+
+		void MulVectors(const AffineVecF* const rows, const AffineVecF* const vectors, const uint32 count, AffineVecF* const outVectors) noexcept
+		{
+			GetDispatchTable()._mulVectors(rows, vectors, count, outVectors);
+		}
+	}
+}
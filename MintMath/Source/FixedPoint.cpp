@@ -0,0 +1,124 @@
+﻿#include <MintMath/Include/FixedPoint.h>
+
+
+namespace mint
+{
+	namespace Math
+	{
+		namespace FixedPointInternal
+		{
+			static constexpr uint32 kSinTableSegmentBitCount = 8;
+			static constexpr uint32 kSinTableSegmentCount = 1 << kSinTableSegmentBitCount;
+			// round(sin(i * (pi / 2) / 256) * 2^30)
+			// 실행 중에 libm 으로 만들면 플랫폼마다 값이 달라질 수 있으므로 상수로 둔다.
+			static constexpr int32 kSinTableQ30[kSinTableSegmentCount + 1]
+			{
+				0, 6588356, 13176464, 19764076, 26350943, 32936819, 39521455, 46104602,
+				52686014, 59265442, 65842639, 72417357, 78989349, 85558366, 92124163, 98686491,
+				105245103, 111799753, 118350194, 124896179, 131437462, 137973796, 144504935, 151030634,
+				157550647, 164064728, 170572633, 177074115, 183568930, 190056834, 196537583, 203010932,
+				209476638, 215934457, 222384147, 228825464, 235258165, 241682010, 248096755, 254502159,
+				260897982, 267283981, 273659918, 280025552, 286380643, 292724951, 299058239, 305380268,
+				311690799, 317989595, 324276419, 330551034, 336813204, 343062693, 349299266, 355522689,
+				361732726, 367929144, 374111709, 380280190, 386434353, 392573967, 398698801, 404808624,
+				410903207, 416982319, 423045732, 429093217, 435124548, 441139496, 447137835, 453119340,
+				459083786, 465030947, 470960600, 476872522, 482766489, 488642281, 494499676, 500338453,
+				506158392, 511959275, 517740883, 523502998, 529245404, 534967884, 540670223, 546352205,
+				552013618, 557654248, 563273883, 568872310, 574449320, 580004702, 585538248, 591049748,
+				596538995, 602005783, 607449906, 612871159, 618269338, 623644239, 628995660, 634323400,
+				639627258, 644907034, 650162530, 655393548, 660599890, 665781362, 670937767, 676068911,
+				681174602, 686254647, 691308855, 696337036, 701339000, 706314559, 711263525, 716185713,
+				721080937, 725949013, 730789757, 735602987, 740388522, 745146182, 749875788, 754577161,
+				759250125, 763894504, 768510122, 773096806, 777654384, 782182683, 786681534, 791150767,
+				795590213, 799999706, 804379079, 808728167, 813046808, 817334838, 821592095, 825818421,
+				830013654, 834177638, 838310216, 842411232, 846480531, 850517961, 854523370, 858496606,
+				862437520, 866345964, 870221790, 874064853, 877875009, 881652112, 885396022, 889106597,
+				892783698, 896427186, 900036924, 903612776, 907154608, 910662286, 914135678, 917574653,
+				920979082, 924348837, 927683790, 930983817, 934248793, 937478595, 940673101, 943832191,
+				946955747, 950043650, 953095785, 956112036, 959092290, 962036435, 964944360, 967815955,
+				970651112, 973449725, 976211688, 978936898, 981625251, 984276646, 986890984, 989468165,
+				992008094, 994510675, 996975812, 999403415, 1001793390, 1004145648, 1006460100, 1008736660,
+				1010975242, 1013175761, 1015338134, 1017462281, 1019548121, 1021595575, 1023604567, 1025575020,
+				1027506862, 1029400018, 1031254418, 1033069992, 1034846671, 1036584389, 1038283080, 1039942680,
+				1041563127, 1043144360, 1044686319, 1046188946, 1047652185, 1049075980, 1050460278, 1051805027,
+				1053110176, 1054375676, 1055601479, 1056787540, 1057933813, 1059040255, 1060106826, 1061133483,
+				1062120190, 1063066909, 1063973603, 1064840240, 1065666786, 1066453210, 1067199483, 1067905576,
+				1068571464, 1069197120, 1069782521, 1070327646, 1070832474, 1071296985, 1071721163, 1072104991,
+				1072448455, 1072751542, 1073014240, 1073236540, 1073418433, 1073559913, 1073660973, 1073721611,
+				1073741824,
+			};
+
+			void SinCosTurn(const uint32 turn, int32& outSinQ30, int32& outCosQ30) noexcept
+			{
+				static constexpr uint32 kQuadrantBitCount = 30;
+				static constexpr uint32 kRemainderBitCount = kQuadrantBitCount - kSinTableSegmentBitCount;
+				static constexpr int64 kOneQ30 = static_cast<int64>(1) << 30;
+				static constexpr int64 kHalfPiQ30 = 1686629713;
+
+				const uint32 quadrant = turn >> kQuadrantBitCount;
+				const uint32 turnInQuadrant = turn & ((1u << kQuadrantBitCount) - 1);
+				const uint32 segment = turnInQuadrant >> kRemainderBitCount;
+				const int64 remainder = static_cast<int64>(turnInQuadrant & ((1u << kRemainderBitCount) - 1));
+
+				// 구간 시작점 a 의 sin, cos 를 표에서 읽고 구간 안의 작은 각도 d (< pi / 512) 는 Taylor 급수로 계산해서
+				// sin(a + d) = sin(a) cos(d) + cos(a) sin(d)
+				// cos(a + d) = cos(a) cos(d) - sin(a) sin(d)
+				// 를 계산한다. 버리는 항 중 가장 큰 d^4 / 24 가 약 5.9e-11 로 Q30 의 1 (9.3e-10) 보다 작으므로 두 항이면 충분하다.
+				const int64 sinA = kSinTableQ30[segment];
+				const int64 cosA = kSinTableQ30[kSinTableSegmentCount - segment];
+				const int64 d = (remainder * kHalfPiQ30 + (kOneQ30 >> 1)) >> kQuadrantBitCount;
+				const int64 dSquare = (d * d) >> 30;
+				const int64 cosD = kOneQ30 - (dSquare >> 1);
+				const int64 sinD = d - ((dSquare * d) >> 30) / 6;
+				const int32 sinQ30 = static_cast<int32>((sinA * cosD + cosA * sinD + (kOneQ30 >> 1)) >> 30);
+				const int32 cosQ30 = static_cast<int32>((cosA * cosD - sinA * sinD + (kOneQ30 >> 1)) >> 30);
+				switch (quadrant)
+				{
+				case 0:
+					outSinQ30 = sinQ30;
+					outCosQ30 = cosQ30;
+					break;
+				case 1:
+					outSinQ30 = cosQ30;
+					outCosQ30 = -sinQ30;
+					break;
+				case 2:
+					outSinQ30 = -sinQ30;
+					outCosQ30 = -cosQ30;
+					break;
+				default:
+					outSinQ30 = -cosQ30;
+					outCosQ30 = sinQ30;
+					break;
+				}
+			}
+
+			uint64 SqrtShifted(const uint64 value, const uint32 appendedBitCount) noexcept
+			{
+				MINT_ASSERT(appendedBitCount % 2 == 0 && appendedBitCount < 64, "appendedBitCount 는 64 보다 작은 짝수여야 합니다!");
+
+				// N = value * 2^appendedBitCount (128 bit)
+				const uint64 high = (appendedBitCount == 0) ? 0 : (value >> (64 - appendedBitCount));
+				const uint64 low = value << appendedBitCount;
+				const auto isSquareGreaterThanN = [high, low](const uint64 root)
+				{
+					const Int128 square = Multiply128(static_cast<int64>(root), static_cast<int64>(root));
+					const uint64 squareHigh = static_cast<uint64>(square._high);
+					return (squareHigh > high) || (squareHigh == high && square._low > low);
+				};
+
+				// double 로 구한 추정값을 정수 연산으로 검산해서 고치므로, 추정값이 플랫폼마다 조금 달라도 결과는 항상 floor(sqrt(N)) 이다.
+				uint64 root = static_cast<uint64>(::sqrt(static_cast<double>(value)) * static_cast<double>(static_cast<uint64>(1) << (appendedBitCount / 2)));
+				while (root > 0 && isSquareGreaterThanN(root) == true)
+				{
+					--root;
+				}
+				while (isSquareGreaterThanN(root + 1) == false)
+				{
+					++root;
+				}
+				return root;
+			}
+		}
+	}
+}
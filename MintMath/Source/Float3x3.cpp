@@ -3,6 +3,8 @@
 #include <MintMath/Include/Vec.hpp>
 #include <MintMath/Include/Matrix.hpp>
 
+#include <immintrin.h>
+
 
 namespace mint
 {
@@ -91,7 +93,7 @@ namespace mint
 
 	Float3x3& Float3x3::operator*=(const Float3x3& rhs) noexcept
 	{
-		Math::Mul(_m, rhs._m, _m);
+		*this = *this * rhs;
 		return *this;
 	}
 
@@ -103,15 +105,31 @@ namespace mint
 	Float3x3 Float3x3::operator*(const Float3x3& rhs) const noexcept
 	{
 		Float3x3 result;
+#if defined MINT_NO_SIMD
 		Math::Mul(_m, rhs._m, result._m);
+#else
+		// row 가 16 byte 정렬되어 있지 않고 마지막 row 뒤로는 읽으면 안 되므로 set 으로 load 한다.
+		const __m128 rhsRow0 = _mm_setr_ps(rhs._11, rhs._12, rhs._13, 0.0f);
+		const __m128 rhsRow1 = _mm_setr_ps(rhs._21, rhs._22, rhs._23, 0.0f);
+		const __m128 rhsRow2 = _mm_setr_ps(rhs._31, rhs._32, rhs._33, 0.0f);
+		alignas(16) float resultRow[4];
+		for (uint32 rowIndex = 0; rowIndex < 3; ++rowIndex)
+		{
+			__m128 resultRowRaw = _mm_mul_ps(_mm_set1_ps(_m[rowIndex][0]), rhsRow0);
+			resultRowRaw = _mm_add_ps(resultRowRaw, _mm_mul_ps(_mm_set1_ps(_m[rowIndex][1]), rhsRow1));
+			resultRowRaw = _mm_add_ps(resultRowRaw, _mm_mul_ps(_mm_set1_ps(_m[rowIndex][2]), rhsRow2));
+			_mm_store_ps(resultRow, resultRowRaw);
+			result._m[rowIndex][0] = resultRow[0];
+			result._m[rowIndex][1] = resultRow[1];
+			result._m[rowIndex][2] = resultRow[2];
+		}
+#endif
 		return result;
 	}
 
 	Float3 Float3x3::operator*(const Float3& vec) const noexcept
 	{
-		Float3 result;
-		Math::Mul(_m, vec._c, result._c);
-		return result;
+		return Mul(vec);
 	}
 
 	Float3x3 Float3x3::operator*(const float scalar) const noexcept
@@ -140,28 +158,42 @@ namespace mint
 
 	float Float3x3::Determinant() const noexcept
 	{
-		return Math::Determinant(_m);
+		return Float3::Dot(_row[0], Float3::Cross(_row[1], _row[2]));
 	}
 
 	Float3x3 Float3x3::Transpose() const noexcept
 	{
-		Float3x3 result;
-		Math::Transpose(_m, result._m);
-		return result;
+		return Float3x3
+		(
+			_11, _21, _31,
+			_12, _22, _32,
+			_13, _23, _33
+		);
 	}
 
 	Float3x3 Float3x3::Inverse() const noexcept
 	{
-		Float3x3 adj;
-		Math::Adjugate(_m, adj._m);
-		return adj / Math::Determinant(_m);
+		// 역행렬의 column 들은 row 들의 cross product 를 determinant 로 나눈 것이다.
+		const Float3 column0 = Float3::Cross(_row[1], _row[2]);
+		const Float3 column1 = Float3::Cross(_row[2], _row[0]);
+		const Float3 column2 = Float3::Cross(_row[0], _row[1]);
+		const float reciprocalDeterminant = 1.0f / Float3::Dot(_row[0], column0);
+		return Float3x3
+		(
+			column0._x * reciprocalDeterminant, column1._x * reciprocalDeterminant, column2._x * reciprocalDeterminant,
+			column0._y * reciprocalDeterminant, column1._y * reciprocalDeterminant, column2._y * reciprocalDeterminant,
+			column0._z * reciprocalDeterminant, column1._z * reciprocalDeterminant, column2._z * reciprocalDeterminant
+		);
 	}
 
 	Float3 Float3x3::Mul(const Float3& vec) const noexcept
 	{
-		Float3 result;
-		Math::Mul(_m, vec._c, result._c);
-		return result;
+		return Float3
+		(
+			_11 * vec._x + _12 * vec._y + _13 * vec._z,
+			_21 * vec._x + _22 * vec._y + _23 * vec._z,
+			_31 * vec._x + _32 * vec._y + _33 * vec._z
+		);
 	}
 
 	void Float3x3::DecomposeSRT(Float2& outScale, Float3x3& outRotationMatrix, Float2& outTranslation) const noexcept
@@ -3,9 +3,51 @@
 #include <MintMath/Include/Quaternion.h>
 #include <MintMath/Include/Vec.hpp>
 
+#include <immintrin.h>
+
 
 namespace mint
 {
+#if !defined MINT_NO_SIMD
+	namespace Math
+	{
+		// 2x2 행렬은 (_11, _12, _21, _22) 순서로 __m128 하나에 담는다.
+		MINT_INLINE __m128 Mul2x2(const __m128 lhs, const __m128 rhs) noexcept
+		{
+			return _mm_add_ps(_mm_mul_ps(lhs, _mm_shuffle_ps(rhs, rhs, _MM_SHUFFLE(3, 0, 3, 0))),
+				_mm_mul_ps(_mm_shuffle_ps(lhs, lhs, _MM_SHUFFLE(2, 3, 0, 1)), _mm_shuffle_ps(rhs, rhs, _MM_SHUFFLE(1, 2, 1, 2))));
+		}
+
+		// adj(lhs) * rhs
+		MINT_INLINE __m128 AdjugateMul2x2(const __m128 lhs, const __m128 rhs) noexcept
+		{
+			return _mm_sub_ps(_mm_mul_ps(_mm_shuffle_ps(lhs, lhs, _MM_SHUFFLE(0, 0, 3, 3)), rhs),
+				_mm_mul_ps(_mm_shuffle_ps(lhs, lhs, _MM_SHUFFLE(2, 2, 1, 1)), _mm_shuffle_ps(rhs, rhs, _MM_SHUFFLE(1, 0, 3, 2))));
+		}
+
+		// lhs * adj(rhs)
+		MINT_INLINE __m128 MulAdjugate2x2(const __m128 lhs, const __m128 rhs) noexcept
+		{
+			return _mm_sub_ps(_mm_mul_ps(lhs, _mm_shuffle_ps(rhs, rhs, _MM_SHUFFLE(0, 3, 0, 3))),
+				_mm_mul_ps(_mm_shuffle_ps(lhs, lhs, _MM_SHUFFLE(2, 3, 0, 1)), _mm_shuffle_ps(rhs, rhs, _MM_SHUFFLE(1, 2, 1, 2))));
+		}
+
+		// w 성분은 0 이 된다.
+		MINT_INLINE __m128 Cross3(const __m128 lhs, const __m128 rhs) noexcept
+		{
+			return _mm_sub_ps(
+				_mm_mul_ps(_mm_shuffle_ps(lhs, lhs, _MM_SHUFFLE(3, 0, 2, 1)), _mm_shuffle_ps(rhs, rhs, _MM_SHUFFLE(3, 1, 0, 2))),
+				_mm_mul_ps(_mm_shuffle_ps(lhs, lhs, _MM_SHUFFLE(3, 1, 0, 2)), _mm_shuffle_ps(rhs, rhs, _MM_SHUFFLE(3, 0, 2, 1))));
+		}
+
+		MINT_INLINE __m128 HorizontalSum4(const __m128 value) noexcept
+		{
+			const __m128 sum = _mm_add_ps(value, _mm_shuffle_ps(value, value, _MM_SHUFFLE(2, 3, 0, 1)));
+			return _mm_add_ps(sum, _mm_shuffle_ps(sum, sum, _MM_SHUFFLE(1, 0, 3, 2)));
+		}
+	}
+#endif
+
 	const Float4x4 Float4x4::kIdentity = Float4x4();
 
 	Float4 Float4x4::Mul(const Float4x4& m, const Float4& v) noexcept
@@ -23,6 +65,57 @@ namespace mint
 		return l.Mul(r);
 	}
 
+	void Float4x4::Mul(const Float4x4& m, const Float4* const vectors, const uint32 count, Float4* const outVectors) noexcept
+	{
+#if defined MINT_NO_SIMD
+		for (uint32 i = 0; i < count; ++i)
+		{
+			outVectors[i] = m.Mul(vectors[i]);
+		}
+#else
+		__m128 column0 = _mm_load_ps(m._m[0]);
+		__m128 column1 = _mm_load_ps(m._m[1]);
+		__m128 column2 = _mm_load_ps(m._m[2]);
+		__m128 column3 = _mm_load_ps(m._m[3]);
+		_MM_TRANSPOSE4_PS(column0, column1, column2, column3);
+		for (uint32 i = 0; i < count; ++i)
+		{
+			const __m128 v = _mm_load_ps(vectors[i]._c);
+			__m128 result = _mm_mul_ps(column0, _mm_shuffle_ps(v, v, _MM_SHUFFLE(0, 0, 0, 0)));
+			result = _mm_add_ps(result, _mm_mul_ps(column1, _mm_shuffle_ps(v, v, _MM_SHUFFLE(1, 1, 1, 1))));
+			result = _mm_add_ps(result, _mm_mul_ps(column2, _mm_shuffle_ps(v, v, _MM_SHUFFLE(2, 2, 2, 2))));
+			result = _mm_add_ps(result, _mm_mul_ps(column3, _mm_shuffle_ps(v, v, _MM_SHUFFLE(3, 3, 3, 3))));
+			_mm_store_ps(outVectors[i]._c, result);
+		}
+#endif
+	}
+
+	void Float4x4::Mul(const Float4x4& m, const Float3* const points, const uint32 count, Float3* const outPoints) noexcept
+	{
+#if defined MINT_NO_SIMD
+		for (uint32 i = 0; i < count; ++i)
+		{
+			outPoints[i] = m.Mul(points[i]);
+		}
+#else
+		__m128 column0 = _mm_load_ps(m._m[0]);
+		__m128 column1 = _mm_load_ps(m._m[1]);
+		__m128 column2 = _mm_load_ps(m._m[2]);
+		__m128 column3 = _mm_load_ps(m._m[3]);
+		_MM_TRANSPOSE4_PS(column0, column1, column2, column3);
+		Float4 result;
+		for (uint32 i = 0; i < count; ++i)
+		{
+			const Float3& point = points[i];
+			__m128 resultRaw = _mm_add_ps(column3, _mm_mul_ps(column0, _mm_set1_ps(point._x)));
+			resultRaw = _mm_add_ps(resultRaw, _mm_mul_ps(column1, _mm_set1_ps(point._y)));
+			resultRaw = _mm_add_ps(resultRaw, _mm_mul_ps(column2, _mm_set1_ps(point._z)));
+			_mm_store_ps(result._c, resultRaw);
+			outPoints[i] = result.GetXYZ();
+		}
+#endif
+	}
+
 	Float4x4 Float4x4::TranslationMatrix(const float x, const float y, const float z) noexcept
 	{
 		return Float4x4
@@ -121,10 +214,32 @@ namespace mint
 
 	Float4x4 Float4x4::RotationMatrix(const QuaternionF& rotation) noexcept
 	{
-		Float3 axis;
-		float angle;
-		rotation.GetAxisAngle(axis, angle);
-		return RotationMatrixAxisAngle(axis, angle);
+		// axis-angle 을 거치지 않고 (acos, sin, cos 없이) 바로 계산한다.
+		// s 로 나누므로 단위 quaternion 이 아니어도 방향만 쓴다.
+		const float x = rotation._x;
+		const float y = rotation._y;
+		const float z = rotation._z;
+		const float w = rotation._w;
+		const float s = 2.0f / (x * x + y * y + z * z + w * w);
+		const float xs = x * s;
+		const float ys = y * s;
+		const float zs = z * s;
+		const float wx = w * xs;
+		const float wy = w * ys;
+		const float wz = w * zs;
+		const float xx = x * xs;
+		const float xy = x * ys;
+		const float xz = x * zs;
+		const float yy = y * ys;
+		const float yz = y * zs;
+		const float zz = z * zs;
+		return Float4x4
+		(
+			1.0f - (yy + zz), xy - wz, xz + wy, 0.0f,
+			xy + wz, 1.0f - (xx + zz), yz - wx, 0.0f,
+			xz - wy, yz + wx, 1.0f - (xx + yy), 0.0f,
+			0.0f, 0.0f, 0.0f, 1.0f
+		);
 	}
 
 	Float4x4 Float4x4::AxesToColumns(const Float3& axisX, const Float3& axisY, const Float3& axisZ) noexcept
@@ -245,7 +360,7 @@ namespace mint
 
 	Float4x4& Float4x4::operator*=(const Float4x4& rhs) noexcept
 	{
-		Math::Mul(_m, rhs._m, _m);
+		*this = Mul(rhs);
 		return *this;
 	}
 
@@ -457,48 +572,196 @@ namespace mint
 
 	float Float4x4::Determinant() const noexcept
 	{
+#if defined MINT_NO_SIMD
 		return Math::Determinant(_m);
+#else
+		const __m128 row0 = _mm_load_ps(_m[0]);
+		const __m128 row1 = _mm_load_ps(_m[1]);
+		const __m128 row2 = _mm_load_ps(_m[2]);
+		const __m128 row3 = _mm_load_ps(_m[3]);
+
+		// | A B |
+		// | C D |
+		const __m128 a = _mm_movelh_ps(row0, row1);
+		const __m128 b = _mm_movehl_ps(row1, row0);
+		const __m128 c = _mm_movelh_ps(row2, row3);
+		const __m128 d = _mm_movehl_ps(row3, row2);
+
+		// (|A|, |B|, |C|, |D|)
+		const __m128 subDeterminants = _mm_sub_ps(
+			_mm_mul_ps(_mm_shuffle_ps(row0, row2, _MM_SHUFFLE(2, 0, 2, 0)), _mm_shuffle_ps(row1, row3, _MM_SHUFFLE(3, 1, 3, 1))),
+			_mm_mul_ps(_mm_shuffle_ps(row0, row2, _MM_SHUFFLE(3, 1, 3, 1)), _mm_shuffle_ps(row1, row3, _MM_SHUFFLE(2, 0, 2, 0))));
+
+		// |M| = |A||D| + |B||C| - tr(adj(A)B adj(D)C)
+		const __m128 adjAB = Math::AdjugateMul2x2(a, b);
+		const __m128 adjDC = Math::AdjugateMul2x2(d, c);
+		const __m128 trace = Math::HorizontalSum4(_mm_mul_ps(adjAB, _mm_shuffle_ps(adjDC, adjDC, _MM_SHUFFLE(3, 1, 2, 0))));
+		const __m128 adSubDeterminants = _mm_mul_ps(subDeterminants, _mm_shuffle_ps(subDeterminants, subDeterminants, _MM_SHUFFLE(0, 1, 2, 3)));
+		return _mm_cvtss_f32(adSubDeterminants) + _mm_cvtss_f32(_mm_shuffle_ps(adSubDeterminants, adSubDeterminants, _MM_SHUFFLE(1, 1, 1, 1))) - _mm_cvtss_f32(trace);
+#endif
 	}
 
 	Float4x4 Float4x4::Transpose() const noexcept
 	{
 		Float4x4 result;
+#if defined MINT_NO_SIMD
 		Math::Transpose(_m, result._m);
+#else
+		__m128 row0 = _mm_load_ps(_m[0]);
+		__m128 row1 = _mm_load_ps(_m[1]);
+		__m128 row2 = _mm_load_ps(_m[2]);
+		__m128 row3 = _mm_load_ps(_m[3]);
+		_MM_TRANSPOSE4_PS(row0, row1, row2, row3);
+		_mm_store_ps(result._m[0], row0);
+		_mm_store_ps(result._m[1], row1);
+		_mm_store_ps(result._m[2], row2);
+		_mm_store_ps(result._m[3], row3);
+#endif
 		return result;
 	}
 
 	Float4x4 Float4x4::Inverse() const noexcept
 	{
+#if defined MINT_NO_SIMD
 		Float4x4 adj;
 		Math::Adjugate(_m, adj._m);
 		return adj / Math::Determinant(_m);
+#else
+		// 2x2 block 으로 나누어 계산한다.
+		// | A B |^-1            | X Y |
+		// | C D |    = 1 / |M| * | Z W |
+		const __m128 row0 = _mm_load_ps(_m[0]);
+		const __m128 row1 = _mm_load_ps(_m[1]);
+		const __m128 row2 = _mm_load_ps(_m[2]);
+		const __m128 row3 = _mm_load_ps(_m[3]);
+
+		const __m128 a = _mm_movelh_ps(row0, row1);
+		const __m128 b = _mm_movehl_ps(row1, row0);
+		const __m128 c = _mm_movelh_ps(row2, row3);
+		const __m128 d = _mm_movehl_ps(row3, row2);
+
+		const __m128 subDeterminants = _mm_sub_ps(
+			_mm_mul_ps(_mm_shuffle_ps(row0, row2, _MM_SHUFFLE(2, 0, 2, 0)), _mm_shuffle_ps(row1, row3, _MM_SHUFFLE(3, 1, 3, 1))),
+			_mm_mul_ps(_mm_shuffle_ps(row0, row2, _MM_SHUFFLE(3, 1, 3, 1)), _mm_shuffle_ps(row1, row3, _MM_SHUFFLE(2, 0, 2, 0))));
+		const __m128 determinantA = _mm_shuffle_ps(subDeterminants, subDeterminants, _MM_SHUFFLE(0, 0, 0, 0));
+		const __m128 determinantB = _mm_shuffle_ps(subDeterminants, subDeterminants, _MM_SHUFFLE(1, 1, 1, 1));
+		const __m128 determinantC = _mm_shuffle_ps(subDeterminants, subDeterminants, _MM_SHUFFLE(2, 2, 2, 2));
+		const __m128 determinantD = _mm_shuffle_ps(subDeterminants, subDeterminants, _MM_SHUFFLE(3, 3, 3, 3));
+
+		const __m128 adjDC = Math::AdjugateMul2x2(d, c);
+		const __m128 adjAB = Math::AdjugateMul2x2(a, b);
+		// adj(X) = |D|A - B adj(D)C
+		__m128 x = _mm_sub_ps(_mm_mul_ps(determinantD, a), Math::Mul2x2(b, adjDC));
+		// adj(W) = |A|D - C adj(A)B
+		__m128 w = _mm_sub_ps(_mm_mul_ps(determinantA, d), Math::Mul2x2(c, adjAB));
+		// adj(Y) = |B|C - D adj(adj(A)B)
+		__m128 y = _mm_sub_ps(_mm_mul_ps(determinantB, c), Math::MulAdjugate2x2(d, adjAB));
+		// adj(Z) = |C|B - A adj(adj(D)C)
+		__m128 z = _mm_sub_ps(_mm_mul_ps(determinantC, b), Math::MulAdjugate2x2(a, adjDC));
+
+		// |M| = |A||D| + |B||C| - tr(adj(A)B adj(D)C)
+		const __m128 trace = Math::HorizontalSum4(_mm_mul_ps(adjAB, _mm_shuffle_ps(adjDC, adjDC, _MM_SHUFFLE(3, 1, 2, 0))));
+		const __m128 determinant = _mm_sub_ps(_mm_add_ps(_mm_mul_ps(determinantA, determinantD), _mm_mul_ps(determinantB, determinantC)), trace);
+		const __m128 reciprocalDeterminant = _mm_div_ps(_mm_setr_ps(1.0f, -1.0f, -1.0f, 1.0f), determinant);
+		x = _mm_mul_ps(x, reciprocalDeterminant);
+		y = _mm_mul_ps(y, reciprocalDeterminant);
+		z = _mm_mul_ps(z, reciprocalDeterminant);
+		w = _mm_mul_ps(w, reciprocalDeterminant);
+
+		// adjugate 를 다시 취하면서 row 순서로 저장한다.
+		Float4x4 result;
+		_mm_store_ps(result._m[0], _mm_shuffle_ps(x, y, _MM_SHUFFLE(1, 3, 1, 3)));
+		_mm_store_ps(result._m[1], _mm_shuffle_ps(x, y, _MM_SHUFFLE(0, 2, 0, 2)));
+		_mm_store_ps(result._m[2], _mm_shuffle_ps(z, w, _MM_SHUFFLE(1, 3, 1, 3)));
+		_mm_store_ps(result._m[3], _mm_shuffle_ps(z, w, _MM_SHUFFLE(0, 2, 0, 2)));
+		return result;
+#endif
+	}
+
+	Float4x4 Float4x4::InverseAffine() const noexcept
+	{
+		MINT_ASSERT(_41 == 0.0f && _42 == 0.0f && _43 == 0.0f && _44 == 1.0f, "Affine 행렬이 아닙니다!");
+
+#if defined MINT_NO_SIMD
+		return Inverse();
+#else
+		// | R t |^-1   | R^-1 -R^-1 t |
+		// | 0 1 |    = | 0     1       |
+		const __m128 kXYZMask = _mm_castsi128_ps(_mm_setr_epi32(-1, -1, -1, 0));
+		const __m128 row0 = _mm_and_ps(_mm_load_ps(_m[0]), kXYZMask);
+		const __m128 row1 = _mm_and_ps(_mm_load_ps(_m[1]), kXYZMask);
+		const __m128 row2 = _mm_and_ps(_mm_load_ps(_m[2]), kXYZMask);
+
+		// R^-1 의 column 들은 row 들의 cross product 를 |R| 로 나눈 것이다.
+		__m128 column0 = Math::Cross3(row1, row2);
+		__m128 column1 = Math::Cross3(row2, row0);
+		__m128 column2 = Math::Cross3(row0, row1);
+		const __m128 reciprocalDeterminant = _mm_div_ps(_mm_set1_ps(1.0f), Math::HorizontalSum4(_mm_mul_ps(row0, column0)));
+		column0 = _mm_mul_ps(column0, reciprocalDeterminant);
+		column1 = _mm_mul_ps(column1, reciprocalDeterminant);
+		column2 = _mm_mul_ps(column2, reciprocalDeterminant);
+
+		__m128 column3 = _mm_mul_ps(column0, _mm_set1_ps(-_14));
+		column3 = _mm_sub_ps(column3, _mm_mul_ps(column1, _mm_set1_ps(_24)));
+		column3 = _mm_sub_ps(column3, _mm_mul_ps(column2, _mm_set1_ps(_34)));
+		_MM_TRANSPOSE4_PS(column0, column1, column2, column3);
+
+		Float4x4 result;
+		_mm_store_ps(result._m[0], column0);
+		_mm_store_ps(result._m[1], column1);
+		_mm_store_ps(result._m[2], column2);
+		_mm_store_ps(result._m[3], _mm_setr_ps(0.0f, 0.0f, 0.0f, 1.0f));
+		return result;
+#endif
 	}
 
 	Float4x4 Float4x4::Mul(const Float4x4& rhs) const noexcept
 	{
 		Float4x4 result;
+#if defined MINT_NO_SIMD
 		Math::Mul(_m, rhs._m, result._m);
+#else
+		const __m128 rhsRow0 = _mm_load_ps(rhs._m[0]);
+		const __m128 rhsRow1 = _mm_load_ps(rhs._m[1]);
+		const __m128 rhsRow2 = _mm_load_ps(rhs._m[2]);
+		const __m128 rhsRow3 = _mm_load_ps(rhs._m[3]);
+		for (uint32 rowIndex = 0; rowIndex < 4; ++rowIndex)
+		{
+			const __m128 lhsRow = _mm_load_ps(_m[rowIndex]);
+			__m128 resultRow = _mm_mul_ps(_mm_shuffle_ps(lhsRow, lhsRow, _MM_SHUFFLE(0, 0, 0, 0)), rhsRow0);
+			resultRow = _mm_add_ps(resultRow, _mm_mul_ps(_mm_shuffle_ps(lhsRow, lhsRow, _MM_SHUFFLE(1, 1, 1, 1)), rhsRow1));
+			resultRow = _mm_add_ps(resultRow, _mm_mul_ps(_mm_shuffle_ps(lhsRow, lhsRow, _MM_SHUFFLE(2, 2, 2, 2)), rhsRow2));
+			resultRow = _mm_add_ps(resultRow, _mm_mul_ps(_mm_shuffle_ps(lhsRow, lhsRow, _MM_SHUFFLE(3, 3, 3, 3)), rhsRow3));
+			_mm_store_ps(result._m[rowIndex], resultRow);
+		}
+#endif
 		return result;
 	}
 
 	void Float4x4::MulAssignReverse(const Float4x4& lhs) noexcept
 	{
-		Float4x4 rhsCopy = *this;
-		Math::Mul(lhs._m, rhsCopy._m, _m);
+		*this = lhs.Mul(*this);
 	}
 
 	Float4 Float4x4::Mul(const Float4& vec) const noexcept
 	{
 		Float4 result;
+#if defined MINT_NO_SIMD
 		Math::Mul(_m, vec._c, result._c);
+#else
+		const __m128 v = _mm_load_ps(vec._c);
+		__m128 product0 = _mm_mul_ps(_mm_load_ps(_m[0]), v);
+		__m128 product1 = _mm_mul_ps(_mm_load_ps(_m[1]), v);
+		__m128 product2 = _mm_mul_ps(_mm_load_ps(_m[2]), v);
+		__m128 product3 = _mm_mul_ps(_mm_load_ps(_m[3]), v);
+		_MM_TRANSPOSE4_PS(product0, product1, product2, product3);
+		_mm_store_ps(result._c, _mm_add_ps(_mm_add_ps(product0, product1), _mm_add_ps(product2, product3)));
+#endif
 		return result;
 	}
 
 	Float3 Float4x4::Mul(const Float3& vec) const noexcept
 	{
-		Float4 v4 = Float4(vec._x, vec._y, vec._z, 1.0f);
-		Float4 r4;
-		Math::Mul(_m, v4._c, r4._c);
-		return r4.GetXYZ();
+		return Mul(Float4(vec._x, vec._y, vec._z, 1.0f)).GetXYZ();
 	}
 }
@@ -0,0 +1,656 @@
+﻿#include <MintMath/Include/FloatStream.h>
+
+#include <MintContainer/Include/Vector.hpp>
+
+#include <MintMath/Include/Float3x3.h>
+#include <MintMath/Include/Float4x4.h>
+#include <MintMath/Include/Quaternion.h>
+
+#include <immintrin.h>
+#include <cmath>
+
+
+namespace mint
+{
+#pragma region FloatStream
+	template<uint32 ComponentCount>
+	FloatStream<ComponentCount>::FloatStream()
+		: _size{ 0 }
+	{
+		__noop;
+	}
+
+	template<uint32 ComponentCount>
+	FloatStream<ComponentCount>::FloatStream(const uint32 size)
+		: _size{ 0 }
+	{
+		Resize(size);
+	}
+
+	template<uint32 ComponentCount>
+	FloatStream<ComponentCount>::FloatStream(const FloatStream& rhs)
+		: _size{ rhs._size }
+	{
+		for (uint32 componentIndex = 0; componentIndex < ComponentCount; ++componentIndex)
+		{
+			_components[componentIndex] = rhs._components[componentIndex];
+		}
+	}
+
+	template<uint32 ComponentCount>
+	FloatStream<ComponentCount>::FloatStream(FloatStream&& rhs) noexcept
+		: _size{ rhs._size }
+	{
+		for (uint32 componentIndex = 0; componentIndex < ComponentCount; ++componentIndex)
+		{
+			_components[componentIndex] = std::move(rhs._components[componentIndex]);
+		}
+		rhs._size = 0;
+	}
+
+	template<uint32 ComponentCount>
+	FloatStream<ComponentCount>::~FloatStream()
+	{
+		__noop;
+	}
+
+	template<uint32 ComponentCount>
+	FloatStream<ComponentCount>& FloatStream<ComponentCount>::operator=(const FloatStream& rhs)
+	{
+		if (this != &rhs)
+		{
+			for (uint32 componentIndex = 0; componentIndex < ComponentCount; ++componentIndex)
+			{
+				_components[componentIndex] = rhs._components[componentIndex];
+			}
+			_size = rhs._size;
+		}
+		return *this;
+	}
+
+	template<uint32 ComponentCount>
+	FloatStream<ComponentCount>& FloatStream<ComponentCount>::operator=(FloatStream&& rhs) noexcept
+	{
+		if (this != &rhs)
+		{
+			for (uint32 componentIndex = 0; componentIndex < ComponentCount; ++componentIndex)
+			{
+				_components[componentIndex] = std::move(rhs._components[componentIndex]);
+			}
+			_size = rhs._size;
+			rhs._size = 0;
+		}
+		return *this;
+	}
+
+	template<uint32 ComponentCount>
+	void FloatStream<ComponentCount>::Resize(const uint32 size)
+	{
+		for (uint32 componentIndex = 0; componentIndex < ComponentCount; ++componentIndex)
+		{
+			_components[componentIndex].Resize(size);
+		}
+		_size = size;
+	}
+
+	template<uint32 ComponentCount>
+	void FloatStream<ComponentCount>::Reserve(const uint32 capacity)
+	{
+		for (uint32 componentIndex = 0; componentIndex < ComponentCount; ++componentIndex)
+		{
+			_components[componentIndex].Reserve(capacity);
+		}
+	}
+
+	template<uint32 ComponentCount>
+	void FloatStream<ComponentCount>::Clear() noexcept
+	{
+		for (uint32 componentIndex = 0; componentIndex < ComponentCount; ++componentIndex)
+		{
+			_components[componentIndex].Clear();
+		}
+		_size = 0;
+	}
+
+	template<uint32 ComponentCount>
+	void FloatStream<ComponentCount>::PushBack(const ElementType& value)
+	{
+		for (uint32 componentIndex = 0; componentIndex < ComponentCount; ++componentIndex)
+		{
+			_components[componentIndex].PushBack(value._c[componentIndex]);
+		}
+		++_size;
+	}
+
+	template<uint32 ComponentCount>
+	void FloatStream<ComponentCount>::Set(const uint32 index, const ElementType& value) noexcept
+	{
+		for (uint32 componentIndex = 0; componentIndex < ComponentCount; ++componentIndex)
+		{
+			_components[componentIndex][index] = value._c[componentIndex];
+		}
+	}
+
+	template<uint32 ComponentCount>
+	typename FloatStream<ComponentCount>::ElementType FloatStream<ComponentCount>::Get(const uint32 index) const noexcept
+	{
+		ElementType result;
+		for (uint32 componentIndex = 0; componentIndex < ComponentCount; ++componentIndex)
+		{
+			result._c[componentIndex] = _components[componentIndex][index];
+		}
+		return result;
+	}
+
+	template<uint32 ComponentCount>
+	void FloatStream<ComponentCount>::Assign(const ElementType* const values, const uint32 count)
+	{
+		Resize(count);
+		for (uint32 componentIndex = 0; componentIndex < ComponentCount; ++componentIndex)
+		{
+			float* const componentData = _components[componentIndex].Data();
+			for (uint32 index = 0; index < count; ++index)
+			{
+				componentData[index] = values[index]._c[componentIndex];
+			}
+		}
+	}
+
+	template<uint32 ComponentCount>
+	void FloatStream<ComponentCount>::CopyTo(ElementType* const outValues) const noexcept
+	{
+		for (uint32 componentIndex = 0; componentIndex < ComponentCount; ++componentIndex)
+		{
+			const float* const componentData = _components[componentIndex].Data();
+			for (uint32 index = 0; index < _size; ++index)
+			{
+				outValues[index]._c[componentIndex] = componentData[index];
+			}
+		}
+	}
+
+	template class FloatStream<2>;
+	template class FloatStream<3>;
+	template class FloatStream<4>;
+#pragma endregion
+
+
+	namespace Math
+	{
+		namespace FloatStreamLane
+		{
+#if defined MINT_NO_SIMD
+			static constexpr uint32 kCount = 1;
+#elif defined __AVX__
+			// AVX 로 빌드할 때는 8 lane 을 쓴다.
+			using Type = __m256;
+			static constexpr uint32 kCount = 8;
+			MINT_INLINE Type Load(const float* const source) noexcept { return _mm256_loadu_ps(source); }
+			MINT_INLINE void Store(float* const destination, const Type value) noexcept { _mm256_storeu_ps(destination, value); }
+			MINT_INLINE Type Set(const float value) noexcept { return _mm256_set1_ps(value); }
+			MINT_INLINE Type Add(const Type lhs, const Type rhs) noexcept { return _mm256_add_ps(lhs, rhs); }
+			MINT_INLINE Type Sub(const Type lhs, const Type rhs) noexcept { return _mm256_sub_ps(lhs, rhs); }
+			MINT_INLINE Type Mul(const Type lhs, const Type rhs) noexcept { return _mm256_mul_ps(lhs, rhs); }
+			MINT_INLINE Type Div(const Type lhs, const Type rhs) noexcept { return _mm256_div_ps(lhs, rhs); }
+			MINT_INLINE Type Min(const Type lhs, const Type rhs) noexcept { return _mm256_min_ps(lhs, rhs); }
+			MINT_INLINE Type Max(const Type lhs, const Type rhs) noexcept { return _mm256_max_ps(lhs, rhs); }
+			MINT_INLINE Type Sqrt(const Type value) noexcept { return _mm256_sqrt_ps(value); }
+			// value > 0 인 lane 에만 1 / value, 나머지는 0
+			MINT_INLINE Type SafeReciprocal(const Type value) noexcept
+			{
+				return _mm256_and_ps(_mm256_cmp_ps(value, _mm256_setzero_ps(), _CMP_GT_OQ), _mm256_div_ps(_mm256_set1_ps(1.0f), value));
+			}
+#else
+			using Type = __m128;
+			static constexpr uint32 kCount = 4;
+			MINT_INLINE Type Load(const float* const source) noexcept { return _mm_loadu_ps(source); }
+			MINT_INLINE void Store(float* const destination, const Type value) noexcept { _mm_storeu_ps(destination, value); }
+			MINT_INLINE Type Set(const float value) noexcept { return _mm_set1_ps(value); }
+			MINT_INLINE Type Add(const Type lhs, const Type rhs) noexcept { return _mm_add_ps(lhs, rhs); }
+			MINT_INLINE Type Sub(const Type lhs, const Type rhs) noexcept { return _mm_sub_ps(lhs, rhs); }
+			MINT_INLINE Type Mul(const Type lhs, const Type rhs) noexcept { return _mm_mul_ps(lhs, rhs); }
+			MINT_INLINE Type Div(const Type lhs, const Type rhs) noexcept { return _mm_div_ps(lhs, rhs); }
+			MINT_INLINE Type Min(const Type lhs, const Type rhs) noexcept { return _mm_min_ps(lhs, rhs); }
+			MINT_INLINE Type Max(const Type lhs, const Type rhs) noexcept { return _mm_max_ps(lhs, rhs); }
+			MINT_INLINE Type Sqrt(const Type value) noexcept { return _mm_sqrt_ps(value); }
+			// value > 0 인 lane 에만 1 / value, 나머지는 0
+			MINT_INLINE Type SafeReciprocal(const Type value) noexcept
+			{
+				return _mm_and_ps(_mm_cmpgt_ps(value, _mm_setzero_ps()), _mm_div_ps(_mm_set1_ps(1.0f), value));
+			}
+#endif
+
+			// lane 단위로 처리할 수 있는 원소 개수
+			MINT_INLINE uint32 ComputeLaneEnd(const uint32 size) noexcept
+			{
+				return size - (size % kCount);
+			}
+		}
+
+
+		void TransformPoints(const Float3x3& m, const Float2Stream& points, Float2Stream& outPoints)
+		{
+			const uint32 size = points.Size();
+			outPoints.Resize(size);
+			const float* const inX = points.GetComponentData(0);
+			const float* const inY = points.GetComponentData(1);
+			float* const outX = outPoints.GetComponentData(0);
+			float* const outY = outPoints.GetComponentData(1);
+
+			uint32 index = 0;
+#if !defined MINT_NO_SIMD
+			{
+				using namespace FloatStreamLane;
+				const Type m11 = Set(m._11);
+				const Type m12 = Set(m._12);
+				const Type m13 = Set(m._13);
+				const Type m21 = Set(m._21);
+				const Type m22 = Set(m._22);
+				const Type m23 = Set(m._23);
+				const uint32 laneEnd = ComputeLaneEnd(size);
+				for (; index < laneEnd; index += kCount)
+				{
+					const Type x = Load(inX + index);
+					const Type y = Load(inY + index);
+					Store(outX + index, Add(Add(Mul(m11, x), Mul(m12, y)), m13));
+					Store(outY + index, Add(Add(Mul(m21, x), Mul(m22, y)), m23));
+				}
+			}
+#endif
+			for (; index < size; ++index)
+			{
+				const float x = inX[index];
+				const float y = inY[index];
+				outX[index] = m._11 * x + m._12 * y + m._13;
+				outY[index] = m._21 * x + m._22 * y + m._23;
+			}
+		}
+
+		void TransformPoints(const Float4x4& m, const Float3Stream& points, Float3Stream& outPoints)
+		{
+			const uint32 size = points.Size();
+			outPoints.Resize(size);
+			const float* const inX = points.GetComponentData(0);
+			const float* const inY = points.GetComponentData(1);
+			const float* const inZ = points.GetComponentData(2);
+			float* const outX = outPoints.GetComponentData(0);
+			float* const outY = outPoints.GetComponentData(1);
+			float* const outZ = outPoints.GetComponentData(2);
+
+			uint32 index = 0;
+#if !defined MINT_NO_SIMD
+			{
+				using namespace FloatStreamLane;
+				const Type m11 = Set(m._11);
+				const Type m12 = Set(m._12);
+				const Type m13 = Set(m._13);
+				const Type m14 = Set(m._14);
+				const Type m21 = Set(m._21);
+				const Type m22 = Set(m._22);
+				const Type m23 = Set(m._23);
+				const Type m24 = Set(m._24);
+				const Type m31 = Set(m._31);
+				const Type m32 = Set(m._32);
+				const Type m33 = Set(m._33);
+				const Type m34 = Set(m._34);
+				const uint32 laneEnd = ComputeLaneEnd(size);
+				for (; index < laneEnd; index += kCount)
+				{
+					const Type x = Load(inX + index);
+					const Type y = Load(inY + index);
+					const Type z = Load(inZ + index);
+					Store(outX + index, Add(Add(Mul(m11, x), Mul(m12, y)), Add(Mul(m13, z), m14)));
+					Store(outY + index, Add(Add(Mul(m21, x), Mul(m22, y)), Add(Mul(m23, z), m24)));
+					Store(outZ + index, Add(Add(Mul(m31, x), Mul(m32, y)), Add(Mul(m33, z), m34)));
+				}
+			}
+#endif
+			for (; index < size; ++index)
+			{
+				const float x = inX[index];
+				const float y = inY[index];
+				const float z = inZ[index];
+				outX[index] = m._11 * x + m._12 * y + m._13 * z + m._14;
+				outY[index] = m._21 * x + m._22 * y + m._23 * z + m._24;
+				outZ[index] = m._31 * x + m._32 * y + m._33 * z + m._34;
+			}
+		}
+
+		void TransformVectors(const Float4x4& m, const Float4Stream& vectors, Float4Stream& outVectors)
+		{
+			const uint32 size = vectors.Size();
+			outVectors.Resize(size);
+			const float* in[4];
+			float* out[4];
+			for (uint32 componentIndex = 0; componentIndex < 4; ++componentIndex)
+			{
+				in[componentIndex] = vectors.GetComponentData(componentIndex);
+				out[componentIndex] = outVectors.GetComponentData(componentIndex);
+			}
+
+			uint32 index = 0;
+#if !defined MINT_NO_SIMD
+			{
+				using namespace FloatStreamLane;
+				Type lanes[4][4];
+				for (uint32 row = 0; row < 4; ++row)
+				{
+					for (uint32 column = 0; column < 4; ++column)
+					{
+						lanes[row][column] = Set(m._m[row][column]);
+					}
+				}
+				const uint32 laneEnd = ComputeLaneEnd(size);
+				for (; index < laneEnd; index += kCount)
+				{
+					const Type x = Load(in[0] + index);
+					const Type y = Load(in[1] + index);
+					const Type z = Load(in[2] + index);
+					const Type w = Load(in[3] + index);
+					for (uint32 row = 0; row < 4; ++row)
+					{
+						Store(out[row] + index, Add(Add(Mul(lanes[row][0], x), Mul(lanes[row][1], y)), Add(Mul(lanes[row][2], z), Mul(lanes[row][3], w))));
+					}
+				}
+			}
+#endif
+			for (; index < size; ++index)
+			{
+				const float x = in[0][index];
+				const float y = in[1][index];
+				const float z = in[2][index];
+				const float w = in[3][index];
+				for (uint32 row = 0; row < 4; ++row)
+				{
+					out[row][index] = m._m[row][0] * x + m._m[row][1] * y + m._m[row][2] * z + m._m[row][3] * w;
+				}
+			}
+		}
+
+		void RotateVectors(const QuaternionF& rotation, const Float3Stream& vectors, Float3Stream& outVectors)
+		{
+			// v' = v + w * t + q x t (t = 2 * (q x v))
+			const uint32 size = vectors.Size();
+			outVectors.Resize(size);
+			const float* const inX = vectors.GetComponentData(0);
+			const float* const inY = vectors.GetComponentData(1);
+			const float* const inZ = vectors.GetComponentData(2);
+			float* const outX = outVectors.GetComponentData(0);
+			float* const outY = outVectors.GetComponentData(1);
+			float* const outZ = outVectors.GetComponentData(2);
+			const float qx = rotation._x;
+			const float qy = rotation._y;
+			const float qz = rotation._z;
+			const float qw = rotation._w;
+
+			uint32 index = 0;
+#if !defined MINT_NO_SIMD
+			{
+				using namespace FloatStreamLane;
+				const Type laneQX = Set(qx);
+				const Type laneQY = Set(qy);
+				const Type laneQZ = Set(qz);
+				const Type laneQW = Set(qw);
+				const Type two = Set(2.0f);
+				const uint32 laneEnd = ComputeLaneEnd(size);
+				for (; index < laneEnd; index += kCount)
+				{
+					const Type x = Load(inX + index);
+					const Type y = Load(inY + index);
+					const Type z = Load(inZ + index);
+					const Type tx = Mul(two, Sub(Mul(laneQY, z), Mul(laneQZ, y)));
+					const Type ty = Mul(two, Sub(Mul(laneQZ, x), Mul(laneQX, z)));
+					const Type tz = Mul(two, Sub(Mul(laneQX, y), Mul(laneQY, x)));
+					Store(outX + index, Add(Add(x, Mul(laneQW, tx)), Sub(Mul(laneQY, tz), Mul(laneQZ, ty))));
+					Store(outY + index, Add(Add(y, Mul(laneQW, ty)), Sub(Mul(laneQZ, tx), Mul(laneQX, tz))));
+					Store(outZ + index, Add(Add(z, Mul(laneQW, tz)), Sub(Mul(laneQX, ty), Mul(laneQY, tx))));
+				}
+			}
+#endif
+			for (; index < size; ++index)
+			{
+				const float x = inX[index];
+				const float y = inY[index];
+				const float z = inZ[index];
+				const float tx = 2.0f * (qy * z - qz * y);
+				const float ty = 2.0f * (qz * x - qx * z);
+				const float tz = 2.0f * (qx * y - qy * x);
+				outX[index] = x + qw * tx + (qy * tz - qz * ty);
+				outY[index] = y + qw * ty + (qz * tx - qx * tz);
+				outZ[index] = z + qw * tz + (qx * ty - qy * tx);
+			}
+		}
+
+		template<uint32 ComponentCount>
+		void DotInternal(const FloatStream<ComponentCount>& lhs, const FloatStream<ComponentCount>& rhs, Vector<float>& outDots)
+		{
+			MINT_ASSERT(lhs.Size() == rhs.Size(), "두 stream 의 크기가 달라선 안 됩니다!");
+
+			const uint32 size = lhs.Size();
+			outDots.Resize(size);
+			float* const out = outDots.Data();
+
+			uint32 index = 0;
+#if !defined MINT_NO_SIMD
+			{
+				using namespace FloatStreamLane;
+				const uint32 laneEnd = ComputeLaneEnd(size);
+				for (; index < laneEnd; index += kCount)
+				{
+					Type sum = Mul(Load(lhs.GetComponentData(0) + index), Load(rhs.GetComponentData(0) + index));
+					for (uint32 componentIndex = 1; componentIndex < ComponentCount; ++componentIndex)
+					{
+						sum = Add(sum, Mul(Load(lhs.GetComponentData(componentIndex) + index), Load(rhs.GetComponentData(componentIndex) + index)));
+					}
+					Store(out + index, sum);
+				}
+			}
+#endif
+			for (; index < size; ++index)
+			{
+				float sum = 0.0f;
+				for (uint32 componentIndex = 0; componentIndex < ComponentCount; ++componentIndex)
+				{
+					sum += lhs.GetComponentData(componentIndex)[index] * rhs.GetComponentData(componentIndex)[index];
+				}
+				out[index] = sum;
+			}
+		}
+
+		template<uint32 ComponentCount>
+		void NormalizeInternal(FloatStream<ComponentCount>& inoutVectors) noexcept
+		{
+			const uint32 size = inoutVectors.Size();
+			float* components[ComponentCount];
+			for (uint32 componentIndex = 0; componentIndex < ComponentCount; ++componentIndex)
+			{
+				components[componentIndex] = inoutVectors.GetComponentData(componentIndex);
+			}
+
+			uint32 index = 0;
+#if !defined MINT_NO_SIMD
+			{
+				using namespace FloatStreamLane;
+				const uint32 laneEnd = ComputeLaneEnd(size);
+				for (; index < laneEnd; index += kCount)
+				{
+					Type values[ComponentCount];
+					Type lengthSq = Set(0.0f);
+					for (uint32 componentIndex = 0; componentIndex < ComponentCount; ++componentIndex)
+					{
+						values[componentIndex] = Load(components[componentIndex] + index);
+						lengthSq = Add(lengthSq, Mul(values[componentIndex], values[componentIndex]));
+					}
+					const Type inverseLength = SafeReciprocal(Sqrt(lengthSq));
+					for (uint32 componentIndex = 0; componentIndex < ComponentCount; ++componentIndex)
+					{
+						Store(components[componentIndex] + index, Mul(values[componentIndex], inverseLength));
+					}
+				}
+			}
+#endif
+			for (; index < size; ++index)
+			{
+				float lengthSq = 0.0f;
+				for (uint32 componentIndex = 0; componentIndex < ComponentCount; ++componentIndex)
+				{
+					lengthSq += components[componentIndex][index] * components[componentIndex][index];
+				}
+				const float length = ::sqrtf(lengthSq);
+				const float inverseLength = (length > 0.0f) ? 1.0f / length : 0.0f;
+				for (uint32 componentIndex = 0; componentIndex < ComponentCount; ++componentIndex)
+				{
+					components[componentIndex][index] *= inverseLength;
+				}
+			}
+		}
+
+		template<uint32 ComponentCount>
+		void LerpInternal(const FloatStream<ComponentCount>& a, const FloatStream<ComponentCount>& b, const float t, FloatStream<ComponentCount>& out)
+		{
+			MINT_ASSERT(a.Size() == b.Size(), "두 stream 의 크기가 달라선 안 됩니다!");
+
+			const uint32 size = a.Size();
+			out.Resize(size);
+			for (uint32 componentIndex = 0; componentIndex < ComponentCount; ++componentIndex)
+			{
+				const float* const aComponent = a.GetComponentData(componentIndex);
+				const float* const bComponent = b.GetComponentData(componentIndex);
+				float* const outComponent = out.GetComponentData(componentIndex);
+
+				uint32 index = 0;
+#if !defined MINT_NO_SIMD
+				{
+					using namespace FloatStreamLane;
+					const Type laneT = Set(t);
+					const Type laneOneMinusT = Set(1.0f - t);
+					const uint32 laneEnd = ComputeLaneEnd(size);
+					for (; index < laneEnd; index += kCount)
+					{
+						Store(outComponent + index, Add(Mul(Load(aComponent + index), laneOneMinusT), Mul(Load(bComponent + index), laneT)));
+					}
+				}
+#endif
+				for (; index < size; ++index)
+				{
+					outComponent[index] = aComponent[index] * (1.0f - t) + bComponent[index] * t;
+				}
+			}
+		}
+
+		template<uint32 ComponentCount>
+		bool MinMaxInternal(const FloatStream<ComponentCount>& vectors, typename FloatStream<ComponentCount>::ElementType& outMin, typename FloatStream<ComponentCount>::ElementType& outMax) noexcept
+		{
+			const uint32 size = vectors.Size();
+			if (size == 0)
+			{
+				return false;
+			}
+
+			for (uint32 componentIndex = 0; componentIndex < ComponentCount; ++componentIndex)
+			{
+				const float* const component = vectors.GetComponentData(componentIndex);
+				float minValue = component[0];
+				float maxValue = component[0];
+
+				uint32 index = 0;
+#if !defined MINT_NO_SIMD
+				{
+					using namespace FloatStreamLane;
+					const uint32 laneEnd = ComputeLaneEnd(size);
+					if (laneEnd > 0)
+					{
+						Type laneMin = Load(component);
+						Type laneMax = laneMin;
+						for (index = kCount; index < laneEnd; index += kCount)
+						{
+							const Type value = Load(component + index);
+							laneMin = Min(laneMin, value);
+							laneMax = Max(laneMax, value);
+						}
+
+						float minLanes[kCount];
+						float maxLanes[kCount];
+						Store(minLanes, laneMin);
+						Store(maxLanes, laneMax);
+						for (uint32 laneIndex = 0; laneIndex < kCount; ++laneIndex)
+						{
+							minValue = (minLanes[laneIndex] < minValue) ? minLanes[laneIndex] : minValue;
+							maxValue = (maxValue < maxLanes[laneIndex]) ? maxLanes[laneIndex] : maxValue;
+						}
+					}
+				}
+#endif
+				for (; index < size; ++index)
+				{
+					minValue = (component[index] < minValue) ? component[index] : minValue;
+					maxValue = (maxValue < component[index]) ? component[index] : maxValue;
+				}
+
+				outMin._c[componentIndex] = minValue;
+				outMax._c[componentIndex] = maxValue;
+			}
+			return true;
+		}
+
+		void Dot(const Float2Stream& lhs, const Float2Stream& rhs, Vector<float>& outDots)
+		{
+			DotInternal(lhs, rhs, outDots);
+		}
+
+		void Dot(const Float3Stream& lhs, const Float3Stream& rhs, Vector<float>& outDots)
+		{
+			DotInternal(lhs, rhs, outDots);
+		}
+
+		void Dot(const Float4Stream& lhs, const Float4Stream& rhs, Vector<float>& outDots)
+		{
+			DotInternal(lhs, rhs, outDots);
+		}
+
+		void Normalize(Float2Stream& inoutVectors) noexcept
+		{
+			NormalizeInternal(inoutVectors);
+		}
+
+		void Normalize(Float3Stream& inoutVectors) noexcept
+		{
+			NormalizeInternal(inoutVectors);
+		}
+
+		void Normalize(Float4Stream& inoutVectors) noexcept
+		{
+			NormalizeInternal(inoutVectors);
+		}
+
+		void Lerp(const Float2Stream& a, const Float2Stream& b, const float t, Float2Stream& out)
+		{
+			LerpInternal(a, b, t, out);
+		}
+
+		void Lerp(const Float3Stream& a, const Float3Stream& b, const float t, Float3Stream& out)
+		{
+			LerpInternal(a, b, t, out);
+		}
+
+		void Lerp(const Float4Stream& a, const Float4Stream& b, const float t, Float4Stream& out)
+		{
+			LerpInternal(a, b, t, out);
+		}
+
+		bool MinMax(const Float2Stream& vectors, Float2& outMin, Float2& outMax) noexcept
+		{
+			return MinMaxInternal(vectors, outMin, outMax);
+		}
+
+		bool MinMax(const Float3Stream& vectors, Float3& outMin, Float3& outMax) noexcept
+		{
+			return MinMaxInternal(vectors, outMin, outMax);
+		}
+
+		bool MinMax(const Float4Stream& vectors, Float4& outMin, Float4& outMax) noexcept
+		{
+			return MinMaxInternal(vectors, outMin, outMax);
+		}
+	}
+}
@@ -1,10 +1,90 @@
-#include <MintMath/Include/Geometry.h>
+﻿#include <MintMath/Include/Geometry.h>
 #include <MintMath/Include/Float3.h>
 #include <MintContainer/Include/Algorithm.hpp>
 
 
 namespace mint
 {
+	namespace Math
+	{
+		namespace GeometryInternal
+		{
+			// Knuth 의 TwoSum. a + b == outSum + outError 가 정확히 성립한다.
+			MINT_INLINE void TwoSum(const double a, const double b, double& outSum, double& outError) noexcept
+			{
+				outSum = a + b;
+				const double bVirtual = outSum - a;
+				const double aVirtual = outSum - bVirtual;
+				outError = (a - aVirtual) + (b - bVirtual);
+			}
+
+			// float * float 는 double 로 정확히 표현되므로, 6 개의 곱을 expansion 으로 더하면 행렬식을 정확히 구할 수 있다.
+			double Orient2DExact(const Float2& a, const Float2& b, const Float2& c) noexcept
+			{
+				const double products[6]
+				{
+					static_cast<double>(a._x) * static_cast<double>(b._y),
+					-static_cast<double>(a._x) * static_cast<double>(c._y),
+					-static_cast<double>(c._x) * static_cast<double>(b._y),
+					-static_cast<double>(a._y) * static_cast<double>(b._x),
+					static_cast<double>(a._y) * static_cast<double>(c._x),
+					static_cast<double>(c._y) * static_cast<double>(b._x),
+				};
+
+				// Shewchuk 의 Grow-Expansion. 성분들은 겹치지 않고 크기 순으로 쌓인다.
+				double expansion[6]{};
+				uint32 expansionLength = 0;
+				for (const double product : products)
+				{
+					double q = product;
+					for (uint32 i = 0; i < expansionLength; ++i)
+					{
+						double sum;
+						TwoSum(q, expansion[i], sum, expansion[i]);
+						q = sum;
+					}
+					expansion[expansionLength++] = q;
+				}
+
+				// 가장 큰 0 이 아닌 성분이 전체의 부호를 결정한다.
+				for (uint32 i = expansionLength; i > 0; --i)
+				{
+					if (expansion[i - 1] != 0.0)
+					{
+						return expansion[i - 1];
+					}
+				}
+				return 0.0;
+			}
+		}
+
+		double Orient2D(const Float2& a, const Float2& b, const Float2& c) noexcept
+		{
+			// Shewchuk 의 ccwerrboundA = (3 + 16 * eps) * eps
+			static constexpr double kErrorBound = (3.0 + 16.0 * 1.1102230246251565e-16) * 1.1102230246251565e-16;
+
+			const double detLeft = (static_cast<double>(a._x) - c._x) * (static_cast<double>(b._y) - c._y);
+			const double detRight = (static_cast<double>(a._y) - c._y) * (static_cast<double>(b._x) - c._x);
+			const double det = detLeft - detRight;
+			const double detSum = ::abs(detLeft) + ::abs(detRight);
+			if (::abs(det) > kErrorBound * detSum)
+			{
+				return det;
+			}
+			return GeometryInternal::Orient2DExact(a, b, c);
+		}
+
+		double ComputeSignedDoubleArea(const Float2* const points, const uint32 pointCount) noexcept
+		{
+			double result = 0.0;
+			for (uint32 i = 0, j = pointCount - 1; i < pointCount; j = i++)
+			{
+				result += static_cast<double>(points[j]._x) * points[i]._y - static_cast<double>(points[i]._x) * points[j]._y;
+			}
+			return result;
+		}
+	}
+
 	uint32 GrahamScan_FindStartPoint(const Vector<Float2>& points)
 	{
 		Float2 min = Float2(10000.0f, -10000.0f);
@@ -119,4 +199,339 @@ namespace mint
 		}
 		inoutPoints = convexPoints;
 	}
+
+	uint32 ConvexHull_Compute(const Float2* const points, const uint32 pointCount, Float2* const scratch, Float2* const outHull)
+	{
+		if (pointCount == 0)
+		{
+			return 0;
+		}
+
+		if (scratch != points)
+		{
+			for (uint32 i = 0; i < pointCount; ++i)
+			{
+				scratch[i] = points[i];
+			}
+		}
+
+		struct LexicographicComparator
+		{
+			bool operator()(const Float2& lhs, const Float2& rhs) const { return (lhs._x < rhs._x) || (lhs._x == rhs._x && lhs._y < rhs._y); }
+		};
+		QuickSort(scratch, pointCount, LexicographicComparator());
+
+		if (scratch[0] == scratch[pointCount - 1])
+		{
+			outHull[0] = scratch[0];
+			return 1;
+		}
+
+		// Lower hull
+		uint32 hullCount = 0;
+		for (uint32 i = 0; i < pointCount; ++i)
+		{
+			while (hullCount >= 2 && Math::Orient2D(outHull[hullCount - 2], outHull[hullCount - 1], scratch[i]) <= 0.0)
+			{
+				--hullCount;
+			}
+			outHull[hullCount++] = scratch[i];
+		}
+
+		// Upper hull
+		const uint32 lowerHullCount = hullCount + 1;
+		for (uint32 i = pointCount - 1; i > 0; --i)
+		{
+			const Float2& point = scratch[i - 1];
+			while (hullCount >= lowerHullCount && Math::Orient2D(outHull[hullCount - 2], outHull[hullCount - 1], point) <= 0.0)
+			{
+				--hullCount;
+			}
+			outHull[hullCount++] = point;
+		}
+
+		// 마지막 점은 시작점과 같다.
+		return hullCount - 1;
+	}
+
+	void ConvexHull_Compute(Vector<Float2>& inoutPoints, Vector<Float2>& scratch)
+	{
+		const uint32 pointCount = inoutPoints.Size();
+		scratch.Resize(pointCount + 1);
+		const uint32 hullCount = ConvexHull_Compute(inoutPoints.Data(), pointCount, inoutPoints.Data(), scratch.Data());
+		for (uint32 i = 0; i < hullCount; ++i)
+		{
+			inoutPoints[i] = scratch[i];
+		}
+		inoutPoints.Resize(hullCount);
+	}
+
+	bool ConvexHull_InsertPoint(Vector<Float2>& inoutHull, const Float2& point, const uint32 edgeEndIndex)
+	{
+		const uint32 hullCount = inoutHull.Size();
+		if (hullCount < 3)
+		{
+			if (hullCount == 2)
+			{
+				const double orientation = Math::Orient2D(inoutHull[0], inoutHull[1], point);
+				if (orientation == 0.0)
+				{
+					return false;
+				}
+				inoutHull.Insert((orientation > 0.0 ? 2 : 1), point);
+				return true;
+			}
+			if (hullCount == 1 && inoutHull[0] == point)
+			{
+				return false;
+			}
+			inoutHull.PushBack(point);
+			return true;
+		}
+
+		const uint32 edgeEnd = edgeEndIndex % hullCount;
+		const uint32 edgeStart = (edgeEnd + hullCount - 1) % hullCount;
+		if (Math::Orient2D(inoutHull[edgeStart], inoutHull[edgeEnd], point) >= 0.0)
+		{
+			return false;
+		}
+
+		// 점에서 보이는 꼭짓점들을 양쪽으로 찾아 나간다.
+		uint32 forwardRemovalCount = 0;
+		while (forwardRemovalCount + 2 < hullCount)
+		{
+			const Float2& vertex = inoutHull[(edgeEnd + forwardRemovalCount) % hullCount];
+			const Float2& nextVertex = inoutHull[(edgeEnd + forwardRemovalCount + 1) % hullCount];
+			if (Math::Orient2D(point, vertex, nextVertex) > 0.0)
+			{
+				break;
+			}
+			++forwardRemovalCount;
+		}
+		uint32 backwardRemovalCount = 0;
+		while (forwardRemovalCount + backwardRemovalCount + 2 < hullCount)
+		{
+			const Float2& vertex = inoutHull[(edgeStart + hullCount - backwardRemovalCount) % hullCount];
+			const Float2& previousVertex = inoutHull[(edgeStart + hullCount - backwardRemovalCount - 1) % hullCount];
+			if (Math::Orient2D(previousVertex, vertex, point) > 0.0)
+			{
+				break;
+			}
+			++backwardRemovalCount;
+		}
+
+		const uint32 removalCount = forwardRemovalCount + backwardRemovalCount;
+		if (removalCount == 0)
+		{
+			inoutHull.Insert(edgeEnd, point);
+			return true;
+		}
+
+		// 제거될 꼭짓점들은 원형으로 연속되어 있으므로 그 첫 자리에 점을 넣고 나머지를 당긴다.
+		const uint32 removalStart = (edgeStart + hullCount + 1 - backwardRemovalCount) % hullCount;
+		if (removalStart + removalCount <= hullCount)
+		{
+			inoutHull[removalStart] = point;
+			for (uint32 i = removalStart + removalCount; i < hullCount; ++i)
+			{
+				inoutHull[i - removalCount + 1] = inoutHull[i];
+			}
+			inoutHull.Resize(hullCount - removalCount + 1);
+		}
+		else
+		{
+			const uint32 headRemovalCount = removalStart + removalCount - hullCount;
+			for (uint32 i = headRemovalCount; i < removalStart; ++i)
+			{
+				inoutHull[i - headRemovalCount] = inoutHull[i];
+			}
+			inoutHull[removalStart - headRemovalCount] = point;
+			inoutHull.Resize(removalStart - headRemovalCount + 1);
+		}
+		return true;
+	}
+
+	bool ConvexHull_InsertPoint(Vector<Float2>& inoutHull, const Float2& point)
+	{
+		const uint32 hullCount = inoutHull.Size();
+		if (hullCount < 3)
+		{
+			return ConvexHull_InsertPoint(inoutHull, point, 0);
+		}
+
+		for (uint32 i = 0; i < hullCount; ++i)
+		{
+			const Float2& edgeStart = inoutHull[(i == 0 ? hullCount - 1 : i - 1)];
+			if (Math::Orient2D(edgeStart, inoutHull[i], point) < 0.0)
+			{
+				return ConvexHull_InsertPoint(inoutHull, point, i);
+			}
+		}
+		return false;
+	}
+
+	namespace GeometryInternal
+	{
+		// remainingIndices 중 [excludedBegin, excludedBegin + excludedCount) (원형) 를 제외한 점이 CCW 삼각형 abc 안이나 경계 위에 있는지
+		bool ContainsAnyRemainingPoint(const Float2* const polygon, const uint32* const remainingIndices, const uint32 remainingCount, const uint32 excludedBegin, const uint32 excludedCount,
+			const Float2& a, const Float2& b, const Float2& c) noexcept
+		{
+			for (uint32 i = excludedCount; i < remainingCount; ++i)
+			{
+				const Float2& point = polygon[remainingIndices[(excludedBegin + i) % remainingCount]];
+				if (Math::Orient2D(a, b, point) >= 0.0 && Math::Orient2D(b, c, point) >= 0.0 && Math::Orient2D(c, a, point) >= 0.0)
+				{
+					return true;
+				}
+			}
+			return false;
+		}
+
+		// 볼록 조각 remainingIndices[pieceBegin] ~ remainingIndices[pieceBegin + pieceLength - 1] (원형) 의 앞이나 뒤에 꼭짓점 하나를 더 붙여도
+		// 볼록하고 다른 점을 품지 않는지. 붙는 꼭짓점은 어느 쪽이든 원형으로는 마지막과 처음 사이에 들어간다.
+		bool CanExtendConvexPiece(const Float2* const polygon, const uint32* const remainingIndices, const uint32 remainingCount, const uint32 pieceBegin, const uint32 pieceLength, const bool extendsForward) noexcept
+		{
+			const uint32 extendedBegin = (extendsForward ? pieceBegin : (pieceBegin + remainingCount - 1) % remainingCount);
+			const Float2& first = polygon[remainingIndices[pieceBegin]];
+			const Float2& second = polygon[remainingIndices[(pieceBegin + 1) % remainingCount]];
+			const Float2& previousLast = polygon[remainingIndices[(pieceBegin + pieceLength - 2) % remainingCount]];
+			const Float2& last = polygon[remainingIndices[(pieceBegin + pieceLength - 1) % remainingCount]];
+			const Float2& vertex = polygon[remainingIndices[(extendsForward ? (pieceBegin + pieceLength) % remainingCount : extendedBegin)]];
+			if (Math::Orient2D(previousLast, last, vertex) <= 0.0 || Math::Orient2D(last, vertex, first) <= 0.0 || Math::Orient2D(vertex, first, second) <= 0.0)
+			{
+				return false;
+			}
+			return ContainsAnyRemainingPoint(polygon, remainingIndices, remainingCount, extendedBegin, pieceLength + 1, first, last, vertex) == false;
+		}
+
+		bool IsConvexPolygon(const Float2* const polygon, const uint32* const remainingIndices, const uint32 remainingCount) noexcept
+		{
+			for (uint32 i = 0; i < remainingCount; ++i)
+			{
+				const Float2& a = polygon[remainingIndices[i]];
+				const Float2& b = polygon[remainingIndices[(i + 1) % remainingCount]];
+				const Float2& c = polygon[remainingIndices[(i + 2) % remainingCount]];
+				if (Math::Orient2D(a, b, c) < 0.0)
+				{
+					return false;
+				}
+			}
+			return true;
+		}
+	}
+
+	uint32 ConvexDecomposition_Compute(const Float2* const polygon, const uint32 pointCount, uint32* const scratchIndices, uint32* const outIndices, uint32* const outPieceOffsets)
+	{
+		outPieceOffsets[0] = 0;
+		if (pointCount < 3)
+		{
+			return 0;
+		}
+
+		const bool isCounterClockwise = Math::ComputeSignedDoubleArea(polygon, pointCount) >= 0.0;
+		for (uint32 i = 0; i < pointCount; ++i)
+		{
+			scratchIndices[i] = (isCounterClockwise ? i : pointCount - 1 - i);
+		}
+
+		uint32* const remainingIndices = scratchIndices;
+		uint32 remainingCount = pointCount;
+		uint32 pieceCount = 0;
+		uint32 indexCount = 0;
+		while (remainingCount > 3 && GeometryInternal::IsConvexPolygon(polygon, remainingIndices, remainingCount) == false)
+		{
+			bool isClipped = false;
+			for (uint32 start = 0; start < remainingCount; ++start)
+			{
+				const Float2& a = polygon[remainingIndices[start]];
+				const Float2& b = polygon[remainingIndices[(start + 1) % remainingCount]];
+				const Float2& c = polygon[remainingIndices[(start + 2) % remainingCount]];
+				if (Math::Orient2D(a, b, c) <= 0.0)
+				{
+					continue;
+				}
+
+				if (GeometryInternal::ContainsAnyRemainingPoint(polygon, remainingIndices, remainingCount, start, 3, a, b, c) == true)
+				{
+					continue;
+				}
+
+				// 귀를 찾았으니 볼록함이 유지되고 다른 점을 품지 않는 동안 앞뒤로 넓힌다.
+				// 남는 다각형이 삼각형 이상이 되도록 remainingCount - 1 개까지만 넓힌다.
+				uint32 pieceBegin = start;
+				uint32 pieceLength = 3;
+				while (pieceLength + 1 < remainingCount)
+				{
+					if (GeometryInternal::CanExtendConvexPiece(polygon, remainingIndices, remainingCount, pieceBegin, pieceLength, true) == true)
+					{
+						++pieceLength;
+					}
+					else if (GeometryInternal::CanExtendConvexPiece(polygon, remainingIndices, remainingCount, pieceBegin, pieceLength, false) == true)
+					{
+						pieceBegin = (pieceBegin + remainingCount - 1) % remainingCount;
+						++pieceLength;
+					}
+					else
+					{
+						break;
+					}
+				}
+
+				for (uint32 i = 0; i < pieceLength; ++i)
+				{
+					outIndices[indexCount++] = remainingIndices[(pieceBegin + i) % remainingCount];
+				}
+				outPieceOffsets[++pieceCount] = indexCount;
+
+				// 조각의 양 끝을 제외한 꼭짓점들을 제거한다.
+				const uint32 removalCount = pieceLength - 2;
+				const uint32 removalBegin = (pieceBegin + 1) % remainingCount;
+				uint32 keptCount = 0;
+				for (uint32 i = 0; i < remainingCount; ++i)
+				{
+					const uint32 offsetFromRemoval = (i + remainingCount - removalBegin) % remainingCount;
+					if (offsetFromRemoval >= removalCount)
+					{
+						remainingIndices[keptCount++] = remainingIndices[i];
+					}
+				}
+				remainingCount = keptCount;
+				isClipped = true;
+				break;
+			}
+
+			if (isClipped == false)
+			{
+				// 자기 교차하는 다각형이라 귀를 찾지 못했다. 남은 부분을 그대로 한 조각으로 둔다.
+				break;
+			}
+		}
+
+		for (uint32 i = 0; i < remainingCount; ++i)
+		{
+			outIndices[indexCount++] = remainingIndices[i];
+		}
+		outPieceOffsets[++pieceCount] = indexCount;
+		return pieceCount;
+	}
+
+	uint32 ConvexDecomposition_Compute(const Vector<Float2>& polygon, Vector<uint32>& scratchIndices, Vector<uint32>& outIndices, Vector<uint32>& outPieceOffsets)
+	{
+		const uint32 pointCount = polygon.Size();
+		if (pointCount < 3)
+		{
+			outIndices.Clear();
+			outPieceOffsets.Resize(1);
+			outPieceOffsets[0] = 0;
+			return 0;
+		}
+
+		scratchIndices.Resize(pointCount);
+		outIndices.Resize((pointCount - 2) * 3);
+		outPieceOffsets.Resize(pointCount - 1);
+		const uint32 pieceCount = ConvexDecomposition_Compute(polygon.Data(), pointCount, scratchIndices.Data(), outIndices.Data(), outPieceOffsets.Data());
+		outIndices.Resize(outPieceOffsets[pieceCount]);
+		outPieceOffsets.Resize(pieceCount + 1);
+		return pieceCount;
+	}
 }
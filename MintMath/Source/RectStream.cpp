@@ -0,0 +1,384 @@
+﻿#include <MintMath/Include/RectStream.h>
+#include <MintMath/Include/Float4x4.h>
+
+#include <MintContainer/Include/Vector.hpp>
+
+#include <immintrin.h>
+#include <cmath>
+
+
+namespace mint
+{
+#pragma region RectStream
+	RectStream::RectStream()
+		: _size{ 0 }
+	{
+		__noop;
+	}
+
+	RectStream::RectStream(const uint32 size)
+		: _size{ 0 }
+	{
+		Resize(size);
+	}
+
+	RectStream::RectStream(RectStream&& rhs) noexcept
+		: _lefts{ std::move(rhs._lefts) }
+		, _rights{ std::move(rhs._rights) }
+		, _tops{ std::move(rhs._tops) }
+		, _bottoms{ std::move(rhs._bottoms) }
+		, _size{ rhs._size }
+	{
+		rhs._size = 0;
+	}
+
+	RectStream& RectStream::operator=(RectStream&& rhs) noexcept
+	{
+		if (this != &rhs)
+		{
+			_lefts = std::move(rhs._lefts);
+			_rights = std::move(rhs._rights);
+			_tops = std::move(rhs._tops);
+			_bottoms = std::move(rhs._bottoms);
+			_size = rhs._size;
+			rhs._size = 0;
+		}
+		return *this;
+	}
+
+	void RectStream::Resize(const uint32 size)
+	{
+		_lefts.Resize(size);
+		_rights.Resize(size);
+		_tops.Resize(size);
+		_bottoms.Resize(size);
+		_size = size;
+	}
+
+	void RectStream::Reserve(const uint32 capacity)
+	{
+		_lefts.Reserve(capacity);
+		_rights.Reserve(capacity);
+		_tops.Reserve(capacity);
+		_bottoms.Reserve(capacity);
+	}
+
+	void RectStream::Clear() noexcept
+	{
+		_lefts.Clear();
+		_rights.Clear();
+		_tops.Clear();
+		_bottoms.Clear();
+		_size = 0;
+	}
+
+	void RectStream::PushBack(const Rect& rect)
+	{
+		_lefts.PushBack(rect.Left());
+		_rights.PushBack(rect.Right());
+		_tops.PushBack(rect.Top());
+		_bottoms.PushBack(rect.Bottom());
+		++_size;
+	}
+
+	void RectStream::Set(const uint32 index, const Rect& rect) noexcept
+	{
+		_lefts[index] = rect.Left();
+		_rights[index] = rect.Right();
+		_tops[index] = rect.Top();
+		_bottoms[index] = rect.Bottom();
+	}
+
+	Rect RectStream::Get(const uint32 index) const noexcept
+	{
+		return Rect(_lefts[index], _rights[index], _tops[index], _bottoms[index]);
+	}
+
+	void RectStream::Assign(const Rect* const rects, const uint32 count)
+	{
+		Resize(count);
+		for (uint32 index = 0; index < count; ++index)
+		{
+			_lefts[index] = rects[index].Left();
+			_rights[index] = rects[index].Right();
+			_tops[index] = rects[index].Top();
+			_bottoms[index] = rects[index].Bottom();
+		}
+	}
+#pragma endregion
+
+
+	namespace Math
+	{
+		namespace RectStreamLane
+		{
+#if defined MINT_NO_SIMD
+			static constexpr uint32 kCount = 1;
+#elif defined __AVX__
+			using Type = __m256;
+			static constexpr uint32 kCount = 8;
+			MINT_INLINE Type Load(const float* const source) noexcept { return _mm256_loadu_ps(source); }
+			MINT_INLINE void Store(float* const destination, const Type value) noexcept { _mm256_storeu_ps(destination, value); }
+			MINT_INLINE Type Set(const float value) noexcept { return _mm256_set1_ps(value); }
+			MINT_INLINE Type Add(const Type lhs, const Type rhs) noexcept { return _mm256_add_ps(lhs, rhs); }
+			MINT_INLINE Type Mul(const Type lhs, const Type rhs) noexcept { return _mm256_mul_ps(lhs, rhs); }
+			MINT_INLINE Type Min(const Type lhs, const Type rhs) noexcept { return _mm256_min_ps(lhs, rhs); }
+			MINT_INLINE Type Max(const Type lhs, const Type rhs) noexcept { return _mm256_max_ps(lhs, rhs); }
+			MINT_INLINE Type And(const Type lhs, const Type rhs) noexcept { return _mm256_and_ps(lhs, rhs); }
+			MINT_INLINE Type LessEqual(const Type lhs, const Type rhs) noexcept { return _mm256_cmp_ps(lhs, rhs, _CMP_LE_OQ); }
+			MINT_INLINE Type Less(const Type lhs, const Type rhs) noexcept { return _mm256_cmp_ps(lhs, rhs, _CMP_LT_OQ); }
+			// lane i 의 비교 결과가 i 번째 bit 가 된다.
+			MINT_INLINE uint64 MoveMask(const Type value) noexcept { return static_cast<uint64>(_mm256_movemask_ps(value)); }
+#else
+			using Type = __m128;
+			static constexpr uint32 kCount = 4;
+			MINT_INLINE Type Load(const float* const source) noexcept { return _mm_loadu_ps(source); }
+			MINT_INLINE void Store(float* const destination, const Type value) noexcept { _mm_storeu_ps(destination, value); }
+			MINT_INLINE Type Set(const float value) noexcept { return _mm_set1_ps(value); }
+			MINT_INLINE Type Add(const Type lhs, const Type rhs) noexcept { return _mm_add_ps(lhs, rhs); }
+			MINT_INLINE Type Mul(const Type lhs, const Type rhs) noexcept { return _mm_mul_ps(lhs, rhs); }
+			MINT_INLINE Type Min(const Type lhs, const Type rhs) noexcept { return _mm_min_ps(lhs, rhs); }
+			MINT_INLINE Type Max(const Type lhs, const Type rhs) noexcept { return _mm_max_ps(lhs, rhs); }
+			MINT_INLINE Type And(const Type lhs, const Type rhs) noexcept { return _mm_and_ps(lhs, rhs); }
+			MINT_INLINE Type LessEqual(const Type lhs, const Type rhs) noexcept { return _mm_cmple_ps(lhs, rhs); }
+			MINT_INLINE Type Less(const Type lhs, const Type rhs) noexcept { return _mm_cmplt_ps(lhs, rhs); }
+			// lane i 의 비교 결과가 i 번째 bit 가 된다.
+			MINT_INLINE uint64 MoveMask(const Type value) noexcept { return static_cast<uint64>(_mm_movemask_ps(value)); }
+#endif
+
+			// lane 단위로 처리할 수 있는 원소 개수
+			MINT_INLINE uint32 ComputeLaneEnd(const uint32 size) noexcept
+			{
+				return size - (size % kCount);
+			}
+		}
+
+		static_assert(64 % RectStreamLane::kCount == 0, "한 lane 묶음의 결과가 두 word 에 걸치면 안 된다.");
+
+		MINT_INLINE void PrepareMasks(const uint32 size, Vector<uint64>& outMasks)
+		{
+			const uint32 wordCount = (size + 63) / 64;
+			outMasks.Resize(wordCount);
+			for (uint32 wordIndex = 0; wordIndex < wordCount; ++wordIndex)
+			{
+				outMasks[wordIndex] = 0;
+			}
+		}
+
+		void Contains(const RectStream& rects, const Float2& point, Vector<uint64>& outMasks)
+		{
+			const uint32 size = rects.Size();
+			PrepareMasks(size, outMasks);
+			const float* const lefts = rects.GetLeftData();
+			const float* const rights = rects.GetRightData();
+			const float* const tops = rects.GetTopData();
+			const float* const bottoms = rects.GetBottomData();
+			uint64* const masks = outMasks.Data();
+
+			uint32 index = 0;
+#if !defined MINT_NO_SIMD
+			{
+				using namespace RectStreamLane;
+				const Type x = Set(point._x);
+				const Type y = Set(point._y);
+				const uint32 laneEnd = ComputeLaneEnd(size);
+				for (; index < laneEnd; index += kCount)
+				{
+					const Type left = Load(lefts + index);
+					const Type right = Load(rights + index);
+					const Type top = Load(tops + index);
+					const Type bottom = Load(bottoms + index);
+					// 넓이가 0 인 Rect 를 빼려면 left < right, top < bottom 이어야 한다. (left > right 면 어차피 점이 들어갈 수 없다.)
+					const Type inside = And(And(And(LessEqual(left, x), LessEqual(x, right)), And(LessEqual(top, y), LessEqual(y, bottom))), And(Less(left, right), Less(top, bottom)));
+					masks[index / 64] |= MoveMask(inside) << (index % 64);
+				}
+			}
+#endif
+			for (; index < size; ++index)
+			{
+				const bool inside = (lefts[index] <= point._x) && (point._x <= rights[index]) && (tops[index] <= point._y) && (point._y <= bottoms[index])
+					&& (lefts[index] < rights[index]) && (tops[index] < bottoms[index]);
+				masks[index / 64] |= static_cast<uint64>(inside) << (index % 64);
+			}
+		}
+
+		void Intersects(const RectStream& rects, const Rect& query, Vector<uint64>& outMasks)
+		{
+			const uint32 size = rects.Size();
+			PrepareMasks(size, outMasks);
+			const float* const lefts = rects.GetLeftData();
+			const float* const rights = rects.GetRightData();
+			const float* const tops = rects.GetTopData();
+			const float* const bottoms = rects.GetBottomData();
+			uint64* const masks = outMasks.Data();
+
+			uint32 index = 0;
+#if !defined MINT_NO_SIMD
+			{
+				using namespace RectStreamLane;
+				const Type queryLeft = Set(query.Left());
+				const Type queryRight = Set(query.Right());
+				const Type queryTop = Set(query.Top());
+				const Type queryBottom = Set(query.Bottom());
+				const uint32 laneEnd = ComputeLaneEnd(size);
+				for (; index < laneEnd; index += kCount)
+				{
+					const Type horz = And(LessEqual(Load(lefts + index), queryRight), LessEqual(queryLeft, Load(rights + index)));
+					const Type vert = And(LessEqual(Load(tops + index), queryBottom), LessEqual(queryTop, Load(bottoms + index)));
+					masks[index / 64] |= MoveMask(And(horz, vert)) << (index % 64);
+				}
+			}
+#endif
+			for (; index < size; ++index)
+			{
+				const bool intersects = (lefts[index] <= query.Right()) && (query.Left() <= rights[index]) && (tops[index] <= query.Bottom()) && (query.Top() <= bottoms[index]);
+				masks[index / 64] |= static_cast<uint64>(intersects) << (index % 64);
+			}
+		}
+
+		void ClipBy(RectStream& inoutRects, const Rect& outerRect) noexcept
+		{
+			const uint32 size = inoutRects.Size();
+			float* const lefts = inoutRects.GetLeftData();
+			float* const rights = inoutRects.GetRightData();
+			float* const tops = inoutRects.GetTopData();
+			float* const bottoms = inoutRects.GetBottomData();
+
+			uint32 index = 0;
+#if !defined MINT_NO_SIMD
+			{
+				using namespace RectStreamLane;
+				const Type outerLeft = Set(outerRect.Left());
+				const Type outerRight = Set(outerRect.Right());
+				const Type outerTop = Set(outerRect.Top());
+				const Type outerBottom = Set(outerRect.Bottom());
+				const uint32 laneEnd = ComputeLaneEnd(size);
+				for (; index < laneEnd; index += kCount)
+				{
+					const Type left = Max(Load(lefts + index), outerLeft);
+					const Type top = Max(Load(tops + index), outerTop);
+					Store(lefts + index, left);
+					Store(tops + index, top);
+					// Rect::Validate() 처럼 크기가 음수가 되지 않게 한다.
+					Store(rights + index, Max(left, Min(Load(rights + index), outerRight)));
+					Store(bottoms + index, Max(top, Min(Load(bottoms + index), outerBottom)));
+				}
+			}
+#endif
+			for (; index < size; ++index)
+			{
+				const float left = mint::Max(lefts[index], outerRect.Left());
+				const float top = mint::Max(tops[index], outerRect.Top());
+				lefts[index] = left;
+				tops[index] = top;
+				rights[index] = mint::Max(left, mint::Min(rights[index], outerRect.Right()));
+				bottoms[index] = mint::Max(top, mint::Min(bottoms[index], outerRect.Bottom()));
+			}
+		}
+
+		void ComputeFrustumPlanes(const Float4x4& viewProjection, Float4 (&outPlanes)[6]) noexcept
+		{
+			// clip = viewProjection * (p, 1) 일 때 -w <= x <= w, -w <= y <= w, 0 <= z <= w
+			const float (&m)[4][4] = viewProjection._m;
+			for (uint32 column = 0; column < 4; ++column)
+			{
+				outPlanes[0]._c[column] = m[3][column] + m[0][column];
+				outPlanes[1]._c[column] = m[3][column] - m[0][column];
+				outPlanes[2]._c[column] = m[3][column] + m[1][column];
+				outPlanes[3]._c[column] = m[3][column] - m[1][column];
+				outPlanes[4]._c[column] = m[2][column];
+				outPlanes[5]._c[column] = m[3][column] - m[2][column];
+			}
+		}
+
+		void CullAABBs(const Float4 (&frustumPlanes)[6], const Float3Stream& centers, const Float3Stream& halfSizes, Vector<uint64>& outVisibleMasks)
+		{
+			MINT_ASSERT(centers.Size() == halfSizes.Size(), "두 stream 의 크기가 달라선 안 됩니다!");
+
+			// 평면에서 가장 안쪽으로 나온 꼭짓점까지의 거리 = dot(n, center) + d + dot(|n|, halfSize)
+			// 이 값이 음수인 평면이 하나라도 있으면 AABB 전체가 그 평면 바깥에 있다.
+			const uint32 size = centers.Size();
+			PrepareMasks(size, outVisibleMasks);
+			const float* const centerXs = centers.GetComponentData(0);
+			const float* const centerYs = centers.GetComponentData(1);
+			const float* const centerZs = centers.GetComponentData(2);
+			const float* const halfSizeXs = halfSizes.GetComponentData(0);
+			const float* const halfSizeYs = halfSizes.GetComponentData(1);
+			const float* const halfSizeZs = halfSizes.GetComponentData(2);
+			uint64* const masks = outVisibleMasks.Data();
+
+			Float4 absPlanes[6];
+			for (uint32 planeIndex = 0; planeIndex < 6; ++planeIndex)
+			{
+				for (uint32 componentIndex = 0; componentIndex < 3; ++componentIndex)
+				{
+					absPlanes[planeIndex]._c[componentIndex] = ::fabsf(frustumPlanes[planeIndex]._c[componentIndex]);
+				}
+			}
+
+			uint32 index = 0;
+#if !defined MINT_NO_SIMD
+			{
+				using namespace RectStreamLane;
+				Type planes[6][4];
+				Type absNormals[6][3];
+				for (uint32 planeIndex = 0; planeIndex < 6; ++planeIndex)
+				{
+					for (uint32 componentIndex = 0; componentIndex < 4; ++componentIndex)
+					{
+						planes[planeIndex][componentIndex] = Set(frustumPlanes[planeIndex]._c[componentIndex]);
+					}
+					for (uint32 componentIndex = 0; componentIndex < 3; ++componentIndex)
+					{
+						absNormals[planeIndex][componentIndex] = Set(absPlanes[planeIndex]._c[componentIndex]);
+					}
+				}
+
+				const Type zero = Set(0.0f);
+				const uint32 laneEnd = ComputeLaneEnd(size);
+				for (; index < laneEnd; index += kCount)
+				{
+					const Type x = Load(centerXs + index);
+					const Type y = Load(centerYs + index);
+					const Type z = Load(centerZs + index);
+					const Type hx = Load(halfSizeXs + index);
+					const Type hy = Load(halfSizeYs + index);
+					const Type hz = Load(halfSizeZs + index);
+					Type visible = LessEqual(zero, zero);
+					for (uint32 planeIndex = 0; planeIndex < 6; ++planeIndex)
+					{
+						const Type distance = Add(Add(Mul(planes[planeIndex][0], x), Mul(planes[planeIndex][1], y)), Add(Mul(planes[planeIndex][2], z), planes[planeIndex][3]));
+						const Type radius = Add(Add(Mul(absNormals[planeIndex][0], hx), Mul(absNormals[planeIndex][1], hy)), Mul(absNormals[planeIndex][2], hz));
+						visible = And(visible, LessEqual(zero, Add(distance, radius)));
+					}
+					masks[index / 64] |= MoveMask(visible) << (index % 64);
+				}
+			}
+#endif
+			for (; index < size; ++index)
+			{
+				bool visible = true;
+				for (uint32 planeIndex = 0; planeIndex < 6; ++planeIndex)
+				{
+					const Float4& plane = frustumPlanes[planeIndex];
+					const Float4& absPlane = absPlanes[planeIndex];
+					const float distance = (plane._x * centerXs[index] + plane._y * centerYs[index]) + (plane._z * centerZs[index] + plane._w);
+					const float radius = (absPlane._x * halfSizeXs[index] + absPlane._y * halfSizeYs[index]) + absPlane._z * halfSizeZs[index];
+					visible &= (0.0f <= distance + radius);
+				}
+				masks[index / 64] |= static_cast<uint64>(visible) << (index % 64);
+			}
+		}
+
+		uint32 CountSetBits(const Vector<uint64>& masks) noexcept
+		{
+			uint32 count = 0;
+			const uint32 wordCount = masks.Size();
+			for (uint32 wordIndex = 0; wordIndex < wordCount; ++wordIndex)
+			{
+				count += PopCount64(masks[wordIndex]);
+			}
+			return count;
+		}
+	}
+}
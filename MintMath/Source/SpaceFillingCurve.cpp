@@ -0,0 +1,370 @@
+#include <MintMath/Include/SpaceFillingCurve.h>
+
+#include <MintContainer/Include/Vector.hpp>
+
+#include <MintCommon/Include/CPUFeatures.h>
+
+#include <immintrin.h>
+
+
+// _pdep_u64 / _pext_u64 는 64 bit 빌드에만 있다.
+#if defined _M_X64 || defined __x86_64__
+#define MINT_SPACE_FILLING_CURVE_HAS_BMI2
+#endif
+
+
+namespace mint
+{
+	namespace Math
+	{
+		namespace SpaceFillingCurveInternal
+		{
+#if defined __AVX2__
+			using WideLane = Lane::AVX2;
+			static constexpr uint32 kWideLaneWidth = 8;
+
+			MINT_INLINE WideLane::Type LoadWide(const uint32* const source) noexcept { return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(source)); }
+			MINT_INLINE void StoreWide(uint32* const destination, const WideLane::Type value) noexcept { _mm256_storeu_si256(reinterpret_cast<__m256i*>(destination), value); }
+			// 0 이상의 float 를 격자 좌표로 바꾼다. 곱한 결과가 [0, maxCell] 밖이면 자른다.
+			MINT_INLINE WideLane::Type QuantizeWide(const float* const source, const float min, const float scale, const float maxCell) noexcept
+			{
+				const __m256 offset = _mm256_sub_ps(_mm256_loadu_ps(source), _mm256_set1_ps(min));
+				const __m256 scaled = _mm256_min_ps(_mm256_max_ps(_mm256_mul_ps(offset, _mm256_set1_ps(scale)), _mm256_setzero_ps()), _mm256_set1_ps(maxCell));
+				return _mm256_cvttps_epi32(scaled);
+			}
+#else
+			using WideLane = Lane::SSE;
+			static constexpr uint32 kWideLaneWidth = 4;
+
+			MINT_INLINE WideLane::Type LoadWide(const uint32* const source) noexcept { return _mm_loadu_si128(reinterpret_cast<const __m128i*>(source)); }
+			MINT_INLINE void StoreWide(uint32* const destination, const WideLane::Type value) noexcept { _mm_storeu_si128(reinterpret_cast<__m128i*>(destination), value); }
+			MINT_INLINE WideLane::Type QuantizeWide(const float* const source, const float min, const float scale, const float maxCell) noexcept
+			{
+				const __m128 offset = _mm_sub_ps(_mm_loadu_ps(source), _mm_set1_ps(min));
+				const __m128 scaled = _mm_min_ps(_mm_max_ps(_mm_mul_ps(offset, _mm_set1_ps(scale)), _mm_setzero_ps()), _mm_set1_ps(maxCell));
+				return _mm_cvttps_epi32(scaled);
+			}
+#endif
+
+			MINT_INLINE uint32 ComputeWideLaneEnd(const uint32 count) noexcept
+			{
+				return count - (count % kWideLaneWidth);
+			}
+
+			// QuantizeToGrid 와 같은 값을 내도록 scale 을 미리 구해 둔다.
+			MINT_INLINE float ComputeQuantizationScale(const float min, const float max, const uint32 bitCount) noexcept
+			{
+				const float extent = max - min;
+				return (extent > 0.0f) ? static_cast<float>(1u << bitCount) / extent : 0.0f;
+			}
+
+			MINT_INLINE uint32 Quantize(const float value, const float min, const float scale, const float maxCell) noexcept
+			{
+				const float scaled = (value - min) * scale;
+				return static_cast<uint32>(scaled < 0.0f ? 0.0f : (scaled > maxCell ? maxCell : scaled));
+			}
+		}
+
+		uint32 QuantizeToGrid(const float value, const float min, const float max, const uint32 bitCount) noexcept
+		{
+			using namespace SpaceFillingCurveInternal;
+			const float maxCell = static_cast<float>((1u << bitCount) - 1);
+			return Quantize(value, min, ComputeQuantizationScale(min, max, bitCount), maxCell);
+		}
+
+		uint32 EncodeMorton2D(const Float2& position, const Float2& boundsMin, const Float2& boundsMax) noexcept
+		{
+			const uint32 x = QuantizeToGrid(position._x, boundsMin._x, boundsMax._x, kSpaceFillingCurve2DAxisBitCount);
+			const uint32 y = QuantizeToGrid(position._y, boundsMin._y, boundsMax._y, kSpaceFillingCurve2DAxisBitCount);
+			return EncodeMorton2D(x, y);
+		}
+
+		uint64 EncodeMorton3D(const Float3& position, const Float3& boundsMin, const Float3& boundsMax) noexcept
+		{
+			const uint32 x = QuantizeToGrid(position._x, boundsMin._x, boundsMax._x, kSpaceFillingCurve3DAxisBitCount);
+			const uint32 y = QuantizeToGrid(position._y, boundsMin._y, boundsMax._y, kSpaceFillingCurve3DAxisBitCount);
+			const uint32 z = QuantizeToGrid(position._z, boundsMin._z, boundsMax._z, kSpaceFillingCurve3DAxisBitCount);
+			return EncodeMorton3D(x, y, z);
+		}
+
+		uint32 EncodeHilbert2D(const Float2& position, const Float2& boundsMin, const Float2& boundsMax) noexcept
+		{
+			const uint32 x = QuantizeToGrid(position._x, boundsMin._x, boundsMax._x, kSpaceFillingCurve2DAxisBitCount);
+			const uint32 y = QuantizeToGrid(position._y, boundsMin._y, boundsMax._y, kSpaceFillingCurve2DAxisBitCount);
+			return EncodeHilbert2D(x, y);
+		}
+
+		uint64 EncodeHilbert3D(const Float3& position, const Float3& boundsMin, const Float3& boundsMax) noexcept
+		{
+			const uint32 x = QuantizeToGrid(position._x, boundsMin._x, boundsMax._x, kSpaceFillingCurve3DAxisBitCount);
+			const uint32 y = QuantizeToGrid(position._y, boundsMin._y, boundsMax._y, kSpaceFillingCurve3DAxisBitCount);
+			const uint32 z = QuantizeToGrid(position._z, boundsMin._z, boundsMax._z, kSpaceFillingCurve3DAxisBitCount);
+			return EncodeHilbert3D(x, y, z);
+		}
+
+		void EncodeMorton2D(const uint32* const xs, const uint32* const ys, const uint32 count, uint32* const outCodes) noexcept
+		{
+			using namespace SpaceFillingCurveInternal;
+			const uint32 laneEnd = ComputeWideLaneEnd(count);
+			for (uint32 i = 0; i < laneEnd; i += kWideLaneWidth)
+			{
+				StoreWide(outCodes + i, EncodeMorton2DImpl<WideLane>(LoadWide(xs + i), LoadWide(ys + i)));
+			}
+			for (uint32 i = laneEnd; i < count; ++i)
+			{
+				outCodes[i] = EncodeMorton2D(xs[i], ys[i]);
+			}
+		}
+
+		void DecodeMorton2D(const uint32* const codes, const uint32 count, uint32* const outXs, uint32* const outYs) noexcept
+		{
+			using namespace SpaceFillingCurveInternal;
+			const uint32 laneEnd = ComputeWideLaneEnd(count);
+			for (uint32 i = 0; i < laneEnd; i += kWideLaneWidth)
+			{
+				const WideLane::Type code = LoadWide(codes + i);
+				StoreWide(outXs + i, CompactBits1Impl<WideLane>(code));
+				StoreWide(outYs + i, CompactBits1Impl<WideLane>(WideLane::ShiftRight<1>(code)));
+			}
+			for (uint32 i = laneEnd; i < count; ++i)
+			{
+				DecodeMorton2D(codes[i], outXs[i], outYs[i]);
+			}
+		}
+
+		void EncodeHilbert2D(const uint32* const xs, const uint32* const ys, const uint32 count, uint32* const outCodes) noexcept
+		{
+			using namespace SpaceFillingCurveInternal;
+			const uint32 laneEnd = ComputeWideLaneEnd(count);
+			for (uint32 i = 0; i < laneEnd; i += kWideLaneWidth)
+			{
+				StoreWide(outCodes + i, EncodeHilbert2DImpl<WideLane>(LoadWide(xs + i), LoadWide(ys + i)));
+			}
+			for (uint32 i = laneEnd; i < count; ++i)
+			{
+				outCodes[i] = EncodeHilbert2D(xs[i], ys[i]);
+			}
+		}
+
+		void EncodeMorton2D(const Float2Stream& positions, const Float2& boundsMin, const Float2& boundsMax, Vector<uint32>& outCodes)
+		{
+			using namespace SpaceFillingCurveInternal;
+			const uint32 count = positions.Size();
+			outCodes.Resize(count);
+			const float* const xs = positions.GetComponentData(0);
+			const float* const ys = positions.GetComponentData(1);
+			const float scaleX = ComputeQuantizationScale(boundsMin._x, boundsMax._x, kSpaceFillingCurve2DAxisBitCount);
+			const float scaleY = ComputeQuantizationScale(boundsMin._y, boundsMax._y, kSpaceFillingCurve2DAxisBitCount);
+			const float maxCell = static_cast<float>((1u << kSpaceFillingCurve2DAxisBitCount) - 1);
+			const uint32 laneEnd = ComputeWideLaneEnd(count);
+			for (uint32 i = 0; i < laneEnd; i += kWideLaneWidth)
+			{
+				const WideLane::Type x = QuantizeWide(xs + i, boundsMin._x, scaleX, maxCell);
+				const WideLane::Type y = QuantizeWide(ys + i, boundsMin._y, scaleY, maxCell);
+				StoreWide(&outCodes[i], EncodeMorton2DImpl<WideLane>(x, y));
+			}
+			for (uint32 i = laneEnd; i < count; ++i)
+			{
+				outCodes[i] = EncodeMorton2D(Quantize(xs[i], boundsMin._x, scaleX, maxCell), Quantize(ys[i], boundsMin._y, scaleY, maxCell));
+			}
+		}
+
+		void EncodeHilbert2D(const Float2Stream& positions, const Float2& boundsMin, const Float2& boundsMax, Vector<uint32>& outCodes)
+		{
+			using namespace SpaceFillingCurveInternal;
+			const uint32 count = positions.Size();
+			outCodes.Resize(count);
+			const float* const xs = positions.GetComponentData(0);
+			const float* const ys = positions.GetComponentData(1);
+			const float scaleX = ComputeQuantizationScale(boundsMin._x, boundsMax._x, kSpaceFillingCurve2DAxisBitCount);
+			const float scaleY = ComputeQuantizationScale(boundsMin._y, boundsMax._y, kSpaceFillingCurve2DAxisBitCount);
+			const float maxCell = static_cast<float>((1u << kSpaceFillingCurve2DAxisBitCount) - 1);
+			const uint32 laneEnd = ComputeWideLaneEnd(count);
+			for (uint32 i = 0; i < laneEnd; i += kWideLaneWidth)
+			{
+				const WideLane::Type x = QuantizeWide(xs + i, boundsMin._x, scaleX, maxCell);
+				const WideLane::Type y = QuantizeWide(ys + i, boundsMin._y, scaleY, maxCell);
+				StoreWide(&outCodes[i], EncodeHilbert2DImpl<WideLane>(x, y));
+			}
+			for (uint32 i = laneEnd; i < count; ++i)
+			{
+				outCodes[i] = EncodeHilbert2D(Quantize(xs[i], boundsMin._x, scaleX, maxCell), Quantize(ys[i], boundsMin._y, scaleY, maxCell));
+			}
+		}
+	}
+
+
+	namespace SpaceFillingCurveKernel
+	{
+		namespace Portable
+		{
+			static void EncodeMorton3D(const uint32* const xs, const uint32* const ys, const uint32* const zs, const uint32 count, uint64* const outCodes) noexcept
+			{
+				for (uint32 i = 0; i < count; ++i)
+				{
+					outCodes[i] = Math::EncodeMorton3D(xs[i], ys[i], zs[i]);
+				}
+			}
+
+			static void DecodeMorton3D(const uint64* const codes, const uint32 count, uint32* const outXs, uint32* const outYs, uint32* const outZs) noexcept
+			{
+				for (uint32 i = 0; i < count; ++i)
+				{
+					Math::DecodeMorton3D(codes[i], outXs[i], outYs[i], outZs[i]);
+				}
+			}
+		}
+
+#if defined MINT_SPACE_FILLING_CURVE_HAS_BMI2
+		namespace BMI2
+		{
+			static constexpr uint64 kAxisMask = 0x1249249249249249ull;
+
+			MINT_TARGET_BMI2 static void EncodeMorton3D(const uint32* const xs, const uint32* const ys, const uint32* const zs, const uint32 count, uint64* const outCodes) noexcept
+			{
+				for (uint32 i = 0; i < count; ++i)
+				{
+					outCodes[i] = _pdep_u64(xs[i], kAxisMask) | _pdep_u64(ys[i], kAxisMask << 1) | _pdep_u64(zs[i], kAxisMask << 2);
+				}
+			}
+
+			MINT_TARGET_BMI2 static void DecodeMorton3D(const uint64* const codes, const uint32 count, uint32* const outXs, uint32* const outYs, uint32* const outZs) noexcept
+			{
+				for (uint32 i = 0; i < count; ++i)
+				{
+					outXs[i] = static_cast<uint32>(_pext_u64(codes[i], kAxisMask));
+					outYs[i] = static_cast<uint32>(_pext_u64(codes[i], kAxisMask << 1));
+					outZs[i] = static_cast<uint32>(_pext_u64(codes[i], kAxisMask << 2));
+				}
+			}
+		}
+#endif
+
+
+		using EncodeMorton3DFunction = void(*)(const uint32* const, const uint32* const, const uint32* const, const uint32, uint64* const) noexcept;
+		using DecodeMorton3DFunction = void(*)(const uint64* const, const uint32, uint32* const, uint32* const, uint32* const) noexcept;
+
+		struct DispatchTable
+		{
+			InstructionSet _instructionSet = InstructionSet::Portable;
+			EncodeMorton3DFunction _encodeMorton3D = Portable::EncodeMorton3D;
+			DecodeMorton3DFunction _decodeMorton3D = Portable::DecodeMorton3D;
+		};
+
+		static bool IsSupported(const InstructionSet instructionSet) noexcept
+		{
+			switch (instructionSet)
+			{
+			case InstructionSet::Portable:
+				return true;
+			case InstructionSet::BMI2:
+#if defined MINT_SPACE_FILLING_CURVE_HAS_BMI2
+				return CPUFeatures::GetInstance().HasBMI2();
+#else
+				return false;
+#endif
+			default:
+				break;
+			}
+			return false;
+		}
+
+		static void SetDispatchTable(const InstructionSet instructionSet, DispatchTable& outDispatchTable) noexcept
+		{
+			outDispatchTable._instructionSet = instructionSet;
+			switch (instructionSet)
+			{
+#if defined MINT_SPACE_FILLING_CURVE_HAS_BMI2
+			case InstructionSet::BMI2:
+				outDispatchTable._encodeMorton3D = BMI2::EncodeMorton3D;
+				outDispatchTable._decodeMorton3D = BMI2::DecodeMorton3D;
+				break;
+#endif
+			default:
+				outDispatchTable._encodeMorton3D = Portable::EncodeMorton3D;
+				outDispatchTable._decodeMorton3D = Portable::DecodeMorton3D;
+				break;
+			}
+		}
+
+		static DispatchTable& GetDispatchTable() noexcept
+		{
+			static DispatchTable dispatchTable = []()
+			{
+				DispatchTable result;
+				const bool prefersBMI2 = IsSupported(InstructionSet::BMI2) && CPUFeatures::GetInstance().HasFastBMI2();
+				SetDispatchTable(prefersBMI2 ? InstructionSet::BMI2 : InstructionSet::Portable, result);
+				return result;
+			}();
+			return dispatchTable;
+		}
+
+		InstructionSet GetInstructionSet() noexcept
+		{
+			return GetDispatchTable()._instructionSet;
+		}
+
+		bool SetInstructionSet(const InstructionSet instructionSet) noexcept
+		{
+			if (IsSupported(instructionSet) == false)
+			{
+				return false;
+			}
+
+			SetDispatchTable(instructionSet, GetDispatchTable());
+			return true;
+		}
+	}
+
+
+	namespace Math
+	{
+		void EncodeMorton3D(const uint32* const xs, const uint32* const ys, const uint32* const zs, const uint32 count, uint64* const outCodes) noexcept
+		{
+			SpaceFillingCurveKernel::GetDispatchTable()._encodeMorton3D(xs, ys, zs, count, outCodes);
+		}
+
+		void DecodeMorton3D(const uint64* const codes, const uint32 count, uint32* const outXs, uint32* const outYs, uint32* const outZs) noexcept
+		{
+			SpaceFillingCurveKernel::GetDispatchTable()._decodeMorton3D(codes, count, outXs, outYs, outZs);
+		}
+
+		void EncodeMorton3D(const Float3Stream& positions, const Float3& boundsMin, const Float3& boundsMax, Vector<uint64>& outCodes)
+		{
+			using namespace SpaceFillingCurveInternal;
+			const uint32 count = positions.Size();
+			outCodes.Resize(count);
+			const float* const components[3]{ positions.GetComponentData(0), positions.GetComponentData(1), positions.GetComponentData(2) };
+			const float mins[3]{ boundsMin._x, boundsMin._y, boundsMin._z };
+			const float scales[3]
+			{
+				ComputeQuantizationScale(boundsMin._x, boundsMax._x, kSpaceFillingCurve3DAxisBitCount),
+				ComputeQuantizationScale(boundsMin._y, boundsMax._y, kSpaceFillingCurve3DAxisBitCount),
+				ComputeQuantizationScale(boundsMin._z, boundsMax._z, kSpaceFillingCurve3DAxisBitCount),
+			};
+			const float maxCell = static_cast<float>((1u << kSpaceFillingCurve3DAxisBitCount) - 1);
+
+			// 한 번에 양자화할 만큼씩 나눠서 dispatch 된 Morton 구현에 넘긴다.
+			static constexpr uint32 kBatchSize = 256;
+			uint32 cells[3][kBatchSize];
+			for (uint32 batchBegin = 0; batchBegin < count; batchBegin += kBatchSize)
+			{
+				const uint32 batchSize = Min(kBatchSize, count - batchBegin);
+				const uint32 laneEnd = ComputeWideLaneEnd(batchSize);
+				for (uint32 axis = 0; axis < 3; ++axis)
+				{
+					const float* const source = components[axis] + batchBegin;
+					for (uint32 i = 0; i < laneEnd; i += kWideLaneWidth)
+					{
+						StoreWide(&cells[axis][i], QuantizeWide(source + i, mins[axis], scales[axis], maxCell));
+					}
+					for (uint32 i = laneEnd; i < batchSize; ++i)
+					{
+						cells[axis][i] = Quantize(source[i], mins[axis], scales[axis], maxCell);
+					}
+				}
+				EncodeMorton3D(cells[0], cells[1], cells[2], batchSize, &outCodes[batchBegin]);
+			}
+		}
+	}
+}
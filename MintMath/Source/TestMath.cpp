@@ -2,7 +2,10 @@
 #include <MintMath/Include/AllHeaders.h>
 #include <MintMath/Include/AllHpps.h>
 
+#include <MintCommon/Include/ScopedCPUProfiler.h>
 
+
+//#define MINT_TEST_PERFORMANCE
 #pragma optimize("", off)
 
 
@@ -147,6 +150,145 @@ namespace mint
 				MINT_ASSURE(Math::Equals(v_b._x, v._x, Math::kFloatEpsilon));
 				MINT_ASSURE(Math::Equals(v_b._y, v._y, Math::kFloatEpsilon));
 			}
+
+			const auto equalsMatrix = [](const Float4x4& lhs, const Float4x4& rhs, const float epsilon)
+			{
+				for (uint32 row = 0; row < 4; ++row)
+				{
+					for (uint32 column = 0; column < 4; ++column)
+					{
+						if (Math::Equals(lhs._m[row][column], rhs._m[row][column], epsilon) == false)
+						{
+							return false;
+						}
+					}
+				}
+				return true;
+			};
+			const auto makeTransform = [](const uint32 index)
+			{
+				const float f = static_cast<float>(index);
+				Transform transform(Float3(f, -2.0f * f, 0.5f * f));
+				transform._scale = Float3(1.0f + 0.1f * f, 2.0f, 0.5f + 0.25f * f);
+				transform._rotation = QuaternionF::MakeRotationQuaternion(Float3(1.0f, f, 2.0f - f), 0.3f * f);
+				return transform;
+			};
+			{
+				const Float3 axis = Float3::Normalize(Float3(1.0f, 2.0f, 3.0f));
+				QuaternionF rotation;
+				rotation.SetAxisAngle(axis, 1.2f);
+				MINT_ASSURE(equalsMatrix(Float4x4::RotationMatrix(rotation), Float4x4::RotationMatrixAxisAngle(axis, 1.2f), 1.0e-6f));
+				MINT_ASSURE(equalsMatrix(Float4x4::RotationMatrix(rotation * 3.0f), Float4x4::RotationMatrixAxisAngle(axis, 1.2f), 1.0e-6f));
+			}
+			{
+				// 4 개씩 처리하고 남는 것까지 확인한다.
+				const uint32 kCount = 11;
+				Transform transforms[kCount];
+				TransformStream transformStream;
+				for (uint32 i = 0; i < kCount; ++i)
+				{
+					transforms[i] = makeTransform(i);
+					transformStream.PushBack(transforms[i]);
+				}
+
+				Float4x4 matrices[kCount];
+				Float4x4 streamMatrices[kCount];
+				Math::ToMatrices(transforms, kCount, matrices);
+				Math::ToMatrices(transformStream, streamMatrices);
+				for (uint32 i = 0; i < kCount; ++i)
+				{
+					const Float4x4 expected = Float4x4::SRTMatrix(transforms[i]._scale, transforms[i]._rotation, transforms[i]._translation);
+					MINT_ASSURE(equalsMatrix(matrices[i], expected, 1.0e-5f));
+					MINT_ASSURE(equalsMatrix(streamMatrices[i], expected, 1.0e-5f));
+				}
+
+				// 0 <- 1 <- 2, 0 <- 3, 4
+				const int32 parentIndices[5] = { -1, 0, 1, 0, -1 };
+				Float4x4 worldMatrices[5];
+				Math::ComposeHierarchy(parentIndices, matrices, 5, worldMatrices);
+				MINT_ASSURE(equalsMatrix(worldMatrices[0], matrices[0], 1.0e-6f));
+				MINT_ASSURE(equalsMatrix(worldMatrices[2], matrices[0] * matrices[1] * matrices[2], 1.0e-4f));
+				MINT_ASSURE(equalsMatrix(worldMatrices[3], matrices[0] * matrices[3], 1.0e-4f));
+				MINT_ASSURE(equalsMatrix(worldMatrices[4], matrices[4], 1.0e-6f));
+
+				Float4x4 composedMatrices[5];
+				Math::ComposeMatrices(matrices, matrices + 5, 5, composedMatrices);
+				MINT_ASSURE(equalsMatrix(composedMatrices[4], matrices[4] * matrices[9], 1.0e-4f));
+			}
+			{
+				const QuaternionF a = QuaternionF::MakeRotationQuaternion(Float3::kAxisZ, 0.0f);
+				const QuaternionF b = QuaternionF::MakeRotationQuaternion(Float3::kAxisZ, 1.0f);
+				const QuaternionF half = QuaternionF::MakeRotationQuaternion(Float3::kAxisZ, 0.5f);
+				const QuaternionF slerp = QuaternionF::Slerp(a, b * -1.0f, 0.5f);
+				MINT_ASSURE(Math::Equals(slerp._w, half._w, 1.0e-6f) && Math::Equals(slerp._z, half._z, 1.0e-6f));
+
+				const uint32 kCount = 7;
+				Float4Stream as;
+				Float4Stream bs;
+				for (uint32 i = 0; i < kCount; ++i)
+				{
+					const QuaternionF qa = makeTransform(i)._rotation;
+					// 내적이 음수인 경우와 두 quaternion 이 같은 경우도 넣는다.
+					const QuaternionF qb = (i == 2) ? qa : makeTransform(i + 5)._rotation * ((i % 2 == 0) ? 1.0f : -1.0f);
+					as.PushBack(Float4(qa._x, qa._y, qa._z, qa._w));
+					bs.PushBack(Float4(qb._x, qb._y, qb._z, qb._w));
+				}
+
+				Float4Stream nlerps;
+				Float4Stream slerps;
+				Math::Nlerp(as, bs, 0.3f, nlerps);
+				Math::Slerp(as, bs, 0.3f, slerps);
+				for (uint32 i = 0; i < kCount; ++i)
+				{
+					const Float4 qa = as.Get(i);
+					const Float4 qb = bs.Get(i);
+					const QuaternionF nlerp = QuaternionF::Nlerp(QuaternionF(qa._w, qa._x, qa._y, qa._z), QuaternionF(qb._w, qb._x, qb._y, qb._z), 0.3f);
+					const QuaternionF slerp = QuaternionF::Slerp(QuaternionF(qa._w, qa._x, qa._y, qa._z), QuaternionF(qb._w, qb._x, qb._y, qb._z), 0.3f);
+					MINT_ASSURE(Math::Equals(nlerps.Get(i)._c, Float4(nlerp._x, nlerp._y, nlerp._z, nlerp._w)._c, 1.0e-6f));
+					MINT_ASSURE(Math::Equals(slerps.Get(i)._c, Float4(slerp._x, slerp._y, slerp._z, slerp._w)._c, 1.0e-5f));
+				}
+			}
+
+#if defined MINT_TEST_PERFORMANCE
+			{
+				const uint32 kCount = 100000;
+				Vector<Transform> transforms;
+				TransformStream transformStream;
+				Vector<Float4x4> matrices;
+				transforms.Resize(kCount);
+				transformStream.Reserve(kCount);
+				matrices.Resize(kCount);
+				for (uint32 i = 0; i < kCount; ++i)
+				{
+					transforms[i] = makeTransform(i % 1000);
+					transformStream.PushBack(transforms[i]);
+				}
+
+				{
+					Profiler::ScopedCPUProfiler profiler{ "Transform::ToMatrix - per element" };
+					for (uint32 i = 0; i < kCount; ++i)
+					{
+						matrices[i] = transforms[i].ToMatrix();
+					}
+				}
+				{
+					Profiler::ScopedCPUProfiler profiler{ "Math::ToMatrices - Transform array" };
+					Math::ToMatrices(transforms.Data(), kCount, matrices.Data());
+				}
+				{
+					Profiler::ScopedCPUProfiler profiler{ "Math::ToMatrices - TransformStream" };
+					Math::ToMatrices(transformStream, matrices.Data());
+				}
+				{
+					Float4Stream slerps;
+					Profiler::ScopedCPUProfiler profiler{ "Math::Slerp - Float4Stream" };
+					Math::Slerp(transformStream.GetRotations(), transformStream.GetRotations(), 0.5f, slerps);
+				}
+
+				const std::vector<Profiler::ScopedCPUProfiler::LogData>& logArray = Profiler::ScopedCPUProfiler::GetEntireLogData();
+				const bool IsEmpty = logArray.empty();
+			}
+#endif
 			return true;
 		}
 
@@ -208,6 +350,35 @@ namespace mint
 			Float4x4 testFloat4x4;
 			testFloat4x4.Set(1, 1, 1, 0, 0, 3, 1, 2, 2, 3, 1, 0, 1, 0, 2, 1);
 			Float4x4 testFloat4x4Inverse{ testFloat4x4.Inverse() };
+			{
+				// SIMD 결과를 scalar (Math::) 결과와 비교한다.
+				Float4x4 scalarResult;
+				Math::Mul(testFloat4x4._m, testFloat4x4Inverse._m, scalarResult._m);
+				MINT_ASSURE(Math::Equals(scalarResult._m, Float4x4::kIdentity._m, 0.0001f));
+				MINT_ASSURE(Math::Equals((testFloat4x4 * testFloat4x4Inverse)._m, scalarResult._m, 0.0001f));
+				MINT_ASSURE(Math::Equals(testFloat4x4.Determinant(), Math::Determinant(testFloat4x4._m), 0.0001f));
+
+				Math::Transpose(testFloat4x4._m, scalarResult._m);
+				MINT_ASSURE(Math::Equals(testFloat4x4.Transpose()._m, scalarResult._m, 0.0f));
+
+				const Float4 vector{ 1.0f, -2.0f, 3.0f, 1.0f };
+				Float4 scalarVector;
+				Math::Mul(testFloat4x4._m, vector._c, scalarVector._c);
+				MINT_ASSURE(Math::Equals((testFloat4x4 * vector)._c, scalarVector._c, 0.0001f));
+
+				const Float4 vectors[2]{ vector, vector };
+				Float4 transformedVectors[2];
+				Float4x4::Mul(testFloat4x4, vectors, 2, transformedVectors);
+				MINT_ASSURE(Math::Equals(transformedVectors[1]._c, scalarVector._c, 0.0001f));
+
+				const Float4x4 affine = Float4x4::SRTMatrix(Float3(2.0f, 3.0f, 4.0f), QuaternionF::MakeRotationQuaternion(Float3(1.0f, 1.0f, 0.0f), 0.5f), Float3(4.0f, 5.0f, 6.0f));
+				MINT_ASSURE(Math::Equals(affine.InverseAffine()._m, affine.Inverse()._m, 0.0001f));
+				MINT_ASSURE(Math::Equals((affine * affine.InverseAffine())._m, Float4x4::kIdentity._m, 0.0001f));
+
+				const Float3x3 float3x3{ 1.0f, 2.0f, 3.0f, 0.0f, 1.0f, 4.0f, 5.0f, 6.0f, 0.0f };
+				MINT_ASSURE(Math::Equals(float3x3.Determinant(), 1.0f));
+				MINT_ASSURE(float3x3 * float3x3.Inverse() == Float3x3());
+			}
 
 			Matrix<4, 4, float> testMatrix4x4;
 			testMatrix4x4.SetRow(0, { 1, 1, 1, 0 });
@@ -219,6 +390,107 @@ namespace mint
 
 			const Matrix<4, 4, float> testIdentity(MatrixUtils::Identity<4, float>());
 
+			// 상수 행렬의 계산은 컴파일 시간에 끝난다.
+			{
+				constexpr MatrixD<2, 3> kA{ 1.0, 2.0, 3.0, 4.0, 5.0, 6.0 };
+				constexpr MatrixD<3, 2> kB = kA.Transpose();
+				constexpr MatrixD<2, 2> kAB = kA * kB;
+				static_assert(kAB.GetElement(0, 0) == 14.0 && kAB.GetElement(0, 1) == 32.0 && kAB.GetElement(1, 1) == 77.0);
+				static_assert(kAB.Determinant() == 54.0);
+				static_assert(kAB.Trace() == 91.0);
+
+				constexpr MatrixD<3, 3> kC{ 2.0, 0.0, 0.0, 0.0, 4.0, 0.0, 1.0, 0.0, 8.0 };
+				static_assert(kC.Determinant() == 64.0);
+				static_assert(kC.Inverse().GetElement(1, 1) == 0.25 && kC.Inverse().GetElement(2, 0) == -0.0625);
+
+				constexpr MatrixD<4, 4> kD{ 1.0, 1.0, 1.0, 0.0, 0.0, 3.0, 1.0, 2.0, 2.0, 3.0, 1.0, 0.0, 1.0, 0.0, 2.0, 1.0 };
+				static_assert(kD.Determinant() == -4.0);
+				static_assert((kD * kD.Adjugate()).GetElement(2, 2) == -4.0 && (kD * kD.Adjugate()).GetElement(2, 3) == 0.0);
+			}
+			{
+				MINT_ASSURE(Math::Equals(testMatrix4x4.Determinant(), Math::DeterminantLU(testMatrix4x4._m), 0.01f));
+				const Matrix<4, 4, float> inverse4x4 = testMatrix4x4.Inverse();
+				MINT_ASSURE(Math::Equals((testMatrix4x4 * inverse4x4)._m, testIdentity._m, 0.0001f));
+				float inverseLU[4][4];
+				MINT_ASSURE(Math::InverseLU(testMatrix4x4._m, inverseLU) == true);
+				MINT_ASSURE(Math::Equals(inverse4x4._m, inverseLU, 0.0001f));
+
+				// 4x4 보다 크면 LU 분해로 계산한다.
+				MatrixD<6, 6> mat6x6;
+				for (uint32 row = 0; row < 6; ++row)
+				{
+					for (uint32 col = 0; col < 6; ++col)
+					{
+						mat6x6.SetElement(row, col, (row == col) ? 10.0 : static_cast<double>((row * 7 + col * 3) % 5) - 2.0);
+					}
+				}
+				const MatrixD<6, 6> inverse6x6 = mat6x6.Inverse();
+				MINT_ASSURE(Math::Equals((mat6x6 * inverse6x6)._m, MatrixUtils::Identity<6, double>()._m, 1.0e-12));
+				MINT_ASSURE(Math::Equals(mat6x6.Determinant() * inverse6x6.Determinant(), 1.0, 1.0e-9));
+
+				const MatrixD<2, 2> singular{ 1.0, 2.0, 2.0, 4.0 };
+				MINT_ASSURE(singular.Inverse().IsZeroMatrix() == true);
+				MatrixD<5, 5> singular5x5;
+				singular5x5.SetRow(0, VecD<5>(1.0, 2.0, 3.0, 4.0, 5.0));
+				singular5x5.SetRow(1, VecD<5>(2.0, 4.0, 6.0, 8.0, 10.0));
+				MINT_ASSURE(singular5x5.Determinant() == 0.0);
+				MINT_ASSURE(singular5x5.Inverse().IsZeroMatrix() == true);
+			}
+#if defined MINT_TEST_PERFORMANCE
+			{
+				// 닫힌 식 (4x4 전용) 과 LU 분해 (모든 N) 를 비교한다.
+				const uint32 kPerformanceCount = 1 << 18;
+				Vector<Matrix<4, 4, float>> matrices;
+				matrices.Resize(kPerformanceCount);
+				for (uint32 index = 0; index < kPerformanceCount; ++index)
+				{
+					matrices[index] = testMatrix4x4;
+					matrices[index].AddElement(index % 4, (index / 4) % 4, static_cast<float>(index % 13));
+				}
+				Vector<Matrix<4, 4, float>> results;
+				results.Resize(kPerformanceCount);
+				float determinantSum = 0.0f;
+				{
+					Profiler::ScopedCPUProfiler profiler{ "Matrix<4, 4> Determinant - closed form" };
+					for (uint32 index = 0; index < kPerformanceCount; ++index)
+					{
+						determinantSum += matrices[index].Determinant();
+					}
+				}
+				{
+					Profiler::ScopedCPUProfiler profiler{ "Matrix<4, 4> Determinant - LU" };
+					for (uint32 index = 0; index < kPerformanceCount; ++index)
+					{
+						determinantSum += Math::DeterminantLU(matrices[index]._m);
+					}
+				}
+				{
+					Profiler::ScopedCPUProfiler profiler{ "Matrix<4, 4> Inverse - adjugate" };
+					for (uint32 index = 0; index < kPerformanceCount; ++index)
+					{
+						results[index] = matrices[index].Inverse();
+					}
+				}
+				{
+					Profiler::ScopedCPUProfiler profiler{ "Matrix<4, 4> Inverse - LU" };
+					for (uint32 index = 0; index < kPerformanceCount; ++index)
+					{
+						Math::InverseLU(matrices[index]._m, results[index]._m);
+					}
+				}
+				{
+					Profiler::ScopedCPUProfiler profiler{ "Matrix<4, 4> Mul" };
+					for (uint32 index = 1; index < kPerformanceCount; ++index)
+					{
+						results[index] = matrices[index - 1] * matrices[index];
+					}
+				}
+
+				const std::vector<Profiler::ScopedCPUProfiler::LogData>& logArray = Profiler::ScopedCPUProfiler::GetEntireLogData();
+				const bool IsEmpty = logArray.empty();
+			}
+#endif
+
 			// Affine
 			{
 				float v[4];
@@ -239,6 +511,1129 @@ namespace mint
 				printf("");
 			}
 
+			// AffineMatKernel: CPU 가 지원하는 모든 구현을 scalar (Math::) 결과와 비교한다.
+			{
+				const float lhs[4][4]{ { 1, 1, 1, 0 }, { 0, 3, 1, 2 }, { 2, 3, 1, 0 }, { 1, 0, 2, 1 } };
+				const float rhs[4][4]{ { 2, 0, 1, 4 }, { -1, 3, 0, 2 }, { 5, 1, -2, 0 }, { 0, 0, 0, 1 } };
+				float expected[4][4];
+				Math::Mul(lhs, rhs, expected);
+
+				const AffineVecF vectors[5]{ AffineVecF(1, 2, 3, 1), AffineVecF(-1, 0, 4, 0), AffineVecF(2, 2, 2, 1), AffineVecF(0, -3, 1, 1), AffineVecF(5, 1, 0, 0) };
+				const AffineMatKernel::InstructionSet bestInstructionSet = AffineMatKernel::GetInstructionSet();
+				const AffineMatKernel::InstructionSet instructionSets[3]{ AffineMatKernel::InstructionSet::SSE, AffineMatKernel::InstructionSet::AVX2FMA, AffineMatKernel::InstructionSet::AVX512 };
+				for (const AffineMatKernel::InstructionSet instructionSet : instructionSets)
+				{
+					if (AffineMatKernel::SetInstructionSet(instructionSet) == false)
+					{
+						continue;
+					}
+
+					float actual[4][4];
+					(AffineMat<float>(lhs) * AffineMat<float>(rhs)).Get(actual);
+					MINT_ASSURE(Math::Equals(actual, expected, 0.0001f));
+
+					AffineVecF transformedVectors[5];
+					AffineMat<float>::Mul(AffineMat<float>(rhs), vectors, 5, transformedVectors);
+					for (uint32 index = 0; index < 5; ++index)
+					{
+						float vector[4];
+						vectors[index].Get(vector);
+						float expectedVector[4];
+						Math::Mul(rhs, vector, expectedVector);
+						float actualVector[4];
+						transformedVectors[index].Get(actualVector);
+						MINT_ASSURE(Math::Equals(actualVector, expectedVector, 0.0001f));
+					}
+				}
+				AffineMatKernel::SetInstructionSet(bestInstructionSet);
+
+				const AffineVecD crossD = AffineVecD(1, 2, 3, 7).Cross(AffineVecD(4, 5, 6, 9));
+				MINT_ASSURE(crossD == AffineVecD(-3, 6, -3, 0));
+				MINT_ASSURE(AffineVecD(1, 2, 3, 7).Dot(AffineVecD(4, 5, 6, 9)) == 95.0);
+			}
+
+			return true;
+		}
+
+		bool Test_FloatStreams()
+		{
+			// lane 개수 (4 or 8) 의 배수가 아닌 크기로 나머지 처리까지 확인한다.
+			const uint32 kCount = 19;
+			Vector<Float3> points;
+			Vector<Float4> vectors;
+			for (uint32 index = 0; index < kCount; ++index)
+			{
+				const float value = static_cast<float>(index);
+				points.PushBack(Float3(value, value * -0.5f + 1.0f, 3.0f - value * 0.25f));
+				vectors.PushBack(Float4(value * 0.1f, 2.0f, -value, (index % 2 == 0) ? 1.0f : 0.0f));
+			}
+
+			Float3Stream pointStream;
+			pointStream.Assign(points.Data(), kCount);
+			MINT_ASSURE(pointStream.Size() == kCount);
+			MINT_ASSURE(pointStream.Get(7) == points[7]);
+
+			const Float4x4 matrix = Float4x4::SRTMatrix(Float3(2.0f, 3.0f, 4.0f), QuaternionF::MakeRotationQuaternion(Float3(1.0f, 1.0f, 0.0f), 0.5f), Float3(4.0f, 5.0f, 6.0f));
+			Float3Stream transformedPointStream;
+			Math::TransformPoints(matrix, pointStream, transformedPointStream);
+			for (uint32 index = 0; index < kCount; ++index)
+			{
+				MINT_ASSURE(Math::Equals(transformedPointStream.Get(index)._c, (matrix * Float4(points[index], 1.0f)).GetXYZ()._c, 0.0001f));
+			}
+
+			Float4Stream vectorStream;
+			vectorStream.Assign(vectors.Data(), kCount);
+			Float4Stream transformedVectorStream;
+			Math::TransformVectors(matrix, vectorStream, transformedVectorStream);
+			for (uint32 index = 0; index < kCount; ++index)
+			{
+				MINT_ASSURE(Math::Equals(transformedVectorStream.Get(index)._c, (matrix * vectors[index])._c, 0.0001f));
+			}
+
+			const Float3x3 matrix2D = Float3x3::TranslationMatrix(Float2(3.0f, -1.0f)) * Float3x3::RotationMatrixZ(0.3f);
+			Float2Stream pointStream2D;
+			for (uint32 index = 0; index < kCount; ++index)
+			{
+				pointStream2D.PushBack(Float2(points[index]._x, points[index]._y));
+			}
+			Float2Stream transformedPointStream2D;
+			Math::TransformPoints(matrix2D, pointStream2D, transformedPointStream2D);
+			for (uint32 index = 0; index < kCount; ++index)
+			{
+				const Float3 expected = matrix2D.Mul(Float3(points[index]._x, points[index]._y, 1.0f));
+				MINT_ASSURE(Math::Equals(transformedPointStream2D.Get(index)._c, Float2(expected._x, expected._y)._c, 0.0001f));
+			}
+
+			const QuaternionF rotation = QuaternionF::MakeRotationQuaternion(Float3::Normalize(Float3(1.0f, 2.0f, 3.0f)), 1.2f);
+			Float3Stream rotatedStream;
+			Math::RotateVectors(rotation, pointStream, rotatedStream);
+			for (uint32 index = 0; index < kCount; ++index)
+			{
+				const Float4 expected = Float4x4::RotationMatrix(rotation) * Float4(points[index], 0.0f);
+				MINT_ASSURE(Math::Equals(rotatedStream.Get(index)._c, expected.GetXYZ()._c, 0.0001f));
+			}
+
+			Vector<float> dots;
+			Math::Dot(pointStream, rotatedStream, dots);
+			for (uint32 index = 0; index < kCount; ++index)
+			{
+				MINT_ASSURE(Math::Equals(dots[index], points[index].Dot(rotatedStream.Get(index)), 0.001f));
+			}
+
+			Float3Stream lerpedStream;
+			Math::Lerp(pointStream, rotatedStream, 0.25f, lerpedStream);
+			MINT_ASSURE(Math::Equals(lerpedStream.Get(kCount - 1)._c, Math::Lerp(points[kCount - 1], rotatedStream.Get(kCount - 1), 0.25f)._c, 0.0001f));
+
+			Float3Stream normalizedStream = pointStream;
+			normalizedStream.PushBack(Float3::kZero);
+			Math::Normalize(normalizedStream);
+			for (uint32 index = 0; index < kCount; ++index)
+			{
+				MINT_ASSURE(Math::Equals(normalizedStream.Get(index)._c, Float3::Normalize(points[index])._c, 0.0001f));
+			}
+			MINT_ASSURE(normalizedStream.Get(kCount) == Float3::kZero);
+
+			Float3 streamMin;
+			Float3 streamMax;
+			MINT_ASSURE(Math::MinMax(pointStream, streamMin, streamMax) == true);
+			MINT_ASSURE(streamMin == Float3(0.0f, (kCount - 1) * -0.5f + 1.0f, 3.0f - (kCount - 1) * 0.25f));
+			MINT_ASSURE(streamMax == Float3(kCount - 1.0f, 1.0f, 3.0f));
+			MINT_ASSURE(Math::MinMax(Float3Stream(), streamMin, streamMax) == false);
+
+			Vector<Float3> copiedPoints;
+			copiedPoints.Resize(kCount);
+			pointStream.CopyTo(copiedPoints.Data());
+			MINT_ASSURE(copiedPoints[kCount - 1] == points[kCount - 1]);
+
+#if defined MINT_TEST_PERFORMANCE
+			{
+				const uint32 kPerformanceCount = 1 << 20;
+				Vector<Float3> performancePoints;
+				performancePoints.Resize(kPerformanceCount);
+				for (uint32 index = 0; index < kPerformanceCount; ++index)
+				{
+					performancePoints[index] = Float3(static_cast<float>(index), 1.0f, -static_cast<float>(index));
+				}
+				Vector<Float3> performanceResults;
+				performanceResults.Resize(kPerformanceCount);
+				Float3Stream performanceStream;
+				performanceStream.Assign(performancePoints.Data(), kPerformanceCount);
+				Float3Stream performanceResultStream;
+				performanceResultStream.Resize(kPerformanceCount);
+
+				{
+					Profiler::ScopedCPUProfiler profiler{ "Transform - per element" };
+					for (uint32 index = 0; index < kPerformanceCount; ++index)
+					{
+						performanceResults[index] = matrix.Mul(performancePoints[index]);
+					}
+				}
+				{
+					Profiler::ScopedCPUProfiler profiler{ "Transform - Float4x4::Mul batch" };
+					Float4x4::Mul(matrix, performancePoints.Data(), kPerformanceCount, performanceResults.Data());
+				}
+				{
+					Profiler::ScopedCPUProfiler profiler{ "Transform - Float3Stream" };
+					Math::TransformPoints(matrix, performanceStream, performanceResultStream);
+				}
+				{
+					Profiler::ScopedCPUProfiler profiler{ "Rotate - per element" };
+					for (uint32 index = 0; index < kPerformanceCount; ++index)
+					{
+						performanceResults[index] = rotation.RotateVector(Float4(performancePoints[index], 0.0f)).GetXYZ();
+					}
+				}
+				{
+					Profiler::ScopedCPUProfiler profiler{ "Rotate - Float3Stream" };
+					Math::RotateVectors(rotation, performanceStream, performanceResultStream);
+				}
+				{
+					Profiler::ScopedCPUProfiler profiler{ "Normalize - per element" };
+					for (uint32 index = 0; index < kPerformanceCount; ++index)
+					{
+						performanceResults[index] = Float3::Normalize(performancePoints[index]);
+					}
+				}
+				{
+					Profiler::ScopedCPUProfiler profiler{ "Normalize - Float3Stream" };
+					Math::Normalize(performanceResultStream);
+				}
+				{
+					Profiler::ScopedCPUProfiler profiler{ "MinMax - per element" };
+					Float3 min = performancePoints[0];
+					Float3 max = performancePoints[0];
+					for (uint32 index = 1; index < kPerformanceCount; ++index)
+					{
+						const Float3& point = performancePoints[index];
+						min._x = Min(min._x, point._x);
+						min._y = Min(min._y, point._y);
+						min._z = Min(min._z, point._z);
+						max._x = Max(max._x, point._x);
+						max._y = Max(max._y, point._y);
+						max._z = Max(max._z, point._z);
+					}
+				}
+				{
+					Profiler::ScopedCPUProfiler profiler{ "MinMax - Float3Stream" };
+					Math::MinMax(performanceStream, streamMin, streamMax);
+				}
+
+				const std::vector<Profiler::ScopedCPUProfiler::LogData>& logArray = Profiler::ScopedCPUProfiler::GetEntireLogData();
+				const bool IsEmpty = logArray.empty();
+			}
+#endif
+			return true;
+		}
+
+		bool Test_FastMath()
+		{
+			using namespace Math::Fast;
+
+			// FastMath.h 에 적은 최대 오차 안에 드는지 확인한다.
+			for (int32 i = -1000; i <= 1000; ++i)
+			{
+				const float x = static_cast<float>(i) * 0.731f;
+				float sinValue;
+				float cosValue;
+				SinCos(x, sinValue, cosValue);
+				MINT_ASSURE(::abs(sinValue - ::sin(x)) < 1.0e-6f && ::abs(cosValue - ::cos(x)) < 1.0e-6f);
+				SinCos<Precision::Low>(x, sinValue, cosValue);
+				MINT_ASSURE(::abs(sinValue - ::sin(x)) < 2.0e-4f && ::abs(cosValue - ::cos(x)) < 2.0e-4f);
+
+				const float y = static_cast<float>(i % 37) - 18.0f;
+				MINT_ASSURE(::abs(Atan2(y, x) - ::atan2(y, x)) < 1.0e-5f);
+				MINT_ASSURE(::abs(Atan2<Precision::Low>(y, x) - ::atan2(y, x)) < 6.0e-3f);
+
+				const float e = static_cast<float>(i) * 0.08f;
+				MINT_ASSURE(::abs(Exp(e) / ::exp(e) - 1.0f) < 1.0e-6f);
+				MINT_ASSURE(::abs(Exp<Precision::Low>(e) / ::exp(e) - 1.0f) < 1.0e-4f);
+
+				const float positive = ::exp(e * 0.5f);
+				MINT_ASSURE(::abs(Log(positive) - ::log(positive)) < 1.0e-6f * Max(1.0f, static_cast<float>(::abs(::log(positive)))));
+				MINT_ASSURE(::abs(RSqrt(positive) * ::sqrt(positive) - 1.0f) < 1.0e-6f);
+				MINT_ASSURE(::abs(RSqrt<Precision::Low>(positive) * ::sqrt(positive) - 1.0f) < 4.0e-4f);
+			}
+			MINT_ASSURE(Atan2(0.0f, 0.0f) == 0.0f);
+
+			// SIMD 버전은 scalar 버전과 같은 식으로 계산한다.
+			{
+				const __m128 x = _mm_set_ps(-2.5f, 0.25f, 1.0f, 3.0f);
+				__m128 sinValues;
+				__m128 cosValues;
+				SinCos(x, sinValues, cosValues);
+				float sinArray[4];
+				float cosArray[4];
+				float xArray[4];
+				_mm_storeu_ps(sinArray, sinValues);
+				_mm_storeu_ps(cosArray, cosValues);
+				_mm_storeu_ps(xArray, x);
+				float expArray[4];
+				_mm_storeu_ps(expArray, Exp(x));
+				float atanArray[4];
+				_mm_storeu_ps(atanArray, Atan2(x, _mm_set1_ps(-1.0f)));
+				for (uint32 i = 0; i < 4; ++i)
+				{
+					MINT_ASSURE(Math::Equals(sinArray[i], Sin(xArray[i]), 1.0e-6f) && Math::Equals(cosArray[i], Cos(xArray[i]), 1.0e-6f));
+					MINT_ASSURE(expArray[i] == Exp(xArray[i]));
+					MINT_ASSURE(atanArray[i] == Atan2(xArray[i], -1.0f));
+				}
+			}
+
+#if defined MINT_TEST_PERFORMANCE
+			{
+				const uint32 kCount = 1 << 20;
+				Vector<float> inputs;
+				Vector<float> outputs;
+				inputs.Resize(kCount);
+				outputs.Resize(kCount);
+				for (uint32 i = 0; i < kCount; ++i)
+				{
+					inputs[i] = static_cast<float>(i) * 0.001f;
+				}
+
+				{
+					Profiler::ScopedCPUProfiler profiler{ "sin + cos - libm" };
+					for (uint32 i = 0; i < kCount; ++i)
+					{
+						outputs[i] = ::sin(inputs[i]) + ::cos(inputs[i]);
+					}
+				}
+				{
+					Profiler::ScopedCPUProfiler profiler{ "SinCos - Fast High" };
+					for (uint32 i = 0; i < kCount; ++i)
+					{
+						float sinValue;
+						float cosValue;
+						SinCos(inputs[i], sinValue, cosValue);
+						outputs[i] = sinValue + cosValue;
+					}
+				}
+				{
+					Profiler::ScopedCPUProfiler profiler{ "SinCos - Fast Low" };
+					for (uint32 i = 0; i < kCount; ++i)
+					{
+						float sinValue;
+						float cosValue;
+						SinCos<Precision::Low>(inputs[i], sinValue, cosValue);
+						outputs[i] = sinValue + cosValue;
+					}
+				}
+				{
+					Profiler::ScopedCPUProfiler profiler{ "SinCos - Fast High x4" };
+					for (uint32 i = 0; i < kCount; i += 4)
+					{
+						__m128 sinValues;
+						__m128 cosValues;
+						SinCos(_mm_loadu_ps(&inputs[i]), sinValues, cosValues);
+						_mm_storeu_ps(&outputs[i], _mm_add_ps(sinValues, cosValues));
+					}
+				}
+				{
+					Profiler::ScopedCPUProfiler profiler{ "atan2 - libm" };
+					for (uint32 i = 0; i < kCount; ++i)
+					{
+						outputs[i] = ::atan2(inputs[i], 1.0f - inputs[i]);
+					}
+				}
+				{
+					Profiler::ScopedCPUProfiler profiler{ "Atan2 - Fast High" };
+					for (uint32 i = 0; i < kCount; ++i)
+					{
+						outputs[i] = Atan2(inputs[i], 1.0f - inputs[i]);
+					}
+				}
+				{
+					Profiler::ScopedCPUProfiler profiler{ "exp - libm" };
+					for (uint32 i = 0; i < kCount; ++i)
+					{
+						outputs[i] = ::exp(-inputs[i]);
+					}
+				}
+				{
+					Profiler::ScopedCPUProfiler profiler{ "Exp - Fast High" };
+					for (uint32 i = 0; i < kCount; ++i)
+					{
+						outputs[i] = Exp(-inputs[i]);
+					}
+				}
+				{
+					Profiler::ScopedCPUProfiler profiler{ "log - libm" };
+					for (uint32 i = 1; i < kCount; ++i)
+					{
+						outputs[i] = ::log(inputs[i]);
+					}
+				}
+				{
+					Profiler::ScopedCPUProfiler profiler{ "Log - Fast High" };
+					for (uint32 i = 1; i < kCount; ++i)
+					{
+						outputs[i] = Log(inputs[i]);
+					}
+				}
+				{
+					Profiler::ScopedCPUProfiler profiler{ "1 / sqrt - libm" };
+					for (uint32 i = 1; i < kCount; ++i)
+					{
+						outputs[i] = 1.0f / ::sqrt(inputs[i]);
+					}
+				}
+				{
+					Profiler::ScopedCPUProfiler profiler{ "RSqrt - Fast High" };
+					for (uint32 i = 1; i < kCount; ++i)
+					{
+						outputs[i] = RSqrt(inputs[i]);
+					}
+				}
+
+				const std::vector<Profiler::ScopedCPUProfiler::LogData>& logArray = Profiler::ScopedCPUProfiler::GetEntireLogData();
+				const bool IsEmpty = logArray.empty();
+			}
+#endif
+			return true;
+		}
+
+		bool Test_Geometry()
+		{
+			// Orient2D 는 double 로 계산하면 부호가 틀리는 거의 한 직선 위의 점들도 정확히 판정한다.
+			{
+				MINT_ASSURE(Math::Orient2D(Float2(0, 0), Float2(1, 0), Float2(0, 1)) > 0.0);
+				MINT_ASSURE(Math::Orient2D(Float2(0, 0), Float2(0, 1), Float2(1, 0)) < 0.0);
+				MINT_ASSURE(Math::Orient2D(Float2(0, 0), Float2(1, 1), Float2(3, 3)) == 0.0);
+				const Float2 a = Float2(12.0f, 12.0f);
+				const Float2 b = Float2(24.0f, 24.0f);
+				// c 가 y = x 의 위쪽이면 CCW, 아래쪽이면 CW 다.
+				float cx = 0.5f;
+				for (uint32 i = 0; i < 16; ++i)
+				{
+					float cy = 0.5f;
+					for (uint32 j = 0; j < 16; ++j)
+					{
+						const Float2 c = Float2(cx, cy);
+						const double orientation = Math::Orient2D(a, b, c);
+						MINT_ASSURE((orientation > 0.0) == (cy > cx) && (orientation < 0.0) == (cy < cx));
+						MINT_ASSURE((Math::Orient2D(b, a, c) < 0.0) == (orientation > 0.0));
+						MINT_ASSURE((Math::Orient2D(c, a, b) > 0.0) == (orientation > 0.0));
+						cy = ::nextafterf(cy, 1.0f);
+					}
+					cx = ::nextafterf(cx, 1.0f);
+				}
+			}
+
+			// Monotone chain
+			{
+				Vector<Float2> points{ Float2(0, 0), Float2(2, 0), Float2(1, 1), Float2(2, 2), Float2(0, 2), Float2(1, 0), Float2(0, 1), Float2(1, 2), Float2(2, 1) };
+				Vector<Float2> scratch;
+				ConvexHull_Compute(points, scratch);
+				MINT_ASSURE(points.Size() == 4);
+				MINT_ASSURE(points[0] == Float2(0, 0) && points[1] == Float2(2, 0) && points[2] == Float2(2, 2) && points[3] == Float2(0, 2));
+
+				Vector<Float2> collinearPoints{ Float2(3, 3), Float2(1, 1), Float2(2, 2), Float2(1, 1) };
+				ConvexHull_Compute(collinearPoints, scratch);
+				MINT_ASSURE(collinearPoints.Size() == 2 && collinearPoints[0] == Float2(1, 1) && collinearPoints[1] == Float2(3, 3));
+
+				Vector<Float2> samePoints{ Float2(5, 5), Float2(5, 5), Float2(5, 5) };
+				ConvexHull_Compute(samePoints, scratch);
+				MINT_ASSURE(samePoints.Size() == 1);
+
+				// Graham scan 과 같은 껍질이 나와야 한다.
+				Vector<Float2> randomPoints;
+				uint32 seed = 12345;
+				for (uint32 i = 0; i < 200; ++i)
+				{
+					seed = seed * 1664525 + 1013904223;
+					const float x = static_cast<float>(seed >> 8) / static_cast<float>(1 << 24) * 100.0f;
+					seed = seed * 1664525 + 1013904223;
+					const float y = static_cast<float>(seed >> 8) / static_cast<float>(1 << 24) * 100.0f;
+					randomPoints.PushBack(Float2(x, y));
+				}
+				Vector<Float2> grahamHull = randomPoints;
+				GrahamScan_Convexify(grahamHull);
+				ConvexHull_Compute(randomPoints, scratch);
+				MINT_ASSURE(randomPoints.Size() == grahamHull.Size());
+				for (const Float2& point : grahamHull)
+				{
+					bool found = false;
+					for (const Float2& hullPoint : randomPoints)
+					{
+						found |= (hullPoint == point);
+					}
+					MINT_ASSURE(found == true);
+				}
+				MINT_ASSURE(Math::ComputeSignedDoubleArea(randomPoints.Data(), randomPoints.Size()) > 0.0);
+			}
+
+			// 점 끼워 넣기
+			{
+				Vector<Float2> hull{ Float2(0, 0), Float2(2, 0), Float2(2, 2), Float2(0, 2) };
+				MINT_ASSURE(ConvexHull_InsertPoint(hull, Float2(1, 1)) == false);
+				MINT_ASSURE(ConvexHull_InsertPoint(hull, Float2(1, -1), 1) == true);
+				MINT_ASSURE(hull.Size() == 5 && hull[1] == Float2(1, -1));
+				// (2, 0) 과 (2, 2) 가 더 이상 껍질이 아니게 된다.
+				MINT_ASSURE(ConvexHull_InsertPoint(hull, Float2(4, 2)) == true);
+				MINT_ASSURE(hull.Size() == 4);
+				Vector<Float2> expectedHull{ Float2(0, 0), Float2(1, -1), Float2(4, 2), Float2(0, 2) };
+				for (uint32 i = 0; i < 4; ++i)
+				{
+					MINT_ASSURE(hull[i] == expectedHull[i]);
+				}
+				// 첫 꼭짓점을 넘어 원형으로 제거되는 경우
+				MINT_ASSURE(ConvexHull_InsertPoint(hull, Float2(-4, 4), 0) == true);
+				MINT_ASSURE(hull.Size() == 3 && hull[0] == Float2(1, -1) && hull[1] == Float2(4, 2) && hull[2] == Float2(-4, 4));
+
+				// 항상 볼록 껍질 전체를 다시 구한 것과 같아야 한다.
+				Vector<Float2> incrementalHull{ Float2(0, 0), Float2(1, 0), Float2(0, 1) };
+				Vector<Float2> allPoints = incrementalHull;
+				Vector<Float2> scratch;
+				uint32 seed = 777;
+				for (uint32 i = 0; i < 100; ++i)
+				{
+					seed = seed * 1664525 + 1013904223;
+					const float x = static_cast<float>(seed >> 8) / static_cast<float>(1 << 24) * 20.0f - 10.0f;
+					seed = seed * 1664525 + 1013904223;
+					const float y = static_cast<float>(seed >> 8) / static_cast<float>(1 << 24) * 20.0f - 10.0f;
+					ConvexHull_InsertPoint(incrementalHull, Float2(x, y));
+					allPoints.PushBack(Float2(x, y));
+					Vector<Float2> hullFromScratch = allPoints;
+					ConvexHull_Compute(hullFromScratch, scratch);
+					MINT_ASSURE(incrementalHull.Size() == hullFromScratch.Size());
+				}
+			}
+
+			// 볼록 분할
+			{
+				Vector<uint32> scratchIndices;
+				Vector<uint32> indices;
+				Vector<uint32> pieceOffsets;
+
+				Vector<Float2> square{ Float2(0, 0), Float2(1, 0), Float2(1, 1), Float2(0, 1) };
+				MINT_ASSURE(ConvexDecomposition_Compute(square, scratchIndices, indices, pieceOffsets) == 1);
+				MINT_ASSURE(indices.Size() == 4 && pieceOffsets.Size() == 2);
+
+				// CW 로 주어진 L 자 모양은 두 조각으로 나뉜다.
+				Vector<Float2> lShape{ Float2(0, 0), Float2(0, 2), Float2(1, 2), Float2(1, 1), Float2(2, 1), Float2(2, 0) };
+				MINT_ASSURE(ConvexDecomposition_Compute(lShape, scratchIndices, indices, pieceOffsets) == 2);
+
+				// 빗 모양. 조각들은 모두 볼록한 CCW 이고, 넓이의 합은 원래 다각형과 같아야 한다.
+				Vector<Float2> comb{ Float2(0, 0), Float2(7, 0), Float2(7, 3), Float2(6, 3), Float2(6, 1), Float2(5, 1), Float2(5, 3), Float2(4, 3), Float2(4, 1), Float2(3, 1), Float2(3, 3), Float2(2, 3), Float2(2, 1), Float2(1, 1), Float2(1, 3), Float2(0, 3) };
+				const uint32 pieceCount = ConvexDecomposition_Compute(comb, scratchIndices, indices, pieceOffsets);
+				MINT_ASSURE(pieceCount >= 4 && pieceCount <= comb.Size() - 2);
+				double areaSum = 0.0;
+				Vector<Float2> piece;
+				for (uint32 pieceIndex = 0; pieceIndex < pieceCount; ++pieceIndex)
+				{
+					piece.Clear();
+					for (uint32 i = pieceOffsets[pieceIndex]; i < pieceOffsets[pieceIndex + 1]; ++i)
+					{
+						piece.PushBack(comb[indices[i]]);
+					}
+					for (uint32 i = 0; i < piece.Size(); ++i)
+					{
+						MINT_ASSURE(Math::Orient2D(piece[i], piece[(i + 1) % piece.Size()], piece[(i + 2) % piece.Size()]) >= 0.0);
+					}
+					areaSum += Math::ComputeSignedDoubleArea(piece.Data(), piece.Size());
+				}
+				MINT_ASSURE(areaSum == Math::ComputeSignedDoubleArea(comb.Data(), comb.Size()));
+			}
+
+#if defined MINT_TEST_PERFORMANCE
+			{
+				const uint32 kCount = 1 << 16;
+				Vector<Float2> points;
+				points.Resize(kCount);
+				uint32 seed = 1;
+				for (uint32 i = 0; i < kCount; ++i)
+				{
+					seed = seed * 1664525 + 1013904223;
+					points[i]._x = static_cast<float>(seed >> 8) / static_cast<float>(1 << 24);
+					seed = seed * 1664525 + 1013904223;
+					points[i]._y = static_cast<float>(seed >> 8) / static_cast<float>(1 << 24);
+				}
+
+				{
+					Vector<Float2> hull = points;
+					Profiler::ScopedCPUProfiler profiler{ "ConvexHull - Graham scan" };
+					GrahamScan_Convexify(hull);
+				}
+				{
+					Vector<Float2> hull = points;
+					Vector<Float2> scratch;
+					Profiler::ScopedCPUProfiler profiler{ "ConvexHull - Monotone chain" };
+					ConvexHull_Compute(hull, scratch);
+				}
+
+				const std::vector<Profiler::ScopedCPUProfiler::LogData>& logArray = Profiler::ScopedCPUProfiler::GetEntireLogData();
+				const bool IsEmpty = logArray.empty();
+			}
+#endif
+			return true;
+		}
+
+		bool Test_SpaceFillingCurves()
+		{
+			static_assert(Math::EncodeMorton2D(0b11, 0b01) == 0b0111);
+			static_assert(Math::EncodeMorton2D(0xFFFF, 0xFFFF) == 0xFFFFFFFF);
+			static_assert(Math::EncodeMorton3D(1, 2, 4) == (1 | (1 << 4) | (1 << 8)));
+			static_assert(Math::EncodeMorton3D(0x1FFFFF, 0x1FFFFF, 0x1FFFFF) == 0x7FFFFFFFFFFFFFFFull);
+
+			uint32 seed = 2024;
+			const auto random = [&seed]()
+			{
+				seed = seed * 1664525 + 1013904223;
+				return seed;
+			};
+
+			// 되돌리기
+			for (uint32 i = 0; i < 10000; ++i)
+			{
+				const uint32 x = random() & 0xFFFF;
+				const uint32 y = random() & 0xFFFF;
+				const uint32 z = random() & 0x1FFFFF;
+				uint32 decodedX = 0;
+				uint32 decodedY = 0;
+				uint32 decodedZ = 0;
+				Math::DecodeMorton2D(Math::EncodeMorton2D(x, y), decodedX, decodedY);
+				MINT_ASSURE(decodedX == x && decodedY == y);
+				Math::DecodeHilbert2D(Math::EncodeHilbert2D(x, y), decodedX, decodedY);
+				MINT_ASSURE(decodedX == x && decodedY == y);
+				Math::DecodeMorton3D(Math::EncodeMorton3D(x, y, z), decodedX, decodedY, decodedZ);
+				MINT_ASSURE(decodedX == x && decodedY == y && decodedZ == z);
+				Math::DecodeHilbert3D(Math::EncodeHilbert3D(x, y, z), decodedX, decodedY, decodedZ);
+				MINT_ASSURE(decodedX == x && decodedY == y && decodedZ == z);
+			}
+
+			// Hilbert 곡선은 이웃한 code 가 항상 이웃한 칸이다.
+			{
+				const auto distance = [](const uint32 a, const uint32 b) { return (a < b) ? b - a : a - b; };
+				uint32 previousX = 0;
+				uint32 previousY = 0;
+				uint32 previousZ = 0;
+				Math::DecodeHilbert2D(0, previousX, previousY);
+				MINT_ASSURE(previousX == 0 && previousY == 0);
+				for (uint32 code = 1; code < (1 << 16); ++code)
+				{
+					uint32 x = 0;
+					uint32 y = 0;
+					Math::DecodeHilbert2D(code, x, y);
+					MINT_ASSURE(distance(x, previousX) + distance(y, previousY) == 1);
+					previousX = x;
+					previousY = y;
+				}
+
+				Math::DecodeHilbert3D(0, previousX, previousY, previousZ);
+				MINT_ASSURE(previousX == 0 && previousY == 0 && previousZ == 0);
+				for (uint64 code = 1; code < (1 << 18); ++code)
+				{
+					uint32 x = 0;
+					uint32 y = 0;
+					uint32 z = 0;
+					Math::DecodeHilbert3D(code, x, y, z);
+					MINT_ASSURE(distance(x, previousX) + distance(y, previousY) + distance(z, previousZ) == 1);
+					previousX = x;
+					previousY = y;
+					previousZ = z;
+				}
+			}
+
+			// 양자화
+			MINT_ASSURE(Math::QuantizeToGrid(-1.0f, 0.0f, 1.0f, 16) == 0);
+			MINT_ASSURE(Math::QuantizeToGrid(0.5f, 0.0f, 1.0f, 16) == (1 << 15));
+			MINT_ASSURE(Math::QuantizeToGrid(1.0f, 0.0f, 1.0f, 16) == 0xFFFF);
+			MINT_ASSURE(Math::QuantizeToGrid(2.0f, 0.0f, 1.0f, 16) == 0xFFFF);
+			MINT_ASSURE(Math::QuantizeToGrid(3.0f, 3.0f, 3.0f, 16) == 0);
+
+			// 여러 개 버전은 하나씩 계산한 것과 같아야 한다.
+			{
+				const uint32 kCount = 1003;
+				Vector<uint32> xs;
+				Vector<uint32> ys;
+				Vector<uint32> zs;
+				xs.Resize(kCount);
+				ys.Resize(kCount);
+				zs.Resize(kCount);
+				Float2Stream positions2(kCount);
+				Float3Stream positions3(kCount);
+				for (uint32 i = 0; i < kCount; ++i)
+				{
+					xs[i] = random();
+					ys[i] = random();
+					zs[i] = random();
+					const float fx = static_cast<float>(xs[i] >> 8) / static_cast<float>(1 << 24) * 300.0f - 100.0f;
+					const float fy = static_cast<float>(ys[i] >> 8) / static_cast<float>(1 << 24) * 300.0f - 100.0f;
+					const float fz = static_cast<float>(zs[i] >> 8) / static_cast<float>(1 << 24) * 300.0f - 100.0f;
+					positions2.Set(i, Float2(fx, fy));
+					positions3.Set(i, Float3(fx, fy, fz));
+				}
+
+				Vector<uint32> codes2;
+				codes2.Resize(kCount);
+				Math::EncodeMorton2D(xs.Data(), ys.Data(), kCount, codes2.Data());
+				Vector<uint32> decodedXs;
+				Vector<uint32> decodedYs;
+				Vector<uint32> decodedZs;
+				decodedXs.Resize(kCount);
+				decodedYs.Resize(kCount);
+				decodedZs.Resize(kCount);
+				Math::DecodeMorton2D(codes2.Data(), kCount, decodedXs.Data(), decodedYs.Data());
+				for (uint32 i = 0; i < kCount; ++i)
+				{
+					MINT_ASSURE(codes2[i] == Math::EncodeMorton2D(xs[i], ys[i]));
+					MINT_ASSURE(decodedXs[i] == (xs[i] & 0xFFFF) && decodedYs[i] == (ys[i] & 0xFFFF));
+				}
+				Math::EncodeHilbert2D(xs.Data(), ys.Data(), kCount, codes2.Data());
+				for (uint32 i = 0; i < kCount; ++i)
+				{
+					MINT_ASSURE(codes2[i] == Math::EncodeHilbert2D(xs[i], ys[i]));
+				}
+
+				const Float2 boundsMin2 = Float2(-100.0f, -100.0f);
+				const Float2 boundsMax2 = Float2(100.0f, 100.0f);
+				Math::EncodeMorton2D(positions2, boundsMin2, boundsMax2, codes2);
+				for (uint32 i = 0; i < kCount; ++i)
+				{
+					MINT_ASSURE(codes2[i] == Math::EncodeMorton2D(positions2.Get(i), boundsMin2, boundsMax2));
+				}
+				Math::EncodeHilbert2D(positions2, boundsMin2, boundsMax2, codes2);
+				for (uint32 i = 0; i < kCount; ++i)
+				{
+					MINT_ASSURE(codes2[i] == Math::EncodeHilbert2D(positions2.Get(i), boundsMin2, boundsMax2));
+				}
+
+				const SpaceFillingCurveKernel::InstructionSet defaultInstructionSet = SpaceFillingCurveKernel::GetInstructionSet();
+				const SpaceFillingCurveKernel::InstructionSet instructionSets[]{ SpaceFillingCurveKernel::InstructionSet::Portable, SpaceFillingCurveKernel::InstructionSet::BMI2 };
+				Vector<uint64> codes3;
+				codes3.Resize(kCount);
+				for (const SpaceFillingCurveKernel::InstructionSet instructionSet : instructionSets)
+				{
+					if (SpaceFillingCurveKernel::SetInstructionSet(instructionSet) == false)
+					{
+						continue;
+					}
+
+					Math::EncodeMorton3D(xs.Data(), ys.Data(), zs.Data(), kCount, codes3.Data());
+					Math::DecodeMorton3D(codes3.Data(), kCount, decodedXs.Data(), decodedYs.Data(), decodedZs.Data());
+					for (uint32 i = 0; i < kCount; ++i)
+					{
+						MINT_ASSURE(codes3[i] == Math::EncodeMorton3D(xs[i], ys[i], zs[i]));
+						MINT_ASSURE(decodedXs[i] == (xs[i] & 0x1FFFFF) && decodedYs[i] == (ys[i] & 0x1FFFFF) && decodedZs[i] == (zs[i] & 0x1FFFFF));
+					}
+
+					const Float3 boundsMin3 = Float3(-100.0f, -100.0f, -100.0f);
+					const Float3 boundsMax3 = Float3(100.0f, 100.0f, 100.0f);
+					Math::EncodeMorton3D(positions3, boundsMin3, boundsMax3, codes3);
+					for (uint32 i = 0; i < kCount; ++i)
+					{
+						MINT_ASSURE(codes3[i] == Math::EncodeMorton3D(positions3.Get(i), boundsMin3, boundsMax3));
+					}
+				}
+				SpaceFillingCurveKernel::SetInstructionSet(defaultInstructionSet);
+			}
+
+#if defined MINT_TEST_PERFORMANCE
+			{
+				const uint32 kCount = 1 << 20;
+				Vector<uint32> xs;
+				Vector<uint32> ys;
+				Vector<uint32> zs;
+				Vector<uint32> codes2;
+				Vector<uint64> codes3;
+				xs.Resize(kCount);
+				ys.Resize(kCount);
+				zs.Resize(kCount);
+				codes2.Resize(kCount);
+				codes3.Resize(kCount);
+				for (uint32 i = 0; i < kCount; ++i)
+				{
+					xs[i] = random();
+					ys[i] = random();
+					zs[i] = random();
+				}
+
+				{
+					Profiler::ScopedCPUProfiler profiler{ "Morton2D - Scalar" };
+					for (uint32 i = 0; i < kCount; ++i)
+					{
+						codes2[i] = Math::EncodeMorton2D(xs[i], ys[i]);
+					}
+				}
+				{
+					Profiler::ScopedCPUProfiler profiler{ "Morton2D - Bulk" };
+					Math::EncodeMorton2D(xs.Data(), ys.Data(), kCount, codes2.Data());
+				}
+				{
+					Profiler::ScopedCPUProfiler profiler{ "Hilbert2D - Scalar" };
+					for (uint32 i = 0; i < kCount; ++i)
+					{
+						codes2[i] = Math::EncodeHilbert2D(xs[i], ys[i]);
+					}
+				}
+				{
+					Profiler::ScopedCPUProfiler profiler{ "Hilbert2D - Bulk" };
+					Math::EncodeHilbert2D(xs.Data(), ys.Data(), kCount, codes2.Data());
+				}
+				{
+					Profiler::ScopedCPUProfiler profiler{ "Hilbert3D - Scalar" };
+					for (uint32 i = 0; i < kCount; ++i)
+					{
+						codes3[i] = Math::EncodeHilbert3D(xs[i], ys[i], zs[i]);
+					}
+				}
+				const SpaceFillingCurveKernel::InstructionSet defaultInstructionSet = SpaceFillingCurveKernel::GetInstructionSet();
+				if (SpaceFillingCurveKernel::SetInstructionSet(SpaceFillingCurveKernel::InstructionSet::Portable) == true)
+				{
+					Profiler::ScopedCPUProfiler profiler{ "Morton3D - Bulk Portable" };
+					Math::EncodeMorton3D(xs.Data(), ys.Data(), zs.Data(), kCount, codes3.Data());
+				}
+				if (SpaceFillingCurveKernel::SetInstructionSet(SpaceFillingCurveKernel::InstructionSet::BMI2) == true)
+				{
+					Profiler::ScopedCPUProfiler profiler{ "Morton3D - Bulk BMI2" };
+					Math::EncodeMorton3D(xs.Data(), ys.Data(), zs.Data(), kCount, codes3.Data());
+				}
+				SpaceFillingCurveKernel::SetInstructionSet(defaultInstructionSet);
+
+				const std::vector<Profiler::ScopedCPUProfiler::LogData>& logArray = Profiler::ScopedCPUProfiler::GetEntireLogData();
+				const bool IsEmpty = logArray.empty();
+			}
+#endif
+			return true;
+		}
+
+		bool Test_FixedPoint()
+		{
+			static_assert(Fixed32(3).GetRaw() == (3 << 16));
+			static_assert(Fixed32(-32768).GetRaw() == Fixed32::kMinRaw);
+			static_assert(Fixed32(32768).GetRaw() == Fixed32::kMinRaw);
+			static_assert(Fixed32(40000).ToInt() == 40000 - 65536);
+			static_assert((Fixed64(1) + Fixed64(2)) == Fixed64(3));
+			static_assert((-Fixed32(2)).GetRaw() == -(2 << 16));
+			static_assert(Fixed32::FromRaw(-1).ToInt() == -1);
+
+			// 사칙연산
+			MINT_ASSURE(Fixed32(3) * Fixed32(0.5f) == Fixed32(1.5f));
+			MINT_ASSURE(Fixed64(-3) * Fixed64(0.5f) == Fixed64(-1.5f));
+			MINT_ASSURE(Fixed64(-40000) * Fixed64(40000) == Fixed64(-1600000000));
+			MINT_ASSURE(Fixed32(1) / Fixed32(3) == Fixed32::FromRaw(21845));
+			MINT_ASSURE(Fixed32(2) / Fixed32(3) == Fixed32::FromRaw(43691));
+			MINT_ASSURE(Fixed32(-2) / Fixed32(3) == Fixed32::FromRaw(-43691));
+			MINT_ASSURE(Fixed64(7) / Fixed64(-2) == Fixed64(-3.5f));
+			MINT_ASSURE(Fixed64(1) / Fixed64(3) == Fixed64::FromRaw(1431655765));
+			MINT_ASSURE(Fixed32(1) / Fixed32() == Fixed32::FromRaw(Fixed32::kMaxRaw));
+			MINT_ASSURE(Fixed64(-1) / Fixed64() == Fixed64::FromRaw(Fixed64::kMinRaw));
+			MINT_ASSURE(Fixed64(1000000000) / Fixed64(0.001f) == Fixed64::FromRaw(Fixed64::kMaxRaw));
+			MINT_ASSURE(Fixed32(0.1f).ToFloat() == 6554.0f / 65536.0f);
+			MINT_ASSURE(Fixed64(-2.75).ToInt() == -3);
+
+			uint32 seed = 39;
+			const auto random = [&seed]()
+			{
+				seed = seed * 1664525 + 1013904223;
+				return seed;
+			};
+
+			// double 로 계산한 값과 반올림 오차 안에서 같아야 한다.
+			for (uint32 i = 0; i < 10000; ++i)
+			{
+				const Fixed64 a = Fixed64::FromRaw(static_cast<int64>(static_cast<int32>(random())) << 12);
+				const Fixed64 b = Fixed64::FromRaw((static_cast<int64>(static_cast<int32>(random())) << 4) | 1);
+				const double product = a.ToDouble() * b.ToDouble();
+				MINT_ASSURE(::abs((a * b).ToDouble() - product) <= 1.0 / 4294967296.0);
+				const double quotient = a.ToDouble() / b.ToDouble();
+				if (::abs(quotient) < 2.0e9)
+				{
+					MINT_ASSURE(::abs((a / b).ToDouble() - quotient) <= ::abs(quotient) * 1.0e-15 + 1.0 / 4294967296.0);
+				}
+			}
+
+			// Sqrt 는 내림한 값이어야 한다.
+			MINT_ASSURE(Math::Sqrt(Fixed32(4)) == Fixed32(2));
+			MINT_ASSURE(Math::Sqrt(Fixed64(-4)) == Fixed64());
+			MINT_ASSURE(Math::Sqrt(Fixed64(2)) == Fixed64::FromRaw(6074000999));
+			for (uint32 i = 0; i < 10000; ++i)
+			{
+				const Fixed32 x32 = Fixed32::FromRaw(static_cast<int32>(random() >> 1));
+				const int64 root32 = Math::Sqrt(x32).GetRaw();
+				MINT_ASSURE(root32 * root32 <= (static_cast<int64>(x32.GetRaw()) << 16) && (static_cast<int64>(x32.GetRaw()) << 16) < (root32 + 1) * (root32 + 1));
+
+				const Fixed64 x64 = Fixed64::FromRaw(static_cast<int64>((static_cast<uint64>(random()) << 31) ^ random()));
+				const double root64 = Math::Sqrt(x64).ToDouble();
+				MINT_ASSURE(::abs(root64 - ::sqrt(x64.ToDouble())) < 2.0 / 4294967296.0);
+			}
+
+			// Sin, Cos
+			for (int32 i = -2000; i <= 2000; ++i)
+			{
+				const double angle = static_cast<double>(i) * 0.0123;
+				Fixed64 sin64;
+				Fixed64 cos64;
+				Math::SinCos(Fixed64(angle), sin64, cos64);
+				MINT_ASSURE(::abs(sin64.ToDouble() - ::sin(Fixed64(angle).ToDouble())) < 4.0e-9);
+				MINT_ASSURE(::abs(cos64.ToDouble() - ::cos(Fixed64(angle).ToDouble())) < 4.0e-9);
+				const Fixed32 angle32 = Fixed32(angle);
+				MINT_ASSURE(::abs(Math::Sin(angle32).ToDouble() - ::sin(angle32.ToDouble())) <= 1.0 / 65536.0);
+				MINT_ASSURE(::abs(Math::Cos(angle32).ToDouble() - ::cos(angle32.ToDouble())) <= 1.0 / 65536.0);
+			}
+			MINT_ASSURE(Math::Sin(Fixed64()) == Fixed64() && Math::Cos(Fixed64()) == Fixed64(1));
+
+			// 벡터
+			{
+				Fixed64Vec2 v{ Fixed64(3), Fixed64(-4) };
+				MINT_ASSURE(v.Length() == Fixed64(5));
+				MINT_ASSURE(v.Dot(Fixed64Vec2(Fixed64(1), Fixed64(1))) == Fixed64(-1));
+				MINT_ASSURE(v.Cross(Fixed64Vec2(Fixed64(1), Fixed64())) == Fixed64(4));
+				v.Normalize();
+				MINT_ASSURE(v == Fixed64Vec2(Fixed64(0.6), Fixed64(-0.8)));
+				MINT_ASSURE(v.ToFloat2() == Float2(0.6f, -0.8f));
+				v.SetZero();
+				v.Normalize();
+				MINT_ASSURE(v.IsZero() == true);
+			}
+
+			// 결정성: 어느 컴파일러, 어느 CPU 에서도 bit 단위로 같은 결과가 나와야 한다.
+			{
+				const Fixed64 deltaTime = Fixed64(1) / Fixed64(60);
+				const Fixed64Vec2 gravity{ Fixed64(), Fixed64(-9.8f) };
+				Fixed64Vec2 position;
+				Fixed64Vec2 velocity{ Fixed64(3), Fixed64(12) };
+				Fixed64 rotation;
+				uint64 checksum = 0;
+				for (uint32 i = 0; i < 600; ++i)
+				{
+					velocity += gravity * deltaTime;
+					Fixed64 sin;
+					Fixed64 cos;
+					Math::SinCos(rotation, sin, cos);
+					velocity += Fixed64Vec2(cos, sin) * (deltaTime / Fixed64(4));
+					position += velocity * deltaTime;
+					rotation += Math::Sqrt(velocity.LengthSqaure()) * deltaTime;
+					checksum = checksum * 31 + static_cast<uint64>(position._x.GetRaw() ^ position._y.GetRaw() ^ rotation.GetRaw());
+				}
+				MINT_ASSURE(checksum == 3618147278659021183ull);
+			}
+
+#if defined MINT_TEST_PERFORMANCE
+			{
+				const uint32 kCount = 1 << 20;
+				Vector<float> floats;
+				Vector<Fixed64> fixeds;
+				floats.Resize(kCount);
+				fixeds.Resize(kCount);
+				for (uint32 i = 0; i < kCount; ++i)
+				{
+					fixeds[i] = Fixed64::FromRaw(static_cast<int64>(random() >> 2) << 2);
+					floats[i] = fixeds[i].ToFloat();
+				}
+
+				float floatSum = 0.0f;
+				Fixed64 fixedSum;
+				{
+					Profiler::ScopedCPUProfiler profiler{ "MulAdd - float" };
+					for (uint32 i = 1; i < kCount; ++i)
+					{
+						floatSum += floats[i] * floats[i - 1];
+					}
+				}
+				{
+					Profiler::ScopedCPUProfiler profiler{ "MulAdd - Fixed64" };
+					for (uint32 i = 1; i < kCount; ++i)
+					{
+						fixedSum += fixeds[i] * fixeds[i - 1];
+					}
+				}
+				{
+					Profiler::ScopedCPUProfiler profiler{ "SinCos - libm" };
+					for (uint32 i = 0; i < kCount; ++i)
+					{
+						floatSum += ::sin(floats[i]) + ::cos(floats[i]);
+					}
+				}
+				{
+					Profiler::ScopedCPUProfiler profiler{ "SinCos - Fixed64" };
+					for (uint32 i = 0; i < kCount; ++i)
+					{
+						Fixed64 sin;
+						Fixed64 cos;
+						Math::SinCos(fixeds[i], sin, cos);
+						fixedSum += sin + cos;
+					}
+				}
+				{
+					Profiler::ScopedCPUProfiler profiler{ "Sqrt - libm" };
+					for (uint32 i = 0; i < kCount; ++i)
+					{
+						floatSum += ::sqrt(floats[i]);
+					}
+				}
+				{
+					Profiler::ScopedCPUProfiler profiler{ "Sqrt - Fixed64" };
+					for (uint32 i = 0; i < kCount; ++i)
+					{
+						fixedSum += Math::Sqrt(fixeds[i]);
+					}
+				}
+
+				const std::vector<Profiler::ScopedCPUProfiler::LogData>& logArray = Profiler::ScopedCPUProfiler::GetEntireLogData();
+				const bool IsEmpty = logArray.empty();
+			}
+#endif
+			return true;
+		}
+
+		bool Test_RectStreams()
+		{
+			// lane 개수 (4 or 8) 의 배수가 아니고 64 를 넘는 크기로 나머지 처리와 word 경계를 확인한다.
+			const uint32 kCount = 67;
+			Vector<Rect> rects;
+			uint32 seed = 2024;
+			for (uint32 index = 0; index < kCount; ++index)
+			{
+				seed = seed * 1664525 + 1013904223;
+				const float left = static_cast<float>(seed >> 8) / static_cast<float>(1 << 24) * 100.0f;
+				seed = seed * 1664525 + 1013904223;
+				const float top = static_cast<float>(seed >> 8) / static_cast<float>(1 << 24) * 100.0f;
+				seed = seed * 1664525 + 1013904223;
+				const float width = static_cast<float>(seed >> 8) / static_cast<float>(1 << 24) * 40.0f;
+				seed = seed * 1664525 + 1013904223;
+				const float height = static_cast<float>(seed >> 8) / static_cast<float>(1 << 24) * 40.0f;
+				// 넓이가 0 인 Rect 와 뒤집힌 Rect 도 섞는다.
+				const float widthSign = (index % 11 == 5) ? -1.0f : 1.0f;
+				const float heightScale = (index % 13 == 7) ? 0.0f : 1.0f;
+				rects.PushBack(Rect(left, left + width * widthSign, top, top + height * heightScale));
+			}
+
+			RectStream rectStream;
+			rectStream.Assign(rects.Data(), kCount);
+			MINT_ASSURE(rectStream.Size() == kCount);
+			MINT_ASSURE(rectStream.Get(31) == rects[31]);
+
+			Vector<uint64> masks;
+			const Float2 points[] = { Float2(50.0f, 50.0f), Float2(10.0f, 90.0f), Float2(rects[3].Left(), rects[3].Top()), Float2(-1.0f, -1.0f) };
+			for (const Float2& point : points)
+			{
+				Math::Contains(rectStream, point, masks);
+				MINT_ASSURE(masks.Size() == 2);
+				for (uint32 index = 0; index < kCount; ++index)
+				{
+					MINT_ASSURE(((masks[index / 64] >> (index % 64)) & 1) == static_cast<uint64>(rects[index].Contains(point)));
+				}
+				MINT_ASSURE((masks[1] >> (kCount % 64)) == 0);
+			}
+			Math::Contains(rectStream, points[2], masks);
+			MINT_ASSURE((masks[0] & (1ull << 3)) != 0);
+
+			const Rect queries[] = { Rect(20.0f, 60.0f, 30.0f, 45.0f), Rect(rects[10].Right(), rects[10].Right() + 1.0f, rects[10].Top(), rects[10].Bottom()), Rect(200.0f, 300.0f, 0.0f, 100.0f) };
+			for (const Rect& query : queries)
+			{
+				Math::Intersects(rectStream, query, masks);
+				uint32 expectedCount = 0;
+				for (uint32 index = 0; index < kCount; ++index)
+				{
+					const bool expected = rects[index].Intersects(query);
+					expectedCount += (expected ? 1 : 0);
+					MINT_ASSURE(((masks[index / 64] >> (index % 64)) & 1) == static_cast<uint64>(expected));
+				}
+				MINT_ASSURE(Math::CountSetBits(masks) == expectedCount);
+			}
+			// 경계가 닿기만 해도 겹친다.
+			Math::Intersects(rectStream, queries[1], masks);
+			MINT_ASSURE((masks[0] & (1ull << 10)) != 0);
+			Math::Intersects(rectStream, queries[2], masks);
+			MINT_ASSURE(Math::CountSetBits(masks) == 0);
+
+			const Rect clipRect(25.0f, 75.0f, 10.0f, 60.0f);
+			RectStream clippedStream = rectStream;
+			Math::ClipBy(clippedStream, clipRect);
+			for (uint32 index = 0; index < kCount; ++index)
+			{
+				Rect expected = rects[index];
+				expected.ClipBy(clipRect);
+				MINT_ASSURE(clippedStream.Get(index) == expected);
+			}
+
+			Math::Contains(RectStream(), points[0], masks);
+			MINT_ASSURE(masks.IsEmpty() == true);
+
+			// 오른손 좌표계, 90 도 시야, near 1, far 100 인 카메라가 원점에서 -z 를 본다.
+			const Float4x4 projectionMatrix = Float4x4::ProjectionMatrixPerspectiveYUP(true, Math::kPiOverTwo, 1.0f, 100.0f, 1.0f);
+			Float4 frustumPlanes[6];
+			Math::ComputeFrustumPlanes(projectionMatrix, frustumPlanes);
+			Float3Stream centers;
+			Float3Stream halfSizes;
+			// 안쪽
+			centers.PushBack(Float3(0.0f, 0.0f, -10.0f));
+			halfSizes.PushBack(Float3(1.0f, 1.0f, 1.0f));
+			// 뒤
+			centers.PushBack(Float3(0.0f, 0.0f, 10.0f));
+			halfSizes.PushBack(Float3(1.0f, 1.0f, 1.0f));
+			// far 너머
+			centers.PushBack(Float3(0.0f, 0.0f, -200.0f));
+			halfSizes.PushBack(Float3(1.0f, 1.0f, 1.0f));
+			// 오른쪽 바깥
+			centers.PushBack(Float3(50.0f, 0.0f, -10.0f));
+			halfSizes.PushBack(Float3(1.0f, 1.0f, 1.0f));
+			// 오른쪽 평면에 걸침
+			centers.PushBack(Float3(11.5f, 0.0f, -10.0f));
+			halfSizes.PushBack(Float3(2.0f, 2.0f, 2.0f));
+			// near 앞
+			centers.PushBack(Float3(0.0f, 0.0f, -0.5f));
+			halfSizes.PushBack(Float3(0.4f, 0.4f, 0.4f));
+			// 아래 바깥
+			centers.PushBack(Float3(0.0f, -30.0f, -20.0f));
+			halfSizes.PushBack(Float3(1.0f, 1.0f, 1.0f));
+			// far 평면에 걸침
+			centers.PushBack(Float3(0.0f, 0.0f, -100.5f));
+			halfSizes.PushBack(Float3(1.0f, 1.0f, 1.0f));
+			// 점
+			centers.PushBack(Float3(-5.0f, 5.0f, -50.0f));
+			halfSizes.PushBack(Float3(0.0f, 0.0f, 0.0f));
+			Math::CullAABBs(frustumPlanes, centers, halfSizes, masks);
+			MINT_ASSURE(masks.Size() == 1);
+			MINT_ASSURE(masks[0] == 0b110010001);
+
+#if defined MINT_TEST_PERFORMANCE
+			{
+				const uint32 kPerformanceCount = 1 << 20;
+				Vector<Rect> performanceRects;
+				performanceRects.Resize(kPerformanceCount);
+				for (uint32 index = 0; index < kPerformanceCount; ++index)
+				{
+					seed = seed * 1664525 + 1013904223;
+					const float left = static_cast<float>(seed >> 8) / static_cast<float>(1 << 24) * 4096.0f;
+					seed = seed * 1664525 + 1013904223;
+					const float top = static_cast<float>(seed >> 8) / static_cast<float>(1 << 24) * 4096.0f;
+					performanceRects[index] = Rect(left, left + 32.0f, top, top + 32.0f);
+				}
+				RectStream performanceStream;
+				performanceStream.Assign(performanceRects.Data(), kPerformanceCount);
+				const Rect viewRect(1000.0f, 2920.0f, 1000.0f, 2080.0f);
+				const Float2 mousePosition(1500.0f, 1500.0f);
+				uint32 hitCount = 0;
+
+				{
+					Profiler::ScopedCPUProfiler profiler{ "Rect culling - per element" };
+					for (uint32 index = 0; index < kPerformanceCount; ++index)
+					{
+						hitCount += (performanceRects[index].Intersects(viewRect) ? 1 : 0);
+					}
+				}
+				{
+					Profiler::ScopedCPUProfiler profiler{ "Rect culling - RectStream" };
+					Math::Intersects(performanceStream, viewRect, masks);
+				}
+				{
+					Profiler::ScopedCPUProfiler profiler{ "Hit test - per element" };
+					for (uint32 index = 0; index < kPerformanceCount; ++index)
+					{
+						hitCount += (performanceRects[index].Contains(mousePosition) ? 1 : 0);
+					}
+				}
+				{
+					Profiler::ScopedCPUProfiler profiler{ "Hit test - RectStream" };
+					Math::Contains(performanceStream, mousePosition, masks);
+				}
+
+				const std::vector<Profiler::ScopedCPUProfiler::LogData>& logArray = Profiler::ScopedCPUProfiler::GetEntireLogData();
+				const bool IsEmpty = logArray.empty();
+			}
+#endif
 			return true;
 		}
 
@@ -248,6 +1643,12 @@ namespace mint
 			MINT_ASSURE(Test_FloatTypes());
 			MINT_ASSURE(Test_Transforms());
 			MINT_ASSURE(Test_LinearAlgebra());
+			MINT_ASSURE(Test_FloatStreams());
+			MINT_ASSURE(Test_FastMath());
+			MINT_ASSURE(Test_Geometry());
+			MINT_ASSURE(Test_SpaceFillingCurves());
+			MINT_ASSURE(Test_FixedPoint());
+			MINT_ASSURE(Test_RectStreams());
 			return true;
 		}
 	}
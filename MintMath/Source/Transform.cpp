@@ -1,5 +1,10 @@
 #include <MintMath/Include/Transform.h>
 #include <MintMath/Include/Float2x2.h>
+#include <MintMath/Include/FastMath.h>
+
+#include <MintContainer/Include/Vector.hpp>
+
+#include <immintrin.h>
 
 
 namespace mint
@@ -30,6 +35,60 @@ namespace mint
 	}
 #pragma endregion
 
+#pragma region TransformStream
+	TransformStream::TransformStream(const uint32 size)
+	{
+		Resize(size);
+	}
+
+	void TransformStream::Resize(const uint32 size)
+	{
+		_scales.Resize(size);
+		_rotations.Resize(size);
+		_translations.Resize(size);
+	}
+
+	void TransformStream::Reserve(const uint32 capacity)
+	{
+		_scales.Reserve(capacity);
+		_rotations.Reserve(capacity);
+		_translations.Reserve(capacity);
+	}
+
+	void TransformStream::Clear() noexcept
+	{
+		_scales.Clear();
+		_rotations.Clear();
+		_translations.Clear();
+	}
+
+	void TransformStream::PushBack(const Transform& transform)
+	{
+		const QuaternionF& rotation = transform._rotation;
+		_scales.PushBack(transform._scale);
+		_rotations.PushBack(Float4(rotation._x, rotation._y, rotation._z, rotation._w));
+		_translations.PushBack(transform._translation);
+	}
+
+	void TransformStream::Set(const uint32 index, const Transform& transform) noexcept
+	{
+		const QuaternionF& rotation = transform._rotation;
+		_scales.Set(index, transform._scale);
+		_rotations.Set(index, Float4(rotation._x, rotation._y, rotation._z, rotation._w));
+		_translations.Set(index, transform._translation);
+	}
+
+	Transform TransformStream::Get(const uint32 index) const noexcept
+	{
+		const Float4 rotation = _rotations.Get(index);
+		Transform transform;
+		transform._scale = _scales.Get(index);
+		transform._rotation = QuaternionF(rotation._w, rotation._x, rotation._y, rotation._z);
+		transform._translation = _translations.Get(index);
+		return transform;
+	}
+#pragma endregion
+
 #pragma region Transform2D
 	Transform2D::Transform2D()
 		: Transform2D(Float2::kZero)
@@ -148,5 +207,244 @@ namespace mint
 
 			return true;
 		}
+
+		namespace TransformLane
+		{
+			// 4 개의 Transform 을 성분별 register 로 받아 4 개의 SRT 행렬을 만든다. (Float4x4::SRTMatrix 와 같은 식)
+			MINT_INLINE void StoreSRTMatrices(const __m128 sx, const __m128 sy, const __m128 sz,
+				const __m128 qx, const __m128 qy, const __m128 qz, const __m128 qw,
+				const __m128 tx, const __m128 ty, const __m128 tz, Float4x4* const outMatrices) noexcept
+			{
+				const __m128 one = _mm_set1_ps(1.0f);
+				const __m128 lengthSq = _mm_add_ps(_mm_add_ps(_mm_mul_ps(qx, qx), _mm_mul_ps(qy, qy)), _mm_add_ps(_mm_mul_ps(qz, qz), _mm_mul_ps(qw, qw)));
+				const __m128 s = _mm_div_ps(_mm_set1_ps(2.0f), lengthSq);
+				const __m128 xs = _mm_mul_ps(qx, s);
+				const __m128 ys = _mm_mul_ps(qy, s);
+				const __m128 zs = _mm_mul_ps(qz, s);
+				const __m128 wx = _mm_mul_ps(qw, xs);
+				const __m128 wy = _mm_mul_ps(qw, ys);
+				const __m128 wz = _mm_mul_ps(qw, zs);
+				const __m128 xx = _mm_mul_ps(qx, xs);
+				const __m128 xy = _mm_mul_ps(qx, ys);
+				const __m128 xz = _mm_mul_ps(qx, zs);
+				const __m128 yy = _mm_mul_ps(qy, ys);
+				const __m128 yz = _mm_mul_ps(qy, zs);
+				const __m128 zz = _mm_mul_ps(qz, zs);
+
+				// 열마다 scale 을 곱한다. (R * S)
+				__m128 m11 = _mm_mul_ps(_mm_sub_ps(one, _mm_add_ps(yy, zz)), sx);
+				__m128 m12 = _mm_mul_ps(_mm_sub_ps(xy, wz), sy);
+				__m128 m13 = _mm_mul_ps(_mm_add_ps(xz, wy), sz);
+				__m128 m14 = tx;
+				__m128 m21 = _mm_mul_ps(_mm_add_ps(xy, wz), sx);
+				__m128 m22 = _mm_mul_ps(_mm_sub_ps(one, _mm_add_ps(xx, zz)), sy);
+				__m128 m23 = _mm_mul_ps(_mm_sub_ps(yz, wx), sz);
+				__m128 m24 = ty;
+				__m128 m31 = _mm_mul_ps(_mm_sub_ps(xz, wy), sx);
+				__m128 m32 = _mm_mul_ps(_mm_add_ps(yz, wx), sy);
+				__m128 m33 = _mm_mul_ps(_mm_sub_ps(one, _mm_add_ps(xx, yy)), sz);
+				__m128 m34 = tz;
+				_MM_TRANSPOSE4_PS(m11, m12, m13, m14);
+				_MM_TRANSPOSE4_PS(m21, m22, m23, m24);
+				_MM_TRANSPOSE4_PS(m31, m32, m33, m34);
+
+				const __m128 row3 = _mm_setr_ps(0.0f, 0.0f, 0.0f, 1.0f);
+				const __m128 rows[4][3] = { { m11, m21, m31 }, { m12, m22, m32 }, { m13, m23, m33 }, { m14, m24, m34 } };
+				for (uint32 i = 0; i < 4; ++i)
+				{
+					float* const out = &outMatrices[i]._m[0][0];
+					_mm_storeu_ps(out + 0, rows[i][0]);
+					_mm_storeu_ps(out + 4, rows[i][1]);
+					_mm_storeu_ps(out + 8, rows[i][2]);
+					_mm_storeu_ps(out + 12, row3);
+				}
+			}
+
+			MINT_INLINE __m128 Dot4(const __m128 (&a)[4], const __m128 (&b)[4]) noexcept
+			{
+				return _mm_add_ps(_mm_add_ps(_mm_mul_ps(a[0], b[0]), _mm_mul_ps(a[1], b[1])), _mm_add_ps(_mm_mul_ps(a[2], b[2]), _mm_mul_ps(a[3], b[3])));
+			}
+
+			// out = normalize(a * wa + b * wb)
+			MINT_INLINE void StoreWeightedSum(const __m128 (&a)[4], const __m128 (&b)[4], const __m128 wa, const __m128 wb, Float4Stream& out, const uint32 index) noexcept
+			{
+				__m128 result[4];
+				for (uint32 componentIndex = 0; componentIndex < 4; ++componentIndex)
+				{
+					result[componentIndex] = _mm_add_ps(_mm_mul_ps(a[componentIndex], wa), _mm_mul_ps(b[componentIndex], wb));
+				}
+				const __m128 inverseLength = Fast::RSqrt(Dot4(result, result));
+				for (uint32 componentIndex = 0; componentIndex < 4; ++componentIndex)
+				{
+					_mm_storeu_ps(out.GetComponentData(componentIndex) + index, _mm_mul_ps(result[componentIndex], inverseLength));
+				}
+			}
+
+			MINT_INLINE void Load(const Float4Stream& stream, const uint32 index, __m128 (&outComponents)[4]) noexcept
+			{
+				for (uint32 componentIndex = 0; componentIndex < 4; ++componentIndex)
+				{
+					outComponents[componentIndex] = _mm_loadu_ps(stream.GetComponentData(componentIndex) + index);
+				}
+			}
+
+			MINT_INLINE QuaternionF ToQuaternion(const Float4& value) noexcept
+			{
+				return QuaternionF(value._w, value._x, value._y, value._z);
+			}
+
+			MINT_INLINE Float4 ToFloat4(const QuaternionF& value) noexcept
+			{
+				return Float4(value._x, value._y, value._z, value._w);
+			}
+		}
+
+		void ToMatrices(const Transform* const transforms, const uint32 count, Float4x4* const outMatrices) noexcept
+		{
+			uint32 index = 0;
+			for (; index + 4 <= count; index += 4)
+			{
+				const Transform* const t = transforms + index;
+				TransformLane::StoreSRTMatrices(
+					_mm_setr_ps(t[0]._scale._x, t[1]._scale._x, t[2]._scale._x, t[3]._scale._x),
+					_mm_setr_ps(t[0]._scale._y, t[1]._scale._y, t[2]._scale._y, t[3]._scale._y),
+					_mm_setr_ps(t[0]._scale._z, t[1]._scale._z, t[2]._scale._z, t[3]._scale._z),
+					_mm_setr_ps(t[0]._rotation._x, t[1]._rotation._x, t[2]._rotation._x, t[3]._rotation._x),
+					_mm_setr_ps(t[0]._rotation._y, t[1]._rotation._y, t[2]._rotation._y, t[3]._rotation._y),
+					_mm_setr_ps(t[0]._rotation._z, t[1]._rotation._z, t[2]._rotation._z, t[3]._rotation._z),
+					_mm_setr_ps(t[0]._rotation._w, t[1]._rotation._w, t[2]._rotation._w, t[3]._rotation._w),
+					_mm_setr_ps(t[0]._translation._x, t[1]._translation._x, t[2]._translation._x, t[3]._translation._x),
+					_mm_setr_ps(t[0]._translation._y, t[1]._translation._y, t[2]._translation._y, t[3]._translation._y),
+					_mm_setr_ps(t[0]._translation._z, t[1]._translation._z, t[2]._translation._z, t[3]._translation._z),
+					outMatrices + index);
+			}
+			for (; index < count; ++index)
+			{
+				outMatrices[index] = transforms[index].ToMatrix();
+			}
+		}
+
+		void ToMatrices(const TransformStream& transforms, Float4x4* const outMatrices) noexcept
+		{
+			const uint32 count = transforms.Size();
+			const float* const sx = transforms.GetScales().GetComponentData(0);
+			const float* const sy = transforms.GetScales().GetComponentData(1);
+			const float* const sz = transforms.GetScales().GetComponentData(2);
+			const float* const qx = transforms.GetRotations().GetComponentData(0);
+			const float* const qy = transforms.GetRotations().GetComponentData(1);
+			const float* const qz = transforms.GetRotations().GetComponentData(2);
+			const float* const qw = transforms.GetRotations().GetComponentData(3);
+			const float* const tx = transforms.GetTranslations().GetComponentData(0);
+			const float* const ty = transforms.GetTranslations().GetComponentData(1);
+			const float* const tz = transforms.GetTranslations().GetComponentData(2);
+			uint32 index = 0;
+			for (; index + 4 <= count; index += 4)
+			{
+				TransformLane::StoreSRTMatrices(
+					_mm_loadu_ps(sx + index), _mm_loadu_ps(sy + index), _mm_loadu_ps(sz + index),
+					_mm_loadu_ps(qx + index), _mm_loadu_ps(qy + index), _mm_loadu_ps(qz + index), _mm_loadu_ps(qw + index),
+					_mm_loadu_ps(tx + index), _mm_loadu_ps(ty + index), _mm_loadu_ps(tz + index),
+					outMatrices + index);
+			}
+			for (; index < count; ++index)
+			{
+				outMatrices[index] = transforms.Get(index).ToMatrix();
+			}
+		}
+
+		void ComposeMatrices(const Float4x4* const parentMatrices, const Float4x4* const localMatrices, const uint32 count, Float4x4* const outMatrices) noexcept
+		{
+			for (uint32 index = 0; index < count; ++index)
+			{
+				outMatrices[index] = Float4x4::Mul(parentMatrices[index], localMatrices[index]);
+			}
+		}
+
+		void ComposeHierarchy(const int32* const parentIndices, const Float4x4* const localMatrices, const uint32 count, Float4x4* const outWorldMatrices) noexcept
+		{
+			for (uint32 index = 0; index < count; ++index)
+			{
+				const int32 parentIndex = parentIndices[index];
+				if (parentIndex < 0)
+				{
+					outWorldMatrices[index] = localMatrices[index];
+					continue;
+				}
+
+				MINT_ASSERT(static_cast<uint32>(parentIndex) < index, "부모가 먼저 나와야 합니다!");
+				outWorldMatrices[index] = Float4x4::Mul(outWorldMatrices[parentIndex], localMatrices[index]);
+			}
+		}
+
+		void Nlerp(const Float4Stream& a, const Float4Stream& b, const float t, Float4Stream& out)
+		{
+			MINT_ASSERT(a.Size() == b.Size(), "두 stream 의 크기가 달라선 안 됩니다!");
+			const uint32 count = a.Size();
+			out.Resize(count);
+
+			const __m128 ta = _mm_set1_ps(1.0f - t);
+			const __m128 tb = _mm_set1_ps(t);
+			const __m128 signMask = _mm_set1_ps(-0.0f);
+			uint32 index = 0;
+			for (; index + 4 <= count; index += 4)
+			{
+				__m128 qa[4];
+				__m128 qb[4];
+				TransformLane::Load(a, index, qa);
+				TransformLane::Load(b, index, qb);
+				// 내적이 음수면 b 를 뒤집어 짧은 쪽으로 보간한다.
+				const __m128 dotSign = _mm_and_ps(TransformLane::Dot4(qa, qb), signMask);
+				TransformLane::StoreWeightedSum(qa, qb, ta, _mm_xor_ps(tb, dotSign), out, index);
+			}
+			for (; index < count; ++index)
+			{
+				const QuaternionF result = QuaternionF::Nlerp(TransformLane::ToQuaternion(a.Get(index)), TransformLane::ToQuaternion(b.Get(index)), t);
+				out.Set(index, TransformLane::ToFloat4(result));
+			}
+		}
+
+		void Slerp(const Float4Stream& a, const Float4Stream& b, const float t, Float4Stream& out)
+		{
+			MINT_ASSERT(a.Size() == b.Size(), "두 stream 의 크기가 달라선 안 됩니다!");
+			const uint32 count = a.Size();
+			out.Resize(count);
+
+			const __m128 one = _mm_set1_ps(1.0f);
+			const __m128 ta = _mm_set1_ps(1.0f - t);
+			const __m128 tb = _mm_set1_ps(t);
+			const __m128 signMask = _mm_set1_ps(-0.0f);
+			const __m128 nlerpThreshold = _mm_set1_ps(0.9995f);
+			uint32 index = 0;
+			for (; index + 4 <= count; index += 4)
+			{
+				__m128 qa[4];
+				__m128 qb[4];
+				TransformLane::Load(a, index, qa);
+				TransformLane::Load(b, index, qb);
+				const __m128 dot = TransformLane::Dot4(qa, qb);
+				const __m128 dotSign = _mm_and_ps(dot, signMask);
+				const __m128 cosTheta = _mm_min_ps(_mm_andnot_ps(signMask, dot), one);
+				const __m128 sinTheta = _mm_sqrt_ps(_mm_sub_ps(one, _mm_mul_ps(cosTheta, cosTheta)));
+				const __m128 theta = Fast::Atan2(sinTheta, cosTheta);
+				__m128 sinB;
+				__m128 cosB;
+				Fast::SinCos(_mm_mul_ps(tb, theta), sinB, cosB);
+				const __m128 inverseSinTheta = _mm_div_ps(one, sinTheta);
+				// sin((1 - t)θ) / sinθ = cos(tθ) - cosθ * sin(tθ) / sinθ
+				const __m128 sinBOverSinTheta = _mm_mul_ps(sinB, inverseSinTheta);
+				const __m128 slerpA = _mm_sub_ps(cosB, _mm_mul_ps(cosTheta, sinBOverSinTheta));
+
+				// sin(theta) 가 0 에 가까운 lane 은 Nlerp 로 계산한다.
+				const __m128 useNlerp = _mm_cmpgt_ps(cosTheta, nlerpThreshold);
+				const __m128 wa = _mm_or_ps(_mm_and_ps(useNlerp, ta), _mm_andnot_ps(useNlerp, slerpA));
+				const __m128 wb = _mm_or_ps(_mm_and_ps(useNlerp, tb), _mm_andnot_ps(useNlerp, sinBOverSinTheta));
+				TransformLane::StoreWeightedSum(qa, qb, wa, _mm_xor_ps(wb, dotSign), out, index);
+			}
+			for (; index < count; ++index)
+			{
+				const QuaternionF result = QuaternionF::Slerp(TransformLane::ToQuaternion(a.Get(index)), TransformLane::ToQuaternion(b.Get(index)), t);
+				out.Set(index, TransformLane::ToFloat4(result));
+			}
+		}
 	}
 }
@@ -8,5 +8,10 @@
 #include <MintMath/Source/Float4x4.cpp>
 #include <MintMath/Source/Transform.cpp>
 #include <MintMath/Source/AffineVec.cpp>
+#include <MintMath/Source/AffineMat.cpp>
 #include <MintMath/Source/Geometry.cpp>
+#include <MintMath/Source/FloatStream.cpp>
+#include <MintMath/Source/RectStream.cpp>
+#include <MintMath/Source/SpaceFillingCurve.cpp>
+#include <MintMath/Source/FixedPoint.cpp>
 #include <MintMath/Source/TestMath.cpp>
@@ -9,6 +9,10 @@
 #include <MintPhysics/Include/CollisionShape.h>
 #include <MintPhysics/Include/Intersection.h>
 #include <MintPhysics/Include/TimeStepCalculator.h>
+#include <MintPhysics/Include/DynamicAABBTree.h>
+#include <MintPhysics/Include/SweepAndPrune.h>
+#include <MintPhysics/Include/SpatialHashGrid.h>
+#include <MintPhysics/Include/ThreadPool.h>
 #include <MintPhysics/Include/ConstraintSolver.h>
 #include <MintPhysics/Include/PhysicsWorld.h>
 
@@ -6,6 +6,10 @@
 
 
 #include <MintPhysics/Include/Intersection.hpp>
+#include <MintPhysics/Include/DynamicAABBTree.hpp>
+#include <MintPhysics/Include/SweepAndPrune.hpp>
+#include <MintPhysics/Include/SpatialHashGrid.hpp>
+#include <MintPhysics/Include/ThreadPool.hpp>
 
 
 #endif // !_MINT_PHYSICS_ALL_HPPS_H_
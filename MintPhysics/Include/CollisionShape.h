@@ -8,6 +8,7 @@
 #include <MintContainer/Include/Vector.h>
 #include <MintContainer/Include/SharedPtr.h>
 #include <MintMath/Include/Float2.h>
+#include <MintMath/Include/Float2x2.h>
 #include <MintMath/Include/Transform.h>
 
 
@@ -129,6 +130,12 @@ namespace mint
 			void SetExpanded(const AABBCollisionShape& aabbCollisionShape, const Transform2D& transform2D, const Float2& displacement);
 			void SetExpandedByRadius(const AABBCollisionShape& aabbCollisionShape, const Transform2D& transform2D, const Float2& displacement);
 			void SetExpandedByRadius(float radius, const Float2& center, const Float2& displacement);
+
+		public:
+			// halfSize 인 AABB 를 rotation 만큼 돌렸을 때 그것을 감싸는 AABB 의 halfSize
+			static Float2 ComputeRotatedHalfSize(const Float2& halfSize, const float rotation);
+			// 돌린 AABB 를 감싸고 displacement 만큼 움직인 자리까지 늘린 AABB 의 min, max
+			static void ComputeExpandedMinMax(const Float2& center, const Float2& halfSize, const float rotation, const Float2& displacement, Float2& outMin, Float2& outMax);
 		
 		public:
 			virtual CollisionShapeType GetCollisionShapeType() const override final { return CollisionShapeType::AABB; }
@@ -229,6 +236,36 @@ namespace mint
 		private:
 			Vector<ShapeInstance> _shapeInstances;
 		};
+
+		// A shape placed by transform2D without being copied.
+		// Support functions are the same as the ones of CollisionShape::MakeTransformed(shape, transform2D), but computed on the fly,
+		// so making one costs no heap allocation.
+		// The shape must outlive this.
+		class TransformedCollisionShape
+		{
+		public:
+			TransformedCollisionShape(const CollisionShape& shape, const Transform2D& transform2D);
+
+		public:
+			Float2 ComputeSupportPoint(const Float2& direction) const;
+			void ComputeSupportEdge(const Float2& direction, Float2& outVertexA, Float2& outVertexB) const;
+			// The farthest a point of the shape moves when the rotation of the transform changes by 1 radian.
+			// It is 0 for shapes that are only translated.
+			float ComputeRotationRadius() const;
+			// The shape seen as a convex polygon in CCW order, for contact clipping.
+			// Point and Circle are a single vertex at the center, and Edge is a two-sided polygon with two vertices.
+			uint32 GetVertexCount() const;
+			Float2 ComputeVertex(const uint32 index) const;
+			const CollisionShape& GetShape() const { return *_shape; }
+
+		private:
+			const CollisionShape* _shape;
+			// A point p of the shape is placed at (_matrix * p + _translation).
+			Float2x2 _matrix;
+			Float2x2 _transposedMatrix;
+			Float2 _translation;
+			bool _isTranslationOnly;
+		};
 	}
 }
 
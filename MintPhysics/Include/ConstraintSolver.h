@@ -1,9 +1,11 @@
-#pragma once
+﻿#pragma once
 
 
 #ifndef _MINT_PHYSICS_CONSTRAINT_SOLVER_H_
 #define _MINT_PHYSICS_CONSTRAINT_SOLVER_H_
 
+#include <MintContainer/Include/Vector.h>
+
 #include <MintPhysics/Include/PhysicsCommon.h>
 
 namespace mint
@@ -16,9 +18,112 @@ namespace mint
 			BodyID _bodyBID;
 			float _distance; // Desired distance between the two particles
 			float _stiffness; // Stiffness of the constraint
+			// Solver 가 누적한 impulse. 다음 step 의 warm starting 에 쓴다.
+			Real _impulse = Real(0);
 		};
 
-		void SolveParticleDistanceConstraint(World& world, float timeStep, const ParticleDistanceConstraint& particleDistanceConstraint);
+		// 두 body 의 속도에 대한 1 차원 constraint (Jacobian row) 들을 projected Gauss-Seidel 로 푼다.
+		// - row 는 J = [-direction, -angularA, direction, angularB] 이고, 누적 impulse 를 [minImpulse, maxImpulse] 로 자른다.
+		// - 같은 dynamic body 를 쓰지 않는 row 끼리 색 (color) 으로 묶고, 색마다 SIMD lane 수만큼 SoA 로 모아서 한꺼번에 푼다.
+		//   한 색 안의 row 는 서로 영향을 주지 않고 곱셈과 덧셈을 FMA 로 합치지 않으므로, lane 수 (MINT_NO_SIMD 포함) 와 상관없이 결과가 bit 단위로 같다.
+		// - 값은 모두 Real 이다. MINT_PHYSICS_DETERMINISTIC 이면 Fixed64 로 row 를 하나씩 풀고, float 를 거치지 않는다.
+		// - 버퍼는 Clear 해도 메모리를 그대로 두므로 step 마다 다시 할당하지 않는다.
+		class ConstraintSolver final
+		{
+		public:
+			ConstraintSolver();
+			~ConstraintSolver() = default;
+
+		public:
+			void Clear();
+			// 반환하는 번호로 row 를 만들고 속도를 읽는다. inverseMass 와 inverseInertia 가 모두 0 이면 속도가 바뀌지 않는다.
+			uint32 AddBody(const Real2& linearVelocity, const Real angularVelocity, const Real inverseMass, const Real inverseInertia);
+			// 반환하는 번호로 Solve 뒤의 누적 impulse 를 읽는다. initialImpulse 는 warm starting 으로 먼저 가한다.
+			// bias 는 J * v 에 더해지는 속도이다. (J * v + bias = 0 이 되도록 푼다.)
+			uint32 AddRow(const uint32 bodyIndexA, const uint32 bodyIndexB, const Real2& direction, const Real angularA, const Real angularB, const Real bias, const Real minImpulse, const Real maxImpulse, const Real initialImpulse);
+			// 마찰 row. 누적 impulse 를 normal row 의 누적 impulse 의 frictionCoefficient 배 안으로 자른다.
+			uint32 AddFrictionRow(const uint32 bodyIndexA, const uint32 bodyIndexB, const Real2& tangent, const Real angularA, const Real angularB, const uint32 normalRowIndex, const Real frictionCoefficient, const Real initialImpulse);
+			void Solve(const uint32 iterationCount);
+
+		public:
+			Real GetImpulse(const uint32 rowIndex) const { return _impulses[_rowSlots[rowIndex]]; }
+			Real2 GetLinearVelocity(const uint32 bodyIndex) const { return Real2(_velocityXs[bodyIndex], _velocityYs[bodyIndex]); }
+			Real GetAngularVelocity(const uint32 bodyIndex) const { return _angularVelocities[bodyIndex]; }
+			uint32 GetRowCount() const { return _rows.Size(); }
+			// Solve 에서 나눈 색의 수 (테스트용)
+			uint32 GetColorCount() const { return _colorRowRanges.Size(); }
+
+		private:
+			struct Row
+			{
+				uint32 _bodyIndexA = 0;
+				uint32 _bodyIndexB = 0;
+				Real2 _direction;
+				Real _angularA = Real(0);
+				Real _angularB = Real(0);
+				Real _bias = Real(0);
+				Real _minImpulse = Real(0);
+				Real _maxImpulse = Real(0);
+				Real _initialImpulse = Real(0);
+				// 마찰 row 가 아니면 kInvalidIndexUint32
+				uint32 _normalRowIndex = kInvalidIndexUint32;
+				Real _frictionCoefficient = Real(0);
+			};
+
+			struct FrictionRow
+			{
+				uint32 _slot = 0;
+				uint32 _normalSlot = 0;
+				Real _frictionCoefficient = Real(0);
+			};
+
+			struct RowRange
+			{
+				uint32 _begin = 0;
+				uint32 _end = 0;
+			};
+
+		private:
+			bool IsDynamicBody(const uint32 bodyIndex) const { return _inverseMasses[bodyIndex] > Real(0) || _inverseInertias[bodyIndex] > Real(0); }
+			void BuildColors();
+			void WarmStart();
+			template<typename L>
+			void SolveRows(const uint32 slotBegin, const uint32 slotEnd);
+
+		private:
+			// 64 개가 넘는 색이 필요한 row 는 마지막 색에 모아서 lane 없이 하나씩 푼다.
+			static constexpr const uint32 kMaxColorCount = 64;
+
+		private:
+			// body (0 번은 padding lane 이 쓰는 움직이지 않는 body)
+			Vector<Real> _velocityXs;
+			Vector<Real> _velocityYs;
+			Vector<Real> _angularVelocities;
+			Vector<Real> _inverseMasses;
+			Vector<Real> _inverseInertias;
+			Vector<uint64> _bodyColorMasks;
+
+			// AddRow 순서의 row 와, 색 순서로 늘어놓은 row 의 위치 (slot)
+			Vector<Row> _rows;
+			Vector<uint32> _rowColors;
+			Vector<uint32> _rowSlots;
+
+			// 색 순서로 늘어놓은 SoA row. 색마다 lane 수의 배수가 되도록 빈 row 를 채운다.
+			Vector<uint32> _bodyIndexAs;
+			Vector<uint32> _bodyIndexBs;
+			Vector<Real> _directionXs;
+			Vector<Real> _directionYs;
+			Vector<Real> _angularAs;
+			Vector<Real> _angularBs;
+			Vector<Real> _effectiveMasses;
+			Vector<Real> _biases;
+			Vector<Real> _minImpulses;
+			Vector<Real> _maxImpulses;
+			Vector<Real> _impulses;
+			Vector<FrictionRow> _frictionRows;
+			Vector<RowRange> _colorRowRanges;
+			Vector<uint32> _colorRowCounts;
+		};
 	}
 }
 
@@ -0,0 +1,106 @@
+﻿#pragma once
+
+
+#ifndef _MINT_PHYSICS_DYNAMIC_AABB_TREE_H_
+#define _MINT_PHYSICS_DYNAMIC_AABB_TREE_H_
+
+
+#include <MintCommon/Include/CommonDefinitions.h>
+
+#include <MintContainer/Include/Vector.h>
+
+#include <MintMath/Include/Float2.h>
+
+
+namespace mint
+{
+	namespace Physics2D
+	{
+		// AABB 들의 bounding volume hierarchy. broad phase 에서 겹치는 AABB 쌍을 찾는 데 쓴다.
+		// - leaf (proxy) 는 넣은 AABB 를 margin 만큼 키운 fat AABB 를 가진다.
+		//   MoveProxy 에서 새 AABB 가 fat AABB 안에 있으면 아무것도 하지 않고, 벗어났을 때만 leaf 를 빼서 다시 넣는다.
+		// - 넣을 때는 부모 AABB 둘레의 합이 가장 작게 늘어나는 자리를 고르고, 올라가면서 AVL 회전으로 높이를 맞춘다.
+		// - RebuildSAH 는 모든 leaf 로 트리를 새로 만든다. (binned SAH) 많이 움직인 뒤 질의가 느려졌을 때 부르면 된다.
+		// - 결과는 넣은 순서와 AABB 값에만 의존한다. (같은 입력이면 같은 순서로 같은 쌍이 나온다.)
+		class DynamicAABBTree final
+		{
+		public:
+			struct Node
+			{
+				bool IsLeaf() const { return _childA == kInvalidIndexUint32; }
+
+				Float2 _min;
+				Float2 _max;
+				// 비어 있는 node 는 다음 빈 node 의 index
+				uint32 _parent = kInvalidIndexUint32;
+				uint32 _childA = kInvalidIndexUint32;
+				uint32 _childB = kInvalidIndexUint32;
+				// leaf 는 0, 비어 있는 node 는 -1
+				int32 _height = -1;
+				uint32 _userData = kInvalidIndexUint32;
+			};
+
+		public:
+			DynamicAABBTree();
+			explicit DynamicAABBTree(const float fatMargin);
+			~DynamicAABBTree() = default;
+
+		public:
+			// 반환하는 proxy ID 는 DestroyProxy 전까지 바뀌지 않는다.
+			uint32 CreateProxy(const Float2& min, const Float2& max, const uint32 userData);
+			void DestroyProxy(const uint32 proxyID);
+			// AABB 가 fat AABB 를 벗어나서 다시 넣었으면 true
+			bool MoveProxy(const uint32 proxyID, const Float2& min, const Float2& max);
+			void Clear();
+			// 모든 leaf 로 트리를 새로 만든다. proxy ID 는 그대로다.
+			void RebuildSAH();
+
+		public:
+			// fat AABB 가 [min, max] 와 겹치는 모든 leaf 에 대해 callback(userData) 를 부른다.
+			template<typename Callback>
+			void Query(const Float2& min, const Float2& max, Callback&& callback) const;
+			// fat AABB 가 겹치는 모든 leaf 쌍에 대해 callback(userDataA, userDataB) 를 한 번씩 부른다.
+			template<typename Callback>
+			void QueryPairs(Callback&& callback) const;
+			// treeA 의 leaf 와 treeB 의 leaf 중 fat AABB 가 겹치는 모든 쌍에 대해 callback(userDataA, userDataB) 를 부른다.
+			template<typename Callback>
+			static void QueryPairs(const DynamicAABBTree& treeA, const DynamicAABBTree& treeB, Callback&& callback);
+
+		public:
+			MINT_INLINE uint32 GetProxyCount() const noexcept { return _leafCount; }
+			MINT_INLINE uint32 GetRootIndex() const noexcept { return _rootIndex; }
+			MINT_INLINE const Node& GetNode(const uint32 nodeIndex) const noexcept { return _nodes[nodeIndex]; }
+			MINT_INLINE uint32 GetUserData(const uint32 proxyID) const noexcept { return _nodes[proxyID]._userData; }
+			MINT_INLINE float GetFatMargin() const noexcept { return _fatMargin; }
+			int32 GetHeight() const noexcept;
+			// 모든 내부 node 의 AABB 둘레의 합. 작을수록 질의가 빠르다.
+			float ComputeCost() const noexcept;
+			// 부모 자식 관계, 높이, AABB 가 맞는지 확인한다. (테스트용)
+			bool Validate() const noexcept;
+
+		private:
+			uint32 AllocateNode();
+			void FreeNode(const uint32 nodeIndex);
+			void InsertLeaf(const uint32 leafIndex);
+			void RemoveLeaf(const uint32 leafIndex);
+			uint32 Balance(const uint32 nodeIndex);
+			void Refit(uint32 nodeIndex);
+			uint32 BuildSAH(uint32* const leafIndices, const uint32 leafCount, const uint32 depth);
+			bool ValidateNode(const uint32 nodeIndex, const uint32 parentIndex) const noexcept;
+
+		private:
+			static MINT_INLINE bool Overlaps(const Node& a, const Node& b) noexcept;
+			static MINT_INLINE float ComputePerimeter(const Float2& min, const Float2& max) noexcept;
+
+		private:
+			Vector<Node> _nodes;
+			uint32 _rootIndex;
+			uint32 _freeNodeIndex;
+			uint32 _leafCount;
+			float _fatMargin;
+		};
+	}
+}
+
+
+#endif // !_MINT_PHYSICS_DYNAMIC_AABB_TREE_H_
@@ -0,0 +1,155 @@
+﻿#pragma once
+
+
+#include <MintPhysics/Include/DynamicAABBTree.h>
+
+#include <MintContainer/Include/Vector.hpp>
+#include <MintContainer/Include/InlineVector.hpp>
+
+
+namespace mint
+{
+	namespace Physics2D
+	{
+		template<typename Callback>
+		inline void DynamicAABBTree::Query(const Float2& min, const Float2& max, Callback&& callback) const
+		{
+			if (_rootIndex == kInvalidIndexUint32)
+			{
+				return;
+			}
+
+			InlineVector<uint32, 64> stack;
+			stack.PushBack(_rootIndex);
+			while (stack.IsEmpty() == false)
+			{
+				const Node& node = _nodes[stack.Back()];
+				stack.PopBack();
+				if (node._max._x < min._x || max._x < node._min._x || node._max._y < min._y || max._y < node._min._y)
+				{
+					continue;
+				}
+
+				if (node.IsLeaf() == true)
+				{
+					callback(node._userData);
+				}
+				else
+				{
+					stack.PushBack(node._childB);
+					stack.PushBack(node._childA);
+				}
+			}
+		}
+
+		template<typename Callback>
+		inline void DynamicAABBTree::QueryPairs(Callback&& callback) const
+		{
+			if (_rootIndex == kInvalidIndexUint32)
+			{
+				return;
+			}
+
+			// (a, a) 는 a 의 subtree 안의 쌍, (a, b) 는 a 의 subtree 와 b 의 subtree 사이의 쌍을 뜻한다.
+			// 이렇게 나누면 같은 쌍을 두 번 만나지 않는다.
+			struct NodePair
+			{
+				uint32 _a;
+				uint32 _b;
+			};
+			InlineVector<NodePair, 64> stack;
+			stack.PushBack(NodePair{ _rootIndex, _rootIndex });
+			while (stack.IsEmpty() == false)
+			{
+				const NodePair nodePair = stack.Back();
+				stack.PopBack();
+				const Node& nodeA = _nodes[nodePair._a];
+				if (nodePair._a == nodePair._b)
+				{
+					if (nodeA.IsLeaf() == false)
+					{
+						stack.PushBack(NodePair{ nodeA._childA, nodeA._childB });
+						stack.PushBack(NodePair{ nodeA._childB, nodeA._childB });
+						stack.PushBack(NodePair{ nodeA._childA, nodeA._childA });
+					}
+					continue;
+				}
+
+				const Node& nodeB = _nodes[nodePair._b];
+				if (Overlaps(nodeA, nodeB) == false)
+				{
+					continue;
+				}
+
+				if (nodeA.IsLeaf() == true && nodeB.IsLeaf() == true)
+				{
+					callback(nodeA._userData, nodeB._userData);
+				}
+				else if (nodeB.IsLeaf() == true || (nodeA.IsLeaf() == false && ComputePerimeter(nodeA._min, nodeA._max) >= ComputePerimeter(nodeB._min, nodeB._max)))
+				{
+					stack.PushBack(NodePair{ nodeA._childB, nodePair._b });
+					stack.PushBack(NodePair{ nodeA._childA, nodePair._b });
+				}
+				else
+				{
+					stack.PushBack(NodePair{ nodePair._a, nodeB._childB });
+					stack.PushBack(NodePair{ nodePair._a, nodeB._childA });
+				}
+			}
+		}
+
+		template<typename Callback>
+		inline void DynamicAABBTree::QueryPairs(const DynamicAABBTree& treeA, const DynamicAABBTree& treeB, Callback&& callback)
+		{
+			if (treeA._rootIndex == kInvalidIndexUint32 || treeB._rootIndex == kInvalidIndexUint32)
+			{
+				return;
+			}
+
+			struct NodePair
+			{
+				uint32 _a;
+				uint32 _b;
+			};
+			InlineVector<NodePair, 64> stack;
+			stack.PushBack(NodePair{ treeA._rootIndex, treeB._rootIndex });
+			while (stack.IsEmpty() == false)
+			{
+				const NodePair nodePair = stack.Back();
+				stack.PopBack();
+				const Node& nodeA = treeA._nodes[nodePair._a];
+				const Node& nodeB = treeB._nodes[nodePair._b];
+				if (Overlaps(nodeA, nodeB) == false)
+				{
+					continue;
+				}
+
+				// 더 큰 쪽을 내려간다.
+				if (nodeA.IsLeaf() == true && nodeB.IsLeaf() == true)
+				{
+					callback(nodeA._userData, nodeB._userData);
+				}
+				else if (nodeB.IsLeaf() == true || (nodeA.IsLeaf() == false && ComputePerimeter(nodeA._min, nodeA._max) >= ComputePerimeter(nodeB._min, nodeB._max)))
+				{
+					stack.PushBack(NodePair{ nodeA._childB, nodePair._b });
+					stack.PushBack(NodePair{ nodeA._childA, nodePair._b });
+				}
+				else
+				{
+					stack.PushBack(NodePair{ nodePair._a, nodeB._childB });
+					stack.PushBack(NodePair{ nodePair._a, nodeB._childA });
+				}
+			}
+		}
+
+		MINT_INLINE bool DynamicAABBTree::Overlaps(const Node& a, const Node& b) noexcept
+		{
+			return (a._max._x < b._min._x || b._max._x < a._min._x || a._max._y < b._min._y || b._max._y < a._min._y) == false;
+		}
+
+		MINT_INLINE float DynamicAABBTree::ComputePerimeter(const Float2& min, const Float2& max) noexcept
+		{
+			return 2.0f * ((max._x - min._x) + (max._y - min._y));
+		}
+	}
+}
@@ -25,6 +25,7 @@ namespace mint
 	{
 		class CollisionShape;
 		class AABBCollisionShape;
+		class TransformedCollisionShape;
 	}
 }
 
@@ -71,6 +72,12 @@ namespace mint
 		bool Intersect_AABB_Point(const Rect& aabb, const Float2& point);
 		bool Intersect_AABB_AABB(const AABBCollisionShape& shapeA, const AABBCollisionShape& shapeB);
 		bool Intersect_GJK(const CollisionShape& shapeA, const CollisionShape& shapeB, GJKInfo* const outGJKInfo = nullptr);
+		bool Intersect_GJK(const TransformedCollisionShape& shapeA, const TransformedCollisionShape& shapeB, GJKInfo* const outGJKInfo = nullptr);
+		// 떨어져 있는 두 shape 사이의 거리와, A 에서 B 를 향하는 단위 벡터 (witness normal) 를 구한다.
+		// outDistance 는 실제 거리보다 크지 않다. (conservative advancement 에 그대로 써도 안전하다.)
+		// 두 shape 이 겹치거나 닿아 있으면 false 를 반환한다.
+		bool ComputeDistance_GJK(const CollisionShape& shapeA, const CollisionShape& shapeB, Float2& outNormal, float& outDistance);
+		bool ComputeDistance_GJK(const TransformedCollisionShape& shapeA, const TransformedCollisionShape& shapeB, Float2& outNormal, float& outDistance);
 
 		Float2 ComputeEdgeNormal(const Float2& edgeVertex0, const Float2& edgeVertex1);
 		Float2 ComputeClosestPointOnEdge(const Float2& point, const Float2& edgeVertex0, const Float2& edgeVertex1);
@@ -79,8 +86,25 @@ namespace mint
 			uint32 _maxIterationCount = kUint32Max;
 			uint32 _iteration = 0;
 			Vector<Float2> _points;
+			Vector<Float2> _hullScratch;
 		};
+		// epaInfo 를 다시 쓰면 _points 와 _hullScratch 의 메모리를 다시 할당하지 않는다.
 		void ComputePenetration_EPA(const CollisionShape& shapeA, const CollisionShape& shapeB, const GJKInfo& gjkInfo, Float2& outNormal, float& outDistance, EPAInfo& epaInfo);
+		void ComputePenetration_EPA(const TransformedCollisionShape& shapeA, const TransformedCollisionShape& shapeB, const GJKInfo& gjkInfo, Float2& outNormal, float& outDistance, EPAInfo& epaInfo);
+
+		struct ContactPoint
+		{
+			// 두 shape 의 표면 사이의 가운데 점
+			Float2 _position;
+			// normal 방향으로 잰 두 표면 사이의 거리. 겹쳐 있으면 음수이다.
+			float _separation = 0.0f;
+			// 점을 만든 면과 꼭짓점의 번호로 만든 값. shape 이 조금 움직여도 같은 면과 꼭짓점에서 생긴 점이면 같은 값이다.
+			uint32 _featureID = 0;
+		};
+		// normal (A 에서 B 를 향하는 방향) 을 가장 잘 따르는 면 (reference face) 으로 상대 shape 의 면 (incident face) 을 잘라서 접촉점을 최대 2 개 구한다.
+		// outNormal 은 reference face 의 normal 이고 A 에서 B 를 향한다. separation 이 maxSeparation 보다 큰 점은 버린다.
+		// Point 나 Circle 이 있으면 normal 방향의 support point 로 접촉점을 하나만 구한다.
+		uint32 ComputeContactPoints_Clip(const TransformedCollisionShape& shapeA, const TransformedCollisionShape& shapeB, const Float2& normal, const float maxSeparation, Float2& outNormal, ContactPoint (&outContactPoints)[2]);
 	}
 }
 
@@ -1,4 +1,4 @@
-#pragma once
+﻿#pragma once
 
 
 #ifndef _MINT_PHYSICS_PHYSICS_COMMON_H_
@@ -6,6 +6,32 @@
 
 #include <MintContainer/Include/ID.h>
 
+#include <MintMath/Include/Float2.h>
+#include <MintMath/Include/Float2x2.h>
+#include <MintMath/Include/FixedPoint.h>
+
+
+// MINT_PHYSICS_DETERMINISTIC 을 정의하고 빌드하면 물체의 상태 (위치, 회전, 속도, 가속도, 질량) 와 그 적분, constraint 풀기를 Fixed64 로 계산한다.
+// 입력 (BodyCreationDesc, Step 의 deltaTime, 사이사이에 바꾼 속도) 이 같으면, 컴파일러와 CPU 가 달라도 매 step 의 상태가 bit 단위로 같다. (lockstep, replay 용)
+// 충돌 검출 (GJK, EPA, 접촉점 자르기) 과 CCD 의 충돌 시각은 float 로 계산하지만, libm 을 부르지 않고 IEEE 754 의 사칙연산과 sqrt 만 쓰므로 어디서나 같은 값이 나온다.
+// - 회전 행렬은 libm 의 sin, cos 대신 Fixed64 의 SinCos 로 만든다. (MakeRotationMatrix)
+// - 충돌 검출의 결과는 2^-16 격자에 맞춰 Real 로 바꿔서 solver 에 넘긴다. (QuantizeToReal)
+// 그러려면 float 연산을 IEEE 754 그대로 하도록 빌드해야 한다. 알 수 있는 것은 아래에서 #error 로 막는다.
+// - gcc, clang: -ffp-contract=off 로 빌드하고 -ffast-math 를 쓰지 않는다.
+// - MSVC: /fp:precise 나 /fp:strict 로 빌드한다. (/fp:fast, /fp:contract 는 안 된다.)
+// - x87 이 아닌 SSE2 나 ARM64 의 float 연산을 쓴다. (x86 32 bit 는 /arch:SSE2, -msse2 -mfpmath=sse)
+// 그리기는 float 로 바꾼 값을 쓴다.
+//#define MINT_PHYSICS_DETERMINISTIC
+
+#if defined MINT_PHYSICS_DETERMINISTIC
+#if defined __FAST_MATH__ || defined _M_FP_FAST || defined _M_FP_CONTRACT
+#error "MINT_PHYSICS_DETERMINISTIC 은 float 연산 결과를 바꾸는 -ffast-math, /fp:fast, /fp:contract 와 함께 쓸 수 없습니다!"
+#endif
+#if (defined __FLT_EVAL_METHOD__ && __FLT_EVAL_METHOD__ != 0) || (defined _M_IX86_FP && _M_IX86_FP < 2)
+#error "MINT_PHYSICS_DETERMINISTIC 은 x87 float 연산과 함께 쓸 수 없습니다!"
+#endif
+#endif
+
 namespace mint
 {
 	namespace Physics2D
@@ -33,6 +59,52 @@ namespace mint
 	{
 		using namespace PhysicsCommon;
 
+#if defined MINT_PHYSICS_DETERMINISTIC
+		using Real = Fixed64;
+		using Real2 = Fixed64Vec2;
+
+		MINT_INLINE Real ToReal(const float value) { return Real(value); }
+		MINT_INLINE Real2 ToReal2(const Float2& value) { return Real2(value); }
+		MINT_INLINE float ToFloat(const Real& value) { return value.ToFloat(); }
+		MINT_INLINE Float2 ToFloat2(const Real2& value) { return value.ToFloat2(); }
+
+		static constexpr Real kRealMax = Real::FromRaw(Real::kMaxRaw);
+
+		MINT_INLINE Real SqrtReal(const Real& value) { return Math::Sqrt(value); }
+		// float 로 계산한 충돌 검출의 결과를 solver 에 넘길 때 쓴다. 2^-16 격자에 맞춰 반올림한다.
+		MINT_INLINE Real QuantizeToReal(const float value)
+		{
+			static constexpr int64 kGridRaw = static_cast<int64>(1) << (Real::kFractionBitCount - 16);
+			return Real::FromRaw((Real(value).GetRaw() + kGridRaw / 2) & ~(kGridRaw - 1));
+		}
+		MINT_INLINE Real2 QuantizeToReal2(const Float2& value) { return Real2(QuantizeToReal(value._x), QuantizeToReal(value._y)); }
+		// libm 의 sin, cos 는 구현마다 결과가 다르므로 Fixed64 의 SinCos 로 만든다.
+		MINT_INLINE Float2x2 MakeRotationMatrix(const float rotation)
+		{
+			Real sinRotation;
+			Real cosRotation;
+			Math::SinCos(Real(rotation), sinRotation, cosRotation);
+			const float sinTheta = sinRotation.ToFloat();
+			const float cosTheta = cosRotation.ToFloat();
+			return Float2x2(cosTheta, -sinTheta, sinTheta, cosTheta);
+		}
+#else
+		using Real = float;
+		using Real2 = Float2;
+
+		MINT_INLINE Real ToReal(const float value) { return value; }
+		MINT_INLINE const Real2& ToReal2(const Float2& value) { return value; }
+		MINT_INLINE float ToFloat(const Real value) { return value; }
+		MINT_INLINE const Float2& ToFloat2(const Real2& value) { return value; }
+
+		static constexpr Real kRealMax = Math::kFloatMax;
+
+		MINT_INLINE Real SqrtReal(const Real value) { return ::sqrtf(value); }
+		MINT_INLINE Real QuantizeToReal(const float value) { return value; }
+		MINT_INLINE const Real2& QuantizeToReal2(const Float2& value) { return value; }
+		MINT_INLINE Float2x2 MakeRotationMatrix(const float rotation) { return Float2x2::RotationMatrix(rotation); }
+#endif
+
 		class BodyID : public ID32
 		{
 			friend World;
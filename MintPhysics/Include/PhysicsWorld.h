@@ -1,4 +1,4 @@
-#pragma once
+﻿#pragma once
 
 
 #ifndef _MINT_PHYSICS_PHYSICS_WORLD_H_
@@ -14,17 +14,15 @@
 #include <MintMath/Include/Transform.h>
 #include <MintPhysics/Include/PhysicsCommon.h>
 #include <MintPhysics/Include/CollisionShape.h>
+#include <MintPhysics/Include/Intersection.h>
+#include <MintPhysics/Include/ConstraintSolver.h>
 #include <MintPhysics/Include/PhysicsObjectPool.h>
+#include <MintPhysics/Include/DynamicAABBTree.h>
+#include <MintPhysics/Include/SweepAndPrune.h>
+#include <MintPhysics/Include/SpatialHashGrid.h>
+#include <MintPhysics/Include/ThreadPool.h>
 
 
-namespace mint
-{
-	namespace Physics2D
-	{
-		struct GJKInfo;
-	}
-}
-
 namespace mint
 {
 	namespace Physics2D
@@ -32,9 +30,10 @@ namespace mint
 		struct BodyShape
 		{
 			SharedPtr<CollisionShape> _collisionShape;
-			SharedPtr<AABBCollisionShape> _shapeAABB;
 		};
 
+		// Step 마다 바뀌지 않는 body 의 정보.
+		// 위치, 속도, 질량, AABB 처럼 Step 이 body 마다 읽고 쓰는 값은 World 의 BodyStore 에 있고, World::GetTranslation 등으로 읽고 쓴다.
 		class Body
 		{
 		public:
@@ -44,22 +43,50 @@ namespace mint
 		public:
 			bool IsValid() const;
 			void Invalidate() { _bodyID.Invalidate(); }
+			// Static 이 아니고 잠들지 않은 body. Step 은 이런 body 만 적분하고 broad phase 에서 옮긴다.
+			bool IsAwake() const { return _bodyMotionType != BodyMotionType::Static && _isSleeping == false; }
 
 		public:
 			BodyID _bodyID;
 			BodyShape _shape;
-			SharedPtr<AABBCollisionShape> _bodyAABB;
-			Transform2D _transform2D;
+			// shape 에 적용하는 크기. 위치와 회전은 BodyStore 에 있다.
+			Float2 _scale = Float2::kOne;
 
 			BodyMotionType _bodyMotionType;
+			float _friction = 0.6f;
+
+			// 잠든 body 는 broad phase 에서 static 처럼 다루고 적분하지 않는다. 같은 island 의 body 들은 함께 잠들고 함께 깨어난다.
+			bool _isSleeping = false;
+			// false 이면 이 body 가 속한 island 는 잠들지 않는다.
+			bool _canSleep = true;
+			// 속도가 SleepSettings 의 기준보다 작게 유지된 시간
+			float _sleepTime = 0.0f;
+		};
 
-			// TODO
-			float _inverseMass = 1.0f;
-			Float2 _linearVelocity;
-			Float2 _linearAcceleration;
-			float _linearDamping = 0.0f;
-			float _angularVelocity;
-			float _angularAcceleration;
+		// Step 이 body 마다 읽고 쓰는 값. body 의 slot index (BodyID 의 값) 로 찾는다.
+		// 값마다 배열을 따로 두어 (structure of arrays), 적분과 AABB 갱신은 필요한 값만 이어진 메모리에서 읽는다.
+		struct BodyStore
+		{
+			void Resize(const uint32 bodyCount);
+
+			Vector<Real2> _translations;
+			Vector<Real> _rotations;
+			Vector<Real2> _linearVelocities;
+			Vector<Real> _angularVelocities;
+			// 다음 Step 에서 한 번만 속도에 더한다. (gravity 는 따로 더한다.)
+			Vector<Real2> _linearAccelerations;
+			Vector<Real> _angularAccelerations;
+			// static body 는 0 이다.
+			Vector<Real> _inverseMasses;
+			// 0 이면 충돌해도 회전하지 않는다.
+			Vector<Real> _inverseInertias;
+			Vector<Real> _linearDampings;
+			// shape 의 AABB (body 공간)
+			Vector<Float2> _shapeAABBCenters;
+			Vector<Float2> _shapeAABBHalfSizes;
+			// body 의 AABB (world 공간). 깨어 있는 dynamic body 는 이번 step 에 움직일 만큼 늘린 것이다.
+			Vector<Float2> _aabbMins;
+			Vector<Float2> _aabbMaxs;
 		};
 
 		struct BodyCreationDesc
@@ -68,12 +95,32 @@ namespace mint
 			Transform2D _transform2D;
 			BodyMotionType _bodyMotionType = BodyMotionType::Static;
 			float _inverseMass = 1.0f;
+			// 0 이면 충돌해도 회전하지 않는다. (질량 m, 크기 w x h 인 상자는 12 / (m * (w^2 + h^2)))
+			float _inverseInertia = 0.0f;
+			// 두 body 의 마찰 계수는 sqrt(frictionA * frictionB) 로 섞는다.
+			float _friction = 0.6f;
+			// dynamic body 의 선속도에 step 마다 (1 - _linearDamping) 를 곱한다.
+			float _linearDamping = 0.0f;
+			bool _canSleep = true;
+		};
+
+		// island (접촉이나 joint 로 이어진, static 이 아닌 body 들) 는 모든 body 가 느린 채로 _timeToSleep 초가 지나면 통째로 잠든다.
+		// 깨어 있는 body 가 닿거나 World::WakeBody, World::AccessBody 로 건드리면 island 전체가 깨어난다.
+		struct SleepSettings
+		{
+			bool _isEnabled = true;
+			float _linearSpeed = 0.05f;
+			// radian / 초
+			float _angularSpeed = 0.05f;
+			float _timeToSleep = 0.5f;
 		};
 
-		struct CollisionSector
+		// broad phase 에서 겹칠 수 있는 물체 쌍을 찾는 방법
+		enum class BroadPhaseType : uint8
 		{
-			uint32 _index = kInvalidIndexUint32;
-			Vector<BodyID> _bodyIDs;
+			SpatialHashGrid,	// AABB 크기에 맞는 level 의 hash 격자에 넣고 이웃 칸끼리 비교한다. 월드 크기에 제한이 없다.
+			AABBTree,			// 정적 물체와 움직이는 물체를 각각 DynamicAABBTree 에 넣고 트리끼리 질의한다.
+			SweepAndPrune,		// 분산이 큰 축을 따라 정렬해 두고 훑는다. 한 방향으로 긴 월드에 알맞다.
 		};
 
 		struct BroadPhaseBodyPair
@@ -88,26 +135,32 @@ namespace mint
 			BodyID _bodyIDB;
 		};
 
+		// 두 body 가 닿는 점을 최대 2 개 가진다. body 쌍마다 하나씩 있고, 쌍이 계속 닿아 있는 동안 step 이 바뀌어도 이어진다.
 		struct CollisionManifold
 		{
-			struct AbsoluteDistanceComparator
+			struct Point
 			{
-				bool operator()(const CollisionManifold& lhs, const CollisionManifold& rhs) const
-				{
-					return ::abs(lhs._signedDistance) < ::abs(rhs._signedDistance);
-				}
+				ContactPoint _contactPoint;
+				// 이 점에 누적한 impulse. 다음 step 에 feature ID 가 같은 점이 있으면 이어받아 solver 의 warm starting 에 쓴다.
+				Real _normalImpulse = Real(0);
+				Real _tangentImpulse = Real(0);
 			};
+			static constexpr const uint32 kMaxPointCount = 2;
+
 			using Key = uint64;
 			Key GetKey() const
 			{
 				return (static_cast<Key>(_bodyIDA.Value()) << 32) | _bodyIDB.Value();
 			}
-			bool IsValid() const { return _collisionNormal != Float2::kZero; }
+			bool IsValid() const { return _pointCount > 0; }
+			// previous 에서 feature ID 가 같은 점의 impulse 를 이어받는다.
+			void InheritImpulses(const CollisionManifold& previous);
 			BodyID _bodyIDA;
 			BodyID _bodyIDB;
-			Float2 _collisionPosition;
+			// A 에서 B 를 향한다.
 			Float2 _collisionNormal = Float2::kZero;
-			float _signedDistance = 0.0f;
+			Point _points[kMaxPointCount];
+			uint32 _pointCount = 0;
 		};
 
 		struct StepSnapshot
@@ -116,10 +169,14 @@ namespace mint
 			struct BodySnapshot
 			{
 				Body _body;
-				Vector<CollisionManifold> _collisionManifolds;
+				Real2 _translation;
+				Real _rotation;
+				Real2 _linearVelocity;
+				Real _angularVelocity;
 			};
 			uint64 _stepIndex = 0;
 			Vector<BodySnapshot> _bodySnapshots;
+			Vector<CollisionManifold> _collisionManifolds;
 		};
 
 		struct WorldHistory
@@ -146,16 +203,63 @@ namespace mint
 
 		public:
 			BodyID CreateBody(const BodyCreationDesc& bodyCreationDesc);
+			// 고칠 body 를 얻는다. 잠든 body 는 island 와 함께 깨우고, static body 는 다음 Step 에서 AABB 를 다시 맞춘다.
 			Body& AccessBody(BodyID bodyID);
 			const Body& GetBody(BodyID bodyID) const;
 
+		public:
+			const Real2& GetTranslation(BodyID bodyID) const;
+			Real GetRotation(BodyID bodyID) const;
+			// 충돌 검출과 그리기에 쓰는 float transform
+			Transform2D GetTransform(BodyID bodyID) const;
+			const Real2& GetLinearVelocity(BodyID bodyID) const;
+			Real GetAngularVelocity(BodyID bodyID) const;
+			// 아래 함수들은 AccessBody 처럼 body 를 깨운다.
+			void SetTranslation(BodyID bodyID, const Real2& translation);
+			void SetRotation(BodyID bodyID, const Real rotation);
+			void SetLinearVelocity(BodyID bodyID, const Real2& linearVelocity);
+			void SetAngularVelocity(BodyID bodyID, const Real angularVelocity);
+			// 다음 Step 에서 한 번만 더한다.
+			void AddLinearAcceleration(BodyID bodyID, const Real2& linearAcceleration);
+			void AddAngularAcceleration(BodyID bodyID, const Real angularAcceleration);
+
 		public:
 			void Step(float deltaTime);
 			uint64 GetTotalStepCount() const { return _totalStepCount; }
 			uint64 GetCurrentStepIndex() const;
 		
 		public:
-			const Float2& GetGravity() const { return _gravity; }
+			const Real2& GetGravity() const { return _gravity; }
+
+		public:
+			// 다음 Step 부터 적용된다. 어느 방법이든 찾는 쌍은 같다.
+			void SetBroadPhaseType(const BroadPhaseType broadPhaseType);
+			BroadPhaseType GetBroadPhaseType() const { return _broadPhaseType; }
+			// BroadPhaseType::AABBTree 일 때 트리를 SAH 로 새로 만든다. 물체를 한꺼번에 많이 만들거나 크게 움직인 뒤에 부르면 질의가 빨라진다.
+			void OptimizeBroadPhase();
+			const HashMap<BroadPhaseBodyPair::Key, BroadPhaseBodyPair>& GetBroadPhaseBodyPairs() const { return _broadPhaseBodyPairs; }
+			const HashMap<CollisionManifold::Key, CollisionManifold>& GetCollisionManifoldMap() const { return _collisionManifoldMap; }
+
+		public:
+			// Step 을 나눠 실행할 thread 수 (부르는 thread 포함). thread 수와 상관없이 Step 의 결과는 같다.
+			// - 나눠 실행하는 것: 물체마다의 AABB 갱신과 적분, broad phase 의 쌍 찾기 (AABBTree 제외), 쌍마다의 narrow phase
+			// - 한 thread 에서 하는 것: 접촉과 joint 의 constraint 풀기 (ConstraintSolver 가 SIMD 로 푼다)
+			void SetThreadCount(const uint32 threadCount);
+			uint32 GetThreadCount() const { return _threadPool.GetThreadCount(); }
+
+		public:
+			// Step 마다 접촉과 joint 의 속도 constraint 를 푸는 횟수. 클수록 쌓인 물체가 덜 흔들리지만 느리다.
+			void SetSolverIterationCount(const uint32 solverIterationCount) { _solverIterationCount = solverIterationCount; }
+			uint32 GetSolverIterationCount() const { return _solverIterationCount; }
+			// 다음 Step 부터 매 step 두 body 의 거리를 유지한다. 두 body 는 깨운다.
+			void AddParticleDistanceConstraint(const ParticleDistanceConstraint& particleDistanceConstraint);
+
+		public:
+			// _isEnabled 를 끄면 잠든 body 를 모두 깨운다.
+			void SetSleepSettings(const SleepSettings& sleepSettings);
+			const SleepSettings& GetSleepSettings() const { return _sleepSettings; }
+			void WakeBody(BodyID bodyID);
+			uint32 GetAwakeBodyCount() const { return _awakeBodySlotIndices.Size(); }
 
 		public:
 			void RenderDebug(Rendering::ShapeRenderer& shapeRenderer) const;
@@ -171,47 +275,138 @@ namespace mint
 		private:
 			void StepCollide(float deltaTime);
 			void StepCollide_BroadPhase(float deltaTime);
+			void StepCollide_BroadPhase_UpdateProxies();
+			void StepCollide_BroadPhase_UpdateProxy(const uint32 bodySlotIndex);
+			void StepCollide_BroadPhase_SpatialHashGrid();
+			void StepCollide_BroadPhase_AABBTree();
+			void StepCollide_BroadPhase_SweepAndPrune();
+			// queryFunction(itemIndexBegin, itemIndexEnd, addBodyPair) 를 작업마다 부른다.
+			template<typename QueryFunction>
+			void StepCollide_BroadPhase_QueryInParallel(const uint32 itemCount, QueryFunction&& queryFunction);
+			void AddBroadPhaseBodyPair(const Body& bodyA, const Body& bodyB);
+			bool MakeBroadPhaseBodyPair(const Body& bodyA, const Body& bodyB, BroadPhaseBodyPair& outBodyPair) const;
+			void InsertBroadPhaseBodyPair(const BroadPhaseBodyPair& bodyPair);
 			void StepCollide_NarrowPhase(float deltaTime);
-			bool StepCollide_NarrowPhase_CCD(float deltaTime, const Body& bodyA, const Body& bodyB, Physics2D::GJKInfo& gjkInfo, SharedPtr<CollisionShape>& outShapeA, SharedPtr<CollisionShape>& outShapeB);
-			void StepCollide_NarrowPhase_GenerateCollision(const Body& bodyA, const CollisionShape& bodyShapeA, const Body& bodyB, const CollisionShape& bodyShapeB, const Physics2D::GJKInfo& gjkInfo, CollisionManifold& outCollisionManifold) const;
+			// 깨어난 island 의 manifold 를 _sleepingCollisionManifoldMap 에서 되돌린다.
+			void StepCollide_NarrowPhase_RestoreWokenCollisionManifolds();
+			// gjkInfo 와 epaInfo 는 여러 쌍에 다시 써서 쌍마다 heap 할당을 하지 않는다.
+			bool StepCollide_NarrowPhase_BodyPair(float deltaTime, const BroadPhaseBodyPair& bodyPair, Physics2D::GJKInfo& gjkInfo, Physics2D::EPAInfo& epaInfo, CollisionManifold& outCollisionManifold) const;
+			// Conservative advancement 로 이번 step 안에서 두 body 가 처음 kTimeOfImpactTargetDistance 안으로 가까워지는 시간 (time of impact) 을 찾는다.
+			// 찾으면 outShapeA, outShapeB 는 그 시간으로 옮긴 body 의 shape 이다.
+			// outDistance 가 0 이면 두 shape 이 이미 겹쳐 있고, 아니면 outNormal 은 A 에서 B 를 향하는 witness normal 이다.
+			bool StepCollide_NarrowPhase_CCD(float deltaTime, const Body& bodyA, const Body& bodyB, TransformedCollisionShape& outShapeA, TransformedCollisionShape& outShapeB, float& outTimeOfImpact, Float2& outNormal, float& outDistance) const;
+			void StepCollide_NarrowPhase_GenerateCollision(const Body& bodyA, const TransformedCollisionShape& bodyShapeA, const Body& bodyB, const TransformedCollisionShape& bodyShapeB, const Physics2D::GJKInfo& gjkInfo, Physics2D::EPAInfo& epaInfo, CollisionManifold& outCollisionManifold) const;
+			// normal 은 A 에서 B 를 향한다.
+			void StepCollide_NarrowPhase_GenerateCollision(const Body& bodyA, const TransformedCollisionShape& bodyShapeA, const Body& bodyB, const TransformedCollisionShape& bodyShapeB, const Float2& normal, CollisionManifold& outCollisionManifold) const;
 			void StepSolve(float deltaTime);
-			void StepSolveResolveCollisions(float deltaTime);
+			void StepSolveIntegrateVelocities(float deltaTime);
+			// 접촉과 joint 를 ConstraintSolver 의 row 로 바꿔서 풀고, 누적 impulse 는 다음 step 의 warm starting 을 위해 되돌려 둔다.
 			void StepSolveSolveConstraints(float deltaTime);
-			void StepSolveIntegrate(float deltaTime);
-			void StepSolveAssignCollisionSectors();
+			uint32 AddSolverBody(const Body& body);
+			void StepSolveIntegratePositions(float deltaTime);
+			// shape 의 AABB 를 body 의 transform 으로 옮긴 AABB 를 _bodyStore 에 넣는다. displacement 만큼 움직이는 동안을 덮도록 늘린다.
+			void UpdateBodyAABB(const uint32 bodySlotIndex, const Float2& displacement);
+			// 접촉과 joint 로 island 를 찾고 (union-find), 오래 느렸던 island 를 잠재운다.
+			void StepUpdateIslands(float deltaTime);
+			uint32 FindIslandRoot(uint32 bodySlotIndex);
+			void WakeIsland(const uint32 bodySlotIndex);
+			// 모든 body 를 깨우고 잠에 관한 상태를 처음부터 다시 만든다.
+			void WakeAllBodies();
 			void StepRecordSnapshot();
 
 		private:
-			void ComputeCollisionSectorIndices(const Physics2D::AABBCollisionShape& aabb, const Float2& worldMin, const Float2& collisionSectorSize, Vector<uint32>& outIndices) const;
-			uint32 ComputeCollisionSectorIndex(const Physics2D::AABBCollisionShape& aabb, const Float2& worldMin, const Float2& collisionSectorSize) const;
-			uint32 ComputeCollisionSectorIndex(const Int2& collisionSectorIndex2) const;
-			CollisionSector* GetCollisionSector(const Int2& collisionSectorIndex2);
-			void GetAdjacentCollisionSectors(const CollisionSector& collisionSector, CollisionSector* (outAdjacentCollisionSectors)[8]);
+			// StepSolveIntegrateVelocities, StepSolveIntegratePositions 와 같이 gravity 까지 더해서 deltaTime 뒤의 transform 을 예측한다.
 			Transform2D PredictBodyTransform(const Body& body, float deltaTime) const;
+			Float2 PredictBodyLinearAcceleration(const Body& body) const;
 			Transform2D PredictTransform(const Transform2D& transform2D, const Float2& linearVelocity, const Float2& linearAcceleration, float angularVelocity, float angularAcceleration, float deltaTime) const;
 
 		private:
-			void RenderDebugBody(Rendering::ShapeRenderer& shapeRenderer, const Body& body) const;
+			static uint32 ComputeStepTaskCount(const uint32 itemCount) { return (itemCount + kStepTaskItemCount - 1) / kStepTaskItemCount; }
+
+		private:
+			void RenderDebugBody(Rendering::ShapeRenderer& shapeRenderer, const Body& body, const Transform2D& transform2D) const;
 			void RenderDebugCollisionManifold(Rendering::ShapeRenderer& shapeRenderer, const CollisionManifold& collisionManifold) const;
 
 		public:
 			PhysicsObjectPool<Body> _bodyPool;
 
 		private:
-			Float2 _gravity;
-			Float2 _worldMin;
-			Float2 _worldMax;
-			Float2 _worldSize;
-			Float2 _worldSizePreStepSolve;
+			// _bodyPool 과 같은 크기를 유지한다.
+			BodyStore _bodyStore;
+
+		private:
+			Real2 _gravity;
 			uint64 _totalStepCount;
 
 		private:
-			static constexpr const uint32 kCollisionSectorTessellationPerSide = 2; // 4 = 2 * 2
-			uint32 _collisionSectorDepth = 1;
-			uint32 _collisionSectorSideCount = kCollisionSectorTessellationPerSide;
-			Vector<CollisionSector> _collisionSectors;
 			HashMap<BroadPhaseBodyPair::Key, BroadPhaseBodyPair> _broadPhaseBodyPairs;
-			HashMap<BodyID::RawType, Vector<CollisionManifold>> _collisionManifoldMap;
+
+		private:
+			BroadPhaseType _broadPhaseType = BroadPhaseType::SpatialHashGrid;
+			// body 의 slot index 로 찾는다. _proxyID 는 _broadPhaseType 의 구조 안의 ID 이다.
+			struct BroadPhaseProxy
+			{
+				uint32 _proxyID = kInvalidIndexUint32;
+				bool _isStatic = false;
+			};
+			Vector<BroadPhaseProxy> _broadPhaseProxies;
+			DynamicAABBTree _staticBodyTree;
+			DynamicAABBTree _movingBodyTree;
+			SweepAndPrune _sweepAndPrune;
+			// level 0 의 칸 크기. 큰 물체는 알아서 위 level 로 간다.
+			static constexpr const float kSpatialHashGridBaseCellSize = 1.0f;
+			SpatialHashGrid _spatialHashGrid;
+			// body 쌍의 key 로 찾는다. 닿아 있는 쌍의 manifold 는 그 자리에서 고치고, 떨어진 쌍의 manifold 만 지운다.
+			HashMap<CollisionManifold::Key, CollisionManifold> _collisionManifoldMap;
+			Vector<CollisionManifold::Key> _staleCollisionManifoldKeys;
+			// 깨어 있는 body 가 없는 쌍의 manifold. island 가 깨어나면 impulse 와 함께 _collisionManifoldMap 으로 되돌린다.
+			HashMap<CollisionManifold::Key, CollisionManifold> _sleepingCollisionManifoldMap;
+			// CCD 는 두 body 가 이만큼 가까워진 시간을 충돌 시간으로 본다.
+			static constexpr const float kTimeOfImpactTargetDistance = 0.25f;
+			// 이보다 멀리 떨어진 접촉점은 manifold 에 넣지 않는다. CCD 가 찾은 시간의 접촉점을 버리지 않도록 kTimeOfImpactTargetDistance 보다 넉넉하게 잡는다.
+			static constexpr const float kMaxContactSeparation = kTimeOfImpactTargetDistance * 2.0f;
+			static constexpr const uint32 kMaxTimeOfImpactIterationCount = 20;
+
+		private:
+			ConstraintSolver _constraintSolver;
+			uint32 _solverIterationCount = 8;
+			// body 의 slot index 로 찾는 ConstraintSolver 의 body 번호
+			Vector<uint32> _solverBodyIndices;
+			// ConstraintSolver 에 넣은 body 의 slot index
+			Vector<uint32> _solverBodySlotIndices;
+			// _collisionManifoldMap 의 순회 순서대로, 점마다 normal row 와 마찰 row
+			Vector<uint32> _contactRowIndices;
+			Vector<ParticleDistanceConstraint> _particleDistanceConstraints;
+			Vector<uint32> _particleDistanceConstraintRowIndices;
+			// 겹친 깊이를 속도로 되돌리는 비율 (Baumgarte stabilization)
+			static constexpr const float kBaumgarteFactor = 0.2f;
+			// 이만큼은 겹쳐 있어도 밀어내지 않는다. 접촉이 끊겼다 이어졌다 하며 떨리지 않게 한다.
+			static constexpr const float kLinearSlop = 0.005f;
+			static constexpr const float kMaxPushOutSpeed = 3.0f;
+
+		private:
+			SleepSettings _sleepSettings;
+			// 깨어 있는 body 의 slot index. Step 의 body 마다의 일은 이 body 들만 한다.
+			Vector<uint32> _awakeBodySlotIndices;
+			// 다음 broad phase 에서 AABB 와 proxy 를 다시 맞출 body 의 slot index (새로 만들었거나, 잠들거나 깨어났거나, AccessBody 로 건드린 body)
+			Vector<uint32> _touchedBodySlotIndices;
+			// 잠든 island 의 body 들을 원형으로 잇는다. 하나를 깨우면 이것을 따라 island 전체를 깨운다.
+			Vector<uint32> _sleepingIslandNextSlotIndices;
+			// 아래는 body 의 slot index 로 찾고, 깨어 있는 body 의 칸만 쓴다.
+			Vector<uint32> _islandParentSlotIndices;
+			// root 의 칸에 island 에서 가장 짧은 _sleepTime 을 모은다.
+			Vector<float> _islandSleepTimes;
+			Vector<uint32> _islandHeadSlotIndices;
+			bool _hasWokenIsland = false;
+
+		private:
+			// 작업 하나가 맡는 물체 또는 쌍의 수. thread 수와 상관없이 작업을 똑같이 나눠야 결과를 같은 순서로 합칠 수 있다.
+			static constexpr const uint32 kStepTaskItemCount = 128;
+			ThreadPool _threadPool;
+			// 작업 번호별 결과. 작업 번호 순서대로 합친다.
+			Vector<Vector<BroadPhaseBodyPair>> _broadPhaseTaskBodyPairs;
+			Vector<BroadPhaseBodyPair> _narrowPhaseBodyPairs;
+			Vector<Vector<CollisionManifold>> _narrowPhaseTaskCollisionManifolds;
 
 		private:
 			static constexpr const uint32 kWorldHistoryCapacity = 128;
@@ -0,0 +1,124 @@
+﻿#pragma once
+
+
+#ifndef _MINT_PHYSICS_SPATIAL_HASH_GRID_H_
+#define _MINT_PHYSICS_SPATIAL_HASH_GRID_H_
+
+
+#include <MintCommon/Include/CommonDefinitions.h>
+
+#include <MintContainer/Include/Vector.h>
+#include <MintContainer/Include/InlineVector.h>
+#include <MintContainer/Include/HashMap.h>
+
+#include <MintMath/Include/Float2.h>
+
+
+namespace mint
+{
+	namespace Physics2D
+	{
+		// 크기가 다른 격자 여러 층 (level) 으로 겹치는 AABB 쌍을 찾는다.
+		// - level 의 칸 크기는 baseCellSize * 2^level 이고, AABB 는 가장 긴 변이 칸 크기를 넘지 않는 가장 작은 level 에 들어간다.
+		// - AABB 는 min 이 들어 있는 칸 하나에만 넣는다. 그래서 같은 level 에서는 주변 8 칸 중 절반 (4 칸) 만 보면 모든 쌍을 한 번씩 만난다.
+		// - 서로 다른 level 의 쌍은 작은 쪽에서 큰 level 의 칸들을 찾아서 만난다.
+		// - 칸은 비어 있지 않을 때만 있으므로 월드 크기에 제한이 없고, 메모리는 물체가 있는 공간에만 비례한다.
+		//   칸은 level 마다 Vector 에 빈틈없이 모아 두고, hash map 으로는 칸 좌표에서 칸 번호를 찾는다.
+		// - static 끼리의 쌍은 찾지 않는다. static 이 아닌 proxy 가 없는 칸끼리는 비교하지 않으므로, static 이 대부분이면 찾는 시간이 움직이는 proxy 의 수에 가까워진다.
+		class SpatialHashGrid final
+		{
+		public:
+			SpatialHashGrid();
+			explicit SpatialHashGrid(const float baseCellSize);
+			~SpatialHashGrid() = default;
+
+		public:
+			// 반환하는 proxy ID 는 DestroyProxy 전까지 바뀌지 않는다.
+			uint32 CreateProxy(const Float2& min, const Float2& max, const uint32 userData, const bool isStatic);
+			void DestroyProxy(const uint32 proxyID);
+			// 칸이나 level 이 바뀔 때만 칸을 옮긴다.
+			void MoveProxy(const uint32 proxyID, const Float2& min, const Float2& max);
+			// 칸은 그대로 두고 static 인지와 칸, level 의 static 이 아닌 proxy 수만 바꾼다.
+			void SetProxyStatic(const uint32 proxyID, const bool isStatic);
+			void Clear();
+
+		public:
+			// 겹치는 모든 쌍에 대해 callback(userDataA, userDataB) 를 한 번씩 부른다. (경계가 닿기만 해도 겹친다.)
+			template<typename Callback>
+			void QueryPairs(Callback&& callback) const;
+			// 칸을 level 순서, level 안에서는 저장된 순서로 센 번호가 [cellIndexBegin, cellIndexEnd) 인 칸에서 시작하는 쌍만 찾는다.
+			// 범위를 나눠 여러 thread 에서 부를 수 있고, 범위를 순서대로 이어 붙이면 QueryPairs(callback) 와 같은 순서로 쌍을 찾는다.
+			template<typename Callback>
+			void QueryPairs(const uint32 cellIndexBegin, const uint32 cellIndexEnd, Callback&& callback) const;
+
+		public:
+			MINT_INLINE uint32 GetProxyCount() const noexcept { return _proxyCount; }
+			MINT_INLINE float GetBaseCellSize() const noexcept { return _baseCellSize; }
+			MINT_INLINE uint32 GetLevelCount() const noexcept { return _levels.Size(); }
+			// 비어 있지 않은 칸의 개수
+			uint32 GetCellCount() const noexcept;
+			// 모든 proxy 가 자기 level 과 칸에 한 번씩만 들어 있는지 확인한다. (테스트용)
+			bool Validate() const noexcept;
+
+		private:
+			struct Proxy
+			{
+				Float2 _min;
+				Float2 _max;
+				uint32 _userData = kInvalidIndexUint32;
+				// 비어 있는 proxy 는 kInvalidIndexUint32
+				uint32 _level = kInvalidIndexUint32;
+				int32 _cellX = 0;
+				int32 _cellY = 0;
+				bool _isStatic = false;
+			};
+
+			struct Cell
+			{
+				int32 _x = 0;
+				int32 _y = 0;
+				InlineVector<uint32, 4> _proxyIDs;
+				// static 이 아닌 proxy 의 수
+				uint32 _movingProxyCount = 0;
+			};
+
+			struct Level
+			{
+				float _cellSize = 0.0f;
+				float _inverseCellSize = 0.0f;
+				uint32 _proxyCount = 0;
+				uint32 _movingProxyCount = 0;
+				Vector<Cell> _cells;
+				// 칸 좌표의 key 로 _cells 의 index 를 찾는다.
+				HashMap<uint64, uint32> _cellIndices;
+			};
+
+		private:
+			uint32 ComputeLevel(const Float2& min, const Float2& max) const noexcept;
+			void AddToCell(const uint32 proxyID);
+			void RemoveFromCell(const uint32 proxyID);
+
+		private:
+			// 좌표가 아무리 커도 이웃 칸의 좌표 (+-1) 가 넘치지 않도록 제한한다.
+			static MINT_INLINE int32 ComputeCellCoordinate(const float value, const float inverseCellSize) noexcept;
+			static MINT_INLINE uint64 ComputeCellKey(const int32 x, const int32 y) noexcept;
+			static MINT_INLINE const Cell* FindCell(const Level& level, const int32 x, const int32 y) noexcept;
+			template<typename Callback>
+			MINT_INLINE void TestPair(const uint32 proxyIDA, const uint32 proxyIDB, Callback& callback) const;
+
+		private:
+			static constexpr uint32 kMaxLevelCount = 32;
+			static constexpr int32 kMaxCellCoordinate = 1 << 30;
+
+		private:
+			Vector<Proxy> _proxies;
+			Vector<uint32> _freeProxyIDs;
+			Vector<Level> _levels;
+			uint32 _proxyCount;
+			float _baseCellSize;
+		};
+	}
+}
+
+
+#endif // !_MINT_PHYSICS_SPATIAL_HASH_GRID_H_
@@ -0,0 +1,154 @@
+﻿#pragma once
+
+
+#include <MintPhysics/Include/SpatialHashGrid.h>
+
+#include <MintContainer/Include/Vector.hpp>
+#include <MintContainer/Include/InlineVector.hpp>
+#include <MintContainer/Include/HashMap.hpp>
+
+#include <cmath>
+
+
+namespace mint
+{
+	namespace Physics2D
+	{
+		template<typename Callback>
+		inline void SpatialHashGrid::QueryPairs(Callback&& callback) const
+		{
+			QueryPairs(0, kUint32Max, callback);
+		}
+
+		template<typename Callback>
+		inline void SpatialHashGrid::QueryPairs(const uint32 cellIndexBegin, const uint32 cellIndexEnd, Callback&& callback) const
+		{
+			// 나머지 4 칸은 그 칸에서 이 칸을 볼 때 센다.
+			static constexpr int32 kHalfNeighborOffsets[4][2] = { { +1, 0 }, { -1, +1 }, { 0, +1 }, { +1, +1 } };
+
+			uint32 levelCellIndexOffset = 0;
+			const uint32 levelCount = _levels.Size();
+			for (uint32 levelIndex = 0; levelIndex < levelCount && levelCellIndexOffset < cellIndexEnd; ++levelIndex)
+			{
+				const Level& level = _levels[levelIndex];
+				const uint32 levelCellCount = level._cells.Size();
+				const uint32 levelCellIndexBegin = (cellIndexBegin > levelCellIndexOffset) ? cellIndexBegin - levelCellIndexOffset : 0;
+				const uint32 levelCellIndexEnd = Min(cellIndexEnd - levelCellIndexOffset, levelCellCount);
+				levelCellIndexOffset += levelCellCount;
+				for (uint32 levelCellIndex = levelCellIndexBegin; levelCellIndex < levelCellIndexEnd; ++levelCellIndex)
+				{
+					const Cell& cell = level._cells[levelCellIndex];
+					const bool hasMovingProxy = (cell._movingProxyCount > 0);
+					const uint32 cellProxyCount = cell._proxyIDs.Size();
+					for (uint32 indexA = 0; hasMovingProxy == true && indexA < cellProxyCount; ++indexA)
+					{
+						for (uint32 indexB = indexA + 1; indexB < cellProxyCount; ++indexB)
+						{
+							TestPair(cell._proxyIDs[indexA], cell._proxyIDs[indexB], callback);
+						}
+					}
+
+					for (const auto& offset : kHalfNeighborOffsets)
+					{
+						const Cell* const neighborCell = FindCell(level, cell._x + offset[0], cell._y + offset[1]);
+						if (neighborCell == nullptr || (hasMovingProxy == false && neighborCell->_movingProxyCount == 0))
+						{
+							continue;
+						}
+
+						for (const uint32 proxyIDA : cell._proxyIDs)
+						{
+							for (const uint32 proxyIDB : neighborCell->_proxyIDs)
+							{
+								TestPair(proxyIDA, proxyIDB, callback);
+							}
+						}
+					}
+
+					// 큰 level 의 AABB 는 자기 칸과 +1 칸까지만 걸치므로, min 이 [min - 1 칸, max] 에 있는 칸만 보면 된다.
+					for (uint32 largerLevelIndex = levelIndex + 1; largerLevelIndex < levelCount; ++largerLevelIndex)
+					{
+						const Level& largerLevel = _levels[largerLevelIndex];
+						if (largerLevel._proxyCount == 0 || (hasMovingProxy == false && largerLevel._movingProxyCount == 0))
+						{
+							continue;
+						}
+
+						for (const uint32 proxyIDA : cell._proxyIDs)
+						{
+							const Proxy& proxyA = _proxies[proxyIDA];
+							if (proxyA._isStatic == true && largerLevel._movingProxyCount == 0)
+							{
+								continue;
+							}
+
+							const int32 xBegin = ComputeCellCoordinate(proxyA._min._x, largerLevel._inverseCellSize) - 1;
+							const int32 xEnd = ComputeCellCoordinate(proxyA._max._x, largerLevel._inverseCellSize);
+							const int32 yBegin = ComputeCellCoordinate(proxyA._min._y, largerLevel._inverseCellSize) - 1;
+							const int32 yEnd = ComputeCellCoordinate(proxyA._max._y, largerLevel._inverseCellSize);
+							for (int32 y = yBegin; y <= yEnd; ++y)
+							{
+								for (int32 x = xBegin; x <= xEnd; ++x)
+								{
+									const Cell* const largerCell = FindCell(largerLevel, x, y);
+									if (largerCell == nullptr || (proxyA._isStatic == true && largerCell->_movingProxyCount == 0))
+									{
+										continue;
+									}
+
+									for (const uint32 proxyIDB : largerCell->_proxyIDs)
+									{
+										TestPair(proxyIDA, proxyIDB, callback);
+									}
+								}
+							}
+						}
+					}
+				}
+			}
+		}
+
+		MINT_INLINE int32 SpatialHashGrid::ComputeCellCoordinate(const float value, const float inverseCellSize) noexcept
+		{
+			const float coordinate = ::floorf(value * inverseCellSize);
+			if (coordinate <= static_cast<float>(-kMaxCellCoordinate))
+			{
+				return -kMaxCellCoordinate;
+			}
+			if (coordinate >= static_cast<float>(kMaxCellCoordinate))
+			{
+				return kMaxCellCoordinate;
+			}
+			return static_cast<int32>(coordinate);
+		}
+
+		MINT_INLINE uint64 SpatialHashGrid::ComputeCellKey(const int32 x, const int32 y) noexcept
+		{
+			return (static_cast<uint64>(static_cast<uint32>(x)) << 32) | static_cast<uint32>(y);
+		}
+
+		MINT_INLINE const SpatialHashGrid::Cell* SpatialHashGrid::FindCell(const Level& level, const int32 x, const int32 y) noexcept
+		{
+			const KeyValuePair found = level._cellIndices.Find(ComputeCellKey(x, y));
+			return (found.IsValid() == true) ? &level._cells[*found._value] : nullptr;
+		}
+
+		template<typename Callback>
+		MINT_INLINE void SpatialHashGrid::TestPair(const uint32 proxyIDA, const uint32 proxyIDB, Callback& callback) const
+		{
+			const Proxy& proxyA = _proxies[proxyIDA];
+			const Proxy& proxyB = _proxies[proxyIDB];
+			if (proxyA._isStatic == true && proxyB._isStatic == true)
+			{
+				return;
+			}
+
+			if (proxyA._max._x < proxyB._min._x || proxyB._max._x < proxyA._min._x || proxyA._max._y < proxyB._min._y || proxyB._max._y < proxyA._min._y)
+			{
+				return;
+			}
+
+			callback(proxyA._userData, proxyB._userData);
+		}
+	}
+}
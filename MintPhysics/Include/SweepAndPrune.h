@@ -0,0 +1,96 @@
+﻿#pragma once
+
+
+#ifndef _MINT_PHYSICS_SWEEP_AND_PRUNE_H_
+#define _MINT_PHYSICS_SWEEP_AND_PRUNE_H_
+
+
+#include <MintCommon/Include/CommonDefinitions.h>
+
+#include <MintContainer/Include/Vector.h>
+
+#include <MintMath/Include/Float2.h>
+
+
+namespace mint
+{
+	namespace Physics2D
+	{
+		// 한 축 (정렬 축) 을 따라 AABB 의 min 으로 정렬해 두고 훑어서 (sort and sweep) 겹치는 AABB 쌍을 찾는다.
+		// - AABB 는 정렬된 순서대로 SoA 로 저장한다. 정렬 축의 구간이 겹치는 동안 다른 축 (교차 축) 의 겹침을 SIMD 로 한 번에 검사한다.
+		// - 물체는 프레임마다 조금씩만 움직이므로 Update 는 거의 정렬된 배열에 insertion sort 를 한다. (거의 선형)
+		// - 정렬 축은 AABB 중심의 분산이 더 큰 축이다. 가로로 긴 월드라면 x 축이 된다.
+		// - static 끼리의 쌍은 찾지 않는다.
+		class SweepAndPrune final
+		{
+		public:
+			SweepAndPrune();
+			~SweepAndPrune() = default;
+
+		public:
+			// 반환하는 proxy ID 는 DestroyProxy 전까지 바뀌지 않는다. 다음 Update 에서 정렬된다.
+			uint32 CreateProxy(const Float2& min, const Float2& max, const uint32 userData, const bool isStatic);
+			// 정렬된 배열에서는 자리만 비워 두고 다음 Update 에서 한꺼번에 당겨 채운다. 여러 개를 지워도 선형이다.
+			void DestroyProxy(const uint32 proxyID);
+			// 다음 Update 에서 정렬된다.
+			void MoveProxy(const uint32 proxyID, const Float2& min, const Float2& max) noexcept;
+			// 정렬된 위치는 그대로 두고 static 인지만 바꾼다.
+			void SetProxyStatic(const uint32 proxyID, const bool isStatic) noexcept;
+			void Clear();
+			// 정렬 축을 고르고 정렬한다. QueryPairs 전에 불러야 한다.
+			void Update();
+
+		public:
+			// 겹치는 모든 쌍에 대해 callback(userDataA, userDataB) 를 한 번씩 부른다. (경계가 닿기만 해도 겹친다.)
+			template<typename Callback>
+			void QueryPairs(Callback&& callback) const;
+			// 정렬된 위치가 [sortedIndexBegin, sortedIndexEnd) 인 proxy 가 앞쪽인 쌍만 찾는다. 범위를 나눠 여러 thread 에서 부를 수 있다.
+			// 범위를 순서대로 이어 붙이면 QueryPairs(callback) 와 같은 순서로 쌍을 찾는다.
+			template<typename Callback>
+			void QueryPairs(const uint32 sortedIndexBegin, const uint32 sortedIndexEnd, Callback&& callback) const;
+
+		public:
+			MINT_INLINE uint32 GetProxyCount() const noexcept { return _sortedProxyIDs.Size() - _removedCount; }
+			// 0 이면 x 축, 1 이면 y 축
+			MINT_INLINE uint32 GetSortAxis() const noexcept { return _sortAxis; }
+			// 정렬되어 있고 proxy 와 정렬된 위치가 서로 맞는지 확인한다. (테스트용)
+			bool Validate() const noexcept;
+
+		private:
+			void SortFully();
+			void SortIncrementally() noexcept;
+			void SwapAxes() noexcept;
+
+		private:
+			struct Proxy
+			{
+				// 비어 있는 proxy 는 kInvalidIndexUint32
+				uint32 _sortedIndex = kInvalidIndexUint32;
+				uint32 _userData = kInvalidIndexUint32;
+				bool _isStatic = false;
+			};
+
+		private:
+			Vector<Proxy> _proxies;
+			Vector<uint32> _freeProxyIDs;
+
+		private:
+			// 아래는 모두 정렬된 순서이다. 지운 proxy 의 자리는 _sortedProxyIDs 가 kInvalidIndexUint32 이다.
+			Vector<float> _sortedMins;
+			Vector<float> _sortedMaxs;
+			Vector<float> _sortedCrossMins;
+			Vector<float> _sortedCrossMaxs;
+			Vector<uint32> _sortedProxyIDs;
+
+		private:
+			uint32 _sortAxis;
+			// 마지막 Update 뒤에 CreateProxy 로 맨 뒤에 붙은 개수. 많으면 insertion sort 대신 전부 정렬한다.
+			uint32 _unsortedCount;
+			// 마지막 Update 뒤에 DestroyProxy 로 비워 둔 자리의 개수
+			uint32 _removedCount;
+		};
+	}
+}
+
+
+#endif // !_MINT_PHYSICS_SWEEP_AND_PRUNE_H_
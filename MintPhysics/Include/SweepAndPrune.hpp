@@ -0,0 +1,91 @@
+﻿#pragma once
+
+
+#include <MintPhysics/Include/SweepAndPrune.h>
+
+#include <MintContainer/Include/Vector.hpp>
+
+#include <intrin.h>
+#include <immintrin.h>
+
+
+namespace mint
+{
+	namespace Physics2D
+	{
+		template<typename Callback>
+		inline void SweepAndPrune::QueryPairs(Callback&& callback) const
+		{
+			QueryPairs(0, _sortedProxyIDs.Size(), callback);
+		}
+
+		template<typename Callback>
+		inline void SweepAndPrune::QueryPairs(const uint32 sortedIndexBegin, const uint32 sortedIndexEnd, Callback&& callback) const
+		{
+			MINT_ASSERT(_unsortedCount == 0 && _removedCount == 0, "Update 를 먼저 불러야 합니다!");
+
+			const uint32 count = _sortedProxyIDs.Size();
+			const float* const mins = _sortedMins.Data();
+			const float* const maxs = _sortedMaxs.Data();
+			const float* const crossMins = _sortedCrossMins.Data();
+			const float* const crossMaxs = _sortedCrossMaxs.Data();
+			const uint32* const proxyIDs = _sortedProxyIDs.Data();
+			const uint32 indexAEnd = Min(sortedIndexEnd, count);
+			for (uint32 indexA = sortedIndexBegin; indexA < indexAEnd; ++indexA)
+			{
+				const Proxy& proxyA = _proxies[proxyIDs[indexA]];
+				const float maxA = maxs[indexA];
+				const float crossMinA = crossMins[indexA];
+				const float crossMaxA = crossMaxs[indexA];
+				uint32 indexB = indexA + 1;
+				bool isSweepDone = false;
+#if !defined MINT_NO_SIMD
+				{
+					// min 으로 정렬되어 있으므로 정렬 축의 구간이 겹치는 lane 은 항상 앞쪽에 모여 있다.
+					const __m128 maxAs = _mm_set1_ps(maxA);
+					const __m128 crossMinAs = _mm_set1_ps(crossMinA);
+					const __m128 crossMaxAs = _mm_set1_ps(crossMaxA);
+					for (; indexB + 4 <= count; indexB += 4)
+					{
+						const __m128 isInSweep = _mm_cmple_ps(_mm_loadu_ps(mins + indexB), maxAs);
+						const int32 sweepMask = _mm_movemask_ps(isInSweep);
+						const __m128 overlapsCross = _mm_and_ps(_mm_cmple_ps(_mm_loadu_ps(crossMins + indexB), crossMaxAs), _mm_cmple_ps(crossMinAs, _mm_loadu_ps(crossMaxs + indexB)));
+						uint32 overlapMask = static_cast<uint32>(_mm_movemask_ps(_mm_and_ps(isInSweep, overlapsCross)));
+						while (overlapMask != 0)
+						{
+							unsigned long lane = 0;
+							_BitScanForward(&lane, overlapMask);
+							overlapMask &= overlapMask - 1;
+
+							const Proxy& proxyB = _proxies[proxyIDs[indexB + lane]];
+							if (proxyA._isStatic == false || proxyB._isStatic == false)
+							{
+								callback(proxyA._userData, proxyB._userData);
+							}
+						}
+
+						if (sweepMask != 0b1111)
+						{
+							isSweepDone = true;
+							break;
+						}
+					}
+				}
+#endif
+				for (; isSweepDone == false && indexB < count && mins[indexB] <= maxA; ++indexB)
+				{
+					if (crossMaxs[indexB] < crossMinA || crossMaxA < crossMins[indexB])
+					{
+						continue;
+					}
+
+					const Proxy& proxyB = _proxies[proxyIDs[indexB]];
+					if (proxyA._isStatic == false || proxyB._isStatic == false)
+					{
+						callback(proxyA._userData, proxyB._userData);
+					}
+				}
+			}
+		}
+	}
+}
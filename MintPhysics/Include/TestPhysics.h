@@ -10,5 +10,8 @@ namespace mint
 	{
 		bool Test();
 		bool TestIntersections();
+		bool TestBroadPhase();
+		bool TestConstraintSolver();
+		bool TestWorld();
 	}
 }
@@ -0,0 +1,75 @@
+﻿#pragma once
+
+
+#ifndef _MINT_PHYSICS_THREAD_POOL_H_
+#define _MINT_PHYSICS_THREAD_POOL_H_
+
+
+#include <MintCommon/Include/CommonDefinitions.h>
+
+#include <MintContainer/Include/Vector.h>
+
+#include <thread>
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+
+
+namespace mint
+{
+	namespace Physics2D
+	{
+		// World::Step 의 단계들을 여러 thread 에서 나눠 실행하기 위한 작업 thread 모음
+		// - ParallelFor 를 부른 thread 도 작업을 맡고, 모든 작업이 끝나야 돌아온다.
+		// - 작업은 번호로만 나뉘고 어느 thread 가 어느 작업을 맡을지는 정해져 있지 않다.
+		//   그러므로 결과는 작업 번호별로 따로 모았다가 번호 순서대로 합쳐야 thread 수와 상관없이 같아진다.
+		class ThreadPool final
+		{
+		public:
+			ThreadPool();
+			ThreadPool(const ThreadPool& rhs) = delete;
+			ThreadPool(ThreadPool&& rhs) noexcept = delete;
+			~ThreadPool();
+
+		public:
+			ThreadPool& operator=(const ThreadPool& rhs) = delete;
+			ThreadPool& operator=(ThreadPool&& rhs) noexcept = delete;
+
+		public:
+			// 부르는 thread 를 포함한 thread 수. 1 이면 작업 thread 없이 부르는 thread 에서 모두 실행한다.
+			void SetThreadCount(const uint32 threadCount);
+			MINT_INLINE uint32 GetThreadCount() const noexcept { return _workerThreads.Size() + 1; }
+
+		public:
+			// 0 부터 taskCount - 1 까지의 모든 작업 번호에 대해 function(taskIndex) 를 한 번씩 부른다.
+			template<typename Function>
+			void ParallelFor(const uint32 taskCount, Function&& function);
+
+		private:
+			using TaskFunction = void (*)(void* const context, const uint32 taskIndex);
+			void Run(const uint32 taskCount, const TaskFunction taskFunction, void* const context);
+			void RunWorkerThread(uint64 lastRunIndex);
+			void ExecuteTasks();
+			void StopWorkerThreads();
+
+		private:
+			Vector<std::thread> _workerThreads;
+			std::mutex _mutex;
+			std::condition_variable _workCondition;
+			std::condition_variable _doneCondition;
+			// Run 이 불릴 때마다 1 씩 늘어서, 작업 thread 가 새 작업이 왔는지 안다.
+			uint64 _runIndex;
+			bool _isStopping;
+			uint32 _busyWorkerThreadCount;
+
+		private:
+			TaskFunction _taskFunction;
+			void* _taskContext;
+			uint32 _taskCount;
+			std::atomic<uint32> _nextTaskIndex;
+		};
+	}
+}
+
+
+#endif // !_MINT_PHYSICS_THREAD_POOL_H_
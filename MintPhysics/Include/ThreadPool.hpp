@@ -0,0 +1,26 @@
+﻿#pragma once
+
+
+#include <MintPhysics/Include/ThreadPool.h>
+
+#include <MintContainer/Include/Vector.hpp>
+
+#include <type_traits>
+
+
+namespace mint
+{
+	namespace Physics2D
+	{
+		template<typename Function>
+		inline void ThreadPool::ParallelFor(const uint32 taskCount, Function&& function)
+		{
+			using FunctionType = std::remove_reference_t<Function>;
+			const TaskFunction taskFunction = [](void* const context, const uint32 taskIndex)
+			{
+				(*static_cast<FunctionType*>(context))(taskIndex);
+			};
+			Run(taskCount, taskFunction, const_cast<void*>(static_cast<const void*>(&function)));
+		}
+	}
+}
@@ -1,6 +1,8 @@
 #include <MintPhysics/Include/CollisionShape.h>
+#include <MintPhysics/Include/PhysicsCommon.h>
 #include <MintContainer/Include/Vector.hpp>
 #include <MintContainer/Include/SharedPtr.hpp>
+#include <MintContainer/Include/Algorithm.hpp>
 #include <MintMath/Include/Float2x2.h>
 #include <MintMath/Include/Geometry.h>
 #include <MintMath/Include/Transform.h>
@@ -44,7 +46,7 @@ namespace mint
 			case mint::Physics2D::CollisionShapeType::Box:
 			{
 				const BoxCollisionShape& castedShape = static_cast<const BoxCollisionShape&>(*shape);
-				const Float2x2 rotationMatrix{ Float2x2::RotationMatrix(transform2D._rotation) };
+				const Float2x2 rotationMatrix{ MakeRotationMatrix(transform2D._rotation) };
 				const Float2 halfLengthedAxisX = rotationMatrix * castedShape.GetHalfLengthedAxisX();
 				const Float2 halfLengthedAxisY = rotationMatrix * castedShape.GetHalfLengthedAxisY();
 				return MakeShared<BoxCollisionShape>(BoxCollisionShape(castedShape._center + transform2D._translation, halfLengthedAxisX, halfLengthedAxisY));
@@ -228,14 +230,9 @@ namespace mint
 			else if (collisionShape.GetCollisionShapeType() == CollisionShapeType::Convex)
 			{
 				const ConvexCollisionShape& convexCollisionShape = static_cast<const ConvexCollisionShape&>(collisionShape);
-				const Vector<Float2>& vertices = convexCollisionShape.GetVertices();
 				Float2 min = +Float2::kMax;
 				Float2 max = -Float2::kMax;
-				for (const Float2& vertex : vertices)
-				{
-					min = Float2::Min(min, vertex);
-					max = Float2::Max(max, vertex);
-				}
+				MinMax(convexCollisionShape.GetVertices(), min, max);
 
 				const Float2 center = (max + min) * 0.5f;
 				const Float2 size = max - min;
@@ -257,50 +254,48 @@ namespace mint
 		void AABBCollisionShape::Set(const AABBCollisionShape& aabbCollisionShape, const Transform2D& transform2D)
 		{
 			_center = aabbCollisionShape._center + transform2D._translation;
-			const Float2x2 rotationMatrix = Float2x2::RotationMatrix(transform2D._rotation);
-			const Float2& x = rotationMatrix._row[0];
-			const Float2& y = rotationMatrix._row[1];
-			const Float2 rotatedHalfSizeX = x * aabbCollisionShape._halfSize._x;
-			const Float2 rotatedHalfSizeY = y * aabbCollisionShape._halfSize._y;
-			const Float2 p0 = -rotatedHalfSizeX + +rotatedHalfSizeY;
-			const Float2 p1 = -rotatedHalfSizeX + -rotatedHalfSizeY;
-			const Float2 p2 = +rotatedHalfSizeX + -rotatedHalfSizeY;
-			const Float2 p3 = +rotatedHalfSizeX + +rotatedHalfSizeY;
-			const float minX = Min(Min(Min(p0._x, p1._x), p2._x), p3._x);
-			const float minY = Min(Min(Min(p0._y, p1._y), p2._y), p3._y);
-			const float maxX = Max(Max(Max(p0._x, p1._x), p2._x), p3._x);
-			const float maxY = Max(Max(Max(p0._y, p1._y), p2._y), p3._y);
-			_halfSize._x = maxX - minX;
-			_halfSize._y = maxY - minY;
-			_halfSize *= 0.5f;
+			_halfSize = ComputeRotatedHalfSize(aabbCollisionShape._halfSize, transform2D._rotation);
 		}
 
 		void AABBCollisionShape::SetExpanded(const AABBCollisionShape& aabbCollisionShape, const Transform2D& transform2D, const Float2& displacement)
 		{
-			Set(aabbCollisionShape, transform2D);
+			Float2 min;
+			Float2 max;
+			ComputeExpandedMinMax(aabbCollisionShape._center + transform2D._translation, aabbCollisionShape._halfSize, transform2D._rotation, displacement, min, max);
+			_center = (min + max) * 0.5f;
+			_halfSize = (max - min) * 0.5f;
+		}
 
-			const Float2& position0 = aabbCollisionShape._center + transform2D._translation;
-			const Float2 position1 = position0 + displacement;
-			Float2 min = _center - _halfSize;
-			Float2 max = _center + _halfSize;
+		Float2 AABBCollisionShape::ComputeRotatedHalfSize(const Float2& halfSize, const float rotation)
+		{
+			// 돌린 x, y 축에 halfSize 를 곱한 두 벡터의 성분별 절댓값의 합이 네 꼭짓점 중 가장 먼 것과 같다.
+			const Float2x2 rotationMatrix = MakeRotationMatrix(rotation);
+			const Float2& x = rotationMatrix._row[0];
+			const Float2& y = rotationMatrix._row[1];
+			return Float2(::abs(x._x * halfSize._x) + ::abs(y._x * halfSize._y), ::abs(x._y * halfSize._x) + ::abs(y._y * halfSize._y));
+		}
+
+		void AABBCollisionShape::ComputeExpandedMinMax(const Float2& center, const Float2& halfSize, const float rotation, const Float2& displacement, Float2& outMin, Float2& outMax)
+		{
+			const Float2 rotatedHalfSize = ComputeRotatedHalfSize(halfSize, rotation);
+			outMin = center - rotatedHalfSize;
+			outMax = center + rotatedHalfSize;
 			if (displacement._x > 0.0f)
 			{
-				max._x += displacement._x;
+				outMax._x += displacement._x;
 			}
 			else
 			{
-				min._x += displacement._x;
+				outMin._x += displacement._x;
 			}
 			if (displacement._y > 0.0f)
 			{
-				max._y += displacement._y;
+				outMax._y += displacement._y;
 			}
 			else
 			{
-				min._y += displacement._y;
+				outMin._y += displacement._y;
 			}
-			_center = (min + max) * 0.5f;
-			_halfSize = (max - min) * 0.5f;
 		}
 
 		void AABBCollisionShape::SetExpandedByRadius(const AABBCollisionShape& aabbCollisionShape, const Transform2D& transform2D, const Float2& displacement)
@@ -412,7 +407,7 @@ namespace mint
 			, _halfLengthedAxisX{ Float2::kZero }
 			, _halfLengthedAxisY{ Float2::kZero }
 		{
-			const Float2x2 rotationMatrix = Float2x2::RotationMatrix(transform2D._rotation);
+			const Float2x2 rotationMatrix = MakeRotationMatrix(transform2D._rotation);
 			const Float2& x = rotationMatrix._row[0];
 			const Float2& y = rotationMatrix._row[1];
 			_halfLengthedAxisX = x * halfSize._x;
@@ -508,9 +503,11 @@ namespace mint
 			: CollisionShape()
 			, _vertices{ vertices }
 		{
+			// Same as Transform2D::operator*(), but with the rotation matrix of MakeRotationMatrix()
+			const Float2x2 rotationMatrix = MakeRotationMatrix(transform2D._rotation);
 			for (Float2& vertex : _vertices)
 			{
-				vertex = transform2D * vertex;
+				vertex = rotationMatrix.Mul(transform2D._scale * vertex) + transform2D._translation;
 			}
 		}
 
@@ -518,9 +515,10 @@ namespace mint
 			: CollisionShape()
 			, _vertices{ rhs._vertices }
 		{
+			const Float2x2 rotationMatrix = MakeRotationMatrix(transform2D._rotation);
 			for (Float2& vertex : _vertices)
 			{
-				vertex = transform2D * vertex;
+				vertex = rotationMatrix.Mul(transform2D._scale * vertex) + transform2D._translation;
 			}
 		}
 
@@ -532,8 +530,16 @@ namespace mint
 
 		ConvexCollisionShape ConvexCollisionShape::MakeFromPoints(const Vector<Float2>& points)
 		{
-			ConvexCollisionShape shape(points);
-			GrahamScan_Convexify(shape._vertices);
+			// _vertices 의 앞쪽 (pointCount + 1) 개에 껍질을 쓰고 뒤쪽 pointCount 개를 scratch 로 써서, 결과 외의 메모리를 할당하지 않는다.
+			const uint32 pointCount = points.Size();
+			ConvexCollisionShape shape;
+			shape._vertices.Resize(pointCount * 2 + 1);
+			Float2* const scratch = shape._vertices.Data() + pointCount + 1;
+			for (uint32 i = 0; i < pointCount; ++i)
+			{
+				scratch[i] = points[i];
+			}
+			shape._vertices.Resize(ConvexHull_Compute(scratch, pointCount, scratch, shape._vertices.Data()));
 			return shape;
 		}
 
@@ -545,14 +551,15 @@ namespace mint
 				return ConvexCollisionShape(Vector<Float2>());
 			}
 
-			Vector<Float2> points;
-			points.Resize(vertexCount);
+			// MakeFromPoints() 처럼 _vertices 의 뒤쪽을 scratch 로 쓴다.
+			ConvexCollisionShape shape;
+			shape._vertices.Resize(vertexCount * 2 + 1);
+			Float2* const scratch = shape._vertices.Data() + vertexCount + 1;
 			for (uint32 i = 0; i < vertexCount; ++i)
 			{
-				points[i] = center + renderingShape._vertices[i]._position.GetXY();
+				scratch[i] = center + renderingShape._vertices[i]._position.GetXY();
 			}
-			ConvexCollisionShape shape(points);
-			GrahamScan_Convexify(shape._vertices);
+			shape._vertices.Resize(ConvexHull_Compute(scratch, vertexCount, scratch, shape._vertices.Data()));
 			return shape;
 		}
 
@@ -560,15 +567,17 @@ namespace mint
 		{
 			constexpr const uint32 kSampleCount = 128;
 			const Float2x2 rotationMatrix = Float2x2::RotationMatrix(Math::kTwoPi / static_cast<float>(kSampleCount));
+			// MakeFromPoints() 처럼 _vertices 의 뒤쪽에 표본을 모으고 앞쪽에 껍질을 쓴다.
 			ConvexCollisionShape shape;
-			shape._vertices.Clear();
+			shape._vertices.Resize(kSampleCount * 2 + 1);
+			Float2* const samples = shape._vertices.Data() + kSampleCount + 1;
 			Float2 direction = Float2(1, 0);
 			for (uint32 i = 0; i < kSampleCount; ++i)
 			{
-				shape._vertices.PushBack(a.ComputeSupportPoint(direction) - b.ComputeSupportPoint(-direction));
+				samples[i] = a.ComputeSupportPoint(direction) - b.ComputeSupportPoint(-direction);
 				direction = rotationMatrix * direction;
 			}
-			GrahamScan_Convexify(shape._vertices);
+			shape._vertices.Resize(ConvexHull_Compute(samples, kSampleCount, samples, shape._vertices.Data()));
 			return shape;
 		}
 
@@ -745,5 +754,173 @@ namespace mint
 			}
 		}
 #pragma endregion
+
+#pragma region CollisionShape - TransformedCollisionShape
+		TransformedCollisionShape::TransformedCollisionShape(const CollisionShape& shape, const Transform2D& transform2D)
+			: _shape{ &shape }
+			, _matrix{}
+			, _transposedMatrix{}
+			, _translation{ transform2D._translation }
+			, _isTranslationOnly{ true }
+		{
+			// Must match CollisionShape::MakeTransformed()
+			switch (shape.GetCollisionShapeType())
+			{
+			case mint::Physics2D::CollisionShapeType::Point:
+			case mint::Physics2D::CollisionShapeType::Circle:
+			case mint::Physics2D::CollisionShapeType::AABB:
+				// Only translated
+				break;
+			case mint::Physics2D::CollisionShapeType::Box:
+			{
+				// Rotated about its center, not about the origin
+				if (transform2D._rotation != 0.0f)
+				{
+					const BoxCollisionShape& castedShape = static_cast<const BoxCollisionShape&>(shape);
+					_matrix = MakeRotationMatrix(transform2D._rotation);
+					_translation += castedShape._center - _matrix * castedShape._center;
+					_isTranslationOnly = false;
+				}
+				break;
+			}
+			case mint::Physics2D::CollisionShapeType::Edge:
+			case mint::Physics2D::CollisionShapeType::Convex:
+			{
+				if (transform2D._rotation != 0.0f || transform2D._scale != Float2::kOne)
+				{
+					_matrix = MakeRotationMatrix(transform2D._rotation) * Float2x2(transform2D._scale._x, 0.0f, 0.0f, transform2D._scale._y);
+					_isTranslationOnly = false;
+				}
+				break;
+			}
+			default:
+				MINT_NEVER;
+				break;
+			}
+
+			_transposedMatrix = _matrix.Transpose();
+		}
+
+		Float2 TransformedCollisionShape::ComputeSupportPoint(const Float2& direction) const
+		{
+			if (_isTranslationOnly == true)
+			{
+				return _shape->ComputeSupportPoint(direction) + _translation;
+			}
+			return _matrix * _shape->ComputeSupportPoint(_transposedMatrix * direction) + _translation;
+		}
+
+		void TransformedCollisionShape::ComputeSupportEdge(const Float2& direction, Float2& outVertexA, Float2& outVertexB) const
+		{
+			if (_isTranslationOnly == true)
+			{
+				_shape->ComputeSupportEdge(direction, outVertexA, outVertexB);
+				outVertexA += _translation;
+				outVertexB += _translation;
+				return;
+			}
+
+			_shape->ComputeSupportEdge(_transposedMatrix * direction, outVertexA, outVertexB);
+			outVertexA = _matrix * outVertexA + _translation;
+			outVertexB = _matrix * outVertexB + _translation;
+		}
+
+		float TransformedCollisionShape::ComputeRotationRadius() const
+		{
+			// _matrix only rotates and scales, so the rotation doesn't change the lengths.
+			switch (_shape->GetCollisionShapeType())
+			{
+			case mint::Physics2D::CollisionShapeType::Box:
+			{
+				const BoxCollisionShape& castedShape = static_cast<const BoxCollisionShape&>(*_shape);
+				return (_matrix * castedShape.GetHalfLengthedAxisX()).Length() + (_matrix * castedShape.GetHalfLengthedAxisY()).Length();
+			}
+			case mint::Physics2D::CollisionShapeType::Edge:
+			{
+				const EdgeCollisionShape& castedShape = static_cast<const EdgeCollisionShape&>(*_shape);
+				return Max((_matrix * castedShape._vertexA).Length(), (_matrix * castedShape._vertexB).Length());
+			}
+			case mint::Physics2D::CollisionShapeType::Convex:
+			{
+				const ConvexCollisionShape& castedShape = static_cast<const ConvexCollisionShape&>(*_shape);
+				float radius = 0.0f;
+				for (const Float2& vertex : castedShape.GetVertices())
+				{
+					radius = Max(radius, (_matrix * vertex).Length());
+				}
+				return radius;
+			}
+			default:
+				return 0.0f;
+			}
+		}
+
+		uint32 TransformedCollisionShape::GetVertexCount() const
+		{
+			switch (_shape->GetCollisionShapeType())
+			{
+			case mint::Physics2D::CollisionShapeType::Point:
+			case mint::Physics2D::CollisionShapeType::Circle:
+				return 1;
+			case mint::Physics2D::CollisionShapeType::Edge:
+				return 2;
+			case mint::Physics2D::CollisionShapeType::AABB:
+			case mint::Physics2D::CollisionShapeType::Box:
+				return 4;
+			case mint::Physics2D::CollisionShapeType::Convex:
+				return static_cast<const ConvexCollisionShape&>(*_shape).GetVertices().Size();
+			default:
+				MINT_NEVER;
+				return 0;
+			}
+		}
+
+		Float2 TransformedCollisionShape::ComputeVertex(const uint32 index) const
+		{
+			// Signs of the half size for the 4 corners in CCW order
+			static constexpr float kCornerSigns[4][2] = { { -1.0f, -1.0f }, { +1.0f, -1.0f }, { +1.0f, +1.0f }, { -1.0f, +1.0f } };
+
+			Float2 vertex;
+			switch (_shape->GetCollisionShapeType())
+			{
+			case mint::Physics2D::CollisionShapeType::Point:
+				vertex = static_cast<const PointCollisionShape&>(*_shape)._center;
+				break;
+			case mint::Physics2D::CollisionShapeType::Circle:
+				vertex = static_cast<const CircleCollisionShape&>(*_shape)._center;
+				break;
+			case mint::Physics2D::CollisionShapeType::Edge:
+			{
+				const EdgeCollisionShape& castedShape = static_cast<const EdgeCollisionShape&>(*_shape);
+				vertex = (index == 0) ? castedShape._vertexA : castedShape._vertexB;
+				break;
+			}
+			case mint::Physics2D::CollisionShapeType::AABB:
+			{
+				const AABBCollisionShape& castedShape = static_cast<const AABBCollisionShape&>(*_shape);
+				vertex = castedShape._center + Float2(castedShape._halfSize._x * kCornerSigns[index][0], castedShape._halfSize._y * kCornerSigns[index][1]);
+				break;
+			}
+			case mint::Physics2D::CollisionShapeType::Box:
+			{
+				const BoxCollisionShape& castedShape = static_cast<const BoxCollisionShape&>(*_shape);
+				vertex = castedShape._center + castedShape.GetHalfLengthedAxisX() * kCornerSigns[index][0] + castedShape.GetHalfLengthedAxisY() * kCornerSigns[index][1];
+				break;
+			}
+			case mint::Physics2D::CollisionShapeType::Convex:
+				vertex = static_cast<const ConvexCollisionShape&>(*_shape).GetVertices()[index];
+				break;
+			default:
+				MINT_NEVER;
+				break;
+			}
+
+			if (_isTranslationOnly == true)
+			{
+				return vertex + _translation;
+			}
+			return _matrix * vertex + _translation;
+		}
+#pragma endregion
 	}
 }
\ No newline at end of file
@@ -1,92 +1,403 @@
-#include <MintPhysics/Include/ConstraintSolver.h>
-#include <MintPhysics/Include/PhysicsWorld.h>
-#include <MintMath/Include/Vec.hpp>
-#include <MintMath/Include/Matrix.hpp>
+﻿#include <MintPhysics/Include/ConstraintSolver.h>
+#include <MintContainer/Include/Vector.hpp>
+
+#include <immintrin.h>
+
+
+// gcc 는 FMA 를 쓸 수 있게 빌드하면 (-mfma 등) 함수 경계를 넘어서도 곱셈과 덧셈을 FMA 하나로 합치고, clang 은 한 식 안에서 합친다.
+// 어느 식을 합치는지는 lane 마다 다를 수 있으므로 이 파일에서는 합치지 않는다.
+// (MSVC 는 /fp:contract 나 /fp:fast 를 주지 않으면 합치지 않는다.)
+#if defined __clang__
+#pragma clang fp contract(off)
+#elif defined __GNUC__
+#pragma GCC push_options
+#pragma GCC optimize ("fp-contract=off")
+#endif
 
 
 namespace mint
 {
 	namespace Physics2D
 	{
-		void SolveParticleDistanceConstraint(World& world, float timeStep, const ParticleDistanceConstraint& particleDistanceConstraint)
+		namespace ConstraintSolverInternal
+		{
+			// 같은 계산을 Real / __m128 / __m256 에 쓰기 위한 연산 묶음 (SIMD lane 은 Real 이 float 일 때만 쓴다)
+			// Min, Max 는 NaN 이나 같은 값일 때도 SIMD 명령과 같은 값을 고르도록 쓴다.
+			namespace Lane
+			{
+				struct Scalar
+				{
+					using Type = Real;
+					static constexpr uint32 kWidth = 1;
+
+					static MINT_INLINE Type Load(const Real* const source) noexcept { return *source; }
+					static MINT_INLINE void Store(Real* const destination, const Type value) noexcept { *destination = value; }
+					static MINT_INLINE Type Gather(const Real* const base, const uint32* const indices) noexcept { return base[indices[0]]; }
+					static MINT_INLINE void Scatter(Real* const base, const uint32* const indices, const Type value) noexcept { base[indices[0]] = value; }
+					static MINT_INLINE Type Add(const Type lhs, const Type rhs) noexcept { return lhs + rhs; }
+					static MINT_INLINE Type Sub(const Type lhs, const Type rhs) noexcept { return lhs - rhs; }
+					static MINT_INLINE Type Mul(const Type lhs, const Type rhs) noexcept { return lhs * rhs; }
+					static MINT_INLINE Type Min(const Type lhs, const Type rhs) noexcept { return (lhs < rhs) ? lhs : rhs; }
+					static MINT_INLINE Type Max(const Type lhs, const Type rhs) noexcept { return (lhs > rhs) ? lhs : rhs; }
+				};
+
+				struct SSE
+				{
+					using Type = __m128;
+					static constexpr uint32 kWidth = 4;
+
+					static MINT_INLINE Type Load(const float* const source) noexcept { return _mm_loadu_ps(source); }
+					static MINT_INLINE void Store(float* const destination, const Type value) noexcept { _mm_storeu_ps(destination, value); }
+					static MINT_INLINE Type Gather(const float* const base, const uint32* const indices) noexcept
+					{
+						return _mm_set_ps(base[indices[3]], base[indices[2]], base[indices[1]], base[indices[0]]); // 순서에 주의!!!
+					}
+					static MINT_INLINE void Scatter(float* const base, const uint32* const indices, const Type value) noexcept
+					{
+						alignas(16) float values[kWidth];
+						_mm_store_ps(values, value);
+						for (uint32 lane = 0; lane < kWidth; ++lane)
+						{
+							base[indices[lane]] = values[lane];
+						}
+					}
+					static MINT_INLINE Type Add(const Type lhs, const Type rhs) noexcept { return _mm_add_ps(lhs, rhs); }
+					static MINT_INLINE Type Sub(const Type lhs, const Type rhs) noexcept { return _mm_sub_ps(lhs, rhs); }
+					static MINT_INLINE Type Mul(const Type lhs, const Type rhs) noexcept { return _mm_mul_ps(lhs, rhs); }
+					static MINT_INLINE Type Min(const Type lhs, const Type rhs) noexcept { return _mm_min_ps(lhs, rhs); }
+					static MINT_INLINE Type Max(const Type lhs, const Type rhs) noexcept { return _mm_max_ps(lhs, rhs); }
+				};
+
+#if defined __AVX__
+				struct AVX
+				{
+					using Type = __m256;
+					static constexpr uint32 kWidth = 8;
+
+					static MINT_INLINE Type Load(const float* const source) noexcept { return _mm256_loadu_ps(source); }
+					static MINT_INLINE void Store(float* const destination, const Type value) noexcept { _mm256_storeu_ps(destination, value); }
+					static MINT_INLINE Type Gather(const float* const base, const uint32* const indices) noexcept
+					{
+						return _mm256_set_ps(base[indices[7]], base[indices[6]], base[indices[5]], base[indices[4]], base[indices[3]], base[indices[2]], base[indices[1]], base[indices[0]]); // 순서에 주의!!!
+					}
+					static MINT_INLINE void Scatter(float* const base, const uint32* const indices, const Type value) noexcept
+					{
+						alignas(32) float values[kWidth];
+						_mm256_store_ps(values, value);
+						for (uint32 lane = 0; lane < kWidth; ++lane)
+						{
+							base[indices[lane]] = values[lane];
+						}
+					}
+					static MINT_INLINE Type Add(const Type lhs, const Type rhs) noexcept { return _mm256_add_ps(lhs, rhs); }
+					static MINT_INLINE Type Sub(const Type lhs, const Type rhs) noexcept { return _mm256_sub_ps(lhs, rhs); }
+					static MINT_INLINE Type Mul(const Type lhs, const Type rhs) noexcept { return _mm256_mul_ps(lhs, rhs); }
+					static MINT_INLINE Type Min(const Type lhs, const Type rhs) noexcept { return _mm256_min_ps(lhs, rhs); }
+					static MINT_INLINE Type Max(const Type lhs, const Type rhs) noexcept { return _mm256_max_ps(lhs, rhs); }
+				};
+#endif
+			}
+
+#if defined MINT_NO_SIMD || defined MINT_PHYSICS_DETERMINISTIC
+			using SolverLane = Lane::Scalar;
+#elif defined __AVX__
+			using SolverLane = Lane::AVX;
+#else
+			using SolverLane = Lane::SSE;
+#endif
+		}
+
+		ConstraintSolver::ConstraintSolver()
+		{
+			Clear();
+		}
+
+		void ConstraintSolver::Clear()
+		{
+			_velocityXs.Clear();
+			_velocityYs.Clear();
+			_angularVelocities.Clear();
+			_inverseMasses.Clear();
+			_inverseInertias.Clear();
+			_rows.Clear();
+
+			// 0 번 body 는 padding lane 이 쓴다.
+			AddBody(ToReal2(Float2::kZero), Real(0), Real(0), Real(0));
+		}
+
+		uint32 ConstraintSolver::AddBody(const Real2& linearVelocity, const Real angularVelocity, const Real inverseMass, const Real inverseInertia)
+		{
+			_velocityXs.PushBack(linearVelocity._x);
+			_velocityYs.PushBack(linearVelocity._y);
+			_angularVelocities.PushBack(angularVelocity);
+			_inverseMasses.PushBack(inverseMass);
+			_inverseInertias.PushBack(inverseInertia);
+			return _velocityXs.Size() - 1;
+		}
+
+		uint32 ConstraintSolver::AddRow(const uint32 bodyIndexA, const uint32 bodyIndexB, const Real2& direction, const Real angularA, const Real angularB, const Real bias, const Real minImpulse, const Real maxImpulse, const Real initialImpulse)
 		{
-			MINT_ASSERT(particleDistanceConstraint._bodyAID.IsValid(), "!!!");
-			MINT_ASSERT(particleDistanceConstraint._bodyBID.IsValid(), "!!!");
-
-			const float kBeta = 0.2f; // or 0.1 ~ 0.4, tuning parameter
-
-			Body& bodyA = world.AccessBody(particleDistanceConstraint._bodyAID);
-			Body& bodyB = world.AccessBody(particleDistanceConstraint._bodyBID);
-			Transform2D& transformA = bodyA._transform2D;
-			Transform2D& transformB = bodyB._transform2D;
-
-			VecF<2> xA{ transformA._translation._x, transformA._translation._y };
-			VecF<2> xB{ transformB._translation._x, transformB._translation._y };
-			VecF<2> r = xB - xA;
-			const float C = r.Dot(r) - particleDistanceConstraint._distance * particleDistanceConstraint._distance;
-
-			VecF<2> gradC_xA = -2.0f * r;
-			VecF<2> gradC_xB = 2.0f * r;
-			MatrixF<4, 1> JT; // == gradC
-			JT.SetElement(0, 0, gradC_xA.X());
-			JT.SetElement(1, 0, gradC_xA.Y());
-			JT.SetElement(2, 0, gradC_xB.X());
-			JT.SetElement(3, 0, gradC_xB.Y());
-
-			MatrixF<1, 4> J = JT.Transpose();
-			VecF<2> vA{ bodyA._linearVelocity._x, bodyA._linearVelocity._y };
-			VecF<2> vB{ bodyB._linearVelocity._x, bodyB._linearVelocity._y };
-			VecF<4> v;
-			v.SetComponent(0, vA.X());
-			v.SetComponent(1, vA.Y());
-			v.SetComponent(2, vB.X());
-			v.SetComponent(3, vB.Y());
-
-			const float dCdt = J * v;
-
-			const float inverseMassA = bodyA._inverseMass;
-			const float inverseMassB = bodyB._inverseMass;
-			MatrixF<4, 4> inverseM;
-			inverseM.SetElement(0, 0, inverseMassA);
-			inverseM.SetElement(1, 1, inverseMassA);
-			inverseM.SetElement(2, 2, inverseMassB);
-			inverseM.SetElement(3, 3, inverseMassB);
-
-			// P = M * delta_v ̹Ƿ
-			// => delta_v = inverseM * P
-			// 
-			//  P = J^T * lambda ̹Ƿ
-			// delta_v = inverseM * J^T * lambda
-
-			// impulse   ڿ Constraint  Ǿ ϹǷ
-			// J(v + delta_v) = 0 ̾ Ѵ.
-			// => J * v + J * delta_v = 0
-			// => J * delta_v = -J * v
-			// => J * inverseM * J^T * lambda = -J * v
-			// lambda = (-J * v) / (J * inverseM * J^T)
-
-			float numerator = -J * v;
-			// Baumgarte Stabilization
-			const float kPositionalCorrection = kBeta * C / timeStep;
-			numerator -= kPositionalCorrection;
-
-			const float denominator = (J * inverseM * JT);
-			if (denominator == 0.0f)
+			MINT_ASSERT(bodyIndexA < _velocityXs.Size() && bodyIndexB < _velocityXs.Size(), "Bodies must be added first!");
+
+			Row row;
+			row._bodyIndexA = bodyIndexA;
+			row._bodyIndexB = bodyIndexB;
+			row._direction = direction;
+			row._angularA = angularA;
+			row._angularB = angularB;
+			row._bias = bias;
+			row._minImpulse = minImpulse;
+			row._maxImpulse = maxImpulse;
+			row._initialImpulse = initialImpulse;
+			_rows.PushBack(row);
+			return _rows.Size() - 1;
+		}
+
+		uint32 ConstraintSolver::AddFrictionRow(const uint32 bodyIndexA, const uint32 bodyIndexB, const Real2& tangent, const Real angularA, const Real angularB, const uint32 normalRowIndex, const Real frictionCoefficient, const Real initialImpulse)
+		{
+			MINT_ASSERT(normalRowIndex < _rows.Size(), "The normal row must be added first!");
+
+			const uint32 rowIndex = AddRow(bodyIndexA, bodyIndexB, tangent, angularA, angularB, Real(0), Real(0), Real(0), initialImpulse);
+			_rows[rowIndex]._normalRowIndex = normalRowIndex;
+			_rows[rowIndex]._frictionCoefficient = frictionCoefficient;
+			return rowIndex;
+		}
+
+		void ConstraintSolver::Solve(const uint32 iterationCount)
+		{
+			using namespace ConstraintSolverInternal;
+
+			BuildColors();
+			WarmStart();
+
+			for (uint32 iteration = 0; iteration < iterationCount; ++iteration)
 			{
-				return;
+				// 마찰의 한계는 iteration 을 시작할 때의 normal impulse 로 정한다.
+				for (const FrictionRow& frictionRow : _frictionRows)
+				{
+					const Real maxImpulse = frictionRow._frictionCoefficient * _impulses[frictionRow._normalSlot];
+					_minImpulses[frictionRow._slot] = -maxImpulse;
+					_maxImpulses[frictionRow._slot] = maxImpulse;
+				}
+
+				const uint32 colorCount = _colorRowRanges.Size();
+				for (uint32 color = 0; color < colorCount; ++color)
+				{
+					const RowRange& rowRange = _colorRowRanges[color];
+					if (color < kMaxColorCount)
+					{
+						SolveRows<SolverLane>(rowRange._begin, rowRange._end);
+					}
+					else
+					{
+						SolveRows<Lane::Scalar>(rowRange._begin, rowRange._end);
+					}
+				}
+			}
+		}
+
+		void ConstraintSolver::BuildColors()
+		{
+			using namespace ConstraintSolverInternal;
+
+			// Greedy coloring: 두 dynamic body 가 아직 쓰지 않은 가장 작은 색을 고른다.
+			// 움직이지 않는 body 는 여러 lane 이 같이 써도 속도가 바뀌지 않으므로 색을 나누지 않는다.
+			const uint32 bodyCount = _velocityXs.Size();
+			_bodyColorMasks.Resize(bodyCount);
+			for (uint64& bodyColorMask : _bodyColorMasks)
+			{
+				bodyColorMask = 0;
+			}
+
+			const uint32 rowCount = _rows.Size();
+			_rowColors.Resize(rowCount);
+			_colorRowCounts.Resize(kMaxColorCount + 1);
+			for (uint32& colorRowCount : _colorRowCounts)
+			{
+				colorRowCount = 0;
+			}
+
+			uint32 colorCount = 0;
+			for (uint32 rowIndex = 0; rowIndex < rowCount; ++rowIndex)
+			{
+				const Row& row = _rows[rowIndex];
+				const bool isDynamicA = IsDynamicBody(row._bodyIndexA);
+				const bool isDynamicB = IsDynamicBody(row._bodyIndexB);
+				const uint64 usedColorMask = ((isDynamicA == true) ? _bodyColorMasks[row._bodyIndexA] : 0) | ((isDynamicB == true) ? _bodyColorMasks[row._bodyIndexB] : 0);
+				uint32 color = kMaxColorCount;
+				unsigned long freeColor = 0;
+				if (_BitScanForward64(&freeColor, ~usedColorMask) != 0)
+				{
+					color = static_cast<uint32>(freeColor);
+					if (isDynamicA == true)
+					{
+						_bodyColorMasks[row._bodyIndexA] |= (1ull << color);
+					}
+					if (isDynamicB == true)
+					{
+						_bodyColorMasks[row._bodyIndexB] |= (1ull << color);
+					}
+				}
+				_rowColors[rowIndex] = color;
+				++_colorRowCounts[color];
+				colorCount = Max(colorCount, color + 1);
+			}
+
+			// 색마다 lane 수의 배수가 되도록 빈 row 를 채운다. 마지막 색은 하나씩 풀므로 채우지 않는다.
+			_colorRowRanges.Resize(colorCount);
+			uint32 slotCount = 0;
+			for (uint32 color = 0; color < colorCount; ++color)
+			{
+				const uint32 colorRowCount = _colorRowCounts[color];
+				const uint32 paddedRowCount = (color < kMaxColorCount) ? (colorRowCount + SolverLane::kWidth - 1) / SolverLane::kWidth * SolverLane::kWidth : colorRowCount;
+				_colorRowRanges[color]._begin = slotCount;
+				_colorRowRanges[color]._end = slotCount + paddedRowCount;
+				// 이제부터는 그 색의 다음 row 를 넣을 slot
+				_colorRowCounts[color] = slotCount;
+				slotCount += paddedRowCount;
+			}
+
+			_bodyIndexAs.Resize(slotCount);
+			_bodyIndexBs.Resize(slotCount);
+			_directionXs.Resize(slotCount);
+			_directionYs.Resize(slotCount);
+			_angularAs.Resize(slotCount);
+			_angularBs.Resize(slotCount);
+			_effectiveMasses.Resize(slotCount);
+			_biases.Resize(slotCount);
+			_minImpulses.Resize(slotCount);
+			_maxImpulses.Resize(slotCount);
+			_impulses.Resize(slotCount);
+			_rowSlots.Resize(rowCount);
+			for (uint32 rowIndex = 0; rowIndex < rowCount; ++rowIndex)
+			{
+				const Row& row = _rows[rowIndex];
+				const uint32 slot = _colorRowCounts[_rowColors[rowIndex]]++;
+				_rowSlots[rowIndex] = slot;
+
+				// J * M^-1 * J^T
+				const Real inverseEffectiveMass = (_inverseMasses[row._bodyIndexA] + _inverseMasses[row._bodyIndexB]) * row._direction.Dot(row._direction)
+					+ _inverseInertias[row._bodyIndexA] * row._angularA * row._angularA + _inverseInertias[row._bodyIndexB] * row._angularB * row._angularB;
+				_bodyIndexAs[slot] = row._bodyIndexA;
+				_bodyIndexBs[slot] = row._bodyIndexB;
+				_directionXs[slot] = row._direction._x;
+				_directionYs[slot] = row._direction._y;
+				_angularAs[slot] = row._angularA;
+				_angularBs[slot] = row._angularB;
+				_effectiveMasses[slot] = (inverseEffectiveMass > Real(0)) ? Real(1) / inverseEffectiveMass : Real(0);
+				_biases[slot] = row._bias;
+				_minImpulses[slot] = row._minImpulse;
+				_maxImpulses[slot] = row._maxImpulse;
+				_impulses[slot] = row._initialImpulse;
+			}
+
+			// 빈 row 는 0 번 body 를 쓰고 impulse 가 늘 0 이다.
+			for (uint32 color = 0; color < colorCount; ++color)
+			{
+				for (uint32 slot = _colorRowCounts[color]; slot < _colorRowRanges[color]._end; ++slot)
+				{
+					_bodyIndexAs[slot] = 0;
+					_bodyIndexBs[slot] = 0;
+					_directionXs[slot] = Real(0);
+					_directionYs[slot] = Real(0);
+					_angularAs[slot] = Real(0);
+					_angularBs[slot] = Real(0);
+					_effectiveMasses[slot] = Real(0);
+					_biases[slot] = Real(0);
+					_minImpulses[slot] = Real(0);
+					_maxImpulses[slot] = Real(0);
+					_impulses[slot] = Real(0);
+				}
+			}
+
+			_frictionRows.Clear();
+			for (uint32 rowIndex = 0; rowIndex < rowCount; ++rowIndex)
+			{
+				const Row& row = _rows[rowIndex];
+				if (row._normalRowIndex != kInvalidIndexUint32)
+				{
+					FrictionRow frictionRow;
+					frictionRow._slot = _rowSlots[rowIndex];
+					frictionRow._normalSlot = _rowSlots[row._normalRowIndex];
+					frictionRow._frictionCoefficient = row._frictionCoefficient;
+					_frictionRows.PushBack(frictionRow);
+				}
+			}
+		}
+
+		void ConstraintSolver::WarmStart()
+		{
+			// 이전 step 의 impulse 를 먼저 가해 두면 적은 iteration 으로도 수렴한다.
+			for (const Row& row : _rows)
+			{
+				const Real impulse = row._initialImpulse;
+				if (impulse == Real(0))
+				{
+					continue;
+				}
+
+				const uint32 a = row._bodyIndexA;
+				const uint32 b = row._bodyIndexB;
+				_velocityXs[a] -= _inverseMasses[a] * impulse * row._direction._x;
+				_velocityYs[a] -= _inverseMasses[a] * impulse * row._direction._y;
+				_angularVelocities[a] -= _inverseInertias[a] * row._angularA * impulse;
+				_velocityXs[b] += _inverseMasses[b] * impulse * row._direction._x;
+				_velocityYs[b] += _inverseMasses[b] * impulse * row._direction._y;
+				_angularVelocities[b] += _inverseInertias[b] * row._angularB * impulse;
+			}
+		}
+
+		template<typename L>
+		void ConstraintSolver::SolveRows(const uint32 slotBegin, const uint32 slotEnd)
+		{
+			// impulse 를 가한 뒤의 속도가 J * (v + M^-1 * J^T * lambda) + bias = 0 을 만족하도록
+			// lambda = -(J * v + bias) / (J * M^-1 * J^T) 를 구하고, 누적 impulse 가 범위를 넘지 않도록 자른다.
+			using Type = typename L::Type;
+
+			const uint32* const bodyIndexAs = _bodyIndexAs.Data();
+			const uint32* const bodyIndexBs = _bodyIndexBs.Data();
+			Real* const velocityXs = _velocityXs.Data();
+			Real* const velocityYs = _velocityYs.Data();
+			Real* const angularVelocities = _angularVelocities.Data();
+			const Real* const inverseMasses = _inverseMasses.Data();
+			const Real* const inverseInertias = _inverseInertias.Data();
+			for (uint32 slot = slotBegin; slot < slotEnd; slot += L::kWidth)
+			{
+				const uint32* const indexAs = bodyIndexAs + slot;
+				const uint32* const indexBs = bodyIndexBs + slot;
+				const Type velocityXA = L::Gather(velocityXs, indexAs);
+				const Type velocityYA = L::Gather(velocityYs, indexAs);
+				const Type angularVelocityA = L::Gather(angularVelocities, indexAs);
+				const Type velocityXB = L::Gather(velocityXs, indexBs);
+				const Type velocityYB = L::Gather(velocityYs, indexBs);
+				const Type angularVelocityB = L::Gather(angularVelocities, indexBs);
+				const Type directionX = L::Load(_directionXs.Data() + slot);
+				const Type directionY = L::Load(_directionYs.Data() + slot);
+				const Type angularA = L::Load(_angularAs.Data() + slot);
+				const Type angularB = L::Load(_angularBs.Data() + slot);
+
+				// J * v
+				const Type jv = L::Sub(L::Add(L::Add(L::Mul(directionX, L::Sub(velocityXB, velocityXA)), L::Mul(directionY, L::Sub(velocityYB, velocityYA))), L::Mul(angularB, angularVelocityB)), L::Mul(angularA, angularVelocityA));
+				const Type oldImpulse = L::Load(_impulses.Data() + slot);
+				const Type unclampedImpulse = L::Sub(oldImpulse, L::Mul(L::Load(_effectiveMasses.Data() + slot), L::Add(jv, L::Load(_biases.Data() + slot))));
+				const Type newImpulse = L::Min(L::Max(unclampedImpulse, L::Load(_minImpulses.Data() + slot)), L::Load(_maxImpulses.Data() + slot));
+				L::Store(_impulses.Data() + slot, newImpulse);
+				const Type lambda = L::Sub(newImpulse, oldImpulse);
+
+				// v += M^-1 * J^T * lambda
+				const Type linearImpulseA = L::Mul(L::Gather(inverseMasses, indexAs), lambda);
+				const Type linearImpulseB = L::Mul(L::Gather(inverseMasses, indexBs), lambda);
+				L::Scatter(velocityXs, indexAs, L::Sub(velocityXA, L::Mul(linearImpulseA, directionX)));
+				L::Scatter(velocityYs, indexAs, L::Sub(velocityYA, L::Mul(linearImpulseA, directionY)));
+				L::Scatter(angularVelocities, indexAs, L::Sub(angularVelocityA, L::Mul(L::Mul(L::Gather(inverseInertias, indexAs), angularA), lambda)));
+				L::Scatter(velocityXs, indexBs, L::Add(velocityXB, L::Mul(linearImpulseB, directionX)));
+				L::Scatter(velocityYs, indexBs, L::Add(velocityYB, L::Mul(linearImpulseB, directionY)));
+				L::Scatter(angularVelocities, indexBs, L::Add(angularVelocityB, L::Mul(L::Mul(L::Gather(inverseInertias, indexBs), angularB), lambda)));
 			}
-			const float lambda = numerator / denominator;
-
-			const auto delta_v = inverseM * JT * lambda;
-			VecF<2> delta_vA;
-			VecF<2> delta_vB;
-			delta_vA.SetComponent(0, delta_v.GetElement(0, 0));
-			delta_vA.SetComponent(1, delta_v.GetElement(1, 0));
-			delta_vB.SetComponent(0, delta_v.GetElement(2, 0));
-			delta_vB.SetComponent(1, delta_v.GetElement(3, 0));
-
-			bodyA._linearVelocity += Float2(delta_vA.X(), delta_vA.Y());
-			bodyB._linearVelocity += Float2(delta_vB.X(), delta_vB.Y());
 		}
 	}
-}
\ No newline at end of file
+}
+
+#if defined __GNUC__ && !defined __clang__
+#pragma GCC pop_options
+#endif
@@ -0,0 +1,500 @@
+﻿#include <MintPhysics/Include/DynamicAABBTree.hpp>
+
+
+namespace mint
+{
+	namespace Physics2D
+	{
+		DynamicAABBTree::DynamicAABBTree()
+			: DynamicAABBTree(0.1f)
+		{
+			__noop;
+		}
+
+		DynamicAABBTree::DynamicAABBTree(const float fatMargin)
+			: _rootIndex{ kInvalidIndexUint32 }
+			, _freeNodeIndex{ kInvalidIndexUint32 }
+			, _leafCount{ 0 }
+			, _fatMargin{ fatMargin }
+		{
+			__noop;
+		}
+
+		uint32 DynamicAABBTree::CreateProxy(const Float2& min, const Float2& max, const uint32 userData)
+		{
+			const uint32 proxyID = AllocateNode();
+			Node& node = _nodes[proxyID];
+			node._min = min - Float2(_fatMargin);
+			node._max = max + Float2(_fatMargin);
+			node._height = 0;
+			node._userData = userData;
+			InsertLeaf(proxyID);
+			++_leafCount;
+			return proxyID;
+		}
+
+		void DynamicAABBTree::DestroyProxy(const uint32 proxyID)
+		{
+			MINT_ASSERT(_nodes[proxyID].IsLeaf() == true && _nodes[proxyID]._height == 0, "Leaf 가 아닙니다!");
+
+			RemoveLeaf(proxyID);
+			FreeNode(proxyID);
+			--_leafCount;
+		}
+
+		bool DynamicAABBTree::MoveProxy(const uint32 proxyID, const Float2& min, const Float2& max)
+		{
+			MINT_ASSERT(_nodes[proxyID].IsLeaf() == true && _nodes[proxyID]._height == 0, "Leaf 가 아닙니다!");
+
+			Node& node = _nodes[proxyID];
+			if (node._min._x <= min._x && node._min._y <= min._y && max._x <= node._max._x && max._y <= node._max._y)
+			{
+				return false;
+			}
+
+			RemoveLeaf(proxyID);
+			node._min = min - Float2(_fatMargin);
+			node._max = max + Float2(_fatMargin);
+			InsertLeaf(proxyID);
+			return true;
+		}
+
+		void DynamicAABBTree::Clear()
+		{
+			_nodes.Clear();
+			_rootIndex = kInvalidIndexUint32;
+			_freeNodeIndex = kInvalidIndexUint32;
+			_leafCount = 0;
+		}
+
+		void DynamicAABBTree::RebuildSAH()
+		{
+			Vector<uint32> leafIndices;
+			leafIndices.Reserve(_leafCount);
+			const uint32 nodeCount = _nodes.Size();
+			for (uint32 nodeIndex = 0; nodeIndex < nodeCount; ++nodeIndex)
+			{
+				if (_nodes[nodeIndex]._height < 0)
+				{
+					continue;
+				}
+
+				if (_nodes[nodeIndex].IsLeaf() == true)
+				{
+					leafIndices.PushBack(nodeIndex);
+				}
+				else
+				{
+					FreeNode(nodeIndex);
+				}
+			}
+
+			if (leafIndices.IsEmpty() == true)
+			{
+				_rootIndex = kInvalidIndexUint32;
+				return;
+			}
+
+			_rootIndex = BuildSAH(leafIndices.Data(), leafIndices.Size(), 0);
+			_nodes[_rootIndex]._parent = kInvalidIndexUint32;
+		}
+
+		int32 DynamicAABBTree::GetHeight() const noexcept
+		{
+			return (_rootIndex == kInvalidIndexUint32) ? 0 : _nodes[_rootIndex]._height;
+		}
+
+		float DynamicAABBTree::ComputeCost() const noexcept
+		{
+			float cost = 0.0f;
+			for (const Node& node : _nodes)
+			{
+				if (node._height > 0)
+				{
+					cost += ComputePerimeter(node._min, node._max);
+				}
+			}
+			return cost;
+		}
+
+		bool DynamicAABBTree::Validate() const noexcept
+		{
+			if (_rootIndex == kInvalidIndexUint32)
+			{
+				return _leafCount == 0;
+			}
+
+			uint32 freeNodeCount = 0;
+			for (uint32 freeNodeIndex = _freeNodeIndex; freeNodeIndex != kInvalidIndexUint32; freeNodeIndex = _nodes[freeNodeIndex]._parent)
+			{
+				++freeNodeCount;
+			}
+
+			// leaf 가 n 개면 내부 node 는 n - 1 개다.
+			if (freeNodeCount + _leafCount * 2 - 1 != _nodes.Size())
+			{
+				return false;
+			}
+			return ValidateNode(_rootIndex, kInvalidIndexUint32);
+		}
+
+		uint32 DynamicAABBTree::AllocateNode()
+		{
+			if (_freeNodeIndex == kInvalidIndexUint32)
+			{
+				_nodes.PushBack(Node());
+				return _nodes.Size() - 1;
+			}
+
+			const uint32 nodeIndex = _freeNodeIndex;
+			_freeNodeIndex = _nodes[nodeIndex]._parent;
+			_nodes[nodeIndex] = Node();
+			return nodeIndex;
+		}
+
+		void DynamicAABBTree::FreeNode(const uint32 nodeIndex)
+		{
+			Node& node = _nodes[nodeIndex];
+			node._parent = _freeNodeIndex;
+			node._childA = kInvalidIndexUint32;
+			node._childB = kInvalidIndexUint32;
+			node._height = -1;
+			_freeNodeIndex = nodeIndex;
+		}
+
+		void DynamicAABBTree::InsertLeaf(const uint32 leafIndex)
+		{
+			if (_rootIndex == kInvalidIndexUint32)
+			{
+				_rootIndex = leafIndex;
+				_nodes[leafIndex]._parent = kInvalidIndexUint32;
+				return;
+			}
+
+			// 형제가 될 node 를 고른다.
+			// 여기서 멈추면 이 node 의 부모를 새로 만들어야 하고, 내려가면 이 node 의 AABB 가 leaf 만큼 늘어난다. 둘레의 증가량이 더 작은 쪽을 고른다.
+			const Float2 leafMin = _nodes[leafIndex]._min;
+			const Float2 leafMax = _nodes[leafIndex]._max;
+			uint32 siblingIndex = _rootIndex;
+			while (_nodes[siblingIndex].IsLeaf() == false)
+			{
+				const Node& node = _nodes[siblingIndex];
+				const float perimeter = ComputePerimeter(node._min, node._max);
+				const float combinedPerimeter = ComputePerimeter(Float2::Min(node._min, leafMin), Float2::Max(node._max, leafMax));
+				const float cost = 2.0f * combinedPerimeter;
+				const float inheritanceCost = 2.0f * (combinedPerimeter - perimeter);
+
+				float childCosts[2];
+				const uint32 childIndices[2] = { node._childA, node._childB };
+				for (uint32 i = 0; i < 2; ++i)
+				{
+					const Node& child = _nodes[childIndices[i]];
+					const float childCombinedPerimeter = ComputePerimeter(Float2::Min(child._min, leafMin), Float2::Max(child._max, leafMax));
+					childCosts[i] = inheritanceCost + ((child.IsLeaf() == true) ? childCombinedPerimeter : childCombinedPerimeter - ComputePerimeter(child._min, child._max));
+				}
+
+				if (cost < childCosts[0] && cost < childCosts[1])
+				{
+					break;
+				}
+				siblingIndex = (childCosts[0] < childCosts[1]) ? node._childA : node._childB;
+			}
+
+			const uint32 oldParentIndex = _nodes[siblingIndex]._parent;
+			const uint32 newParentIndex = AllocateNode();
+			Node& newParent = _nodes[newParentIndex];
+			newParent._parent = oldParentIndex;
+			newParent._childA = siblingIndex;
+			newParent._childB = leafIndex;
+			newParent._min = Float2::Min(_nodes[siblingIndex]._min, leafMin);
+			newParent._max = Float2::Max(_nodes[siblingIndex]._max, leafMax);
+			newParent._height = _nodes[siblingIndex]._height + 1;
+			if (oldParentIndex == kInvalidIndexUint32)
+			{
+				_rootIndex = newParentIndex;
+			}
+			else if (_nodes[oldParentIndex]._childA == siblingIndex)
+			{
+				_nodes[oldParentIndex]._childA = newParentIndex;
+			}
+			else
+			{
+				_nodes[oldParentIndex]._childB = newParentIndex;
+			}
+			_nodes[siblingIndex]._parent = newParentIndex;
+			_nodes[leafIndex]._parent = newParentIndex;
+
+			Refit(newParentIndex);
+		}
+
+		void DynamicAABBTree::RemoveLeaf(const uint32 leafIndex)
+		{
+			if (leafIndex == _rootIndex)
+			{
+				_rootIndex = kInvalidIndexUint32;
+				return;
+			}
+
+			const uint32 parentIndex = _nodes[leafIndex]._parent;
+			const uint32 grandParentIndex = _nodes[parentIndex]._parent;
+			const uint32 siblingIndex = (_nodes[parentIndex]._childA == leafIndex) ? _nodes[parentIndex]._childB : _nodes[parentIndex]._childA;
+			_nodes[siblingIndex]._parent = grandParentIndex;
+			if (grandParentIndex == kInvalidIndexUint32)
+			{
+				_rootIndex = siblingIndex;
+			}
+			else if (_nodes[grandParentIndex]._childA == parentIndex)
+			{
+				_nodes[grandParentIndex]._childA = siblingIndex;
+			}
+			else
+			{
+				_nodes[grandParentIndex]._childB = siblingIndex;
+			}
+			FreeNode(parentIndex);
+			_nodes[leafIndex]._parent = kInvalidIndexUint32;
+
+			Refit(grandParentIndex);
+		}
+
+		uint32 DynamicAABBTree::Balance(const uint32 nodeIndex)
+		{
+			// 두 자식의 높이가 2 이상 차이 나면 높은 쪽 자식 (C) 을 nodeIndex (A) 자리로 올리고,
+			// C 의 두 자식 중 낮은 쪽을 A 의 자식으로 내린다.
+			Node& a = _nodes[nodeIndex];
+			if (a.IsLeaf() == true || a._height < 2)
+			{
+				return nodeIndex;
+			}
+
+			const int32 balance = _nodes[a._childB]._height - _nodes[a._childA]._height;
+			if (-1 <= balance && balance <= 1)
+			{
+				return nodeIndex;
+			}
+
+			const bool isRightHeavy = (balance > 1);
+			const uint32 cIndex = isRightHeavy ? a._childB : a._childA;
+			const uint32 bIndex = isRightHeavy ? a._childA : a._childB;
+			Node& c = _nodes[cIndex];
+			const Node& b = _nodes[bIndex];
+			const uint32 fIndex = c._childA;
+			const uint32 gIndex = c._childB;
+			Node& f = _nodes[fIndex];
+			Node& g = _nodes[gIndex];
+
+			c._childA = nodeIndex;
+			c._parent = a._parent;
+			a._parent = cIndex;
+			if (c._parent == kInvalidIndexUint32)
+			{
+				_rootIndex = cIndex;
+			}
+			else if (_nodes[c._parent]._childA == nodeIndex)
+			{
+				_nodes[c._parent]._childA = cIndex;
+			}
+			else
+			{
+				_nodes[c._parent]._childB = cIndex;
+			}
+
+			// 높은 쪽 손자는 C 에 남고 낮은 쪽 손자는 A 로 간다.
+			const bool isFHigher = (f._height > g._height);
+			const uint32 keptIndex = isFHigher ? fIndex : gIndex;
+			const uint32 movedIndex = isFHigher ? gIndex : fIndex;
+			Node& kept = _nodes[keptIndex];
+			Node& moved = _nodes[movedIndex];
+			c._childB = keptIndex;
+			if (isRightHeavy)
+			{
+				a._childB = movedIndex;
+			}
+			else
+			{
+				a._childA = movedIndex;
+			}
+			moved._parent = nodeIndex;
+
+			a._min = Float2::Min(b._min, moved._min);
+			a._max = Float2::Max(b._max, moved._max);
+			a._height = 1 + Max(b._height, moved._height);
+			c._min = Float2::Min(a._min, kept._min);
+			c._max = Float2::Max(a._max, kept._max);
+			c._height = 1 + Max(a._height, kept._height);
+			return cIndex;
+		}
+
+		void DynamicAABBTree::Refit(uint32 nodeIndex)
+		{
+			while (nodeIndex != kInvalidIndexUint32)
+			{
+				nodeIndex = Balance(nodeIndex);
+
+				Node& node = _nodes[nodeIndex];
+				const Node& childA = _nodes[node._childA];
+				const Node& childB = _nodes[node._childB];
+				node._min = Float2::Min(childA._min, childB._min);
+				node._max = Float2::Max(childA._max, childB._max);
+				node._height = 1 + Max(childA._height, childB._height);
+				nodeIndex = node._parent;
+			}
+		}
+
+		uint32 DynamicAABBTree::BuildSAH(uint32* const leafIndices, const uint32 leafCount, const uint32 depth)
+		{
+			if (leafCount == 1)
+			{
+				return leafIndices[0];
+			}
+
+			// 중심 (의 2 배) 의 범위를 축마다 kBinCount 칸으로 나누고, 칸 경계에서 나눴을 때의 SAH 비용이 가장 작은 곳을 고른다.
+			// 비용 = 왼쪽 AABB 둘레 * 왼쪽 leaf 수 + 오른쪽 AABB 둘레 * 오른쪽 leaf 수
+			static constexpr uint32 kBinCount = 16;
+			// 한 쪽으로 치우친 분할이 반복되면 재귀가 깊어지므로, 이보다 깊어지면 개수로 반씩 나눈다.
+			static constexpr uint32 kMaxSAHDepth = 64;
+
+			Float2 centroidMin = _nodes[leafIndices[0]]._min + _nodes[leafIndices[0]]._max;
+			Float2 centroidMax = centroidMin;
+			for (uint32 i = 1; i < leafCount; ++i)
+			{
+				const Float2 centroid = _nodes[leafIndices[i]]._min + _nodes[leafIndices[i]]._max;
+				centroidMin = Float2::Min(centroidMin, centroid);
+				centroidMax = Float2::Max(centroidMax, centroid);
+			}
+
+			uint32 bestAxis = kInvalidIndexUint32;
+			uint32 bestSplit = 0;
+			float bestCost = 0.0f;
+			for (uint32 axis = 0; axis < 2 && depth < kMaxSAHDepth; ++axis)
+			{
+				const float extent = centroidMax[axis] - centroidMin[axis];
+				if (extent <= 0.0f)
+				{
+					continue;
+				}
+
+				uint32 binCounts[kBinCount] = {};
+				Float2 binMins[kBinCount];
+				Float2 binMaxs[kBinCount];
+				const float binScale = static_cast<float>(kBinCount) / extent;
+				for (uint32 i = 0; i < leafCount; ++i)
+				{
+					const Node& leaf = _nodes[leafIndices[i]];
+					const uint32 binIndex = Min(static_cast<uint32>(((leaf._min[axis] + leaf._max[axis]) - centroidMin[axis]) * binScale), kBinCount - 1);
+					binMins[binIndex] = (binCounts[binIndex] == 0) ? leaf._min : Float2::Min(binMins[binIndex], leaf._min);
+					binMaxs[binIndex] = (binCounts[binIndex] == 0) ? leaf._max : Float2::Max(binMaxs[binIndex], leaf._max);
+					++binCounts[binIndex];
+				}
+
+				// 오른쪽부터 누적한 비용
+				float rightCosts[kBinCount];
+				uint32 rightCount = 0;
+				Float2 rightMin;
+				Float2 rightMax;
+				for (uint32 binIndex = kBinCount - 1; binIndex > 0; --binIndex)
+				{
+					if (binCounts[binIndex] > 0)
+					{
+						rightMin = (rightCount == 0) ? binMins[binIndex] : Float2::Min(rightMin, binMins[binIndex]);
+						rightMax = (rightCount == 0) ? binMaxs[binIndex] : Float2::Max(rightMax, binMaxs[binIndex]);
+						rightCount += binCounts[binIndex];
+					}
+					rightCosts[binIndex] = (rightCount == 0) ? -1.0f : ComputePerimeter(rightMin, rightMax) * static_cast<float>(rightCount);
+				}
+
+				uint32 leftCount = 0;
+				Float2 leftMin;
+				Float2 leftMax;
+				for (uint32 split = 0; split < kBinCount - 1; ++split)
+				{
+					if (binCounts[split] > 0)
+					{
+						leftMin = (leftCount == 0) ? binMins[split] : Float2::Min(leftMin, binMins[split]);
+						leftMax = (leftCount == 0) ? binMaxs[split] : Float2::Max(leftMax, binMaxs[split]);
+						leftCount += binCounts[split];
+					}
+					if (leftCount == 0 || rightCosts[split + 1] < 0.0f)
+					{
+						continue;
+					}
+
+					const float cost = ComputePerimeter(leftMin, leftMax) * static_cast<float>(leftCount) + rightCosts[split + 1];
+					if (bestAxis == kInvalidIndexUint32 || cost < bestCost)
+					{
+						bestAxis = axis;
+						bestSplit = split;
+						bestCost = cost;
+					}
+				}
+			}
+
+			uint32 middle = leafCount / 2;
+			if (bestAxis != kInvalidIndexUint32)
+			{
+				// [0, middle) 에 bestSplit 이하의 칸에 든 leaf 를 모은다.
+				const float binScale = static_cast<float>(kBinCount) / (centroidMax[bestAxis] - centroidMin[bestAxis]);
+				uint32 begin = 0;
+				uint32 end = leafCount;
+				while (begin < end)
+				{
+					const Node& leaf = _nodes[leafIndices[begin]];
+					const uint32 binIndex = Min(static_cast<uint32>(((leaf._min[bestAxis] + leaf._max[bestAxis]) - centroidMin[bestAxis]) * binScale), kBinCount - 1);
+					if (binIndex <= bestSplit)
+					{
+						++begin;
+					}
+					else
+					{
+						--end;
+						const uint32 temp = leafIndices[begin];
+						leafIndices[begin] = leafIndices[end];
+						leafIndices[end] = temp;
+					}
+				}
+				middle = begin;
+			}
+
+			const uint32 childAIndex = BuildSAH(leafIndices, middle, depth + 1);
+			const uint32 childBIndex = BuildSAH(leafIndices + middle, leafCount - middle, depth + 1);
+			const uint32 nodeIndex = AllocateNode();
+			Node& node = _nodes[nodeIndex];
+			const Node& childA = _nodes[childAIndex];
+			const Node& childB = _nodes[childBIndex];
+			node._childA = childAIndex;
+			node._childB = childBIndex;
+			node._min = Float2::Min(childA._min, childB._min);
+			node._max = Float2::Max(childA._max, childB._max);
+			node._height = 1 + Max(childA._height, childB._height);
+			_nodes[childAIndex]._parent = nodeIndex;
+			_nodes[childBIndex]._parent = nodeIndex;
+			return nodeIndex;
+		}
+
+		bool DynamicAABBTree::ValidateNode(const uint32 nodeIndex, const uint32 parentIndex) const noexcept
+		{
+			const Node& node = _nodes[nodeIndex];
+			if (node._parent != parentIndex || node._height < 0)
+			{
+				return false;
+			}
+
+			if (node.IsLeaf() == true)
+			{
+				return node._height == 0;
+			}
+
+			const Node& childA = _nodes[node._childA];
+			const Node& childB = _nodes[node._childB];
+			if (node._height != 1 + Max(childA._height, childB._height))
+			{
+				return false;
+			}
+			if (node._min != Float2::Min(childA._min, childB._min) || node._max != Float2::Max(childA._max, childB._max))
+			{
+				return false;
+			}
+			return ValidateNode(node._childA, nodeIndex) && ValidateNode(node._childB, nodeIndex);
+		}
+	}
+}
@@ -93,7 +93,8 @@ namespace mint
 			return _points[closestPointIndex];
 		}
 
-		MINT_INLINE Float2 GJK2D_ComputeMinkowskiDifferencePoint(const CollisionShape& shapeA, const CollisionShape& shapeB, const Float2& direction)
+		template<typename ShapeType>
+		MINT_INLINE Float2 GJK2D_ComputeMinkowskiDifferencePoint(const ShapeType& shapeA, const ShapeType& shapeB, const Float2& direction)
 		{
 			return shapeA.ComputeSupportPoint(direction) - shapeB.ComputeSupportPoint(-direction);
 		}
@@ -200,7 +201,9 @@ namespace mint
 			return true;
 		}
 
-		bool Intersect_GJK(const CollisionShape& shapeA, const CollisionShape& shapeB, GJKInfo* const outGJKInfo)
+		// ShapeType 은 CollisionShape 나 TransformedCollisionShape
+		template<typename ShapeType>
+		bool GJK2D_Intersect(const ShapeType& shapeA, const ShapeType& shapeB, GJKInfo* const outGJKInfo)
 		{
 			Float2 direction = Float2(1, 0);
 			if (outGJKInfo != nullptr)
@@ -270,6 +273,180 @@ namespace mint
 			return result;
 		}
 
+		bool Intersect_GJK(const CollisionShape& shapeA, const CollisionShape& shapeB, GJKInfo* const outGJKInfo)
+		{
+			return GJK2D_Intersect(shapeA, shapeB, outGJKInfo);
+		}
+
+		bool Intersect_GJK(const TransformedCollisionShape& shapeA, const TransformedCollisionShape& shapeB, GJKInfo* const outGJKInfo)
+		{
+			return GJK2D_Intersect(shapeA, shapeB, outGJKInfo);
+		}
+
+		// simplex 에서 원점에 가장 가까운 점을 구하고, simplex 에는 그 점을 만드는 점들만 남긴다.
+		// 원점이 삼각형 안에 있으면 false 를 반환한다.
+		bool GJK2D_ReduceToClosestPoint(Float2 (&inoutPoints)[3], uint32& inoutPointCount, Float2& outClosestPoint)
+		{
+			if (inoutPointCount == 1)
+			{
+				outClosestPoint = inoutPoints[0];
+				return true;
+			}
+
+			const Float2 a = inoutPoints[0];
+			const Float2 b = inoutPoints[1];
+			const Float2 ab = b - a;
+			if (inoutPointCount == 2)
+			{
+				const float abLengthSq = ab.LengthSqaure();
+				const float t = -a.Dot(ab);
+				if (t <= 0.0f || abLengthSq <= Math::kFloatEpsilon)
+				{
+					inoutPointCount = 1;
+					outClosestPoint = a;
+				}
+				else if (t >= abLengthSq)
+				{
+					inoutPoints[0] = b;
+					inoutPointCount = 1;
+					outClosestPoint = b;
+				}
+				else
+				{
+					outClosestPoint = a + ab * (t / abLengthSq);
+				}
+				return true;
+			}
+
+			// Voronoi regions of the triangle
+			const Float2 c = inoutPoints[2];
+			const Float2 ac = c - a;
+			const float d1 = -ab.Dot(a);
+			const float d2 = -ac.Dot(a);
+			if (d1 <= 0.0f && d2 <= 0.0f)
+			{
+				inoutPointCount = 1;
+				outClosestPoint = a;
+				return true;
+			}
+
+			const float d3 = -ab.Dot(b);
+			const float d4 = -ac.Dot(b);
+			if (d3 >= 0.0f && d4 <= d3)
+			{
+				inoutPoints[0] = b;
+				inoutPointCount = 1;
+				outClosestPoint = b;
+				return true;
+			}
+
+			const float vc = d1 * d4 - d3 * d2;
+			if (vc <= 0.0f && d1 >= 0.0f && d3 <= 0.0f)
+			{
+				inoutPointCount = 2;
+				outClosestPoint = a + ab * (d1 / (d1 - d3));
+				return true;
+			}
+
+			const float d5 = -ab.Dot(c);
+			const float d6 = -ac.Dot(c);
+			if (d6 >= 0.0f && d5 <= d6)
+			{
+				inoutPoints[0] = c;
+				inoutPointCount = 1;
+				outClosestPoint = c;
+				return true;
+			}
+
+			const float vb = d5 * d2 - d1 * d6;
+			if (vb <= 0.0f && d2 >= 0.0f && d6 <= 0.0f)
+			{
+				inoutPoints[1] = c;
+				inoutPointCount = 2;
+				outClosestPoint = a + ac * (d2 / (d2 - d6));
+				return true;
+			}
+
+			const float va = d3 * d6 - d5 * d4;
+			if (va <= 0.0f && (d4 - d3) >= 0.0f && (d5 - d6) >= 0.0f)
+			{
+				inoutPoints[0] = c;
+				inoutPointCount = 2;
+				outClosestPoint = b + (c - b) * ((d4 - d3) / ((d4 - d3) + (d5 - d6)));
+				return true;
+			}
+
+			// The origin is inside the triangle.
+			return false;
+		}
+
+		template<typename ShapeType>
+		bool GJK2D_ComputeDistance(const ShapeType& shapeA, const ShapeType& shapeB, Float2& outNormal, float& outDistance)
+		{
+			static constexpr uint32 kMaxLoopCount = 32;
+			// 거리의 상한과 하한의 차이가 이만큼 (상대 오차) 안으로 들어오면 멈춘다.
+			static constexpr float kTolerance = 0.0001f;
+
+			Float2 points[3];
+			uint32 pointCount = 1;
+			points[0] = GJK2D_ComputeMinkowskiDifferencePoint(shapeA, shapeB, Float2(1, 0));
+			Float2 closestPoint = points[0];
+			float lowerBound = 0.0f;
+			for (uint32 loopCount = 0; loopCount < kMaxLoopCount; ++loopCount)
+			{
+				const float upperBound = closestPoint.Length();
+				if (upperBound <= Math::kFloatEpsilon)
+				{
+					return false;
+				}
+
+				// 모든 Minkowski difference 의 점은 closestPoint 방향으로 이 support 보다 원점에서 멀다.
+				const Float2 direction = closestPoint / upperBound;
+				const Float2 supportPoint = GJK2D_ComputeMinkowskiDifferencePoint(shapeA, shapeB, -direction);
+				lowerBound = Max(lowerBound, supportPoint.Dot(direction));
+				if (upperBound - lowerBound <= kTolerance * upperBound)
+				{
+					break;
+				}
+
+				bool isDuplicate = false;
+				for (uint32 i = 0; i < pointCount; ++i)
+				{
+					isDuplicate |= (points[i] == supportPoint);
+				}
+				if (isDuplicate == true)
+				{
+					break;
+				}
+
+				points[pointCount] = supportPoint;
+				++pointCount;
+				if (GJK2D_ReduceToClosestPoint(points, pointCount, closestPoint) == false)
+				{
+					return false;
+				}
+			}
+
+			if (lowerBound <= 0.0f)
+			{
+				return false;
+			}
+
+			outNormal = -Float2::Normalize(closestPoint);
+			outDistance = lowerBound;
+			return true;
+		}
+
+		bool ComputeDistance_GJK(const CollisionShape& shapeA, const CollisionShape& shapeB, Float2& outNormal, float& outDistance)
+		{
+			return GJK2D_ComputeDistance(shapeA, shapeB, outNormal, outDistance);
+		}
+
+		bool ComputeDistance_GJK(const TransformedCollisionShape& shapeA, const TransformedCollisionShape& shapeB, Float2& outNormal, float& outDistance)
+		{
+			return GJK2D_ComputeDistance(shapeA, shapeB, outNormal, outDistance);
+		}
+
 		Float2 ComputeEdgeNormal(const Float2& edgeVertex0, const Float2& edgeVertex1)
 		{
 			// V1 => V0 is CCW
@@ -292,7 +469,8 @@ namespace mint
 			return edgeVertex1 + tangent * Max(0.0f, Min(d, edgeLength));
 		}
 
-		void ComputePenetration_EPA(const CollisionShape& shapeA, const CollisionShape& shapeB, const GJKInfo& gjkInfo, Float2& outNormal, float& outDistance, EPAInfo& epaInfo)
+		template<typename ShapeType>
+		void EPA2D_ComputePenetration(const ShapeType& shapeA, const ShapeType& shapeB, const GJKInfo& gjkInfo, Float2& outNormal, float& outDistance, EPAInfo& epaInfo)
 		{
 			epaInfo._iteration = 0;
 			epaInfo._points.Clear();
@@ -328,7 +506,7 @@ namespace mint
 				epaInfo._points.PushBack(b);
 				epaInfo._points.PushBack(a);
 			}
-			GrahamScan_Convexify(epaInfo._points);
+			ConvexHull_Compute(epaInfo._points, epaInfo._hullScratch);
 
 			while (true)
 			{
@@ -379,11 +557,155 @@ namespace mint
 					outDistance = distance;
 					return;
 				}
-				else
+				else if (ConvexHull_InsertPoint(epaInfo._points, support, indexB) == false)
+				{
+					// support 가 가장 가까운 변 바깥에 있지 않으면 polytope 가 더 이상 자라지 않는다.
+					outNormal = closestEdgeNormal;
+					outDistance = distanceToEdge;
+					return;
+				}
+			}
+		}
+
+		void ComputePenetration_EPA(const CollisionShape& shapeA, const CollisionShape& shapeB, const GJKInfo& gjkInfo, Float2& outNormal, float& outDistance, EPAInfo& epaInfo)
+		{
+			EPA2D_ComputePenetration(shapeA, shapeB, gjkInfo, outNormal, outDistance, epaInfo);
+		}
+
+		void ComputePenetration_EPA(const TransformedCollisionShape& shapeA, const TransformedCollisionShape& shapeB, const GJKInfo& gjkInfo, Float2& outNormal, float& outDistance, EPAInfo& epaInfo)
+		{
+			EPA2D_ComputePenetration(shapeA, shapeB, gjkInfo, outNormal, outDistance, epaInfo);
+		}
+
+		struct ClipVertex
+		{
+			Float2 _position;
+			// 0, 1: incident face 의 꼭짓점 그대로, 2, 3: reference face 의 옆면 (0, 1) 에서 잘린 점
+			uint32 _clipCode = 0;
+		};
+
+		// 바깥 normal 이 direction 과 가장 같은 방향인 면 (꼭짓점 index 에서 다음 꼭짓점으로 가는 변) 을 찾는다.
+		uint32 Clip2D_FindFace(const TransformedCollisionShape& shape, const Float2& direction, float& outDot)
+		{
+			const uint32 vertexCount = shape.GetVertexCount();
+			uint32 faceIndex = 0;
+			outDot = -Math::kFloatMax;
+			Float2 vertex0 = shape.ComputeVertex(0);
+			for (uint32 i = 0; i < vertexCount; ++i)
+			{
+				const Float2 vertex1 = shape.ComputeVertex((i + 1) % vertexCount);
+				const float dot = ComputeEdgeNormal(vertex0, vertex1).Dot(direction);
+				if (dot > outDot)
+				{
+					outDot = dot;
+					faceIndex = i;
+				}
+				vertex0 = vertex1;
+			}
+			return faceIndex;
+		}
+
+		// 선분에서 planeNormal.Dot(p) > planeOffset 인 부분을 잘라낸다.
+		uint32 Clip2D_ClipSegment(const ClipVertex (&vertices)[2], const Float2& planeNormal, const float planeOffset, const uint32 clipCode, ClipVertex (&outVertices)[2])
+		{
+			const float distance0 = planeNormal.Dot(vertices[0]._position) - planeOffset;
+			const float distance1 = planeNormal.Dot(vertices[1]._position) - planeOffset;
+			uint32 vertexCount = 0;
+			if (distance0 <= 0.0f)
+			{
+				outVertices[vertexCount++] = vertices[0];
+			}
+			if (distance1 <= 0.0f)
+			{
+				outVertices[vertexCount++] = vertices[1];
+			}
+			if (distance0 * distance1 < 0.0f)
+			{
+				const float t = distance0 / (distance0 - distance1);
+				outVertices[vertexCount]._position = vertices[0]._position + (vertices[1]._position - vertices[0]._position) * t;
+				outVertices[vertexCount]._clipCode = clipCode;
+				++vertexCount;
+			}
+			return vertexCount;
+		}
+
+		uint32 Clip2D_ComputeSupportContactPoint(const TransformedCollisionShape& shapeA, const TransformedCollisionShape& shapeB, const Float2& normal, const float maxSeparation, Float2& outNormal, ContactPoint (&outContactPoints)[2])
+		{
+			const Float2 pointA = shapeA.ComputeSupportPoint(normal);
+			const Float2 pointB = shapeB.ComputeSupportPoint(-normal);
+			const float separation = normal.Dot(pointB - pointA);
+			if (separation > maxSeparation)
+			{
+				return 0;
+			}
+
+			outNormal = normal;
+			outContactPoints[0]._position = (pointA + pointB) * 0.5f;
+			outContactPoints[0]._separation = separation;
+			outContactPoints[0]._featureID = 0;
+			return 1;
+		}
+
+		uint32 ComputeContactPoints_Clip(const TransformedCollisionShape& shapeA, const TransformedCollisionShape& shapeB, const Float2& normal, const float maxSeparation, Float2& outNormal, ContactPoint (&outContactPoints)[2])
+		{
+			// A 를 reference 로 더 좋아해야 비슷한 두 면 사이에서 step 마다 reference 가 바뀌지 않는다.
+			static constexpr float kReferenceFaceTolerance = 0.005f;
+
+			if (shapeA.GetVertexCount() == 1 || shapeB.GetVertexCount() == 1)
+			{
+				return Clip2D_ComputeSupportContactPoint(shapeA, shapeB, normal, maxSeparation, outNormal, outContactPoints);
+			}
+
+			float dotA = 0.0f;
+			float dotB = 0.0f;
+			const uint32 faceIndexA = Clip2D_FindFace(shapeA, normal, dotA);
+			const uint32 faceIndexB = Clip2D_FindFace(shapeB, -normal, dotB);
+			const bool isFlipped = dotB > dotA + kReferenceFaceTolerance;
+			const TransformedCollisionShape& referenceShape = (isFlipped == true) ? shapeB : shapeA;
+			const TransformedCollisionShape& incidentShape = (isFlipped == true) ? shapeA : shapeB;
+			const uint32 referenceFaceIndex = (isFlipped == true) ? faceIndexB : faceIndexA;
+			const Float2 referenceVertex0 = referenceShape.ComputeVertex(referenceFaceIndex);
+			const Float2 referenceVertex1 = referenceShape.ComputeVertex((referenceFaceIndex + 1) % referenceShape.GetVertexCount());
+			const Float2 referenceNormal = ComputeEdgeNormal(referenceVertex0, referenceVertex1);
+			Float2 referenceTangent = referenceVertex1 - referenceVertex0;
+			referenceTangent.Normalize();
+
+			float incidentDot = 0.0f;
+			const uint32 incidentFaceIndex = Clip2D_FindFace(incidentShape, -referenceNormal, incidentDot);
+			ClipVertex incidentVertices[2];
+			incidentVertices[0]._position = incidentShape.ComputeVertex(incidentFaceIndex);
+			incidentVertices[0]._clipCode = 0;
+			incidentVertices[1]._position = incidentShape.ComputeVertex((incidentFaceIndex + 1) % incidentShape.GetVertexCount());
+			incidentVertices[1]._clipCode = 1;
+
+			// reference face 의 양 옆면으로 자른다.
+			ClipVertex clippedVertices0[2];
+			ClipVertex clippedVertices1[2];
+			if (Clip2D_ClipSegment(incidentVertices, -referenceTangent, -referenceTangent.Dot(referenceVertex0), 2, clippedVertices0) < 2
+				|| Clip2D_ClipSegment(clippedVertices0, referenceTangent, referenceTangent.Dot(referenceVertex1), 3, clippedVertices1) < 2)
+			{
+				// incident face 가 옆면 밖에 있으면 (normal 이 면과 잘 맞지 않으면) 점 하나로 대신한다.
+				return Clip2D_ComputeSupportContactPoint(shapeA, shapeB, normal, maxSeparation, outNormal, outContactPoints);
+			}
+
+			// [31] flipped, [30:16] reference face, [15:2] incident face, [1:0] clip code. 꼭짓점이 아주 많으면 번호가 겹칠 수 있지만 impulse 를 조금 잘못 이어받을 뿐이다.
+			const uint32 featureIDBase = ((isFlipped == true) ? (1u << 31) : 0u) | ((referenceFaceIndex & 0x7FFF) << 16) | ((incidentFaceIndex & 0x3FFF) << 2);
+			uint32 contactPointCount = 0;
+			for (const ClipVertex& clippedVertex : clippedVertices1)
+			{
+				const float separation = referenceNormal.Dot(clippedVertex._position - referenceVertex0);
+				if (separation > maxSeparation)
 				{
-					epaInfo._points.Insert(indexB, support);
+					continue;
 				}
+
+				ContactPoint& contactPoint = outContactPoints[contactPointCount++];
+				contactPoint._position = clippedVertex._position - referenceNormal * (separation * 0.5f);
+				contactPoint._separation = separation;
+				contactPoint._featureID = featureIDBase | clippedVertex._clipCode;
 			}
+			outNormal = (isFlipped == true) ? -referenceNormal : referenceNormal;
+			return contactPointCount;
 		}
 	}
 }
@@ -7,6 +7,10 @@
 #include <MintContainer/Include/StringUtil.hpp>
 #include <MintRendering/Include/ShapeRenderer.h>
 #include <MintPhysics/Include/Intersection.hpp>
+#include <MintPhysics/Include/DynamicAABBTree.hpp>
+#include <MintPhysics/Include/SweepAndPrune.hpp>
+#include <MintPhysics/Include/SpatialHashGrid.hpp>
+#include <MintPhysics/Include/ThreadPool.hpp>
 
 
 namespace mint
@@ -16,8 +20,6 @@ namespace mint
 #pragma region Body
 		Body::Body()
 			: _bodyMotionType{ BodyMotionType::Static }
-			, _angularVelocity{ 0.0f }
-			, _angularAcceleration{ 0.0f }
 		{
 			__noop;
 		}
@@ -33,6 +35,45 @@ namespace mint
 		}
 #pragma endregion
 
+#pragma region BodyStore
+		void BodyStore::Resize(const uint32 bodyCount)
+		{
+			_translations.Resize(bodyCount);
+			_rotations.Resize(bodyCount);
+			_linearVelocities.Resize(bodyCount);
+			_angularVelocities.Resize(bodyCount);
+			_linearAccelerations.Resize(bodyCount);
+			_angularAccelerations.Resize(bodyCount);
+			_inverseMasses.Resize(bodyCount);
+			_inverseInertias.Resize(bodyCount);
+			_linearDampings.Resize(bodyCount);
+			_shapeAABBCenters.Resize(bodyCount);
+			_shapeAABBHalfSizes.Resize(bodyCount);
+			_aabbMins.Resize(bodyCount);
+			_aabbMaxs.Resize(bodyCount);
+		}
+#pragma endregion
+
+#pragma region CollisionManifold
+		void CollisionManifold::InheritImpulses(const CollisionManifold& previous)
+		{
+			for (uint32 i = 0; i < _pointCount; ++i)
+			{
+				Point& point = _points[i];
+				for (uint32 j = 0; j < previous._pointCount; ++j)
+				{
+					const Point& previousPoint = previous._points[j];
+					if (previousPoint._contactPoint._featureID == point._contactPoint._featureID)
+					{
+						point._normalImpulse = previousPoint._normalImpulse;
+						point._tangentImpulse = previousPoint._tangentImpulse;
+						break;
+					}
+				}
+			}
+		}
+#pragma endregion
+
 #pragma region WorldHistory
 		void WorldHistory::BeingPlaying()
 		{
@@ -80,23 +121,11 @@ namespace mint
 
 #pragma region World
 		World::World()
-			: _gravity{ 0.0f, -9.8f }
-			, _worldMin{ -2048.0, -2048.0f }
-			, _worldMax{ +2048.0, +2048.0f }
+			: _gravity{ Real(0), ToReal(-9.8f) }
 			, _totalStepCount{ 0 }
+			, _spatialHashGrid{ kSpatialHashGridBaseCellSize }
 		{
-			_collisionSectorSideCount = kCollisionSectorTessellationPerSide;
-			for (uint32 i = 0; i < _collisionSectorDepth; ++i)
-			{
-				_collisionSectorSideCount *= kCollisionSectorTessellationPerSide;
-			}
-
-			const uint32 collisionSectorBufferSize = _collisionSectorSideCount * _collisionSectorSideCount;
-			_collisionSectors.Resize(collisionSectorBufferSize);
-			for (uint32 i = 0; i < collisionSectorBufferSize; ++i)
-			{
-				_collisionSectors[i]._index = i;
-			}
+			__noop;
 		}
 
 		World::~World()
@@ -107,6 +136,10 @@ namespace mint
 		BodyID World::CreateBody(const BodyCreationDesc& bodyCreationDesc)
 		{
 			_bodyPool.GrowIfFull();
+			if (_bodyStore._translations.Size() < _bodyPool.GetObjects().Size())
+			{
+				_bodyStore.Resize(_bodyPool.GetObjects().Size());
+			}
 
 			const uint32 slotIndex = _bodyPool.GetNextSlotIndex();
 			BodyID bodyID;
@@ -115,29 +148,48 @@ namespace mint
 				Body body;
 				body._bodyID = bodyID;
 				body._shape._collisionShape = bodyCreationDesc._collisionShape;
-				body._shape._shapeAABB = MakeShared<AABBCollisionShape>(AABBCollisionShape(*body._shape._collisionShape));
-				body._transform2D = bodyCreationDesc._transform2D;
-				body._bodyAABB = MakeShared<AABBCollisionShape>(AABBCollisionShape(*body._shape._shapeAABB, body._transform2D));
-				body._inverseMass = bodyCreationDesc._inverseMass;
+				body._scale = bodyCreationDesc._transform2D._scale;
+				body._friction = bodyCreationDesc._friction;
+				body._canSleep = bodyCreationDesc._canSleep;
 				body._bodyMotionType = bodyCreationDesc._bodyMotionType;
-				if (body._inverseMass <= 0.0f)
+
+				Real inverseMass = ToReal(bodyCreationDesc._inverseMass);
+				Real inverseInertia = ToReal(bodyCreationDesc._inverseInertia);
+				if (inverseMass <= Real(0))
 				{
 					body._bodyMotionType = BodyMotionType::Static;
-					body._inverseMass = 0.0f;
+					inverseMass = Real(0);
+					inverseInertia = Real(0);
+				}
+				if (body._bodyMotionType != BodyMotionType::Static)
+				{
+					_awakeBodySlotIndices.PushBack(slotIndex);
 				}
 				_bodyPool.Create(slotIndex, std::move(body));
 
-				_worldMin = Float2::Min(_worldMin, body._bodyAABB->_center - body._bodyAABB->_halfSize);
-				_worldMax = Float2::Max(_worldMax, body._bodyAABB->_center + body._bodyAABB->_halfSize);
-				_worldSize = (_worldMax - _worldMin);
+				const AABBCollisionShape shapeAABB{ *bodyCreationDesc._collisionShape };
+				_bodyStore._translations[slotIndex] = ToReal2(bodyCreationDesc._transform2D._translation);
+				_bodyStore._rotations[slotIndex] = ToReal(bodyCreationDesc._transform2D._rotation);
+				_bodyStore._linearVelocities[slotIndex].SetZero();
+				_bodyStore._angularVelocities[slotIndex] = Real(0);
+				_bodyStore._linearAccelerations[slotIndex].SetZero();
+				_bodyStore._angularAccelerations[slotIndex] = Real(0);
+				_bodyStore._inverseMasses[slotIndex] = inverseMass;
+				_bodyStore._inverseInertias[slotIndex] = inverseInertia;
+				// Only dynamic bodies are damped.
+				_bodyStore._linearDampings[slotIndex] = (bodyCreationDesc._bodyMotionType == BodyMotionType::Dynamic) ? ToReal(bodyCreationDesc._linearDamping) : Real(0);
+				_bodyStore._shapeAABBCenters[slotIndex] = shapeAABB._center;
+				_bodyStore._shapeAABBHalfSizes[slotIndex] = shapeAABB._halfSize;
+				UpdateBodyAABB(slotIndex, Float2::kZero);
 			}
-			_collisionSectors[0]._bodyIDs.PushBack(bodyID);
+			_touchedBodySlotIndices.PushBack(slotIndex);
 			return bodyID;
 		}
 
 		Body& World::AccessBody(BodyID bodyID)
 		{
 			MINT_ASSERT(bodyID.IsValid(), "!!!");
+			WakeBody(bodyID);
 			return _bodyPool.GetObject_(bodyID.Value());
 		}
 
@@ -147,6 +199,76 @@ namespace mint
 			return _bodyPool.GetObject_(bodyID.Value());
 		}
 
+		const Real2& World::GetTranslation(BodyID bodyID) const
+		{
+			MINT_ASSERT(bodyID.IsValid(), "!!!");
+			return _bodyStore._translations[bodyID.Value()];
+		}
+
+		Real World::GetRotation(BodyID bodyID) const
+		{
+			MINT_ASSERT(bodyID.IsValid(), "!!!");
+			return _bodyStore._rotations[bodyID.Value()];
+		}
+
+		Transform2D World::GetTransform(BodyID bodyID) const
+		{
+			MINT_ASSERT(bodyID.IsValid(), "!!!");
+			const uint32 bodySlotIndex = bodyID.Value();
+			return Transform2D(_bodyPool.GetObject_(bodySlotIndex)._scale, ToFloat(_bodyStore._rotations[bodySlotIndex]), ToFloat2(_bodyStore._translations[bodySlotIndex]));
+		}
+
+		const Real2& World::GetLinearVelocity(BodyID bodyID) const
+		{
+			MINT_ASSERT(bodyID.IsValid(), "!!!");
+			return _bodyStore._linearVelocities[bodyID.Value()];
+		}
+
+		Real World::GetAngularVelocity(BodyID bodyID) const
+		{
+			MINT_ASSERT(bodyID.IsValid(), "!!!");
+			return _bodyStore._angularVelocities[bodyID.Value()];
+		}
+
+		void World::SetTranslation(BodyID bodyID, const Real2& translation)
+		{
+			WakeBody(bodyID);
+			_bodyStore._translations[bodyID.Value()] = translation;
+			// The AABB is updated in the next broad phase.
+			_touchedBodySlotIndices.PushBack(bodyID.Value());
+		}
+
+		void World::SetRotation(BodyID bodyID, const Real rotation)
+		{
+			WakeBody(bodyID);
+			_bodyStore._rotations[bodyID.Value()] = rotation;
+			_touchedBodySlotIndices.PushBack(bodyID.Value());
+		}
+
+		void World::SetLinearVelocity(BodyID bodyID, const Real2& linearVelocity)
+		{
+			WakeBody(bodyID);
+			_bodyStore._linearVelocities[bodyID.Value()] = linearVelocity;
+		}
+
+		void World::SetAngularVelocity(BodyID bodyID, const Real angularVelocity)
+		{
+			WakeBody(bodyID);
+			_bodyStore._angularVelocities[bodyID.Value()] = angularVelocity;
+		}
+
+		void World::AddLinearAcceleration(BodyID bodyID, const Real2& linearAcceleration)
+		{
+			WakeBody(bodyID);
+			_bodyStore._linearAccelerations[bodyID.Value()] += linearAcceleration;
+		}
+
+		void World::AddAngularAcceleration(BodyID bodyID, const Real angularAcceleration)
+		{
+			WakeBody(bodyID);
+			_bodyStore._angularAccelerations[bodyID.Value()] += angularAcceleration;
+		}
+
 		void World::Step(float deltaTime)
 		{
 			if (_worldHistory.IsPlaying())
@@ -155,7 +277,12 @@ namespace mint
 
 				for (const StepSnapshot::BodySnapshot& bodySnapshot : _worldHistory.GetStepSnapshot()._bodySnapshots)
 				{
-					AccessBody(bodySnapshot._body._bodyID) = bodySnapshot._body;
+					const uint32 bodySlotIndex = bodySnapshot._body._bodyID.Value();
+					_bodyPool.GetObject_(bodySlotIndex) = bodySnapshot._body;
+					_bodyStore._translations[bodySlotIndex] = bodySnapshot._translation;
+					_bodyStore._rotations[bodySlotIndex] = bodySnapshot._rotation;
+					_bodyStore._linearVelocities[bodySlotIndex] = bodySnapshot._linearVelocity;
+					_bodyStore._angularVelocities[bodySlotIndex] = bodySnapshot._angularVelocity;
 				}
 				return;
 			}
@@ -164,6 +291,7 @@ namespace mint
 
 			StepCollide(deltaTime);
 			StepSolve(deltaTime);
+			StepUpdateIslands(deltaTime);
 
 			if (_worldHistory._isRecording == true)
 			{
@@ -171,6 +299,81 @@ namespace mint
 			}
 		}
 
+		void World::AddParticleDistanceConstraint(const ParticleDistanceConstraint& particleDistanceConstraint)
+		{
+			MINT_ASSERT(particleDistanceConstraint._bodyAID.IsValid(), "!!!");
+			MINT_ASSERT(particleDistanceConstraint._bodyBID.IsValid(), "!!!");
+
+			WakeBody(particleDistanceConstraint._bodyAID);
+			WakeBody(particleDistanceConstraint._bodyBID);
+			_particleDistanceConstraints.PushBack(particleDistanceConstraint);
+		}
+
+		void World::SetSleepSettings(const SleepSettings& sleepSettings)
+		{
+			_sleepSettings = sleepSettings;
+			if (_sleepSettings._isEnabled == false)
+			{
+				WakeAllBodies();
+			}
+		}
+
+		void World::WakeBody(BodyID bodyID)
+		{
+			MINT_ASSERT(bodyID.IsValid(), "!!!");
+			const Body& body = _bodyPool.GetObject_(bodyID.Value());
+			if (body._isSleeping == true)
+			{
+				WakeIsland(bodyID.Value());
+			}
+			else if (body._bodyMotionType == BodyMotionType::Static)
+			{
+				// Static bodies are not updated every step, so it may have been moved.
+				_touchedBodySlotIndices.PushBack(bodyID.Value());
+			}
+		}
+
+		void World::SetBroadPhaseType(const BroadPhaseType broadPhaseType)
+		{
+			if (_broadPhaseType == broadPhaseType)
+			{
+				return;
+			}
+
+			// Proxies are created again in the next broad phase.
+			_broadPhaseType = broadPhaseType;
+			_broadPhaseProxies.Clear();
+			_spatialHashGrid.Clear();
+			_staticBodyTree.Clear();
+			_movingBodyTree.Clear();
+			_sweepAndPrune.Clear();
+
+			const uint32 bodyCount = _bodyPool.GetObjects().Size();
+			for (uint32 i = 0; i < bodyCount; ++i)
+			{
+				if (_bodyPool.GetObject_(i).IsValid() == true)
+				{
+					_touchedBodySlotIndices.PushBack(i);
+				}
+			}
+		}
+
+		void World::SetThreadCount(const uint32 threadCount)
+		{
+			_threadPool.SetThreadCount(threadCount);
+		}
+
+		void World::OptimizeBroadPhase()
+		{
+			if (_broadPhaseType != BroadPhaseType::AABBTree)
+			{
+				return;
+			}
+
+			_staticBodyTree.RebuildSAH();
+			_movingBodyTree.RebuildSAH();
+		}
+
 		uint64 World::GetCurrentStepIndex() const
 		{
 			if (_worldHistory.IsPlaying())
@@ -189,294 +392,885 @@ namespace mint
 
 		void World::StepCollide_BroadPhase(float deltaTime)
 		{
-			// Continuous collision detection
+			// Continuous collision detection: AABBs of awake bodies cover their movement in this step.
+			// Only the arrays of _bodyStore are read here.
+			const Real realDeltaTime = ToReal(deltaTime);
+			const uint32 awakeBodyCount = _awakeBodySlotIndices.Size();
+			_threadPool.ParallelFor(ComputeStepTaskCount(awakeBodyCount), [this, realDeltaTime, awakeBodyCount](const uint32 taskIndex)
+				{
+					const uint32 awakeBodyIndexEnd = Min(awakeBodyCount, (taskIndex + 1) * kStepTaskItemCount);
+					for (uint32 i = taskIndex * kStepTaskItemCount; i < awakeBodyIndexEnd; ++i)
+					{
+						const uint32 bodySlotIndex = _awakeBodySlotIndices[i];
+						const Float2 displacement = ToFloat2((_bodyStore._linearVelocities[bodySlotIndex] + _bodyStore._linearAccelerations[bodySlotIndex] * realDeltaTime) * realDeltaTime);
+						UpdateBodyAABB(bodySlotIndex, displacement);
+					}
+				});
+
+			_broadPhaseBodyPairs.Clear();
+			StepCollide_BroadPhase_UpdateProxies();
+			if (_broadPhaseType == BroadPhaseType::AABBTree)
+			{
+				StepCollide_BroadPhase_AABBTree();
+			}
+			else if (_broadPhaseType == BroadPhaseType::SweepAndPrune)
+			{
+				StepCollide_BroadPhase_SweepAndPrune();
+			}
+			else
+			{
+				StepCollide_BroadPhase_SpatialHashGrid();
+			}
+		}
+
+		void World::StepCollide_BroadPhase_UpdateProxies()
+		{
+			// Keep one proxy per body in the structure of the current broad phase type.
+			// Only awake bodies move, so the other bodies are visited only when they are touched.
 			const uint32 bodyCount = _bodyPool.GetObjects().Size();
-			for (uint32 i = 0; i < bodyCount; ++i)
+			if (_broadPhaseProxies.Size() < bodyCount)
 			{
-				Body& body = _bodyPool.GetObject_(i);
-				if (body.IsValid() == false || body._bodyMotionType != BodyMotionType::Dynamic)
+				_broadPhaseProxies.Resize(bodyCount);
+			}
+
+			for (const uint32 bodySlotIndex : _touchedBodySlotIndices)
+			{
+				// Awake bodies already have their AABBs updated above.
+				const Body& body = _bodyPool.GetObject_(bodySlotIndex);
+				if (body.IsValid() == true && body.IsAwake() == false)
 				{
-					continue;
+					UpdateBodyAABB(bodySlotIndex, Float2::kZero);
 				}
+				StepCollide_BroadPhase_UpdateProxy(bodySlotIndex);
+			}
+			_touchedBodySlotIndices.Clear();
 
-				const Float2 displacement = (body._linearVelocity + body._linearAcceleration * deltaTime) * deltaTime;
-				body._bodyAABB->SetExpanded(*body._shape._shapeAABB, body._transform2D, displacement);
+			for (const uint32 bodySlotIndex : _awakeBodySlotIndices)
+			{
+				StepCollide_BroadPhase_UpdateProxy(bodySlotIndex);
 			}
+		}
 
-			_broadPhaseBodyPairs.Clear();
-			const uint32 collisionSectorCount = _collisionSectors.Size();
-			for (uint32 i = 0; i < collisionSectorCount; ++i)
+		void World::StepCollide_BroadPhase_UpdateProxy(const uint32 bodySlotIndex)
+		{
+			// A sleeping body is put in as static, so pairs between sleeping and static bodies are skipped like static-static pairs.
+			// When it becomes static or non-static, the proxy is flagged in place. Only the AABB tree moves it to the other tree.
+			const Body& body = _bodyPool.GetObject_(bodySlotIndex);
+			BroadPhaseProxy& broadPhaseProxy = _broadPhaseProxies[bodySlotIndex];
+			const bool isStatic = (body.IsAwake() == false);
+			if (broadPhaseProxy._proxyID != kInvalidIndexUint32 && (body.IsValid() == false || (_broadPhaseType == BroadPhaseType::AABBTree && broadPhaseProxy._isStatic != isStatic)))
 			{
-				const uint32 collisionSectorBodyCount = _collisionSectors[i]._bodyIDs.Size();
-				for (uint32 indexA = 0; indexA < collisionSectorBodyCount; ++indexA)
+				if (_broadPhaseType == BroadPhaseType::AABBTree)
 				{
-					for (uint32 indexB = 0; indexB < collisionSectorBodyCount; ++indexB)
-					{
-						if (indexA == indexB)
-						{
-							continue;
-						}
+					DynamicAABBTree& tree = (broadPhaseProxy._isStatic ? _staticBodyTree : _movingBodyTree);
+					tree.DestroyProxy(broadPhaseProxy._proxyID);
+				}
+				else if (_broadPhaseType == BroadPhaseType::SweepAndPrune)
+				{
+					_sweepAndPrune.DestroyProxy(broadPhaseProxy._proxyID);
+				}
+				else
+				{
+					_spatialHashGrid.DestroyProxy(broadPhaseProxy._proxyID);
+				}
+				broadPhaseProxy._proxyID = kInvalidIndexUint32;
+			}
 
-						BodyID bodyIDA = _collisionSectors[i]._bodyIDs[indexA];
-						BodyID bodyIDB = _collisionSectors[i]._bodyIDs[indexB];
-						const Body& bodyA = GetBody(bodyIDA);
-						const Body& bodyB = GetBody(bodyIDB);
-						if (bodyA._bodyMotionType != BodyMotionType::Dynamic && bodyB._bodyMotionType != BodyMotionType::Dynamic)
-						{
-							continue;
-						}
+			if (body.IsValid() == false)
+			{
+				return;
+			}
 
-						if (Intersect_AABB_AABB(*bodyA._bodyAABB, *bodyB._bodyAABB) == false)
-						{
-							continue;
-						}
+			const Float2& aabbMin = _bodyStore._aabbMins[bodySlotIndex];
+			const Float2& aabbMax = _bodyStore._aabbMaxs[bodySlotIndex];
+			if (broadPhaseProxy._proxyID == kInvalidIndexUint32)
+			{
+				if (_broadPhaseType == BroadPhaseType::AABBTree)
+				{
+					DynamicAABBTree& tree = (isStatic ? _staticBodyTree : _movingBodyTree);
+					broadPhaseProxy._proxyID = tree.CreateProxy(aabbMin, aabbMax, bodySlotIndex);
+				}
+				else if (_broadPhaseType == BroadPhaseType::SweepAndPrune)
+				{
+					broadPhaseProxy._proxyID = _sweepAndPrune.CreateProxy(aabbMin, aabbMax, bodySlotIndex, isStatic);
+				}
+				else
+				{
+					broadPhaseProxy._proxyID = _spatialHashGrid.CreateProxy(aabbMin, aabbMax, bodySlotIndex, isStatic);
+				}
+				broadPhaseProxy._isStatic = isStatic;
+			}
+			else
+			{
+				if (_broadPhaseType == BroadPhaseType::AABBTree)
+				{
+					DynamicAABBTree& tree = (isStatic ? _staticBodyTree : _movingBodyTree);
+					tree.MoveProxy(broadPhaseProxy._proxyID, aabbMin, aabbMax);
+				}
+				else if (_broadPhaseType == BroadPhaseType::SweepAndPrune)
+				{
+					if (broadPhaseProxy._isStatic != isStatic)
+					{
+						_sweepAndPrune.SetProxyStatic(broadPhaseProxy._proxyID, isStatic);
+					}
+					_sweepAndPrune.MoveProxy(broadPhaseProxy._proxyID, aabbMin, aabbMax);
+				}
+				else
+				{
+					if (broadPhaseProxy._isStatic != isStatic)
+					{
+						_spatialHashGrid.SetProxyStatic(broadPhaseProxy._proxyID, isStatic);
+					}
+					_spatialHashGrid.MoveProxy(broadPhaseProxy._proxyID, aabbMin, aabbMax);
+				}
+				broadPhaseProxy._isStatic = isStatic;
+			}
+		}
 
-						if (bodyIDA.Value() > bodyIDB.Value())
-						{
-							BodyID temp = bodyIDA;
-							bodyIDA = bodyIDB;
-							bodyIDB = temp;
-						}
+		template<typename QueryFunction>
+		void World::StepCollide_BroadPhase_QueryInParallel(const uint32 itemCount, QueryFunction&& queryFunction)
+		{
+			// Each task filters the pairs of its own items into its own buffer.
+			// Buffers are merged in task order, so pairs are inserted in the same order as a single-threaded query.
+			const uint32 taskCount = ComputeStepTaskCount(itemCount);
+			if (_broadPhaseTaskBodyPairs.Size() < taskCount)
+			{
+				_broadPhaseTaskBodyPairs.Resize(taskCount);
+			}
 
-						BroadPhaseBodyPair bodyPair{ bodyIDA, bodyIDB };
-						const KeyValuePair found = _broadPhaseBodyPairs.Find(bodyPair.GetKey());
-						if (found.IsValid() == false)
+			_threadPool.ParallelFor(taskCount, [this, itemCount, &queryFunction](const uint32 taskIndex)
+				{
+					Vector<BroadPhaseBodyPair>& bodyPairs = _broadPhaseTaskBodyPairs[taskIndex];
+					bodyPairs.Clear();
+					const uint32 itemIndexBegin = taskIndex * kStepTaskItemCount;
+					const uint32 itemIndexEnd = Min(itemCount, itemIndexBegin + kStepTaskItemCount);
+					queryFunction(itemIndexBegin, itemIndexEnd, [this, &bodyPairs](const uint32 bodySlotIndexA, const uint32 bodySlotIndexB)
 						{
-							_broadPhaseBodyPairs.Insert(bodyPair.GetKey(), bodyPair);
-						}
-					}
+							BroadPhaseBodyPair bodyPair;
+							if (MakeBroadPhaseBodyPair(_bodyPool.GetObject_(bodySlotIndexA), _bodyPool.GetObject_(bodySlotIndexB), bodyPair) == true)
+							{
+								bodyPairs.PushBack(bodyPair);
+							}
+						});
+				});
+
+			for (uint32 taskIndex = 0; taskIndex < taskCount; ++taskIndex)
+			{
+				for (const BroadPhaseBodyPair& bodyPair : _broadPhaseTaskBodyPairs[taskIndex])
+				{
+					InsertBroadPhaseBodyPair(bodyPair);
 				}
 			}
 		}
 
-		bool World::StepCollide_NarrowPhase_CCD(float deltaTime, const Body& bodyA, const Body& bodyB, Physics2D::GJKInfo& gjkInfo, SharedPtr<CollisionShape>& outShapeA, SharedPtr<CollisionShape>& outShapeB)
+		void World::StepCollide_BroadPhase_SpatialHashGrid()
 		{
-			float fraction = 1.0f;
-			float range = 2.0f;
-			Float2 relativeLinearVelocity = bodyA._linearVelocity - bodyB._linearVelocity;
-			Float2 separatingDirection = relativeLinearVelocity;
-			separatingDirection.Normalize();
-			while (true)
+			// Static-static pairs are skipped by the grid, and each pair is reported only once.
+			if (_threadPool.GetThreadCount() > 1)
 			{
-				float fractionDeltaTime = deltaTime * fraction;
-				Transform2D predictedBodyTransformA = PredictBodyTransform(bodyA, fractionDeltaTime);
-				Transform2D predictedBodyTransformB = PredictBodyTransform(bodyB, fractionDeltaTime);
+				StepCollide_BroadPhase_QueryInParallel(_spatialHashGrid.GetCellCount(), [this](const uint32 cellIndexBegin, const uint32 cellIndexEnd, auto&& addBodyPair)
+					{
+						_spatialHashGrid.QueryPairs(cellIndexBegin, cellIndexEnd, addBodyPair);
+					});
+				return;
+			}
 
-				outShapeA = CollisionShape::MakeTransformed(bodyA._shape._collisionShape, predictedBodyTransformA);
-				outShapeB = CollisionShape::MakeTransformed(bodyB._shape._collisionShape, predictedBodyTransformB);
-				const bool intersected = Intersect_GJK(*outShapeA, *outShapeB, &gjkInfo);
-				if (intersected)
+			_spatialHashGrid.QueryPairs([this](const uint32 bodySlotIndexA, const uint32 bodySlotIndexB)
 				{
-					EPAInfo epaInfo;
-					Float2 normal;
-					float distance = 0.0f;
-					ComputePenetration_EPA(*outShapeA, *outShapeB, gjkInfo, normal, distance, epaInfo);
-					if (distance < 1.0f || range < 0.0625f)
+					AddBroadPhaseBodyPair(_bodyPool.GetObject_(bodySlotIndexA), _bodyPool.GetObject_(bodySlotIndexB));
+				});
+		}
+
+		void World::StepCollide_BroadPhase_AABBTree()
+		{
+			// Static bodies and moving bodies are in separate trees, so static-static pairs are never visited.
+			// Trees hold fat AABBs, so AddBroadPhaseBodyPair() filters pairs with the actual AABBs again.
+			// Each pair is reported only once, but AddBroadPhaseBodyPair() still checks for duplicates.
+			const auto addBodyPair = [this](const uint32 bodySlotIndexA, const uint32 bodySlotIndexB)
+			{
+				AddBroadPhaseBodyPair(_bodyPool.GetObject_(bodySlotIndexA), _bodyPool.GetObject_(bodySlotIndexB));
+			};
+			_movingBodyTree.QueryPairs(addBodyPair);
+			DynamicAABBTree::QueryPairs(_movingBodyTree, _staticBodyTree, addBodyPair);
+		}
+
+		void World::StepCollide_BroadPhase_SweepAndPrune()
+		{
+			// Static bodies are flagged so static-static pairs are skipped during the sweep.
+			_sweepAndPrune.Update();
+			if (_threadPool.GetThreadCount() > 1)
+			{
+				StepCollide_BroadPhase_QueryInParallel(_sweepAndPrune.GetProxyCount(), [this](const uint32 sortedIndexBegin, const uint32 sortedIndexEnd, auto&& addBodyPair)
 					{
-						return true;
-					}
+						_sweepAndPrune.QueryPairs(sortedIndexBegin, sortedIndexEnd, addBodyPair);
+					});
+				return;
+			}
 
-					range *= 0.5f;
-					fraction -= range * 0.5f;
+			_sweepAndPrune.QueryPairs([this](const uint32 bodySlotIndexA, const uint32 bodySlotIndexB)
+				{
+					AddBroadPhaseBodyPair(_bodyPool.GetObject_(bodySlotIndexA), _bodyPool.GetObject_(bodySlotIndexB));
+				});
+		}
+
+		void World::AddBroadPhaseBodyPair(const Body& bodyA, const Body& bodyB)
+		{
+			BroadPhaseBodyPair bodyPair;
+			if (MakeBroadPhaseBodyPair(bodyA, bodyB, bodyPair) == true)
+			{
+				InsertBroadPhaseBodyPair(bodyPair);
+			}
+		}
+
+		bool World::MakeBroadPhaseBodyPair(const Body& bodyA, const Body& bodyB, BroadPhaseBodyPair& outBodyPair) const
+		{
+			if (bodyA._bodyMotionType != BodyMotionType::Dynamic && bodyB._bodyMotionType != BodyMotionType::Dynamic)
+			{
+				return false;
+			}
+
+			if (bodyA.IsAwake() == false && bodyB.IsAwake() == false)
+			{
+				return false;
+			}
+
+			const uint32 bodySlotIndexA = bodyA._bodyID.Value();
+			const uint32 bodySlotIndexB = bodyB._bodyID.Value();
+			const Float2& minA = _bodyStore._aabbMins[bodySlotIndexA];
+			const Float2& maxA = _bodyStore._aabbMaxs[bodySlotIndexA];
+			const Float2& minB = _bodyStore._aabbMins[bodySlotIndexB];
+			const Float2& maxB = _bodyStore._aabbMaxs[bodySlotIndexB];
+			if (maxA._x < minB._x || maxB._x < minA._x || maxA._y < minB._y || maxB._y < minA._y)
+			{
+				return false;
+			}
+
+			outBodyPair._bodyIDA = bodyA._bodyID;
+			outBodyPair._bodyIDB = bodyB._bodyID;
+			if (outBodyPair._bodyIDA.Value() > outBodyPair._bodyIDB.Value())
+			{
+				outBodyPair._bodyIDA = bodyB._bodyID;
+				outBodyPair._bodyIDB = bodyA._bodyID;
+			}
+			return true;
+		}
+
+		void World::InsertBroadPhaseBodyPair(const BroadPhaseBodyPair& bodyPair)
+		{
+			// Every broad phase reports a pair only once, but check for duplicates anyway.
+			const KeyValuePair found = _broadPhaseBodyPairs.Find(bodyPair.GetKey());
+			if (found.IsValid() == false)
+			{
+				_broadPhaseBodyPairs.Insert(bodyPair.GetKey(), bodyPair);
+			}
+		}
+
+		bool World::StepCollide_NarrowPhase_CCD(float deltaTime, const Body& bodyA, const Body& bodyB, TransformedCollisionShape& outShapeA, TransformedCollisionShape& outShapeB, float& outTimeOfImpact, Float2& outNormal, float& outDistance) const
+		{
+			// Conservative advancement:
+			// Both bodies are moved forward by the time in which they can't close the current distance,
+			// until they get closer than kTimeOfImpactTargetDistance or the step ends.
+			// Relative velocity changes linearly over time, so its bound along the normal is at either end of the remaining time.
+			// Each rotating shape adds (its rotation radius) * (the largest angular speed during the step) to the bound.
+			const Float2 relativeLinearVelocity = ToFloat2(_bodyStore._linearVelocities[bodyA._bodyID.Value()] - _bodyStore._linearVelocities[bodyB._bodyID.Value()]);
+			const Float2 relativeLinearAcceleration = PredictBodyLinearAcceleration(bodyA) - PredictBodyLinearAcceleration(bodyB);
+			auto computeMaxAngularSpeed = [this, deltaTime](const Body& body)
+			{
+				const uint32 bodySlotIndex = body._bodyID.Value();
+				const float angularVelocity = ToFloat(_bodyStore._angularVelocities[bodySlotIndex]);
+				return Max(::abs(angularVelocity), ::abs(angularVelocity + 2.0f * ToFloat(_bodyStore._angularAccelerations[bodySlotIndex]) * deltaTime));
+			};
+			const float rotationSpeedBound = outShapeA.ComputeRotationRadius() * computeMaxAngularSpeed(bodyA) + outShapeB.ComputeRotationRadius() * computeMaxAngularSpeed(bodyB);
+
+			float time = 0.0f;
+			for (uint32 iteration = 0; iteration < kMaxTimeOfImpactIterationCount; ++iteration)
+			{
+				outShapeA = TransformedCollisionShape(*bodyA._shape._collisionShape, PredictBodyTransform(bodyA, time));
+				outShapeB = TransformedCollisionShape(*bodyB._shape._collisionShape, PredictBodyTransform(bodyB, time));
+				outTimeOfImpact = time;
+				if (ComputeDistance_GJK(outShapeA, outShapeB, outNormal, outDistance) == false)
+				{
+					outDistance = 0.0f;
+					return true;
 				}
-				else
+
+				if (outDistance < kTimeOfImpactTargetDistance)
 				{
-					if (fraction == 1.0f)
-					{
-						return false;
-					}
+					return true;
+				}
 
-					range *= 0.5f;
-					fraction += range * 0.5f;
+				const float normalVelocity = relativeLinearVelocity.Dot(outNormal);
+				const float normalAcceleration = relativeLinearAcceleration.Dot(outNormal);
+				const float closingSpeedBound = Max(normalVelocity + 2.0f * normalAcceleration * time, normalVelocity + 2.0f * normalAcceleration * deltaTime) + rotationSpeedBound;
+				if (closingSpeedBound <= 0.0f)
+				{
+					return false;
+				}
+
+				time += (outDistance - kTimeOfImpactTargetDistance * 0.5f) / closingSpeedBound;
+				if (time > deltaTime)
+				{
+					return false;
 				}
 			}
+
+			// Ran out of iterations before reaching the target distance.
+			// The bodies haven't touched yet at this time, so it's still safe to report it.
+			return true;
 		}
 
 		void World::StepCollide_NarrowPhase(float deltaTime)
 		{
-			const float deltaTimeSq = deltaTime * deltaTime;
+			// Islands woken since the last step get their manifolds back first, so that they inherit the impulses.
+			StepCollide_NarrowPhase_RestoreWokenCollisionManifolds();
+
+			// Pairs are split into tasks in a fixed way, and manifolds are merged in task order.
+			// So the manifolds are the same and in the same order whatever the thread count is.
+			_narrowPhaseBodyPairs.Clear();
+			for (const BroadPhaseBodyPair& bodyPair : _broadPhaseBodyPairs)
+			{
+				_narrowPhaseBodyPairs.PushBack(bodyPair);
+			}
+
+			const uint32 bodyPairCount = _narrowPhaseBodyPairs.Size();
+			const uint32 taskCount = ComputeStepTaskCount(bodyPairCount);
+			if (_narrowPhaseTaskCollisionManifolds.Size() < taskCount)
+			{
+				_narrowPhaseTaskCollisionManifolds.Resize(taskCount);
+			}
 
-			_collisionManifoldMap.Clear();
+			_threadPool.ParallelFor(taskCount, [this, deltaTime, bodyPairCount](const uint32 taskIndex)
+				{
+					Vector<CollisionManifold>& collisionManifolds = _narrowPhaseTaskCollisionManifolds[taskIndex];
+					collisionManifolds.Clear();
 
-			GJKInfo gjkInfo;
-			for (const auto& iter : _broadPhaseBodyPairs)
+					GJKInfo gjkInfo;
+					EPAInfo epaInfo;
+					const uint32 bodyPairIndexEnd = Min(bodyPairCount, (taskIndex + 1) * kStepTaskItemCount);
+					for (uint32 i = taskIndex * kStepTaskItemCount; i < bodyPairIndexEnd; ++i)
+					{
+						CollisionManifold collisionManifold;
+						if (StepCollide_NarrowPhase_BodyPair(deltaTime, _narrowPhaseBodyPairs[i], gjkInfo, epaInfo, collisionManifold) == true)
+						{
+							// The map is only read while the tasks run.
+							const KeyValuePair previous = _collisionManifoldMap.Find(collisionManifold.GetKey());
+							if (previous.IsValid() == true)
+							{
+								collisionManifold.InheritImpulses(*previous._value);
+							}
+							collisionManifolds.PushBack(collisionManifold);
+						}
+					}
+				});
+
+			// Manifolds of pairs still touching are overwritten in place, and the rest are removed afterwards.
+			for (CollisionManifold& collisionManifold : _collisionManifoldMap)
 			{
-				const Body& bodyA = GetBody(iter._bodyIDA);
-				const Body& bodyB = GetBody(iter._bodyIDB);
+				collisionManifold._pointCount = 0;
+			}
 
-				CollisionManifold collisionManifold;
-				const Float2 relativeLinearVelocity = bodyA._linearVelocity - bodyB._linearVelocity;
-				if (relativeLinearVelocity != Float2::kZero)
+			for (uint32 taskIndex = 0; taskIndex < taskCount; ++taskIndex)
+			{
+				for (const CollisionManifold& collisionManifold : _narrowPhaseTaskCollisionManifolds[taskIndex])
 				{
-					// Continuous collision detection
-					SharedPtr<CollisionShape> transformedShapeA;
-					SharedPtr<CollisionShape> transformedShapeB;
-					if (StepCollide_NarrowPhase_CCD(deltaTime, bodyA, bodyB, gjkInfo, transformedShapeA, transformedShapeB))
+					KeyValuePair found = _collisionManifoldMap.Find(collisionManifold.GetKey());
+					if (found.IsValid() == true)
 					{
-						StepCollide_NarrowPhase_GenerateCollision(bodyA, *transformedShapeA, bodyB, *transformedShapeB, gjkInfo, collisionManifold);
+						*found._value = collisionManifold;
+					}
+					else
+					{
+						_collisionManifoldMap.Insert(collisionManifold.GetKey(), collisionManifold);
 					}
 				}
-				else
+			}
+
+			// A sleeping body touched by an awake body wakes up with its island, before the solver runs.
+			// Pairs inside the woken islands were not in the broad phase, so their manifolds from before the sleep are used for this step.
+			_staleCollisionManifoldKeys.Clear();
+			for (const CollisionManifold& collisionManifold : _collisionManifoldMap)
+			{
+				if (collisionManifold.IsValid() == false)
 				{
-					// Discrete collision detection
-					SharedPtr<CollisionShape> transformedShapeA{ CollisionShape::MakeTransformed(bodyA._shape._collisionShape, bodyA._transform2D) };
-					SharedPtr<CollisionShape> transformedShapeB{ CollisionShape::MakeTransformed(bodyB._shape._collisionShape, bodyB._transform2D) };
-					if (Intersect_GJK(*transformedShapeA, *transformedShapeB, &gjkInfo))
+					_staleCollisionManifoldKeys.PushBack(collisionManifold.GetKey());
+					continue;
+				}
+
+				const Body& bodyA = GetBody(collisionManifold._bodyIDA);
+				const Body& bodyB = GetBody(collisionManifold._bodyIDB);
+				if (bodyA._isSleeping == true && bodyB.IsAwake() == true)
+				{
+					WakeIsland(bodyA._bodyID.Value());
+				}
+				else if (bodyB._isSleeping == true && bodyA.IsAwake() == true)
+				{
+					WakeIsland(bodyB._bodyID.Value());
+				}
+			}
+			for (const CollisionManifold::Key key : _staleCollisionManifoldKeys)
+			{
+				_collisionManifoldMap.Erase(key);
+			}
+			StepCollide_NarrowPhase_RestoreWokenCollisionManifolds();
+		}
+
+		void World::StepCollide_NarrowPhase_RestoreWokenCollisionManifolds()
+		{
+			if (_hasWokenIsland == false)
+			{
+				return;
+			}
+
+			_hasWokenIsland = false;
+			_staleCollisionManifoldKeys.Clear();
+			for (const CollisionManifold& collisionManifold : _sleepingCollisionManifoldMap)
+			{
+				if (GetBody(collisionManifold._bodyIDA).IsAwake() == true || GetBody(collisionManifold._bodyIDB).IsAwake() == true)
+				{
+					// A manifold found in this step is newer.
+					if (_collisionManifoldMap.Find(collisionManifold.GetKey()).IsValid() == false)
 					{
-						StepCollide_NarrowPhase_GenerateCollision(bodyA, *transformedShapeA, bodyB, *transformedShapeB, gjkInfo, collisionManifold);
+						_collisionManifoldMap.Insert(collisionManifold.GetKey(), collisionManifold);
 					}
+					_staleCollisionManifoldKeys.PushBack(collisionManifold.GetKey());
 				}
+			}
+			for (const CollisionManifold::Key key : _staleCollisionManifoldKeys)
+			{
+				_sleepingCollisionManifoldMap.Erase(key);
+			}
+		}
 
-				if (collisionManifold.IsValid() == true)
+		bool World::StepCollide_NarrowPhase_BodyPair(float deltaTime, const BroadPhaseBodyPair& bodyPair, Physics2D::GJKInfo& gjkInfo, Physics2D::EPAInfo& epaInfo, CollisionManifold& outCollisionManifold) const
+		{
+			const Body& bodyA = GetBody(bodyPair._bodyIDA);
+			const Body& bodyB = GetBody(bodyPair._bodyIDB);
+
+			// Shapes are only viewed through the body transforms, not copied.
+			// This does no heap allocation, and doesn't touch the SharedPtr reference counts which are not safe to share between threads.
+			TransformedCollisionShape shapeA{ *bodyA._shape._collisionShape, GetTransform(bodyA._bodyID) };
+			TransformedCollisionShape shapeB{ *bodyB._shape._collisionShape, GetTransform(bodyB._bodyID) };
+			const Real2 relativeLinearVelocity = _bodyStore._linearVelocities[bodyA._bodyID.Value()] - _bodyStore._linearVelocities[bodyB._bodyID.Value()];
+			if (relativeLinearVelocity.IsZero() == false)
+			{
+				// Continuous collision detection
+				float timeOfImpact = 0.0f;
+				Float2 normal;
+				float distance = 0.0f;
+				if (StepCollide_NarrowPhase_CCD(deltaTime, bodyA, bodyB, shapeA, shapeB, timeOfImpact, normal, distance))
 				{
-					KeyValuePair found = _collisionManifoldMap.Find(bodyA._bodyID.Value());
-					if (found.IsValid())
+					if (distance > 0.0f)
 					{
-						found._value->PushBack(collisionManifold);
+						StepCollide_NarrowPhase_GenerateCollision(bodyA, shapeA, bodyB, shapeB, normal, outCollisionManifold);
 					}
-					else
+					else if (Intersect_GJK(shapeA, shapeB, &gjkInfo))
+					{
+						StepCollide_NarrowPhase_GenerateCollision(bodyA, shapeA, bodyB, shapeB, gjkInfo, epaInfo, outCollisionManifold);
+					}
+
+					// The points are found at the time of impact, but the solver starts from the beginning of the step.
+					// So the separations are measured back to then, and the solver lets the bodies close exactly that gap.
+					const float approachDistance = ToFloat2(relativeLinearVelocity).Dot(outCollisionManifold._collisionNormal) * timeOfImpact;
+					for (uint32 i = 0; i < outCollisionManifold._pointCount; ++i)
 					{
-						_collisionManifoldMap.Insert(bodyA._bodyID.Value(), { collisionManifold });
+						outCollisionManifold._points[i]._contactPoint._separation += approachDistance;
 					}
 				}
 			}
+			else
+			{
+				// Discrete collision detection
+				if (Intersect_GJK(shapeA, shapeB, &gjkInfo))
+				{
+					StepCollide_NarrowPhase_GenerateCollision(bodyA, shapeA, bodyB, shapeB, gjkInfo, epaInfo, outCollisionManifold);
+				}
+			}
+			return outCollisionManifold.IsValid();
 		}
 
-		void World::StepCollide_NarrowPhase_GenerateCollision(const Body& bodyA, const CollisionShape& bodyShapeA, const Body& bodyB, const CollisionShape& bodyShapeB, const Physics2D::GJKInfo& gjkInfo, CollisionManifold& outCollisionManifold) const
+		void World::StepCollide_NarrowPhase_GenerateCollision(const Body& bodyA, const TransformedCollisionShape& bodyShapeA, const Body& bodyB, const TransformedCollisionShape& bodyShapeB, const Physics2D::GJKInfo& gjkInfo, Physics2D::EPAInfo& epaInfo, CollisionManifold& outCollisionManifold) const
 		{
-			outCollisionManifold._bodyIDA = bodyA._bodyID;
-			outCollisionManifold._bodyIDB = bodyB._bodyID;
-
-			EPAInfo epaInfo;
 			Float2 normal;
 			float distance = 0.0f;
 			ComputePenetration_EPA(bodyShapeA, bodyShapeB, gjkInfo, normal, distance, epaInfo);
+			StepCollide_NarrowPhase_GenerateCollision(bodyA, bodyShapeA, bodyB, bodyShapeB, normal, outCollisionManifold);
+		}
 
-			Float2 edgeVertex0;
-			Float2 edgeVertex1;
-			bodyShapeB.ComputeSupportEdge(normal, edgeVertex0, edgeVertex1);
-			Float2 edgeDirection = edgeVertex0 - edgeVertex1;
-			edgeDirection.Normalize();
-			outCollisionManifold._collisionNormal = Float2(-edgeDirection._y, edgeDirection._x);
+		void World::StepCollide_NarrowPhase_GenerateCollision(const Body& bodyA, const TransformedCollisionShape& bodyShapeA, const Body& bodyB, const TransformedCollisionShape& bodyShapeB, const Float2& normal, CollisionManifold& outCollisionManifold) const
+		{
+			outCollisionManifold._bodyIDA = bodyA._bodyID;
+			outCollisionManifold._bodyIDB = bodyB._bodyID;
 
-			const Float2 bodyAPoint = bodyShapeA.ComputeSupportPoint(-outCollisionManifold._collisionNormal);
-			outCollisionManifold._collisionPosition = bodyAPoint;
-			outCollisionManifold._signedDistance = outCollisionManifold._collisionNormal.Dot(outCollisionManifold._collisionPosition - edgeVertex0);
+			ContactPoint contactPoints[CollisionManifold::kMaxPointCount];
+			outCollisionManifold._pointCount = ComputeContactPoints_Clip(bodyShapeA, bodyShapeB, normal, kMaxContactSeparation, outCollisionManifold._collisionNormal, contactPoints);
+			for (uint32 i = 0; i < outCollisionManifold._pointCount; ++i)
+			{
+				outCollisionManifold._points[i]._contactPoint = contactPoints[i];
+			}
 		}
 
 		void World::StepSolve(float deltaTime)
 		{
-			_worldSizePreStepSolve = _worldSize;
-
-			//StepSolveResolveCollisions(deltaTime);
+			StepSolveIntegrateVelocities(deltaTime);
 			StepSolveSolveConstraints(deltaTime);
+			StepSolveIntegratePositions(deltaTime);
+		}
 
-			StepSolveIntegrate(deltaTime);
-			StepSolveAssignCollisionSectors();
+		void World::StepSolveIntegrateVelocities(float deltaTime)
+		{
+			// Each body is integrated on its own, so bodies can be split into tasks freely.
+			// Static and sleeping bodies don't move, so only awake bodies are integrated.
+			const Real realDeltaTime = ToReal(deltaTime);
+			const uint32 awakeBodyCount = _awakeBodySlotIndices.Size();
+			_threadPool.ParallelFor(ComputeStepTaskCount(awakeBodyCount), [this, realDeltaTime, awakeBodyCount](const uint32 taskIndex)
+				{
+					const uint32 awakeBodyIndexEnd = Min(awakeBodyCount, (taskIndex + 1) * kStepTaskItemCount);
+					for (uint32 i = taskIndex * kStepTaskItemCount; i < awakeBodyIndexEnd; ++i)
+					{
+						const uint32 bodySlotIndex = _awakeBodySlotIndices[i];
+						Real2& linearAcceleration = _bodyStore._linearAccelerations[bodySlotIndex];
+						Real& angularAcceleration = _bodyStore._angularAccelerations[bodySlotIndex];
+
+						// integrate acceleration
+						_bodyStore._linearVelocities[bodySlotIndex] += (linearAcceleration + _gravity) * realDeltaTime;
+						_bodyStore._angularVelocities[bodySlotIndex] += angularAcceleration * realDeltaTime;
+
+						linearAcceleration.SetZero();
+						angularAcceleration = Real(0);
+					}
+				});
 		}
 
-		void World::StepSolveResolveCollisions(float deltaTime)
+		void World::StepSolveSolveConstraints(float deltaTime)
 		{
-			// Resolve Collisions
-			GJKInfo gjkInfo;
-			for (Vector<CollisionManifold>& collisionManifolds : _collisionManifoldMap)
+			// Entries of _solverBodyIndices are reset after use, so only new slots need to be initialized here.
+			_constraintSolver.Clear();
+			_solverBodySlotIndices.Clear();
+			const uint32 bodyCount = _bodyPool.GetObjects().Size();
+			for (uint32 i = _solverBodyIndices.Size(); i < bodyCount; ++i)
 			{
-				QuickSort(collisionManifolds, CollisionManifold::AbsoluteDistanceComparator());
+				_solverBodyIndices.PushBack(kInvalidIndexUint32);
+			}
 
-				for (CollisionManifold& collisionManifold : collisionManifolds)
+			// Rows are built in Real, so the deterministic build does not round velocities and impulses through float.
+			// The normal, position and separation of contacts come from float collision detection, and are snapped to a fixed grid on the way in.
+			auto cross = [](const Real2& lhs, const Real2& rhs) { return lhs._x * rhs._y - lhs._y * rhs._x; };
+			const Real inverseDeltaTime = Real(1) / ToReal(deltaTime);
+
+			// Contacts
+			// The map is iterated in the same order whatever the thread count is, so are the rows.
+			// Every manifold in the map has an awake body, as the ones between sleeping or static bodies are kept in _sleepingCollisionManifoldMap.
+			_contactRowIndices.Clear();
+			for (const CollisionManifold& collisionManifold : _collisionManifoldMap)
+			{
+				const Body& bodyA = GetBody(collisionManifold._bodyIDA);
+				const Body& bodyB = GetBody(collisionManifold._bodyIDB);
+				const uint32 solverBodyIndexA = AddSolverBody(bodyA);
+				const uint32 solverBodyIndexB = AddSolverBody(bodyB);
+				const Real2& translationA = _bodyStore._translations[collisionManifold._bodyIDA.Value()];
+				const Real2& translationB = _bodyStore._translations[collisionManifold._bodyIDB.Value()];
+				const Real2 normal = QuantizeToReal2(collisionManifold._collisionNormal);
+				const Real2 tangent{ -normal._y, normal._x };
+				const Real friction = SqrtReal(ToReal(bodyA._friction) * ToReal(bodyB._friction));
+				for (uint32 i = 0; i < collisionManifold._pointCount; ++i)
 				{
-					Body* bodyA = &AccessBody(collisionManifold._bodyIDA);
-					Body* bodyB = &AccessBody(collisionManifold._bodyIDB);
-					if (bodyA->_bodyMotionType == BodyMotionType::Dynamic && bodyB->_bodyMotionType == BodyMotionType::Dynamic)
+					const CollisionManifold::Point& point = collisionManifold._points[i];
+					const ContactPoint& contactPoint = point._contactPoint;
+					const Real2 position = QuantizeToReal2(contactPoint._position);
+					const Real2 anchorA = position - translationA;
+					const Real2 anchorB = position - translationB;
+
+					// A separated point is speculative: the bodies may close the gap in this step, but no more.
+					// An overlapped point is pushed out a bit in every step.
+					const Real separation = QuantizeToReal(contactPoint._separation);
+					Real bias = Real(0);
+					if (separation > Real(0))
 					{
-						// TODO
-						MINT_NEVER;
+						bias = separation * inverseDeltaTime;
 					}
 					else
 					{
-						// Make sure bodyA is Dynamic!
-						if (bodyB->_bodyMotionType == BodyMotionType::Dynamic)
-						{
-							Body* bodyTemp = bodyA;
-							bodyA = bodyB;
-							bodyB = bodyTemp;
-						}
+						bias = Max(ToReal(kBaumgarteFactor) * Min(separation + ToReal(kLinearSlop), Real(0)) * inverseDeltaTime, -ToReal(kMaxPushOutSpeed));
+					}
 
-						// TODO: Resolve Penetration!
-						if (collisionManifold._signedDistance < 0.0f)
-						{
-							SharedPtr<CollisionShape> transformedShapeA{ CollisionShape::MakeTransformed(bodyA->_shape._collisionShape, bodyA->_transform2D) };
-							SharedPtr<CollisionShape> transformedShapeB{ CollisionShape::MakeTransformed(bodyB->_shape._collisionShape, bodyB->_transform2D) };
-							if (Intersect_GJK(*transformedShapeA, *transformedShapeB, &gjkInfo))
-							{
-								CollisionManifold newCollisionManifold;
-								StepCollide_NarrowPhase_GenerateCollision(*bodyA, *transformedShapeA, *bodyB, *transformedShapeB, gjkInfo, newCollisionManifold);
-								const Float2 separatingVector = newCollisionManifold._collisionNormal * -newCollisionManifold._signedDistance;
-								bodyA->_transform2D._translation += separatingVector;
+					const uint32 normalRowIndex = _constraintSolver.AddRow(solverBodyIndexA, solverBodyIndexB, normal, cross(anchorA, normal), cross(anchorB, normal), bias, Real(0), kRealMax, point._normalImpulse);
+					const uint32 frictionRowIndex = _constraintSolver.AddFrictionRow(solverBodyIndexA, solverBodyIndexB, tangent, cross(anchorA, tangent), cross(anchorB, tangent), normalRowIndex, friction, point._tangentImpulse);
+					_contactRowIndices.PushBack(normalRowIndex);
+					_contactRowIndices.PushBack(frictionRowIndex);
+				}
+			}
 
-								//bodyA->_linearVelocity += separatingVector / deltaTime;
-							}
-						}
-					}
+			// Joints
+			_particleDistanceConstraintRowIndices.Clear();
+			for (ParticleDistanceConstraint& particleDistanceConstraint : _particleDistanceConstraints)
+			{
+				const Body& bodyA = GetBody(particleDistanceConstraint._bodyAID);
+				const Body& bodyB = GetBody(particleDistanceConstraint._bodyBID);
+				Real2 direction = _bodyStore._translations[particleDistanceConstraint._bodyBID.Value()] - _bodyStore._translations[particleDistanceConstraint._bodyAID.Value()];
+				const Real distance = direction.Length();
+				if (bodyA.IsAwake() == false && bodyB.IsAwake() == false)
+				{
+					// The impulse is kept until the bodies wake up.
+					_particleDistanceConstraintRowIndices.PushBack(kInvalidIndexUint32);
+					continue;
 				}
+
+				if (distance == Real(0))
+				{
+					// The direction is undefined.
+					particleDistanceConstraint._impulse = Real(0);
+					_particleDistanceConstraintRowIndices.PushBack(kInvalidIndexUint32);
+					continue;
+				}
+
+				direction /= distance;
+				const Real bias = ToReal(kBaumgarteFactor) * (distance - ToReal(particleDistanceConstraint._distance)) * inverseDeltaTime;
+				const uint32 rowIndex = _constraintSolver.AddRow(AddSolverBody(bodyA), AddSolverBody(bodyB), direction, Real(0), Real(0), bias, -kRealMax, kRealMax, particleDistanceConstraint._impulse);
+				_particleDistanceConstraintRowIndices.PushBack(rowIndex);
+			}
+
+			if (_constraintSolver.GetRowCount() > 0)
+			{
+				_constraintSolver.Solve(_solverIterationCount);
+			}
+
+			// Impulses are kept for warm starting in the next step.
+			uint32 contactRowIndexCursor = 0;
+			for (CollisionManifold& collisionManifold : _collisionManifoldMap)
+			{
+				for (uint32 i = 0; i < collisionManifold._pointCount; ++i)
+				{
+					CollisionManifold::Point& point = collisionManifold._points[i];
+					point._normalImpulse = _constraintSolver.GetImpulse(_contactRowIndices[contactRowIndexCursor++]);
+					point._tangentImpulse = _constraintSolver.GetImpulse(_contactRowIndices[contactRowIndexCursor++]);
+				}
+			}
+			const uint32 particleDistanceConstraintCount = _particleDistanceConstraints.Size();
+			for (uint32 i = 0; i < particleDistanceConstraintCount; ++i)
+			{
+				const uint32 rowIndex = _particleDistanceConstraintRowIndices[i];
+				if (rowIndex != kInvalidIndexUint32)
+				{
+					_particleDistanceConstraints[i]._impulse = _constraintSolver.GetImpulse(rowIndex);
+				}
+			}
+
+			// Only the awake dynamic bodies in the solver are written back, so the others keep their velocities exactly.
+			for (const uint32 bodySlotIndex : _solverBodySlotIndices)
+			{
+				uint32& solverBodyIndex = _solverBodyIndices[bodySlotIndex];
+				const Body& body = _bodyPool.GetObject_(bodySlotIndex);
+				if (body._bodyMotionType == BodyMotionType::Dynamic && body._isSleeping == false)
+				{
+					_bodyStore._linearVelocities[bodySlotIndex] = _constraintSolver.GetLinearVelocity(solverBodyIndex);
+					_bodyStore._angularVelocities[bodySlotIndex] = _constraintSolver.GetAngularVelocity(solverBodyIndex);
+				}
+				solverBodyIndex = kInvalidIndexUint32;
 			}
 		}
 
-		void World::StepSolveSolveConstraints(float deltaTime)
+		uint32 World::AddSolverBody(const Body& body)
 		{
+			const uint32 bodySlotIndex = body._bodyID.Value();
+			uint32& solverBodyIndex = _solverBodyIndices[bodySlotIndex];
+			if (solverBodyIndex == kInvalidIndexUint32)
+			{
+				// Static, key-framed and sleeping bodies are not moved by the solver.
+				const bool isDynamic = (body._bodyMotionType == BodyMotionType::Dynamic && body._isSleeping == false);
+				const Real inverseMass = (isDynamic == true) ? _bodyStore._inverseMasses[bodySlotIndex] : Real(0);
+				const Real inverseInertia = (isDynamic == true) ? _bodyStore._inverseInertias[bodySlotIndex] : Real(0);
+				solverBodyIndex = _constraintSolver.AddBody(_bodyStore._linearVelocities[bodySlotIndex], _bodyStore._angularVelocities[bodySlotIndex], inverseMass, inverseInertia);
+				_solverBodySlotIndices.PushBack(bodySlotIndex);
+			}
+			return solverBodyIndex;
+		}
+
+		void World::StepSolveIntegratePositions(float deltaTime)
+		{
+			const Real realDeltaTime = ToReal(deltaTime);
+			const uint32 awakeBodyCount = _awakeBodySlotIndices.Size();
+			_threadPool.ParallelFor(ComputeStepTaskCount(awakeBodyCount), [this, realDeltaTime, awakeBodyCount](const uint32 taskIndex)
+				{
+					const uint32 awakeBodyIndexEnd = Min(awakeBodyCount, (taskIndex + 1) * kStepTaskItemCount);
+					for (uint32 i = taskIndex * kStepTaskItemCount; i < awakeBodyIndexEnd; ++i)
+					{
+						// integrate velocity
+						// AABBs are updated at the start of the next step, together with the movement in it.
+						const uint32 bodySlotIndex = _awakeBodySlotIndices[i];
+						Real2& linearVelocity = _bodyStore._linearVelocities[bodySlotIndex];
+						_bodyStore._translations[bodySlotIndex] += linearVelocity * realDeltaTime;
+						_bodyStore._rotations[bodySlotIndex] += _bodyStore._angularVelocities[bodySlotIndex] * realDeltaTime;
+						linearVelocity *= (Real(1) - _bodyStore._linearDampings[bodySlotIndex]);
+					}
+				});
+		}
 
+		void World::UpdateBodyAABB(const uint32 bodySlotIndex, const Float2& displacement)
+		{
+			const Float2 center = _bodyStore._shapeAABBCenters[bodySlotIndex] + ToFloat2(_bodyStore._translations[bodySlotIndex]);
+			AABBCollisionShape::ComputeExpandedMinMax(center, _bodyStore._shapeAABBHalfSizes[bodySlotIndex], ToFloat(_bodyStore._rotations[bodySlotIndex]), displacement, _bodyStore._aabbMins[bodySlotIndex], _bodyStore._aabbMaxs[bodySlotIndex]);
 		}
 
-		void World::StepSolveIntegrate(float deltaTime)
+		void World::StepUpdateIslands(float deltaTime)
 		{
+			if (_sleepSettings._isEnabled == false)
+			{
+				return;
+			}
+
 			const uint32 bodyCount = _bodyPool.GetObjects().Size();
-			for (uint32 i = 0; i < bodyCount; ++i)
+			if (_islandParentSlotIndices.Size() < bodyCount)
 			{
-				Body& body = _bodyPool.GetObject_(i);
-				if (body.IsValid() == false)
+				_islandParentSlotIndices.Resize(bodyCount);
+				_islandSleepTimes.Resize(bodyCount);
+				_islandHeadSlotIndices.Resize(bodyCount);
+				_sleepingIslandNextSlotIndices.Resize(bodyCount);
+			}
+
+			const float linearSpeedSquared = _sleepSettings._linearSpeed * _sleepSettings._linearSpeed;
+			for (const uint32 bodySlotIndex : _awakeBodySlotIndices)
+			{
+				Body& body = _bodyPool.GetObject_(bodySlotIndex);
+				const bool isSlow = (ToFloat2(_bodyStore._linearVelocities[bodySlotIndex]).LengthSqaure() <= linearSpeedSquared && ::abs(ToFloat(_bodyStore._angularVelocities[bodySlotIndex])) <= _sleepSettings._angularSpeed);
+				body._sleepTime = (body._canSleep == true && isSlow == true) ? body._sleepTime + deltaTime : 0.0f;
+
+				_islandParentSlotIndices[bodySlotIndex] = bodySlotIndex;
+				_islandSleepTimes[bodySlotIndex] = body._sleepTime;
+				_islandHeadSlotIndices[bodySlotIndex] = kInvalidIndexUint32;
+			}
+
+			// Union-find over contacts and joints.
+			// Static bodies don't join islands, or everything on the same ground would be one island.
+			const auto unite = [this](const Body& bodyA, const Body& bodyB)
+			{
+				if (bodyA.IsAwake() == false || bodyB.IsAwake() == false)
 				{
-					continue;
+					return;
 				}
 
-				if (body._bodyMotionType != BodyMotionType::Static)
+				const uint32 rootA = FindIslandRoot(bodyA._bodyID.Value());
+				const uint32 rootB = FindIslandRoot(bodyB._bodyID.Value());
+				if (rootA != rootB)
 				{
-					body._linearAcceleration += _gravity;
+					_islandParentSlotIndices[Max(rootA, rootB)] = Min(rootA, rootB);
+				}
+			};
+			for (const CollisionManifold& collisionManifold : _collisionManifoldMap)
+			{
+				unite(GetBody(collisionManifold._bodyIDA), GetBody(collisionManifold._bodyIDB));
+			}
+			for (const ParticleDistanceConstraint& particleDistanceConstraint : _particleDistanceConstraints)
+			{
+				unite(GetBody(particleDistanceConstraint._bodyAID), GetBody(particleDistanceConstraint._bodyBID));
+			}
 
-					// integrate acceleration
-					body._linearVelocity += body._linearAcceleration * deltaTime;
-					body._angularVelocity += body._angularAcceleration * deltaTime;
+			// An island falls asleep when its fastest-changing body has been slow long enough.
+			for (const uint32 bodySlotIndex : _awakeBodySlotIndices)
+			{
+				const uint32 root = FindIslandRoot(bodySlotIndex);
+				_islandSleepTimes[root] = Min(_islandSleepTimes[root], _islandSleepTimes[bodySlotIndex]);
+			}
 
-					body._linearAcceleration.SetZero();
-					body._angularAcceleration = 0.0f;
+			bool hasSleptIsland = false;
+			for (const uint32 bodySlotIndex : _awakeBodySlotIndices)
+			{
+				const uint32 root = FindIslandRoot(bodySlotIndex);
+				if (_islandSleepTimes[root] < _sleepSettings._timeToSleep)
+				{
+					continue;
+				}
 
-					// integrate velocity
-					body._transform2D._translation += body._linearVelocity * deltaTime;
-					body._transform2D._rotation += body._angularVelocity * deltaTime;
+				_bodyPool.GetObject_(bodySlotIndex)._isSleeping = true;
+				_bodyStore._linearVelocities[bodySlotIndex].SetZero();
+				_bodyStore._angularVelocities[bodySlotIndex] = Real(0);
+				_bodyStore._linearAccelerations[bodySlotIndex].SetZero();
+				_bodyStore._angularAccelerations[bodySlotIndex] = Real(0);
 
-					if (body._bodyMotionType == BodyMotionType::Dynamic)
-					{
-						body._linearVelocity *= (1.0f - body._linearDamping);
-					}
+				// Link the bodies of the island in a circle.
+				uint32& head = _islandHeadSlotIndices[root];
+				if (head == kInvalidIndexUint32)
+				{
+					head = bodySlotIndex;
+					_sleepingIslandNextSlotIndices[bodySlotIndex] = bodySlotIndex;
+				}
+				else
+				{
+					_sleepingIslandNextSlotIndices[bodySlotIndex] = _sleepingIslandNextSlotIndices[head];
+					_sleepingIslandNextSlotIndices[head] = bodySlotIndex;
 				}
 
-				body._bodyAABB->Set(*body._shape._shapeAABB, body._transform2D);
+				// The proxy becomes static in the next broad phase.
+				_touchedBodySlotIndices.PushBack(bodySlotIndex);
+				hasSleptIsland = true;
+			}
 
-				_worldMin = Float2::Min(_worldMin, body._transform2D._translation);
-				_worldMax = Float2::Max(_worldMax, body._transform2D._translation);
+			if (hasSleptIsland == false)
+			{
+				return;
+			}
+
+			uint32 awakeBodyCount = 0;
+			for (const uint32 bodySlotIndex : _awakeBodySlotIndices)
+			{
+				if (_bodyPool.GetObject_(bodySlotIndex)._isSleeping == false)
+				{
+					_awakeBodySlotIndices[awakeBodyCount++] = bodySlotIndex;
+				}
+			}
+			_awakeBodySlotIndices.Resize(awakeBodyCount);
+
+			// The broad phase won't find pairs without an awake body, so their manifolds are put aside until the island wakes up.
+			_staleCollisionManifoldKeys.Clear();
+			for (const CollisionManifold& collisionManifold : _collisionManifoldMap)
+			{
+				if (GetBody(collisionManifold._bodyIDA).IsAwake() == false && GetBody(collisionManifold._bodyIDB).IsAwake() == false)
+				{
+					_sleepingCollisionManifoldMap.Insert(collisionManifold.GetKey(), collisionManifold);
+					_staleCollisionManifoldKeys.PushBack(collisionManifold.GetKey());
+				}
+			}
+			for (const CollisionManifold::Key key : _staleCollisionManifoldKeys)
+			{
+				_collisionManifoldMap.Erase(key);
 			}
-			_worldSize = (_worldMax - _worldMin);
 		}
 
-		void World::StepSolveAssignCollisionSectors()
+		uint32 World::FindIslandRoot(uint32 bodySlotIndex)
 		{
-			const Float2 collisionSectorSize = _worldSize / static_cast<float>(1 + _collisionSectorDepth);
-			const uint32 collisionSectorBufferSize = _collisionSectorSideCount * _collisionSectorSideCount;
-			for (uint32 i = 0; i < collisionSectorBufferSize; ++i)
+			while (_islandParentSlotIndices[bodySlotIndex] != bodySlotIndex)
 			{
-				_collisionSectors[i]._bodyIDs.Clear();
+				// Path halving
+				_islandParentSlotIndices[bodySlotIndex] = _islandParentSlotIndices[_islandParentSlotIndices[bodySlotIndex]];
+				bodySlotIndex = _islandParentSlotIndices[bodySlotIndex];
 			}
-			Vector<uint32> collisionSectorIndices;
-			collisionSectorIndices.Resize(4);
+			return bodySlotIndex;
+		}
+
+		void World::WakeIsland(const uint32 bodySlotIndex)
+		{
+			if (_bodyPool.GetObject_(bodySlotIndex)._isSleeping == false)
+			{
+				return;
+			}
+
+			uint32 memberSlotIndex = bodySlotIndex;
+			do
+			{
+				Body& member = _bodyPool.GetObject_(memberSlotIndex);
+				member._isSleeping = false;
+				member._sleepTime = 0.0f;
+				_awakeBodySlotIndices.PushBack(memberSlotIndex);
+				_touchedBodySlotIndices.PushBack(memberSlotIndex);
+				memberSlotIndex = _sleepingIslandNextSlotIndices[memberSlotIndex];
+			} while (memberSlotIndex != bodySlotIndex);
+			_hasWokenIsland = true;
+		}
+
+		void World::WakeAllBodies()
+		{
+			// Everything is rebuilt from the bodies, because they may have been overwritten by history snapshots.
+			_awakeBodySlotIndices.Clear();
+			_touchedBodySlotIndices.Clear();
 			const uint32 bodyCount = _bodyPool.GetObjects().Size();
 			for (uint32 i = 0; i < bodyCount; ++i)
 			{
@@ -486,18 +1280,15 @@ namespace mint
 					continue;
 				}
 
-				ComputeCollisionSectorIndices(*body._bodyAABB, _worldMin, collisionSectorSize, collisionSectorIndices);
-				QuickSort(collisionSectorIndices, ComparatorAscending<uint32>());
-				_collisionSectors[collisionSectorIndices[0]]._bodyIDs.PushBack(body._bodyID);
-				for (uint32 j = 1; j < 4; ++j)
+				body._isSleeping = false;
+				body._sleepTime = 0.0f;
+				if (body._bodyMotionType != BodyMotionType::Static)
 				{
-					if (collisionSectorIndices[j] == collisionSectorIndices[j - 1])
-					{
-						continue;
-					}
-					_collisionSectors[collisionSectorIndices[j]]._bodyIDs.PushBack(body._bodyID);
+					_awakeBodySlotIndices.PushBack(i);
 				}
+				_touchedBodySlotIndices.PushBack(i);
 			}
+			_hasWokenIsland = true;
 		}
 
 		void World::StepRecordSnapshot()
@@ -520,83 +1311,33 @@ namespace mint
 
 				StepSnapshot::BodySnapshot bodySnapshot;
 				bodySnapshot._body = body;
-				KeyValuePair found = _collisionManifoldMap.Find(body._bodyID.Value());
-				if (found.IsValid())
-				{
-					bodySnapshot._collisionManifolds = *found._value;
-				}
+				bodySnapshot._translation = _bodyStore._translations[i];
+				bodySnapshot._rotation = _bodyStore._rotations[i];
+				bodySnapshot._linearVelocity = _bodyStore._linearVelocities[i];
+				bodySnapshot._angularVelocity = _bodyStore._angularVelocities[i];
 				stepSnapshot._bodySnapshots.PushBack(std::move(bodySnapshot));
 			}
+			for (const CollisionManifold& collisionManifold : _collisionManifoldMap)
+			{
+				stepSnapshot._collisionManifolds.PushBack(collisionManifold);
+			}
 			_worldHistory._stepSnapshots.Push(stepSnapshot);
 		}
 
-		void World::ComputeCollisionSectorIndices(const Physics2D::AABBCollisionShape& aabb, const Float2& worldMin, const Float2& collisionSectorSize, Vector<uint32>& outIndices) const
-		{
-			const Float2 aabbMax = aabb._center + aabb._halfSize;
-			const Float2 aabbMin = aabb._center - aabb._halfSize;
-			Float2 p0 = Float2(aabbMin._x, aabbMax._y);
-			const Float2& p1 = aabbMin;
-			Float2 p2 = Float2(aabbMax._x, aabbMin._y);
-			const Float2& p3 = aabbMax;
-
-			const Float2 p0FromMin = p0 - worldMin;
-			const Float2 p1FromMin = p1 - worldMin;
-			const Float2 p2FromMin = p2 - worldMin;
-			const Float2 p3FromMin = p3 - worldMin;
-			outIndices[0] = ComputeCollisionSectorIndex(Int2(p0FromMin / collisionSectorSize));
-			outIndices[1] = ComputeCollisionSectorIndex(Int2(p1FromMin / collisionSectorSize));
-			outIndices[2] = ComputeCollisionSectorIndex(Int2(p2FromMin / collisionSectorSize));
-			outIndices[3] = ComputeCollisionSectorIndex(Int2(p3FromMin / collisionSectorSize));
-		}
-
-		uint32 World::ComputeCollisionSectorIndex(const Physics2D::AABBCollisionShape& aabb, const Float2& worldMin, const Float2& collisionSectorSize) const
-		{
-			const Float2 centerFromMin = aabb._center - worldMin;
-			return ComputeCollisionSectorIndex(Int2(centerFromMin / collisionSectorSize));
-		}
-
-		uint32 World::ComputeCollisionSectorIndex(const Int2& collisionSectorIndex2) const
+		Transform2D World::PredictBodyTransform(const Body& body, float deltaTime) const
 		{
-			return collisionSectorIndex2._y * _collisionSectorSideCount + collisionSectorIndex2._x;
+			const uint32 bodySlotIndex = body._bodyID.Value();
+			return PredictTransform(GetTransform(body._bodyID), ToFloat2(_bodyStore._linearVelocities[bodySlotIndex]), PredictBodyLinearAcceleration(body), ToFloat(_bodyStore._angularVelocities[bodySlotIndex]), ToFloat(_bodyStore._angularAccelerations[bodySlotIndex]), deltaTime);
 		}
 
-		CollisionSector* World::GetCollisionSector(const Int2& collisionSectorIndex2)
+		Float2 World::PredictBodyLinearAcceleration(const Body& body) const
 		{
-			if (collisionSectorIndex2._x < 0 || collisionSectorIndex2._x >= static_cast<int32>(_collisionSectorSideCount))
-			{
-				return nullptr;
-			}
-			else if (collisionSectorIndex2._y < 0 || collisionSectorIndex2._y >= static_cast<int32>(_collisionSectorSideCount))
+			const Real2& linearAcceleration = _bodyStore._linearAccelerations[body._bodyID.Value()];
+			if (body._bodyMotionType == BodyMotionType::Static)
 			{
-				return nullptr;
+				return ToFloat2(linearAcceleration);
 			}
-			return &_collisionSectors[ComputeCollisionSectorIndex(collisionSectorIndex2)];
-		}
-
-		void World::GetAdjacentCollisionSectors(const CollisionSector& collisionSector, CollisionSector* (outAdjacentCollisionSectors)[8])
-		{
-			// 5 6 7
-			// 3   4
-			// 0 1 2
-
-			const int32 x = collisionSector._index % _collisionSectorSideCount;
-			const int32 y = collisionSector._index / _collisionSectorSideCount;
-			const Int2 index2(x, y);
-			outAdjacentCollisionSectors[0] = GetCollisionSector(index2 + Int2(-1, -1));
-			outAdjacentCollisionSectors[1] = GetCollisionSector(index2 + Int2(0, -1));
-			outAdjacentCollisionSectors[2] = GetCollisionSector(index2 + Int2(+1, -1));
-
-			outAdjacentCollisionSectors[3] = GetCollisionSector(index2 + Int2(-1, 0));
-			outAdjacentCollisionSectors[4] = GetCollisionSector(index2 + Int2(+1, 0));
-
-			outAdjacentCollisionSectors[5] = GetCollisionSector(index2 + Int2(-1, +1));
-			outAdjacentCollisionSectors[6] = GetCollisionSector(index2 + Int2(0, +1));
-			outAdjacentCollisionSectors[7] = GetCollisionSector(index2 + Int2(+1, +1));
-		}
-
-		Transform2D World::PredictBodyTransform(const Body& body, float deltaTime) const
-		{
-			return PredictTransform(body._transform2D, body._linearVelocity, body._linearAcceleration, body._angularVelocity, body._angularAcceleration, deltaTime);
+			return ToFloat2(linearAcceleration + _gravity);
 		}
 
 		Transform2D World::PredictTransform(const Transform2D& transform2D, const Float2& linearVelocity, const Float2& linearAcceleration, float angularVelocity, float angularAcceleration, float deltaTime) const
@@ -605,7 +1346,7 @@ namespace mint
 			Transform2D resultTransform2D = transform2D;
 			resultTransform2D._translation += linearVelocity * deltaTime;
 			resultTransform2D._translation += linearAcceleration * deltaTimeSq;
-			resultTransform2D._rotation = angularVelocity * deltaTime;
+			resultTransform2D._rotation += angularVelocity * deltaTime;
 			resultTransform2D._rotation += angularAcceleration * deltaTimeSq;
 			return resultTransform2D;
 		}
@@ -617,12 +1358,13 @@ namespace mint
 				const StepSnapshot& stepSnapshot = _worldHistory.GetStepSnapshot();
 				for (const StepSnapshot::BodySnapshot& bodySnapshot : stepSnapshot._bodySnapshots)
 				{
-					RenderDebugBody(shapeRenderer, bodySnapshot._body);
+					const Body& body = bodySnapshot._body;
+					RenderDebugBody(shapeRenderer, body, Transform2D(body._scale, ToFloat(bodySnapshot._rotation), ToFloat2(bodySnapshot._translation)));
+				}
 
-					for (const CollisionManifold& collisionManifold : bodySnapshot._collisionManifolds)
-					{
-						RenderDebugCollisionManifold(shapeRenderer, collisionManifold);
-					}
+				for (const CollisionManifold& collisionManifold : stepSnapshot._collisionManifolds)
+				{
+					RenderDebugCollisionManifold(shapeRenderer, collisionManifold);
 				}
 			}
 			else
@@ -636,32 +1378,26 @@ namespace mint
 						continue;
 					}
 
-					RenderDebugBody(shapeRenderer, body);
+					RenderDebugBody(shapeRenderer, body, GetTransform(body._bodyID));
 				}
 
-				for (const Vector<CollisionManifold>& collisionManifolds : _collisionManifoldMap)
+				for (const CollisionManifold& collisionManifold : _collisionManifoldMap)
 				{
-					for (const CollisionManifold& collisionManifold : collisionManifolds)
-					{
-						RenderDebugCollisionManifold(shapeRenderer, collisionManifold);
-					}
+					RenderDebugCollisionManifold(shapeRenderer, collisionManifold);
 				}
 			}
 		}
 
-		void World::RenderDebugBody(Rendering::ShapeRenderer& shapeRenderer, const Body& body) const
+		void World::RenderDebugBody(Rendering::ShapeRenderer& shapeRenderer, const Body& body, const Transform2D& transform2D) const
 		{
 			MINT_ASSERT(body.IsValid() == true, "Caller must guarantee this!");
 
-			// TEMP
-			//body._bodyAABB->DebugDrawShape(shapeRenderer, ByteColor(255, 255, 0), Transform2D::GetIdentity());
-
-			body._shape._collisionShape->DebugDrawShape(shapeRenderer, ByteColor(128, 128, 128), body._transform2D);
+			body._shape._collisionShape->DebugDrawShape(shapeRenderer, (body._isSleeping == true) ? ByteColor(96, 96, 160) : ByteColor(128, 128, 128), transform2D);
 
 			// TEMP
 			//StackStringW<256> buffer;
 			//FormatString(buffer, L"[%d]", body._bodyID.Value());
-			//shapeRenderer.DrawDynamicText(buffer.CString(), Float4(body._transform2D._translation), Rendering::FontRenderingOption());
+			//shapeRenderer.DrawDynamicText(buffer.CString(), Float4(transform2D._translation), Rendering::FontRenderingOption());
 		}
 
 		void World::RenderDebugCollisionManifold(Rendering::ShapeRenderer& shapeRenderer, const CollisionManifold& collisionManifold) const
@@ -670,12 +1406,18 @@ namespace mint
 			const float kNormalThickness = 2.0f;
 			const float kPositionCircleRadius = 4.0f;
 
-			shapeRenderer.SetColor(ByteColor(0, 128, 255));
-			shapeRenderer.DrawCircle(Float3(collisionManifold._collisionPosition), kPositionCircleRadius);
-			shapeRenderer.DrawLine(collisionManifold._collisionPosition, collisionManifold._collisionPosition + collisionManifold._collisionNormal * kNormalLength, kNormalThickness);
-
-			shapeRenderer.SetColor(ByteColor(128, 0, 255));
-			shapeRenderer.DrawCircle(Float3(collisionManifold._collisionPosition + collisionManifold._collisionNormal * ::abs(collisionManifold._signedDistance)), kPositionCircleRadius);
+			for (uint32 i = 0; i < collisionManifold._pointCount; ++i)
+			{
+				// Points on the surfaces of A and B
+				const ContactPoint& contactPoint = collisionManifold._points[i]._contactPoint;
+				const Float2 halfSeparation = collisionManifold._collisionNormal * (contactPoint._separation * 0.5f);
+				shapeRenderer.SetColor(ByteColor(0, 128, 255));
+				shapeRenderer.DrawCircle(Float3(contactPoint._position - halfSeparation), kPositionCircleRadius);
+				shapeRenderer.DrawLine(contactPoint._position, contactPoint._position + collisionManifold._collisionNormal * kNormalLength, kNormalThickness);
+
+				shapeRenderer.SetColor(ByteColor(128, 0, 255));
+				shapeRenderer.DrawCircle(Float3(contactPoint._position + halfSeparation), kPositionCircleRadius);
+			}
 		}
 
 		void World::BeginHistoryRecording()
@@ -708,6 +1450,7 @@ namespace mint
 		void World::EndHistoryPlaying()
 		{
 			_worldHistory.EndPlaying();
+			WakeAllBodies();
 		}
 
 		uint32 World::GetHistorySize() const
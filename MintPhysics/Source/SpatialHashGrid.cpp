@@ -0,0 +1,299 @@
+﻿#include <MintPhysics/Include/SpatialHashGrid.hpp>
+
+
+namespace mint
+{
+	namespace Physics2D
+	{
+		SpatialHashGrid::SpatialHashGrid()
+			: SpatialHashGrid(1.0f)
+		{
+			__noop;
+		}
+
+		SpatialHashGrid::SpatialHashGrid(const float baseCellSize)
+			: _proxyCount{ 0 }
+			, _baseCellSize{ 1.0f }
+		{
+			MINT_ASSERT(baseCellSize > 0.0f, "칸 크기는 0 보다 커야 합니다!");
+
+			// 칸 크기를 2 의 거듭제곱으로 맞춰서 좌표 * (1 / 칸 크기) 가 정확하게 계산되게 한다. (칸 경계에서 쌍을 놓치지 않도록)
+			int32 exponent = 0;
+			const float mantissa = ::frexpf(baseCellSize, &exponent);
+			_baseCellSize = ::ldexpf(1.0f, (mantissa == 0.5f) ? exponent - 1 : exponent);
+		}
+
+		uint32 SpatialHashGrid::CreateProxy(const Float2& min, const Float2& max, const uint32 userData, const bool isStatic)
+		{
+			uint32 proxyID = kInvalidIndexUint32;
+			if (_freeProxyIDs.IsEmpty() == true)
+			{
+				proxyID = _proxies.Size();
+				_proxies.PushBack(Proxy());
+			}
+			else
+			{
+				proxyID = _freeProxyIDs.Back();
+				_freeProxyIDs.PopBack();
+			}
+
+			Proxy& proxy = _proxies[proxyID];
+			proxy._min = min;
+			proxy._max = max;
+			proxy._userData = userData;
+			proxy._isStatic = isStatic;
+			proxy._level = ComputeLevel(min, max);
+			AddToCell(proxyID);
+			++_proxyCount;
+			return proxyID;
+		}
+
+		void SpatialHashGrid::DestroyProxy(const uint32 proxyID)
+		{
+			MINT_ASSERT(_proxies[proxyID]._level != kInvalidIndexUint32, "이미 지운 proxy 입니다!");
+
+			RemoveFromCell(proxyID);
+			_proxies[proxyID] = Proxy();
+			_freeProxyIDs.PushBack(proxyID);
+			--_proxyCount;
+		}
+
+		void SpatialHashGrid::MoveProxy(const uint32 proxyID, const Float2& min, const Float2& max)
+		{
+			Proxy& proxy = _proxies[proxyID];
+			MINT_ASSERT(proxy._level != kInvalidIndexUint32, "지운 proxy 입니다!");
+
+			proxy._min = min;
+			proxy._max = max;
+
+			const uint32 level = ComputeLevel(min, max);
+			if (level == proxy._level && level < _levels.Size())
+			{
+				const float inverseCellSize = _levels[level]._inverseCellSize;
+				if (ComputeCellCoordinate(min._x, inverseCellSize) == proxy._cellX && ComputeCellCoordinate(min._y, inverseCellSize) == proxy._cellY)
+				{
+					return;
+				}
+			}
+
+			RemoveFromCell(proxyID);
+			proxy._level = level;
+			AddToCell(proxyID);
+		}
+
+		void SpatialHashGrid::SetProxyStatic(const uint32 proxyID, const bool isStatic)
+		{
+			Proxy& proxy = _proxies[proxyID];
+			MINT_ASSERT(proxy._level != kInvalidIndexUint32, "지운 proxy 입니다!");
+
+			if (proxy._isStatic == isStatic)
+			{
+				return;
+			}
+
+			Level& level = _levels[proxy._level];
+			const KeyValuePair found = level._cellIndices.Find(ComputeCellKey(proxy._cellX, proxy._cellY));
+			MINT_ASSERT(found.IsValid() == true, "proxy 가 칸에 없습니다!");
+
+			Cell& cell = level._cells[*found._value];
+			if (isStatic == true)
+			{
+				--cell._movingProxyCount;
+				--level._movingProxyCount;
+			}
+			else
+			{
+				++cell._movingProxyCount;
+				++level._movingProxyCount;
+			}
+			proxy._isStatic = isStatic;
+		}
+
+		void SpatialHashGrid::Clear()
+		{
+			_proxies.Clear();
+			_freeProxyIDs.Clear();
+			_levels.Clear();
+			_proxyCount = 0;
+		}
+
+		uint32 SpatialHashGrid::GetCellCount() const noexcept
+		{
+			uint32 cellCount = 0;
+			for (const Level& level : _levels)
+			{
+				cellCount += level._cells.Size();
+			}
+			return cellCount;
+		}
+
+		bool SpatialHashGrid::Validate() const noexcept
+		{
+			uint32 proxyCount = 0;
+			const uint32 proxySlotCount = _proxies.Size();
+			for (uint32 proxyID = 0; proxyID < proxySlotCount; ++proxyID)
+			{
+				const Proxy& proxy = _proxies[proxyID];
+				if (proxy._level == kInvalidIndexUint32)
+				{
+					continue;
+				}
+
+				++proxyCount;
+				if (proxy._level != ComputeLevel(proxy._min, proxy._max) || proxy._level >= _levels.Size())
+				{
+					return false;
+				}
+
+				const Level& level = _levels[proxy._level];
+				if (proxy._cellX != ComputeCellCoordinate(proxy._min._x, level._inverseCellSize) || proxy._cellY != ComputeCellCoordinate(proxy._min._y, level._inverseCellSize))
+				{
+					return false;
+				}
+
+				const Cell* const cell = FindCell(level, proxy._cellX, proxy._cellY);
+				if (cell == nullptr)
+				{
+					return false;
+				}
+
+				uint32 foundCount = 0;
+				for (const uint32 cellProxyID : cell->_proxyIDs)
+				{
+					foundCount += (cellProxyID == proxyID) ? 1 : 0;
+				}
+				if (foundCount != 1)
+				{
+					return false;
+				}
+			}
+
+			uint32 cellProxyCount = 0;
+			for (const Level& level : _levels)
+			{
+				if (level._cells.Size() != level._cellIndices.Size())
+				{
+					return false;
+				}
+
+				uint32 levelProxyCount = 0;
+				uint32 levelMovingProxyCount = 0;
+				for (const Cell& cell : level._cells)
+				{
+					if (cell._proxyIDs.IsEmpty() == true || FindCell(level, cell._x, cell._y) != &cell)
+					{
+						return false;
+					}
+					levelProxyCount += cell._proxyIDs.Size();
+
+					uint32 cellMovingProxyCount = 0;
+					for (const uint32 cellProxyID : cell._proxyIDs)
+					{
+						cellMovingProxyCount += (_proxies[cellProxyID]._isStatic == true) ? 0 : 1;
+					}
+					if (cellMovingProxyCount != cell._movingProxyCount)
+					{
+						return false;
+					}
+					levelMovingProxyCount += cellMovingProxyCount;
+				}
+
+				if (levelProxyCount != level._proxyCount || levelMovingProxyCount != level._movingProxyCount)
+				{
+					return false;
+				}
+				cellProxyCount += levelProxyCount;
+			}
+			return proxyCount == _proxyCount && cellProxyCount == _proxyCount && proxyCount + _freeProxyIDs.Size() == proxySlotCount;
+		}
+
+		uint32 SpatialHashGrid::ComputeLevel(const Float2& min, const Float2& max) const noexcept
+		{
+			// 가장 긴 변보다 칸이 커야 (같으면 안 된다) AABB 가 자기 칸과 +1 칸 안에 들어간다.
+			const float extent = Max(max._x - min._x, max._y - min._y);
+			uint32 level = 0;
+			float cellSize = _baseCellSize;
+			while (cellSize <= extent && level + 1 < kMaxLevelCount)
+			{
+				cellSize *= 2.0f;
+				++level;
+			}
+			return level;
+		}
+
+		void SpatialHashGrid::AddToCell(const uint32 proxyID)
+		{
+			Proxy& proxy = _proxies[proxyID];
+			while (_levels.Size() <= proxy._level)
+			{
+				Level level;
+				level._cellSize = ::ldexpf(_baseCellSize, static_cast<int32>(_levels.Size()));
+				level._inverseCellSize = 1.0f / level._cellSize;
+				_levels.PushBack(std::move(level));
+			}
+
+			Level& level = _levels[proxy._level];
+			proxy._cellX = ComputeCellCoordinate(proxy._min._x, level._inverseCellSize);
+			proxy._cellY = ComputeCellCoordinate(proxy._min._y, level._inverseCellSize);
+			const uint64 cellKey = ComputeCellKey(proxy._cellX, proxy._cellY);
+			const KeyValuePair found = level._cellIndices.Find(cellKey);
+			if (found.IsValid() == false)
+			{
+				level._cellIndices.Insert(cellKey, level._cells.Size());
+				Cell cell;
+				cell._x = proxy._cellX;
+				cell._y = proxy._cellY;
+				cell._proxyIDs.PushBack(proxyID);
+				cell._movingProxyCount = (proxy._isStatic == true) ? 0 : 1;
+				level._cells.PushBack(std::move(cell));
+			}
+			else
+			{
+				Cell& cell = level._cells[*found._value];
+				cell._proxyIDs.PushBack(proxyID);
+				cell._movingProxyCount += (proxy._isStatic == true) ? 0 : 1;
+			}
+			++level._proxyCount;
+			level._movingProxyCount += (proxy._isStatic == true) ? 0 : 1;
+		}
+
+		void SpatialHashGrid::RemoveFromCell(const uint32 proxyID)
+		{
+			const Proxy& proxy = _proxies[proxyID];
+			Level& level = _levels[proxy._level];
+			const uint64 cellKey = ComputeCellKey(proxy._cellX, proxy._cellY);
+			const KeyValuePair found = level._cellIndices.Find(cellKey);
+			MINT_ASSERT(found.IsValid() == true, "proxy 가 칸에 없습니다!");
+
+			const uint32 cellIndex = *found._value;
+			level._cells[cellIndex]._movingProxyCount -= (proxy._isStatic == true) ? 0 : 1;
+			InlineVector<uint32, 4>& proxyIDs = level._cells[cellIndex]._proxyIDs;
+			const uint32 proxyIDCount = proxyIDs.Size();
+			for (uint32 index = 0; index < proxyIDCount; ++index)
+			{
+				if (proxyIDs[index] == proxyID)
+				{
+					// 칸 안의 순서는 상관없으므로 마지막 것을 옮겨 온다.
+					proxyIDs[index] = proxyIDs[proxyIDCount - 1];
+					proxyIDs.PopBack();
+					break;
+				}
+			}
+
+			if (proxyIDs.IsEmpty() == true)
+			{
+				// 빈 칸 자리로 마지막 칸을 옮겨 온다.
+				level._cellIndices.Erase(cellKey);
+				const uint32 lastCellIndex = level._cells.Size() - 1;
+				if (cellIndex != lastCellIndex)
+				{
+					level._cells[cellIndex] = std::move(level._cells[lastCellIndex]);
+					*level._cellIndices.Find(ComputeCellKey(level._cells[cellIndex]._x, level._cells[cellIndex]._y))._value = cellIndex;
+				}
+				level._cells.PopBack();
+			}
+			--level._proxyCount;
+			level._movingProxyCount -= (proxy._isStatic == true) ? 0 : 1;
+		}
+	}
+}
@@ -0,0 +1,293 @@
+﻿#include <MintPhysics/Include/SweepAndPrune.hpp>
+
+#include <MintContainer/Include/Algorithm.hpp>
+
+
+namespace mint
+{
+	namespace Physics2D
+	{
+		SweepAndPrune::SweepAndPrune()
+			: _sortAxis{ 0 }
+			, _unsortedCount{ 0 }
+			, _removedCount{ 0 }
+		{
+			__noop;
+		}
+
+		uint32 SweepAndPrune::CreateProxy(const Float2& min, const Float2& max, const uint32 userData, const bool isStatic)
+		{
+			uint32 proxyID = kInvalidIndexUint32;
+			if (_freeProxyIDs.IsEmpty() == true)
+			{
+				proxyID = _proxies.Size();
+				_proxies.PushBack(Proxy());
+			}
+			else
+			{
+				proxyID = _freeProxyIDs.Back();
+				_freeProxyIDs.PopBack();
+			}
+
+			Proxy& proxy = _proxies[proxyID];
+			proxy._sortedIndex = _sortedProxyIDs.Size();
+			proxy._userData = userData;
+			proxy._isStatic = isStatic;
+
+			_sortedMins.PushBack(min[_sortAxis]);
+			_sortedMaxs.PushBack(max[_sortAxis]);
+			_sortedCrossMins.PushBack(min[_sortAxis ^ 1]);
+			_sortedCrossMaxs.PushBack(max[_sortAxis ^ 1]);
+			_sortedProxyIDs.PushBack(proxyID);
+			++_unsortedCount;
+			return proxyID;
+		}
+
+		void SweepAndPrune::DestroyProxy(const uint32 proxyID)
+		{
+			Proxy& proxy = _proxies[proxyID];
+			MINT_ASSERT(proxy._sortedIndex != kInvalidIndexUint32, "이미 지운 proxy 입니다!");
+
+			// 지우면서 뒤쪽을 당기면 여러 개를 지울 때 O(n^2) 이 되므로 Update 에서 한 번에 당긴다.
+			_sortedProxyIDs[proxy._sortedIndex] = kInvalidIndexUint32;
+			++_removedCount;
+
+			proxy = Proxy();
+			_freeProxyIDs.PushBack(proxyID);
+		}
+
+		void SweepAndPrune::MoveProxy(const uint32 proxyID, const Float2& min, const Float2& max) noexcept
+		{
+			const uint32 sortedIndex = _proxies[proxyID]._sortedIndex;
+			MINT_ASSERT(sortedIndex != kInvalidIndexUint32, "지운 proxy 입니다!");
+
+			_sortedMins[sortedIndex] = min[_sortAxis];
+			_sortedMaxs[sortedIndex] = max[_sortAxis];
+			_sortedCrossMins[sortedIndex] = min[_sortAxis ^ 1];
+			_sortedCrossMaxs[sortedIndex] = max[_sortAxis ^ 1];
+		}
+
+		void SweepAndPrune::SetProxyStatic(const uint32 proxyID, const bool isStatic) noexcept
+		{
+			Proxy& proxy = _proxies[proxyID];
+			MINT_ASSERT(proxy._sortedIndex != kInvalidIndexUint32, "지운 proxy 입니다!");
+
+			proxy._isStatic = isStatic;
+		}
+
+		void SweepAndPrune::Clear()
+		{
+			_proxies.Clear();
+			_freeProxyIDs.Clear();
+			_sortedMins.Clear();
+			_sortedMaxs.Clear();
+			_sortedCrossMins.Clear();
+			_sortedCrossMaxs.Clear();
+			_sortedProxyIDs.Clear();
+			_sortAxis = 0;
+			_unsortedCount = 0;
+			_removedCount = 0;
+		}
+
+		void SweepAndPrune::Update()
+		{
+			// 중심의 분산으로 정렬 축을 고른다. 좌표가 커도 정밀도를 잃지 않도록 첫 중심을 기준으로 double 로 더한다.
+			// 훑는 김에 DestroyProxy 로 비워 둔 자리를 당겨 채운다. 순서는 그대로이다.
+			const uint32 sortedCount = _sortedProxyIDs.Size();
+			uint32 count = 0;
+			double originAxis = 0.0;
+			double originCross = 0.0;
+			double sumAxis = 0.0;
+			double sumSqAxis = 0.0;
+			double sumCross = 0.0;
+			double sumSqCross = 0.0;
+			for (uint32 index = 0; index < sortedCount; ++index)
+			{
+				const uint32 proxyID = _sortedProxyIDs[index];
+				if (proxyID == kInvalidIndexUint32)
+				{
+					continue;
+				}
+
+				if (count != index)
+				{
+					_sortedMins[count] = _sortedMins[index];
+					_sortedMaxs[count] = _sortedMaxs[index];
+					_sortedCrossMins[count] = _sortedCrossMins[index];
+					_sortedCrossMaxs[count] = _sortedCrossMaxs[index];
+					_sortedProxyIDs[count] = proxyID;
+					_proxies[proxyID]._sortedIndex = count;
+				}
+
+				if (count == 0)
+				{
+					originAxis = 0.5 * (static_cast<double>(_sortedMins[0]) + _sortedMaxs[0]);
+					originCross = 0.5 * (static_cast<double>(_sortedCrossMins[0]) + _sortedCrossMaxs[0]);
+				}
+				const double centerAxis = 0.5 * (static_cast<double>(_sortedMins[count]) + _sortedMaxs[count]) - originAxis;
+				const double centerCross = 0.5 * (static_cast<double>(_sortedCrossMins[count]) + _sortedCrossMaxs[count]) - originCross;
+				sumAxis += centerAxis;
+				sumSqAxis += centerAxis * centerAxis;
+				sumCross += centerCross;
+				sumSqCross += centerCross * centerCross;
+				++count;
+			}
+			if (count != sortedCount)
+			{
+				_sortedMins.Resize(count);
+				_sortedMaxs.Resize(count);
+				_sortedCrossMins.Resize(count);
+				_sortedCrossMaxs.Resize(count);
+				_sortedProxyIDs.Resize(count);
+			}
+			_removedCount = 0;
+
+			if (count == 0)
+			{
+				_unsortedCount = 0;
+				return;
+			}
+			const double varianceAxis = sumSqAxis / count - (sumAxis / count) * (sumAxis / count);
+			const double varianceCross = sumSqCross / count - (sumCross / count) * (sumCross / count);
+
+			// 비슷할 때 축이 계속 바뀌지 않도록 여유를 둔다.
+			if (varianceCross > varianceAxis * 1.5)
+			{
+				SwapAxes();
+				SortFully();
+			}
+			else if (_unsortedCount > count / 8)
+			{
+				SortFully();
+			}
+			else
+			{
+				SortIncrementally();
+			}
+			_unsortedCount = 0;
+		}
+
+		bool SweepAndPrune::Validate() const noexcept
+		{
+			const uint32 count = _sortedProxyIDs.Size();
+			if (_sortedMins.Size() != count || _sortedMaxs.Size() != count || _sortedCrossMins.Size() != count || _sortedCrossMaxs.Size() != count)
+			{
+				return false;
+			}
+
+			uint32 removedCount = 0;
+			for (uint32 index = 0; index < count; ++index)
+			{
+				if (_sortedProxyIDs[index] == kInvalidIndexUint32)
+				{
+					++removedCount;
+					continue;
+				}
+
+				if (_proxies[_sortedProxyIDs[index]]._sortedIndex != index)
+				{
+					return false;
+				}
+
+				if (index > 0 && _unsortedCount == 0 && _sortedMins[index - 1] > _sortedMins[index])
+				{
+					return false;
+				}
+			}
+
+			uint32 proxyCount = 0;
+			for (const Proxy& proxy : _proxies)
+			{
+				proxyCount += (proxy._sortedIndex != kInvalidIndexUint32) ? 1 : 0;
+			}
+			return removedCount == _removedCount && proxyCount + removedCount == count && proxyCount + _freeProxyIDs.Size() == _proxies.Size();
+		}
+
+		void SweepAndPrune::SortFully()
+		{
+			const uint32 count = _sortedProxyIDs.Size();
+			Vector<uint32> order;
+			order.Resize(count);
+			for (uint32 index = 0; index < count; ++index)
+			{
+				order[index] = index;
+			}
+			// 같은 min 이면 원래 순서를 따르게 해서 결과가 항상 같게 한다.
+			const float* const mins = _sortedMins.Data();
+			QuickSort(order, [mins](const uint32 lhs, const uint32 rhs)
+				{
+					return (mins[lhs] < mins[rhs]) || (mins[lhs] == mins[rhs] && lhs < rhs);
+				});
+
+			Vector<float> sortedMins;
+			Vector<float> sortedMaxs;
+			Vector<float> sortedCrossMins;
+			Vector<float> sortedCrossMaxs;
+			Vector<uint32> sortedProxyIDs;
+			sortedMins.Resize(count);
+			sortedMaxs.Resize(count);
+			sortedCrossMins.Resize(count);
+			sortedCrossMaxs.Resize(count);
+			sortedProxyIDs.Resize(count);
+			for (uint32 index = 0; index < count; ++index)
+			{
+				const uint32 from = order[index];
+				sortedMins[index] = _sortedMins[from];
+				sortedMaxs[index] = _sortedMaxs[from];
+				sortedCrossMins[index] = _sortedCrossMins[from];
+				sortedCrossMaxs[index] = _sortedCrossMaxs[from];
+				sortedProxyIDs[index] = _sortedProxyIDs[from];
+				_proxies[sortedProxyIDs[index]]._sortedIndex = index;
+			}
+			_sortedMins = std::move(sortedMins);
+			_sortedMaxs = std::move(sortedMaxs);
+			_sortedCrossMins = std::move(sortedCrossMins);
+			_sortedCrossMaxs = std::move(sortedCrossMaxs);
+			_sortedProxyIDs = std::move(sortedProxyIDs);
+		}
+
+		void SweepAndPrune::SortIncrementally() noexcept
+		{
+			// 지난 Update 뒤로 조금씩만 움직였다면 거의 정렬되어 있으므로 자리를 옮기는 원소가 적다.
+			const uint32 count = _sortedProxyIDs.Size();
+			for (uint32 index = 1; index < count; ++index)
+			{
+				const float min = _sortedMins[index];
+				if (_sortedMins[index - 1] <= min)
+				{
+					continue;
+				}
+
+				const float max = _sortedMaxs[index];
+				const float crossMin = _sortedCrossMins[index];
+				const float crossMax = _sortedCrossMaxs[index];
+				const uint32 proxyID = _sortedProxyIDs[index];
+				uint32 to = index;
+				do
+				{
+					_sortedMins[to] = _sortedMins[to - 1];
+					_sortedMaxs[to] = _sortedMaxs[to - 1];
+					_sortedCrossMins[to] = _sortedCrossMins[to - 1];
+					_sortedCrossMaxs[to] = _sortedCrossMaxs[to - 1];
+					_sortedProxyIDs[to] = _sortedProxyIDs[to - 1];
+					_proxies[_sortedProxyIDs[to]]._sortedIndex = to;
+					--to;
+				} while (to > 0 && _sortedMins[to - 1] > min);
+
+				_sortedMins[to] = min;
+				_sortedMaxs[to] = max;
+				_sortedCrossMins[to] = crossMin;
+				_sortedCrossMaxs[to] = crossMax;
+				_sortedProxyIDs[to] = proxyID;
+				_proxies[proxyID]._sortedIndex = to;
+			}
+		}
+
+		void SweepAndPrune::SwapAxes() noexcept
+		{
+			std::swap(_sortedMins, _sortedCrossMins);
+			std::swap(_sortedMaxs, _sortedCrossMaxs);
+			_sortAxis ^= 1;
+		}
+	}
+}
@@ -2,6 +2,13 @@
 #include <MintPhysics/Include/AllHeaders.h>
 #include <MintPhysics/Include/AllHpps.h>
 
+#include <MintContainer/Include/Algorithm.hpp>
+
+#include <MintCommon/Include/ScopedCPUProfiler.h>
+
+
+//#define MINT_TEST_PERFORMANCE
+
 
 namespace mint
 {
@@ -10,6 +17,9 @@ namespace mint
 		bool Test()
 		{
 			MINT_ASSURE(TestIntersections());
+			MINT_ASSURE(TestBroadPhase());
+			MINT_ASSURE(TestConstraintSolver());
+			MINT_ASSURE(TestWorld());
 			return true;
 		}
 
@@ -39,6 +49,1213 @@ namespace mint
 				MINT_ASSURE(Physics2D::Intersect_GJK(a, b) == true);
 			}
 
+			// TransformedCollisionShape 는 MakeTransformed 로 복사해서 옮긴 shape 와 같은 support 와 충돌 결과를 내야 한다.
+			{
+				using namespace Physics2D;
+
+				Vector<Float2> convexPoints;
+				convexPoints.PushBack(Float2(-3, -2));
+				convexPoints.PushBack(Float2(4, -1));
+				convexPoints.PushBack(Float2(2, 3));
+				convexPoints.PushBack(Float2(-1, 4));
+				Vector<SharedPtr<CollisionShape>> shapes;
+				shapes.PushBack(MakeShared<PointCollisionShape>(PointCollisionShape(Float2(1, 2))));
+				shapes.PushBack(MakeShared<EdgeCollisionShape>(EdgeCollisionShape(Float2(-3, 1), Float2(4, 2))));
+				shapes.PushBack(MakeShared<CircleCollisionShape>(CircleCollisionShape(Float2(1, -1), 3.0f)));
+				shapes.PushBack(MakeShared<AABBCollisionShape>(AABBCollisionShape(Float2(2, 1), Float2(3, 2))));
+				shapes.PushBack(MakeShared<BoxCollisionShape>(BoxCollisionShape(Float2(3, 2), Transform2D(0.3f, Float2(1, 2)))));
+				shapes.PushBack(MakeShared<ConvexCollisionShape>(ConvexCollisionShape::MakeFromPoints(convexPoints)));
+				const Transform2D transforms[] = { Transform2D::GetIdentity(), Transform2D(Float2(5, -3)), Transform2D(0.7f, Float2(2, -1)), Transform2D(-2.1f, Float2(-3, 4)) };
+				auto isNear = [](const Float2& a, const Float2& b) { return (a - b).Length() < 0.001f; };
+				for (const SharedPtr<CollisionShape>& shape : shapes)
+				{
+					for (const Transform2D& transform2D : transforms)
+					{
+						const SharedPtr<CollisionShape> copiedShape = CollisionShape::MakeTransformed(shape, transform2D);
+						const TransformedCollisionShape transformedShape{ *shape, transform2D };
+						for (uint32 i = 0; i < 16; ++i)
+						{
+							const float angle = Math::kTwoPi * static_cast<float>(i) / 16.0f + 0.1f;
+							const Float2 direction{ ::cosf(angle), ::sinf(angle) };
+							MINT_ASSURE(isNear(transformedShape.ComputeSupportPoint(direction), copiedShape->ComputeSupportPoint(direction)) == true);
+
+							Float2 edgeVertexA;
+							Float2 edgeVertexB;
+							Float2 copiedEdgeVertexA;
+							Float2 copiedEdgeVertexB;
+							transformedShape.ComputeSupportEdge(direction, edgeVertexA, edgeVertexB);
+							copiedShape->ComputeSupportEdge(direction, copiedEdgeVertexA, copiedEdgeVertexB);
+							MINT_ASSURE(isNear(edgeVertexA, copiedEdgeVertexA) == true && isNear(edgeVertexB, copiedEdgeVertexB) == true);
+						}
+					}
+				}
+
+				GJKInfo gjkInfo;
+				GJKInfo copiedGJKInfo;
+				EPAInfo epaInfo;
+				EPAInfo copiedEPAInfo;
+				for (uint32 shapeIndexA = 0; shapeIndexA < shapes.Size(); ++shapeIndexA)
+				{
+					for (uint32 shapeIndexB = 0; shapeIndexB < shapes.Size(); ++shapeIndexB)
+					{
+						const Transform2D& transformA = transforms[2];
+						const Transform2D& transformB = transforms[(shapeIndexA + shapeIndexB) % 4];
+						const SharedPtr<CollisionShape> copiedShapeA = CollisionShape::MakeTransformed(shapes[shapeIndexA], transformA);
+						const SharedPtr<CollisionShape> copiedShapeB = CollisionShape::MakeTransformed(shapes[shapeIndexB], transformB);
+						const TransformedCollisionShape shapeA{ *shapes[shapeIndexA], transformA };
+						const TransformedCollisionShape shapeB{ *shapes[shapeIndexB], transformB };
+						const bool intersects = Intersect_GJK(shapeA, shapeB, &gjkInfo);
+						MINT_ASSURE(intersects == Intersect_GJK(*copiedShapeA, *copiedShapeB, &copiedGJKInfo));
+						if (intersects == true)
+						{
+							Float2 normal;
+							Float2 copiedNormal;
+							float distance = 0.0f;
+							float copiedDistance = 0.0f;
+							ComputePenetration_EPA(shapeA, shapeB, gjkInfo, normal, distance, epaInfo);
+							ComputePenetration_EPA(*copiedShapeA, *copiedShapeB, copiedGJKInfo, copiedNormal, copiedDistance, copiedEPAInfo);
+							MINT_ASSURE(isNear(normal, copiedNormal) == true && ::abs(distance - copiedDistance) < 0.001f);
+						}
+					}
+				}
+			}
+
+			// GJK 로 구한 거리와 witness normal
+			{
+				using namespace Physics2D;
+
+				Float2 normal;
+				float distance = 0.0f;
+				const CircleCollisionShape circleA{ Float2(0, 0), 1.0f };
+				const CircleCollisionShape circleB{ Float2(5, 0), 2.0f };
+				MINT_ASSURE(ComputeDistance_GJK(circleA, circleB, normal, distance) == true);
+				MINT_ASSURE(::abs(distance - 2.0f) < 0.01f && distance <= 2.0f && (normal - Float2(1, 0)).Length() < 0.01f);
+				MINT_ASSURE(ComputeDistance_GJK(circleB, circleA, normal, distance) == true);
+				MINT_ASSURE((normal - Float2(-1, 0)).Length() < 0.01f);
+
+				const BoxCollisionShape boxA{ Float2(1, 1), Transform2D(0.0f, Float2(0, 0)) };
+				const BoxCollisionShape boxB{ Float2(1, 1), Transform2D(0.0f, Float2(1, 5)) };
+				MINT_ASSURE(ComputeDistance_GJK(boxA, boxB, normal, distance) == true);
+				MINT_ASSURE(::abs(distance - 3.0f) < 0.001f && (normal - Float2(0, 1)).Length() < 0.001f);
+
+				const BoxCollisionShape rotatedBox{ Float2(1, 1), Transform2D(Math::kPi * 0.25f, Float2(0, 0)) };
+				const PointCollisionShape point{ Float2(3, 0) };
+				MINT_ASSURE(ComputeDistance_GJK(rotatedBox, point, normal, distance) == true);
+				MINT_ASSURE(::abs(distance - (3.0f - ::sqrtf(2.0f))) < 0.001f);
+
+				const CircleCollisionShape overlappingCircle{ Float2(1, 1), 1.0f };
+				MINT_ASSURE(ComputeDistance_GJK(boxA, overlappingCircle, normal, distance) == false);
+			}
+
+			// reference face 로 incident face 를 잘라서 구한 접촉점
+			{
+				using namespace Physics2D;
+
+				auto isNear = [](const float a, const float b) { return ::abs(a - b) < 0.001f; };
+				const BoxCollisionShape lowerBox{ Float2(1, 1), Transform2D::GetIdentity() };
+				const BoxCollisionShape upperBox{ Float2(1, 1), Transform2D(Float2(0.5f, 1.9f)) };
+				const TransformedCollisionShape lowerShape{ lowerBox, Transform2D::GetIdentity() };
+				const TransformedCollisionShape upperShape{ upperBox, Transform2D::GetIdentity() };
+				ContactPoint contactPoints[2];
+				Float2 normal;
+				MINT_ASSURE(ComputeContactPoints_Clip(lowerShape, upperShape, Float2(0, 1), 0.5f, normal, contactPoints) == 2);
+				MINT_ASSURE(isNear(normal._x, 0.0f) == true && isNear(normal._y, 1.0f) == true);
+				// 위 상자의 아랫면은 아래 상자의 윗면 너비 (x = 1) 에서 잘린다.
+				MINT_ASSURE(isNear(Min(contactPoints[0]._position._x, contactPoints[1]._position._x), -0.5f) == true);
+				MINT_ASSURE(isNear(Max(contactPoints[0]._position._x, contactPoints[1]._position._x), 1.0f) == true);
+				for (const ContactPoint& contactPoint : contactPoints)
+				{
+					MINT_ASSURE(isNear(contactPoint._separation, -0.1f) == true && isNear(contactPoint._position._y, 0.95f) == true);
+				}
+				MINT_ASSURE(contactPoints[0]._featureID != contactPoints[1]._featureID);
+
+				// 조금 움직여도 같은 면과 꼭짓점에서 생긴 점의 feature ID 는 그대로이다.
+				ContactPoint movedContactPoints[2];
+				const TransformedCollisionShape movedUpperShape{ upperBox, Transform2D(Float2(0.05f, 0.02f)) };
+				MINT_ASSURE(ComputeContactPoints_Clip(lowerShape, movedUpperShape, Float2(0, 1), 0.5f, normal, movedContactPoints) == 2);
+				MINT_ASSURE(movedContactPoints[0]._featureID == contactPoints[0]._featureID && movedContactPoints[1]._featureID == contactPoints[1]._featureID);
+
+				// 순서를 바꾸면 normal 도 A 에서 B 를 향한다.
+				MINT_ASSURE(ComputeContactPoints_Clip(upperShape, lowerShape, Float2(0, -1), 0.5f, normal, contactPoints) == 2);
+				MINT_ASSURE(isNear(normal._x, 0.0f) == true && isNear(normal._y, -1.0f) == true);
+				MINT_ASSURE(isNear(contactPoints[0]._separation, -0.1f) == true && isNear(contactPoints[1]._separation, -0.1f) == true);
+
+				// maxSeparation 보다 멀리 떨어진 점은 버린다.
+				const TransformedCollisionShape separatedUpperShape{ upperBox, Transform2D(Float2(0.0f, 0.4f)) };
+				MINT_ASSURE(ComputeContactPoints_Clip(lowerShape, separatedUpperShape, Float2(0, 1), 0.5f, normal, contactPoints) == 2);
+				MINT_ASSURE(isNear(contactPoints[0]._separation, 0.3f) == true);
+				MINT_ASSURE(ComputeContactPoints_Clip(lowerShape, separatedUpperShape, Float2(0, 1), 0.1f, normal, contactPoints) == 0);
+
+				// 기울어진 상자는 모서리 하나만 닿는다.
+				const BoxCollisionShape tiltedBox{ Float2(1, 1), Transform2D(Math::kPiOverFour * 0.5f, Float2(0.0f, 2.2f)) };
+				const TransformedCollisionShape tiltedShape{ tiltedBox, Transform2D::GetIdentity() };
+				MINT_ASSURE(ComputeContactPoints_Clip(lowerShape, tiltedShape, Float2(0, 1), 0.1f, normal, contactPoints) == 1);
+				MINT_ASSURE(contactPoints[0]._separation < 0.0f);
+
+				// 원은 점 하나로 닿는다.
+				const CircleCollisionShape circle{ Float2(0.0f, 1.4f), 0.5f };
+				const TransformedCollisionShape circleShape{ circle, Transform2D::GetIdentity() };
+				MINT_ASSURE(ComputeContactPoints_Clip(lowerShape, circleShape, Float2(0, 1), 0.5f, normal, contactPoints) == 1);
+				MINT_ASSURE(isNear(contactPoints[0]._separation, -0.1f) == true && isNear(contactPoints[0]._position._y, 0.95f) == true);
+			}
+
+			return true;
+		}
+
+		bool TestBroadPhase()
+		{
+			using namespace Physics2D;
+
+			uint32 seed = 4321;
+			auto random = [&seed](const float range)
+			{
+				seed = seed * 1664525 + 1013904223;
+				return static_cast<float>(seed >> 8) / static_cast<float>(1 << 24) * range;
+			};
+			auto makeKey = [](const uint32 a, const uint32 b)
+			{
+				return (a < b) ? ((static_cast<uint64>(a) << 32) | b) : ((static_cast<uint64>(b) << 32) | a);
+			};
+			auto areEqual = [](const Vector<uint64>& a, const Vector<uint64>& b)
+			{
+				if (a.Size() != b.Size())
+				{
+					return false;
+				}
+				for (uint32 i = 0; i < a.Size(); ++i)
+				{
+					if (a[i] != b[i])
+					{
+						return false;
+					}
+				}
+				return true;
+			};
+			auto overlaps = [](const DynamicAABBTree::Node& a, const DynamicAABBTree::Node& b)
+			{
+				return (a._max._x < b._min._x || b._max._x < a._min._x || a._max._y < b._min._y || b._max._y < a._min._y) == false;
+			};
+
+			// 트리가 찾은 쌍과 모든 쌍을 비교해서 찾은 쌍이 같아야 한다.
+			const uint32 kProxyCount = 300;
+			DynamicAABBTree tree{ 0.5f };
+			Vector<uint32> proxyIDs;
+			for (uint32 i = 0; i < kProxyCount; ++i)
+			{
+				const Float2 min{ random(200.0f), random(200.0f) };
+				proxyIDs.PushBack(tree.CreateProxy(min, min + Float2(random(8.0f), random(8.0f)), i));
+			}
+			MINT_ASSURE(tree.Validate() == true);
+			MINT_ASSURE(tree.GetProxyCount() == kProxyCount);
+
+			auto collectPairs = [&](const DynamicAABBTree& tree, Vector<uint64>& outTreePairs, Vector<uint64>& outBruteForcePairs)
+			{
+				outTreePairs.Clear();
+				tree.QueryPairs([&](const uint32 a, const uint32 b) { outTreePairs.PushBack(makeKey(a, b)); });
+				QuickSort(outTreePairs, ComparatorAscending<uint64>());
+
+				outBruteForcePairs.Clear();
+				for (uint32 i = 0; i < proxyIDs.Size(); ++i)
+				{
+					for (uint32 j = i + 1; j < proxyIDs.Size(); ++j)
+					{
+						if (overlaps(tree.GetNode(proxyIDs[i]), tree.GetNode(proxyIDs[j])))
+						{
+							outBruteForcePairs.PushBack(makeKey(tree.GetUserData(proxyIDs[i]), tree.GetUserData(proxyIDs[j])));
+						}
+					}
+				}
+				QuickSort(outBruteForcePairs, ComparatorAscending<uint64>());
+			};
+			Vector<uint64> treePairs;
+			Vector<uint64> bruteForcePairs;
+			collectPairs(tree, treePairs, bruteForcePairs);
+			MINT_ASSURE(treePairs.IsEmpty() == false);
+			MINT_ASSURE(areEqual(treePairs, bruteForcePairs) == true);
+
+			// fat AABB 안에서 움직이면 다시 넣지 않는다.
+			{
+				const DynamicAABBTree::Node& node = tree.GetNode(proxyIDs[0]);
+				const Float2 min = node._min + Float2(0.25f);
+				const Float2 max = node._max - Float2(0.25f);
+				MINT_ASSURE(tree.MoveProxy(proxyIDs[0], min, max) == false);
+				MINT_ASSURE(tree.MoveProxy(proxyIDs[0], min + Float2(10.0f, 0.0f), max + Float2(10.0f, 0.0f)) == true);
+			}
+			for (uint32 i = 0; i < kProxyCount; i += 2)
+			{
+				const Float2 min{ random(200.0f), random(200.0f) };
+				tree.MoveProxy(proxyIDs[i], min, min + Float2(random(8.0f), random(8.0f)));
+			}
+			for (uint32 i = 0; i < 50; ++i)
+			{
+				tree.DestroyProxy(proxyIDs.Back());
+				proxyIDs.PopBack();
+			}
+			MINT_ASSURE(tree.Validate() == true);
+			MINT_ASSURE(tree.GetProxyCount() == kProxyCount - 50);
+			collectPairs(tree, treePairs, bruteForcePairs);
+			MINT_ASSURE(areEqual(treePairs, bruteForcePairs) == true);
+
+			// 다시 만들어도 같은 쌍을 찾는다.
+			const float costBeforeRebuild = tree.ComputeCost();
+			tree.RebuildSAH();
+			MINT_ASSURE(tree.Validate() == true);
+			MINT_ASSURE(tree.ComputeCost() > 0.0f && costBeforeRebuild > 0.0f);
+			collectPairs(tree, treePairs, bruteForcePairs);
+			MINT_ASSURE(areEqual(treePairs, bruteForcePairs) == true);
+			for (uint32 i = 0; i < proxyIDs.Size(); ++i)
+			{
+				MINT_ASSURE(tree.GetUserData(proxyIDs[i]) == i);
+			}
+
+			// 트리끼리의 질의
+			{
+				DynamicAABBTree otherTree;
+				Vector<uint32> otherProxyIDs;
+				for (uint32 i = 0; i < 100; ++i)
+				{
+					const Float2 min{ random(200.0f), random(200.0f) };
+					otherProxyIDs.PushBack(otherTree.CreateProxy(min, min + Float2(random(16.0f), random(16.0f)), i));
+				}
+
+				treePairs.Clear();
+				DynamicAABBTree::QueryPairs(tree, otherTree, [&](const uint32 a, const uint32 b) { treePairs.PushBack((static_cast<uint64>(a) << 32) | b); });
+				QuickSort(treePairs, ComparatorAscending<uint64>());
+				bruteForcePairs.Clear();
+				for (uint32 i = 0; i < proxyIDs.Size(); ++i)
+				{
+					for (uint32 j = 0; j < otherProxyIDs.Size(); ++j)
+					{
+						if (overlaps(tree.GetNode(proxyIDs[i]), otherTree.GetNode(otherProxyIDs[j])))
+						{
+							bruteForcePairs.PushBack((static_cast<uint64>(i) << 32) | j);
+						}
+					}
+				}
+				QuickSort(bruteForcePairs, ComparatorAscending<uint64>());
+				MINT_ASSURE(areEqual(treePairs, bruteForcePairs) == true);
+
+				uint32 queryCount = 0;
+				tree.Query(Float2(50.0f), Float2(100.0f), [&queryCount](const uint32) { ++queryCount; });
+				uint32 expectedQueryCount = 0;
+				for (uint32 i = 0; i < proxyIDs.Size(); ++i)
+				{
+					const DynamicAABBTree::Node& node = tree.GetNode(proxyIDs[i]);
+					expectedQueryCount += (node._max._x < 50.0f || 100.0f < node._min._x || node._max._y < 50.0f || 100.0f < node._min._y) ? 0 : 1;
+				}
+				MINT_ASSURE(queryCount == expectedQueryCount);
+			}
+
+			// SweepAndPrune 도 모든 쌍을 비교한 결과와 같아야 한다. (static 끼리의 쌍은 빼고)
+			{
+				SweepAndPrune sweepAndPrune;
+				Vector<Float2> mins;
+				Vector<Float2> maxs;
+				Vector<uint32> sapProxyIDs;
+				const uint32 kSAPProxyCount = 400;
+				for (uint32 i = 0; i < kSAPProxyCount; ++i)
+				{
+					// 가로로 긴 월드
+					const Float2 min{ random(400.0f), random(50.0f) };
+					mins.PushBack(min);
+					maxs.PushBack(min + Float2(random(6.0f), random(6.0f)));
+					sapProxyIDs.PushBack(sweepAndPrune.CreateProxy(mins[i], maxs[i], i, i % 5 == 0));
+				}
+
+				auto collectSAPPairs = [&]()
+				{
+					sweepAndPrune.Update();
+					treePairs.Clear();
+					sweepAndPrune.QueryPairs([&](const uint32 a, const uint32 b) { treePairs.PushBack(makeKey(a, b)); });
+					QuickSort(treePairs, ComparatorAscending<uint64>());
+
+					bruteForcePairs.Clear();
+					for (uint32 i = 0; i < kSAPProxyCount; ++i)
+					{
+						for (uint32 j = i + 1; j < kSAPProxyCount; ++j)
+						{
+							if (sapProxyIDs[i] == kInvalidIndexUint32 || sapProxyIDs[j] == kInvalidIndexUint32 || (i % 5 == 0 && j % 5 == 0))
+							{
+								continue;
+							}
+
+							if ((maxs[i]._x < mins[j]._x || maxs[j]._x < mins[i]._x || maxs[i]._y < mins[j]._y || maxs[j]._y < mins[i]._y) == false)
+							{
+								bruteForcePairs.PushBack(makeKey(i, j));
+							}
+						}
+					}
+					QuickSort(bruteForcePairs, ComparatorAscending<uint64>());
+				};
+				collectSAPPairs();
+				MINT_ASSURE(sweepAndPrune.Validate() == true);
+				MINT_ASSURE(sweepAndPrune.GetSortAxis() == 0);
+				MINT_ASSURE(treePairs.IsEmpty() == false);
+				MINT_ASSURE(areEqual(treePairs, bruteForcePairs) == true);
+
+				// 조금씩 움직이면 insertion sort 로 다시 정렬된다.
+				for (uint32 step = 0; step < 4; ++step)
+				{
+					for (uint32 i = 0; i < kSAPProxyCount; ++i)
+					{
+						const Float2 displacement{ random(2.0f) - 1.0f, random(2.0f) - 1.0f };
+						mins[i] += displacement;
+						maxs[i] += displacement;
+						sweepAndPrune.MoveProxy(sapProxyIDs[i], mins[i], maxs[i]);
+					}
+					collectSAPPairs();
+					MINT_ASSURE(sweepAndPrune.Validate() == true);
+					MINT_ASSURE(areEqual(treePairs, bruteForcePairs) == true);
+				}
+
+				// 지운 자리는 다음 Update 에서 채워진다.
+				uint32 sapDestroyedCount = 0;
+				for (uint32 i = 0; i < kSAPProxyCount; i += 3)
+				{
+					sweepAndPrune.DestroyProxy(sapProxyIDs[i]);
+					sapProxyIDs[i] = kInvalidIndexUint32;
+					++sapDestroyedCount;
+				}
+				MINT_ASSURE(sweepAndPrune.Validate() == true);
+				MINT_ASSURE(sweepAndPrune.GetProxyCount() == kSAPProxyCount - sapDestroyedCount);
+				collectSAPPairs();
+				MINT_ASSURE(sweepAndPrune.Validate() == true);
+				MINT_ASSURE(areEqual(treePairs, bruteForcePairs) == true);
+
+				// 세로로 길게 옮기면 정렬 축이 y 로 바뀐다.
+				for (uint32 i = 0; i < kSAPProxyCount; ++i)
+				{
+					if (sapProxyIDs[i] == kInvalidIndexUint32)
+					{
+						continue;
+					}
+
+					const Float2 min{ random(50.0f), random(400.0f) };
+					maxs[i] = min + (maxs[i] - mins[i]);
+					mins[i] = min;
+					sweepAndPrune.MoveProxy(sapProxyIDs[i], mins[i], maxs[i]);
+				}
+				collectSAPPairs();
+				MINT_ASSURE(sweepAndPrune.Validate() == true);
+				MINT_ASSURE(sweepAndPrune.GetSortAxis() == 1);
+				MINT_ASSURE(areEqual(treePairs, bruteForcePairs) == true);
+			}
+
+			// SpatialHashGrid 도 모든 쌍을 비교한 결과와 같아야 한다. (static 끼리의 쌍은 빼고)
+			{
+				SpatialHashGrid spatialHashGrid{ 1.0f };
+				Vector<Float2> mins;
+				Vector<Float2> maxs;
+				Vector<uint32> gridProxyIDs;
+				Vector<bool> gridIsStatics;
+				const uint32 kGridProxyCount = 500;
+				for (uint32 i = 0; i < kGridProxyCount; ++i)
+				{
+					// 크기가 여러 level 에 걸치도록 작은 것부터 아주 큰 것까지 섞고, 일부는 원점에서 아주 먼 곳에 둔다.
+					const float size = (i % 50 == 0) ? 40.0f + random(80.0f) : (i % 7 == 0) ? 4.0f + random(12.0f) : 0.25f + random(2.0f);
+					const Float2 origin = (i % 10 == 1) ? Float2(1.0e6f, -1.0e6f) : Float2::kZero;
+					const Float2 min = origin + Float2(random(200.0f) - 100.0f, random(200.0f) - 100.0f);
+					mins.PushBack(min);
+					maxs.PushBack(min + Float2(size, random(size)));
+					gridIsStatics.PushBack(i % 5 == 0);
+					gridProxyIDs.PushBack(spatialHashGrid.CreateProxy(mins[i], maxs[i], i, gridIsStatics[i]));
+				}
+
+				auto collectGridPairs = [&]()
+				{
+					treePairs.Clear();
+					spatialHashGrid.QueryPairs([&](const uint32 a, const uint32 b) { treePairs.PushBack(makeKey(a, b)); });
+					QuickSort(treePairs, ComparatorAscending<uint64>());
+
+					bruteForcePairs.Clear();
+					for (uint32 i = 0; i < kGridProxyCount; ++i)
+					{
+						for (uint32 j = i + 1; j < kGridProxyCount; ++j)
+						{
+							if (gridProxyIDs[i] == kInvalidIndexUint32 || gridProxyIDs[j] == kInvalidIndexUint32 || (gridIsStatics[i] == true && gridIsStatics[j] == true))
+							{
+								continue;
+							}
+
+							if ((maxs[i]._x < mins[j]._x || maxs[j]._x < mins[i]._x || maxs[i]._y < mins[j]._y || maxs[j]._y < mins[i]._y) == false)
+							{
+								bruteForcePairs.PushBack(makeKey(i, j));
+							}
+						}
+					}
+					QuickSort(bruteForcePairs, ComparatorAscending<uint64>());
+				};
+				collectGridPairs();
+				MINT_ASSURE(spatialHashGrid.Validate() == true);
+				MINT_ASSURE(spatialHashGrid.GetLevelCount() >= 7);
+				MINT_ASSURE(treePairs.IsEmpty() == false);
+				// 같은 쌍을 두 번 찾으면 여기서 걸린다.
+				MINT_ASSURE(areEqual(treePairs, bruteForcePairs) == true);
+
+				// 움직이면서 칸이 바뀌고, 크기가 바뀌면 level 도 바뀐다.
+				for (uint32 step = 0; step < 4; ++step)
+				{
+					for (uint32 i = 0; i < kGridProxyCount; ++i)
+					{
+						const Float2 displacement{ random(4.0f) - 2.0f, random(4.0f) - 2.0f };
+						mins[i] += displacement;
+						maxs[i] += displacement;
+						if (i % 11 == step)
+						{
+							maxs[i] = mins[i] + (maxs[i] - mins[i]) * (step % 2 == 0 ? 4.0f : 0.25f);
+						}
+						spatialHashGrid.MoveProxy(gridProxyIDs[i], mins[i], maxs[i]);
+					}
+					collectGridPairs();
+					MINT_ASSURE(spatialHashGrid.Validate() == true);
+					MINT_ASSURE(areEqual(treePairs, bruteForcePairs) == true);
+				}
+
+				const uint32 cellCount = spatialHashGrid.GetCellCount();
+				for (uint32 i = 0; i < kGridProxyCount; i += 3)
+				{
+					spatialHashGrid.DestroyProxy(gridProxyIDs[i]);
+					gridProxyIDs[i] = kInvalidIndexUint32;
+				}
+				collectGridPairs();
+				MINT_ASSURE(spatialHashGrid.Validate() == true);
+				MINT_ASSURE(spatialHashGrid.GetCellCount() < cellCount);
+				MINT_ASSURE(areEqual(treePairs, bruteForcePairs) == true);
+
+				// 지운 proxy 의 ID 를 다시 쓴다.
+				for (uint32 i = 0; i < kGridProxyCount; i += 3)
+				{
+					gridProxyIDs[i] = spatialHashGrid.CreateProxy(mins[i], maxs[i], i, gridIsStatics[i]);
+				}
+				collectGridPairs();
+				MINT_ASSURE(spatialHashGrid.Validate() == true);
+				MINT_ASSURE(spatialHashGrid.GetProxyCount() == kGridProxyCount);
+				MINT_ASSURE(areEqual(treePairs, bruteForcePairs) == true);
+
+				// 칸을 옮기지 않고 static 인지만 바꾼다. (물체가 잠들거나 깨어날 때)
+				const uint32 cellCountBeforeSetStatic = spatialHashGrid.GetCellCount();
+				for (uint32 i = 0; i < kGridProxyCount; i += 4)
+				{
+					gridIsStatics[i] = (gridIsStatics[i] == false);
+					spatialHashGrid.SetProxyStatic(gridProxyIDs[i], gridIsStatics[i]);
+				}
+				collectGridPairs();
+				MINT_ASSURE(spatialHashGrid.Validate() == true);
+				MINT_ASSURE(spatialHashGrid.GetCellCount() == cellCountBeforeSetStatic);
+				MINT_ASSURE(areEqual(treePairs, bruteForcePairs) == true);
+
+				spatialHashGrid.Clear();
+				MINT_ASSURE(spatialHashGrid.GetProxyCount() == 0);
+				MINT_ASSURE(spatialHashGrid.GetCellCount() == 0);
+			}
+
+			// World 에서 broad phase 종류와 상관없이 같은 쌍을 찾아야 한다.
+			{
+				// worlds[0] 은 기본값인 BroadPhaseType::SpatialHashGrid
+				World worlds[3];
+				worlds[1].SetBroadPhaseType(BroadPhaseType::AABBTree);
+				worlds[2].SetBroadPhaseType(BroadPhaseType::SweepAndPrune);
+				for (uint32 i = 0; i < 200; ++i)
+				{
+					BodyCreationDesc bodyCreationDesc;
+					bodyCreationDesc._collisionShape = MakeShared<CircleCollisionShape>(CircleCollisionShape(Float2::kZero, 0.5f + random(2.0f)));
+					bodyCreationDesc._transform2D._translation = Float2(random(64.0f), random(64.0f));
+					bodyCreationDesc._bodyMotionType = (i % 4 == 0) ? BodyMotionType::Static : BodyMotionType::Dynamic;
+					bodyCreationDesc._inverseMass = (i % 4 == 0) ? 0.0f : 1.0f;
+					for (World& world : worlds)
+					{
+						world.CreateBody(bodyCreationDesc);
+					}
+				}
+
+				Vector<uint64> pairKeys[3];
+				for (uint32 worldIndex = 0; worldIndex < 3; ++worldIndex)
+				{
+					worlds[worldIndex].Step(1.0f / 60.0f);
+					for (const BroadPhaseBodyPair& bodyPair : worlds[worldIndex].GetBroadPhaseBodyPairs())
+					{
+						pairKeys[worldIndex].PushBack(bodyPair.GetKey());
+					}
+					QuickSort(pairKeys[worldIndex], ComparatorAscending<uint64>());
+				}
+				MINT_ASSURE(pairKeys[0].IsEmpty() == false);
+				MINT_ASSURE(areEqual(pairKeys[0], pairKeys[1]) == true);
+				MINT_ASSURE(areEqual(pairKeys[0], pairKeys[2]) == true);
+			}
+
+			// 여러 thread 로 Step 해도 한 thread 로 Step 한 것과 결과가 완전히 같아야 한다.
+			{
+				const BroadPhaseType broadPhaseTypes[] = { BroadPhaseType::SpatialHashGrid, BroadPhaseType::AABBTree, BroadPhaseType::SweepAndPrune };
+				for (const BroadPhaseType broadPhaseType : broadPhaseTypes)
+				{
+					World worlds[2];
+					worlds[1].SetThreadCount(4);
+					MINT_ASSURE(worlds[1].GetThreadCount() == 4);
+					for (World& world : worlds)
+					{
+						world.SetBroadPhaseType(broadPhaseType);
+					}
+
+					// 작업이 여러 개로 나뉘도록 물체를 충분히 많이 만든다.
+					Vector<BodyID> bodyIDs;
+					for (uint32 i = 0; i < 1000; ++i)
+					{
+						BodyCreationDesc bodyCreationDesc;
+						bodyCreationDesc._collisionShape = MakeShared<CircleCollisionShape>(CircleCollisionShape(Float2::kZero, 0.5f + random(1.0f)));
+						bodyCreationDesc._transform2D._translation = Float2(random(128.0f), random(64.0f));
+						bodyCreationDesc._bodyMotionType = (i % 4 == 0) ? BodyMotionType::Static : BodyMotionType::Dynamic;
+						bodyCreationDesc._inverseMass = (i % 4 == 0) ? 0.0f : 1.0f;
+						const BodyID bodyID = worlds[0].CreateBody(bodyCreationDesc);
+						MINT_ASSURE(worlds[1].CreateBody(bodyCreationDesc) == bodyID);
+						bodyIDs.PushBack(bodyID);
+					}
+
+					for (uint32 step = 0; step < 4; ++step)
+					{
+						Vector<uint64> pairKeys[2];
+						Vector<CollisionManifold> collisionManifolds[2];
+						for (uint32 worldIndex = 0; worldIndex < 2; ++worldIndex)
+						{
+							worlds[worldIndex].Step(1.0f / 60.0f);
+							// 순회 순서까지 같아야 하므로 정렬하지 않는다.
+							for (const BroadPhaseBodyPair& bodyPair : worlds[worldIndex].GetBroadPhaseBodyPairs())
+							{
+								pairKeys[worldIndex].PushBack(bodyPair.GetKey());
+							}
+							for (const CollisionManifold& collisionManifold : worlds[worldIndex].GetCollisionManifoldMap())
+							{
+								collisionManifolds[worldIndex].PushBack(collisionManifold);
+							}
+						}
+						MINT_ASSURE(pairKeys[0].IsEmpty() == false);
+						MINT_ASSURE(areEqual(pairKeys[0], pairKeys[1]) == true);
+						MINT_ASSURE(collisionManifolds[0].IsEmpty() == false);
+						MINT_ASSURE(collisionManifolds[0].Size() == collisionManifolds[1].Size());
+						for (uint32 i = 0; i < collisionManifolds[0].Size(); ++i)
+						{
+							const CollisionManifold& a = collisionManifolds[0][i];
+							const CollisionManifold& b = collisionManifolds[1][i];
+							MINT_ASSURE(a.GetKey() == b.GetKey());
+							MINT_ASSURE(a._collisionNormal == b._collisionNormal && a._pointCount == b._pointCount);
+							for (uint32 pointIndex = 0; pointIndex < a._pointCount; ++pointIndex)
+							{
+								const ContactPoint& contactPointA = a._points[pointIndex]._contactPoint;
+								const ContactPoint& contactPointB = b._points[pointIndex]._contactPoint;
+								MINT_ASSURE(contactPointA._position == contactPointB._position && contactPointA._separation == contactPointB._separation && contactPointA._featureID == contactPointB._featureID);
+							}
+						}
+
+						for (const BodyID bodyID : bodyIDs)
+						{
+							// float 로 바꾸면 Fixed64 의 아래 bit 차이를 놓치므로 Real 그대로 비교한다.
+							MINT_ASSURE(worlds[0].GetTranslation(bodyID) == worlds[1].GetTranslation(bodyID) && worlds[0].GetRotation(bodyID) == worlds[1].GetRotation(bodyID));
+							MINT_ASSURE(worlds[0].GetLinearVelocity(bodyID) == worlds[1].GetLinearVelocity(bodyID) && worlds[0].GetAngularVelocity(bodyID) == worlds[1].GetAngularVelocity(bodyID));
+						}
+					}
+				}
+			}
+
+#if defined MINT_TEST_PERFORMANCE
+			{
+				const uint32 kBodyCounts[] = { 1000, 10000, 100000 };
+				for (const uint32 bodyCount : kBodyCounts)
+				{
+					const BroadPhaseType broadPhaseTypes[] = { BroadPhaseType::SpatialHashGrid, BroadPhaseType::AABBTree, BroadPhaseType::SweepAndPrune };
+					const char* const broadPhaseTypeNames[] = { "SpatialHashGrid", "AABBTree", "SweepAndPrune" };
+					for (const BroadPhaseType broadPhaseType : broadPhaseTypes)
+					{
+						World world;
+						world.SetBroadPhaseType(broadPhaseType);
+						// 가로로 긴 (side-scroller) 월드
+						const float worldSide = ::sqrtf(static_cast<float>(bodyCount)) * 8.0f;
+						for (uint32 i = 0; i < bodyCount; ++i)
+						{
+							BodyCreationDesc bodyCreationDesc;
+							bodyCreationDesc._collisionShape = MakeShared<CircleCollisionShape>(CircleCollisionShape(Float2::kZero, 1.0f));
+							bodyCreationDesc._transform2D._translation = Float2(random(worldSide * 4.0f) - worldSide * 2.0f, random(worldSide * 0.25f));
+							bodyCreationDesc._bodyMotionType = (i % 8 == 0) ? BodyMotionType::Static : BodyMotionType::Dynamic;
+							bodyCreationDesc._inverseMass = (i % 8 == 0) ? 0.0f : 1.0f;
+							world.CreateBody(bodyCreationDesc);
+						}
+						world.Step(1.0f / 60.0f);
+						world.OptimizeBroadPhase();
+
+						StackStringA<64> profilerName;
+						FormatString(profilerName, "Step x 10 - %s %u", broadPhaseTypeNames[static_cast<uint32>(broadPhaseType)], bodyCount);
+						Profiler::ScopedCPUProfiler profiler{ profilerName.CString() };
+						for (uint32 step = 0; step < 10; ++step)
+						{
+							world.Step(1.0f / 60.0f);
+						}
+					}
+				}
+
+				const std::vector<Profiler::ScopedCPUProfiler::LogData>& logArray = Profiler::ScopedCPUProfiler::GetEntireLogData();
+				const bool IsEmpty = logArray.empty();
+			}
+
+			// thread 수에 따른 Step 시간
+			{
+				const uint32 kBodyCount = 100000;
+				const uint32 kThreadCounts[] = { 1, 2, 4, 8, 16, 32 };
+				for (const uint32 threadCount : kThreadCounts)
+				{
+					World world;
+					world.SetThreadCount(threadCount);
+					const float worldSide = ::sqrtf(static_cast<float>(kBodyCount)) * 8.0f;
+					for (uint32 i = 0; i < kBodyCount; ++i)
+					{
+						BodyCreationDesc bodyCreationDesc;
+						bodyCreationDesc._collisionShape = MakeShared<CircleCollisionShape>(CircleCollisionShape(Float2::kZero, 1.0f));
+						bodyCreationDesc._transform2D._translation = Float2(random(worldSide * 4.0f) - worldSide * 2.0f, random(worldSide * 0.25f));
+						bodyCreationDesc._bodyMotionType = (i % 8 == 0) ? BodyMotionType::Static : BodyMotionType::Dynamic;
+						bodyCreationDesc._inverseMass = (i % 8 == 0) ? 0.0f : 1.0f;
+						world.CreateBody(bodyCreationDesc);
+					}
+					world.Step(1.0f / 60.0f);
+
+					StackStringA<64> profilerName;
+					FormatString(profilerName, "Step x 10 - %u threads", threadCount);
+					Profiler::ScopedCPUProfiler profiler{ profilerName.CString() };
+					for (uint32 step = 0; step < 10; ++step)
+					{
+						world.Step(1.0f / 60.0f);
+					}
+				}
+			}
+#endif
+			return true;
+		}
+
+		bool TestConstraintSolver()
+		{
+			using namespace Physics2D;
+
+			// 한 색 안의 row 들은 같은 dynamic body 를 쓰지 않는다. 사슬은 두 색으로 나뉘고, 충분히 풀면 모든 row 의 J * v + bias 가 0 이 된다.
+			{
+				ConstraintSolver constraintSolver;
+				const uint32 kBodyCount = 9;
+				uint32 bodyIndices[kBodyCount];
+				for (uint32 i = 0; i < kBodyCount; ++i)
+				{
+					// 사슬의 한 끝은 움직이지 않는 body
+					const bool isDynamic = (i > 0);
+					bodyIndices[i] = constraintSolver.AddBody(ToReal2(Float2(0.0f, static_cast<float>(i % 3))), Real(0), Real((isDynamic == true) ? 1 : 0), Real(0));
+				}
+				for (uint32 i = 0; i + 1 < kBodyCount; ++i)
+				{
+					const Real bias = ToReal(0.1f * static_cast<float>(i % 4));
+					constraintSolver.AddRow(bodyIndices[i], bodyIndices[i + 1], ToReal2(Float2(0.0f, 1.0f)), Real(0), Real(0), bias, -kRealMax, kRealMax, Real(0));
+				}
+				constraintSolver.Solve(500);
+				MINT_ASSURE(constraintSolver.GetColorCount() == 2);
+				for (uint32 i = 0; i + 1 < kBodyCount; ++i)
+				{
+					const float relativeVelocity = ToFloat(constraintSolver.GetLinearVelocity(bodyIndices[i + 1])._y - constraintSolver.GetLinearVelocity(bodyIndices[i])._y);
+					MINT_ASSURE(::abs(relativeVelocity + 0.1f * static_cast<float>(i % 4)) < 0.001f);
+				}
+			}
+
+			// 바닥에 떨어진 상자는 solver 가 떠받쳐서 멈춰야 하고, 두 점의 normal impulse 가 함께 무게를 버텨야 한다.
+			{
+				World world;
+				BodyCreationDesc groundDesc;
+				groundDesc._collisionShape = MakeShared<BoxCollisionShape>(BoxCollisionShape(Float2(8.0f, 0.5f), Transform2D::GetIdentity()));
+				groundDesc._inverseMass = 0.0f;
+				world.CreateBody(groundDesc);
+				BodyCreationDesc boxDesc;
+				boxDesc._collisionShape = MakeShared<BoxCollisionShape>(BoxCollisionShape(Float2(0.5f, 0.5f), Transform2D::GetIdentity()));
+				boxDesc._transform2D._translation = Float2(0.0f, 1.25f);
+				boxDesc._bodyMotionType = BodyMotionType::Dynamic;
+				// 한 변이 1 이고 질량이 1 인 상자
+				boxDesc._inverseInertia = 6.0f;
+				const BodyID boxID = world.CreateBody(boxDesc);
+				// 잠들면 solver 를 거치지 않으므로 잠들기를 끈다.
+				SleepSettings sleepSettings;
+				sleepSettings._isEnabled = false;
+				world.SetSleepSettings(sleepSettings);
+
+				const float kTimeStep = 1.0f / 60.0f;
+				for (uint32 step = 0; step < 180; ++step)
+				{
+					world.Step(kTimeStep);
+				}
+
+				MINT_ASSURE(ToFloat2(world.GetLinearVelocity(boxID)).Length() < 0.01f && ::abs(ToFloat(world.GetAngularVelocity(boxID))) < 0.01f);
+				// 조금 겹친 채로 멈춘다.
+				MINT_ASSURE(::abs(ToFloat2(world.GetTranslation(boxID))._y - 1.0f) < 0.01f);
+				MINT_ASSURE(world.GetCollisionManifoldMap().Size() == 1);
+				for (const CollisionManifold& collisionManifold : world.GetCollisionManifoldMap())
+				{
+					MINT_ASSURE(collisionManifold._pointCount == 2);
+					MINT_ASSURE(collisionManifold._points[0]._normalImpulse > Real(0) && collisionManifold._points[1]._normalImpulse > Real(0));
+					const float normalImpulse = ToFloat(collisionManifold._points[0]._normalImpulse + collisionManifold._points[1]._normalImpulse);
+					MINT_ASSURE(::abs(normalImpulse - 9.8f * kTimeStep) < 0.01f);
+				}
+			}
+
+			// distance constraint 로 이은 사슬은 흔들리는 동안에도 길이를 지켜야 한다.
+			// 속도만 맞추므로 빠르게 돌 때 조금 늘어나는 것은 허용하고, Baumgarte 항이 다시 줄인다.
+			{
+				World world;
+				BodyCreationDesc anchorDesc;
+				anchorDesc._collisionShape = MakeShared<CircleCollisionShape>(CircleCollisionShape(Float2::kZero, 0.1f));
+				anchorDesc._transform2D._translation = Float2(0.0f, 10.0f);
+				anchorDesc._inverseMass = 0.0f;
+				BodyID previousBodyID = world.CreateBody(anchorDesc);
+				BodyID bodyIDs[8];
+				for (uint32 i = 0; i < 8; ++i)
+				{
+					BodyCreationDesc linkDesc;
+					linkDesc._collisionShape = MakeShared<CircleCollisionShape>(CircleCollisionShape(Float2::kZero, 0.1f));
+					// 옆으로 뻗은 채로 놓아서 떨어지며 흔들리게 한다.
+					linkDesc._transform2D._translation = Float2(0.5f * (i + 1), 10.0f);
+					linkDesc._bodyMotionType = BodyMotionType::Dynamic;
+					bodyIDs[i] = world.CreateBody(linkDesc);
+
+					ParticleDistanceConstraint particleDistanceConstraint;
+					particleDistanceConstraint._bodyAID = previousBodyID;
+					particleDistanceConstraint._bodyBID = bodyIDs[i];
+					particleDistanceConstraint._distance = 0.5f;
+					world.AddParticleDistanceConstraint(particleDistanceConstraint);
+					previousBodyID = bodyIDs[i];
+				}
+
+				float lowestEndY = 10.0f;
+				for (uint32 step = 0; step < 120; ++step)
+				{
+					world.Step(1.0f / 60.0f);
+
+					Float2 previousTranslation = Float2(0.0f, 10.0f);
+					for (uint32 i = 0; i < 8; ++i)
+					{
+						const Float2 translation = ToFloat2(world.GetTranslation(bodyIDs[i]));
+						MINT_ASSURE(::abs((translation - previousTranslation).Length() - 0.5f) < 0.1f);
+						previousTranslation = translation;
+					}
+					lowestEndY = Min(lowestEndY, previousTranslation._y);
+				}
+				// 사슬의 끝이 anchor 아래로 흔들려 내려갔어야 한다.
+				MINT_ASSURE(lowestEndY < 7.0f);
+			}
+
+#if defined MINT_TEST_PERFORMANCE
+			// 쌓인 상자 더미와 사슬의 Step 시간 (solver 가 대부분을 차지한다)
+			{
+				World world;
+				BodyCreationDesc groundDesc;
+				groundDesc._collisionShape = MakeShared<BoxCollisionShape>(BoxCollisionShape(Float2(200.0f, 0.5f), Transform2D::GetIdentity()));
+				groundDesc._inverseMass = 0.0f;
+				world.CreateBody(groundDesc);
+
+				const uint32 kPyramidRowCount = 40;
+				for (uint32 row = 0; row < kPyramidRowCount; ++row)
+				{
+					for (uint32 column = row; column < kPyramidRowCount; ++column)
+					{
+						BodyCreationDesc boxDesc;
+						boxDesc._collisionShape = MakeShared<BoxCollisionShape>(BoxCollisionShape(Float2(0.5f, 0.5f), Transform2D::GetIdentity()));
+						boxDesc._transform2D._translation = Float2(static_cast<float>(column) * 1.05f - static_cast<float>(row) * 0.525f - 20.0f, 1.0f + static_cast<float>(row));
+						boxDesc._bodyMotionType = BodyMotionType::Dynamic;
+						boxDesc._inverseInertia = 6.0f;
+						world.CreateBody(boxDesc);
+					}
+				}
+
+				const uint32 kChainCount = 20;
+				const uint32 kChainLinkCount = 40;
+				// 사슬 길이 (40 x 0.5 = 20) 보다 넓게 떨어뜨려서, 흔들려도 옆 사슬과 겹치지 않게 한다.
+				const float kChainSpacing = 25.0f;
+				for (uint32 chainIndex = 0; chainIndex < kChainCount; ++chainIndex)
+				{
+					BodyCreationDesc anchorDesc;
+					anchorDesc._collisionShape = MakeShared<CircleCollisionShape>(CircleCollisionShape(Float2::kZero, 0.1f));
+					anchorDesc._transform2D._translation = Float2(40.0f + static_cast<float>(chainIndex) * kChainSpacing, 30.0f);
+					anchorDesc._inverseMass = 0.0f;
+					BodyID previousBodyID = world.CreateBody(anchorDesc);
+					for (uint32 i = 0; i < kChainLinkCount; ++i)
+					{
+						BodyCreationDesc linkDesc;
+						linkDesc._collisionShape = MakeShared<CircleCollisionShape>(CircleCollisionShape(Float2::kZero, 0.1f));
+						linkDesc._transform2D._translation = Float2(40.0f + static_cast<float>(chainIndex) * kChainSpacing + 0.5f * (i + 1), 30.0f);
+						linkDesc._bodyMotionType = BodyMotionType::Dynamic;
+						const BodyID linkID = world.CreateBody(linkDesc);
+
+						ParticleDistanceConstraint particleDistanceConstraint;
+						particleDistanceConstraint._bodyAID = previousBodyID;
+						particleDistanceConstraint._bodyBID = linkID;
+						particleDistanceConstraint._distance = 0.5f;
+						world.AddParticleDistanceConstraint(particleDistanceConstraint);
+						previousBodyID = linkID;
+					}
+				}
+				world.Step(1.0f / 60.0f);
+
+				Profiler::ScopedCPUProfiler profiler{ "Step x 100 - Pyramid and chains" };
+				for (uint32 step = 0; step < 100; ++step)
+				{
+					world.Step(1.0f / 60.0f);
+				}
+			}
+#endif
+			return true;
+		}
+
+		bool TestWorld()
+		{
+			using namespace Physics2D;
+
+			// 계속 닿아 있는 쌍의 manifold 는 step 이 바뀌어도 같은 feature ID 의 점을 가지고, impulse 를 이어받는다.
+			{
+				World world;
+				BodyCreationDesc groundDesc;
+				groundDesc._collisionShape = MakeShared<BoxCollisionShape>(BoxCollisionShape(Float2(8.0f, 0.5f), Transform2D::GetIdentity()));
+				groundDesc._inverseMass = 0.0f;
+				const BodyID groundID = world.CreateBody(groundDesc);
+				BodyCreationDesc boxDesc;
+				boxDesc._collisionShape = MakeShared<BoxCollisionShape>(BoxCollisionShape(Float2(0.5f, 0.5f), Transform2D::GetIdentity()));
+				boxDesc._transform2D._translation = Float2(0.0f, 0.95f);
+				boxDesc._bodyMotionType = BodyMotionType::Dynamic;
+				const BodyID boxID = world.CreateBody(boxDesc);
+
+				uint32 featureIDs[2] = {};
+				for (uint32 step = 0; step < 4; ++step)
+				{
+					world.Step(1.0f / 60.0f);
+					MINT_ASSURE(world.GetCollisionManifoldMap().Size() == 1);
+					for (const CollisionManifold& collisionManifold : world.GetCollisionManifoldMap())
+					{
+						MINT_ASSURE(collisionManifold._bodyIDA == groundID && collisionManifold._bodyIDB == boxID);
+						MINT_ASSURE(collisionManifold._pointCount == 2 && (collisionManifold._collisionNormal - Float2(0, 1)).Length() < 0.001f);
+						for (uint32 i = 0; i < 2; ++i)
+						{
+							if (step == 0)
+							{
+								featureIDs[i] = collisionManifold._points[i]._contactPoint._featureID;
+							}
+							MINT_ASSURE(collisionManifold._points[i]._contactPoint._featureID == featureIDs[i]);
+						}
+					}
+				}
+
+				CollisionManifold previous;
+				previous._pointCount = 2;
+				previous._points[0]._contactPoint._featureID = 7;
+				previous._points[0]._normalImpulse = ToReal(1.0f);
+				previous._points[0]._tangentImpulse = ToReal(2.0f);
+				previous._points[1]._contactPoint._featureID = 9;
+				previous._points[1]._normalImpulse = ToReal(3.0f);
+				CollisionManifold current;
+				current._pointCount = 2;
+				current._points[0]._contactPoint._featureID = 9;
+				current._points[1]._contactPoint._featureID = 8;
+				current.InheritImpulses(previous);
+				MINT_ASSURE(current._points[0]._normalImpulse == ToReal(3.0f) && current._points[0]._tangentImpulse == Real(0));
+				MINT_ASSURE(current._points[1]._normalImpulse == Real(0));
+			}
+
+			// 한 step 에 얇은 벽을 지나가는 빠른 물체도 CCD 로 충돌을 찾아야 한다.
+			{
+				for (uint32 caseIndex = 0; caseIndex < 2; ++caseIndex)
+				{
+					// 0: 벽을 향해 간다. 1: 벽에서 멀어진다.
+					World world;
+					BodyCreationDesc bulletDesc;
+					bulletDesc._collisionShape = MakeShared<CircleCollisionShape>(CircleCollisionShape(Float2::kZero, 0.25f));
+					bulletDesc._transform2D._translation = Float2(0, 0);
+					bulletDesc._bodyMotionType = BodyMotionType::Dynamic;
+					const BodyID bulletID = world.CreateBody(bulletDesc);
+					BodyCreationDesc wallDesc;
+					wallDesc._collisionShape = MakeShared<BoxCollisionShape>(BoxCollisionShape(Float2(0.5f, 8.0f), Transform2D::GetIdentity()));
+					wallDesc._transform2D._translation = Float2(10, 0);
+					wallDesc._inverseMass = 0.0f;
+					world.CreateBody(wallDesc);
+
+					// 1/60 초에 20 만큼 가므로 step 이 끝날 때는 벽 너머에 있다.
+					world.SetLinearVelocity(bulletID, ToReal2(Float2((caseIndex == 0) ? 1200.0f : -1200.0f, 0.0f)));
+					world.Step(1.0f / 60.0f);
+
+					uint32 collisionManifoldCount = 0;
+					for (const CollisionManifold& collisionManifold : world.GetCollisionManifoldMap())
+					{
+						++collisionManifoldCount;
+						// 충돌 지점은 step 이 끝난 위치가 아니라 벽에 닿은 시점의 위치에서 구한다.
+						MINT_ASSURE(collisionManifold._bodyIDA == bulletID && collisionManifold._pointCount == 1 && collisionManifold._points[0]._contactPoint._position._x < 10.0f);
+					}
+					MINT_ASSURE(collisionManifoldCount == ((caseIndex == 0) ? 1u : 0u));
+					// solver 가 벽 앞에서 세워야 한다.
+					MINT_ASSURE((caseIndex == 1) || ToFloat2(world.GetTranslation(bulletID))._x < 9.5f);
+				}
+			}
+
+			// 멈춘 상자 더미는 island 째로 잠들고, 깨어 있는 body 가 닿거나 WakeBody, AccessBody 로 건드리면 island 만 깨어난다.
+			{
+				World world;
+				BodyCreationDesc groundDesc;
+				groundDesc._collisionShape = MakeShared<BoxCollisionShape>(BoxCollisionShape(Float2(16.0f, 0.5f), Transform2D::GetIdentity()));
+				groundDesc._inverseMass = 0.0f;
+				world.CreateBody(groundDesc);
+
+				// 서로 떨어진 두 더미
+				BodyID stackBodyIDs[2][3];
+				for (uint32 stackIndex = 0; stackIndex < 2; ++stackIndex)
+				{
+					for (uint32 i = 0; i < 3; ++i)
+					{
+						BodyCreationDesc boxDesc;
+						boxDesc._collisionShape = MakeShared<BoxCollisionShape>(BoxCollisionShape(Float2(0.5f, 0.5f), Transform2D::GetIdentity()));
+						boxDesc._transform2D._translation = Float2(stackIndex == 0 ? -5.0f : 5.0f, 1.0f + static_cast<float>(i));
+						boxDesc._bodyMotionType = BodyMotionType::Dynamic;
+						boxDesc._inverseInertia = 6.0f;
+						stackBodyIDs[stackIndex][i] = world.CreateBody(boxDesc);
+					}
+				}
+				MINT_ASSURE(world.GetAwakeBodyCount() == 6);
+
+				const float kTimeStep = 1.0f / 60.0f;
+				for (uint32 step = 0; step < 240 && world.GetAwakeBodyCount() > 0; ++step)
+				{
+					world.Step(kTimeStep);
+				}
+				MINT_ASSURE(world.GetAwakeBodyCount() == 0);
+				// 잠든 body 끼리의 manifold 는 따로 두었다가 깨어날 때 되살린다.
+				MINT_ASSURE(world.GetCollisionManifoldMap().IsEmpty() == true);
+				const Float2 sleepingTopTranslation = ToFloat2(world.GetTranslation(stackBodyIDs[1][2]));
+				for (uint32 step = 0; step < 10; ++step)
+				{
+					world.Step(kTimeStep);
+				}
+				MINT_ASSURE(ToFloat2(world.GetTranslation(stackBodyIDs[1][2])) == sleepingTopTranslation);
+				MINT_ASSURE(ToFloat2(world.GetLinearVelocity(stackBodyIDs[1][2])) == Float2::kZero);
+
+				// 하나만 깨워도 더미 전체가 깨어나고, 다른 더미는 그대로 잔다.
+				world.WakeBody(stackBodyIDs[0][0]);
+				MINT_ASSURE(world.GetAwakeBodyCount() == 3);
+				world.Step(kTimeStep);
+				MINT_ASSURE(world.GetCollisionManifoldMap().Size() == 3);
+				// warm starting 할 impulse 를 이어받았으므로 깨어나도 더미가 흔들리지 않는다.
+				MINT_ASSURE(ToFloat2(world.GetLinearVelocity(stackBodyIDs[0][2])).Length() < 0.05f);
+				for (uint32 step = 0; step < 240 && world.GetAwakeBodyCount() > 0; ++step)
+				{
+					world.Step(kTimeStep);
+				}
+				MINT_ASSURE(world.GetAwakeBodyCount() == 0);
+
+				world.AccessBody(stackBodyIDs[1][1]);
+				MINT_ASSURE(world.GetAwakeBodyCount() == 3);
+				for (uint32 step = 0; step < 240 && world.GetAwakeBodyCount() > 0; ++step)
+				{
+					world.Step(kTimeStep);
+				}
+				MINT_ASSURE(world.GetAwakeBodyCount() == 0);
+
+				// 떨어지는 공이 더미에 닿으면 더미가 깨어난다.
+				BodyCreationDesc ballDesc;
+				ballDesc._collisionShape = MakeShared<CircleCollisionShape>(CircleCollisionShape(Float2::kZero, 0.25f));
+				ballDesc._transform2D._translation = Float2(5.0f, 6.0f);
+				ballDesc._bodyMotionType = BodyMotionType::Dynamic;
+				world.CreateBody(ballDesc);
+				MINT_ASSURE(world.GetAwakeBodyCount() == 1);
+				uint32 maxAwakeBodyCount = 0;
+				for (uint32 step = 0; step < 120; ++step)
+				{
+					world.Step(kTimeStep);
+					maxAwakeBodyCount = Max(maxAwakeBodyCount, world.GetAwakeBodyCount());
+				}
+				MINT_ASSURE(maxAwakeBodyCount == 4);
+				MINT_ASSURE(world.GetBody(stackBodyIDs[0][2])._isSleeping == true);
+				MINT_ASSURE(ToFloat2(world.GetTranslation(stackBodyIDs[1][2]))._y > 2.5f);
+
+				// 잠들기를 끄면 모두 깨어난다.
+				SleepSettings sleepSettings;
+				sleepSettings._isEnabled = false;
+				world.SetSleepSettings(sleepSettings);
+				MINT_ASSURE(world.GetAwakeBodyCount() == 7);
+			}
+
+			// World 의 setter 로 바꾼 값은 다음 Step 부터 쓰인다. 옮긴 static body 는 AABB 도 다시 맞춘다.
+			{
+				World world;
+				BodyCreationDesc groundDesc;
+				groundDesc._collisionShape = MakeShared<BoxCollisionShape>(BoxCollisionShape(Float2(2.0f, 0.5f), Transform2D::GetIdentity()));
+				groundDesc._transform2D._translation = Float2(100.0f, 0.0f);
+				groundDesc._inverseMass = 0.0f;
+				const BodyID groundID = world.CreateBody(groundDesc);
+				BodyCreationDesc boxDesc;
+				boxDesc._collisionShape = MakeShared<BoxCollisionShape>(BoxCollisionShape(Float2(0.5f, 0.5f), Transform2D::GetIdentity()));
+				boxDesc._transform2D._translation = Float2(0.0f, 2.0f);
+				boxDesc._bodyMotionType = BodyMotionType::Dynamic;
+				const BodyID boxID = world.CreateBody(boxDesc);
+
+				// gravity 를 상쇄하면 떠 있다.
+				const float kTimeStep = 1.0f / 60.0f;
+				for (uint32 step = 0; step < 10; ++step)
+				{
+					world.AddLinearAcceleration(boxID, ToReal2(Float2(0.0f, 9.8f)));
+					world.Step(kTimeStep);
+				}
+				MINT_ASSURE(ToFloat2(world.GetLinearVelocity(boxID)).Length() < 0.001f);
+				MINT_ASSURE((ToFloat2(world.GetTranslation(boxID)) - Float2(0.0f, 2.0f)).Length() < 0.001f);
+
+				// 바닥을 상자 아래로 옮기면 상자가 그 위에 멈춘다.
+				world.SetTranslation(groundID, ToReal2(Float2::kZero));
+				for (uint32 step = 0; step < 120; ++step)
+				{
+					world.Step(kTimeStep);
+				}
+				MINT_ASSURE(::abs(ToFloat2(world.GetTranslation(boxID))._y - 1.0f) < 0.02f);
+				MINT_ASSURE(world.GetTransform(groundID)._translation == Float2::kZero);
+
+				world.SetRotation(boxID, ToReal(0.5f));
+				world.SetAngularVelocity(boxID, ToReal(1.0f));
+				MINT_ASSURE(world.GetTransform(boxID)._rotation == 0.5f);
+				MINT_ASSURE(ToFloat(world.GetAngularVelocity(boxID)) == 1.0f);
+				MINT_ASSURE(world.GetBody(boxID).IsAwake() == true);
+			}
+
+
+#if defined MINT_PHYSICS_DETERMINISTIC
+			// 결정적 빌드에서는 컴파일러, 최적화 옵션, CPU 와 상관없이 Real 상태가 bit 단위로 같아야 한다.
+			// 회전한 상자와 볼록 다각형, 원, 사슬이 부딪히며 쌓이는 장면의 상태를 hash 해서 정해 둔 값과 비교한다.
+			{
+				World world;
+				BodyCreationDesc groundDesc;
+				groundDesc._collisionShape = MakeShared<BoxCollisionShape>(BoxCollisionShape(Float2(16.0f, 0.5f), Transform2D::GetIdentity()));
+				groundDesc._inverseMass = 0.0f;
+				groundDesc._friction = 0.8f;
+				world.CreateBody(groundDesc);
+
+				Vector<BodyID> bodyIDs;
+				Vector<Float2> convexPoints;
+				convexPoints.PushBack(Float2(-0.5f, -0.4f));
+				convexPoints.PushBack(Float2(0.6f, -0.3f));
+				convexPoints.PushBack(Float2(0.2f, 0.5f));
+				convexPoints.PushBack(Float2(-0.4f, 0.3f));
+				for (uint32 i = 0; i < 12; ++i)
+				{
+					BodyCreationDesc bodyDesc;
+					if (i % 3 == 0)
+					{
+						bodyDesc._collisionShape = MakeShared<BoxCollisionShape>(BoxCollisionShape(Float2(0.5f, 0.3f), Transform2D::GetIdentity()));
+					}
+					else if (i % 3 == 1)
+					{
+						bodyDesc._collisionShape = MakeShared<ConvexCollisionShape>(ConvexCollisionShape::MakeFromPoints(convexPoints));
+					}
+					else
+					{
+						bodyDesc._collisionShape = MakeShared<CircleCollisionShape>(CircleCollisionShape(Float2::kZero, 0.35f));
+					}
+					bodyDesc._transform2D._translation = Float2(static_cast<float>(i % 4) * 0.9f - 1.5f, 1.0f + static_cast<float>(i / 4) * 1.2f);
+					bodyDesc._transform2D._rotation = static_cast<float>(i) * 0.7f;
+					bodyDesc._bodyMotionType = BodyMotionType::Dynamic;
+					bodyDesc._inverseInertia = 4.0f;
+					bodyDesc._friction = 0.2f + static_cast<float>(i % 5) * 0.15f;
+					bodyIDs.PushBack(world.CreateBody(bodyDesc));
+				}
+
+				BodyCreationDesc anchorDesc;
+				anchorDesc._collisionShape = MakeShared<CircleCollisionShape>(CircleCollisionShape(Float2::kZero, 0.1f));
+				anchorDesc._transform2D._translation = Float2(6.0f, 6.0f);
+				anchorDesc._inverseMass = 0.0f;
+				BodyID previousBodyID = world.CreateBody(anchorDesc);
+				for (uint32 i = 0; i < 6; ++i)
+				{
+					BodyCreationDesc linkDesc;
+					linkDesc._collisionShape = MakeShared<CircleCollisionShape>(CircleCollisionShape(Float2::kZero, 0.1f));
+					linkDesc._transform2D._translation = Float2(6.0f + 0.5f * (i + 1), 6.0f);
+					linkDesc._bodyMotionType = BodyMotionType::Dynamic;
+					const BodyID linkID = world.CreateBody(linkDesc);
+					ParticleDistanceConstraint particleDistanceConstraint;
+					particleDistanceConstraint._bodyAID = previousBodyID;
+					particleDistanceConstraint._bodyBID = linkID;
+					particleDistanceConstraint._distance = 0.5f;
+					world.AddParticleDistanceConstraint(particleDistanceConstraint);
+					bodyIDs.PushBack(linkID);
+					previousBodyID = linkID;
+				}
+
+				// 빠르게 던진 공은 CCD 를 거친다.
+				BodyCreationDesc bulletDesc;
+				bulletDesc._collisionShape = MakeShared<CircleCollisionShape>(CircleCollisionShape(Float2::kZero, 0.2f));
+				bulletDesc._transform2D._translation = Float2(-10.0f, 2.0f);
+				bulletDesc._bodyMotionType = BodyMotionType::Dynamic;
+				const BodyID bulletID = world.CreateBody(bulletDesc);
+				world.SetLinearVelocity(bulletID, ToReal2(Float2(300.0f, 0.0f)));
+				world.SetAngularVelocity(bulletID, ToReal(20.0f));
+				bodyIDs.PushBack(bulletID);
+
+				for (uint32 step = 0; step < 120; ++step)
+				{
+					world.Step(1.0f / 60.0f);
+				}
+
+				Vector<int64> raws;
+				for (const BodyID bodyID : bodyIDs)
+				{
+					raws.PushBack(world.GetTranslation(bodyID)._x.GetRaw());
+					raws.PushBack(world.GetTranslation(bodyID)._y.GetRaw());
+					raws.PushBack(world.GetRotation(bodyID).GetRaw());
+					raws.PushBack(world.GetLinearVelocity(bodyID)._x.GetRaw());
+					raws.PushBack(world.GetLinearVelocity(bodyID)._y.GetRaw());
+					raws.PushBack(world.GetAngularVelocity(bodyID).GetRaw());
+				}
+				const uint64 stateHash = ComputeHash(reinterpret_cast<const char*>(raws.Data()), raws.Size() * sizeof(int64));
+				MINT_ASSURE(stateHash == 0xFABD83EFEFF8A899ull);
+			}
+#endif
+#if defined MINT_TEST_PERFORMANCE
+			// 대부분 잠든 장면의 Step 시간. 잠들기를 끈 것과 비교한다.
+			{
+				const bool isSleepEnableds[] = { true, false };
+				for (const bool isSleepEnabled : isSleepEnableds)
+				{
+					World world;
+					SleepSettings sleepSettings;
+					sleepSettings._isEnabled = isSleepEnabled;
+					world.SetSleepSettings(sleepSettings);
+
+					BodyCreationDesc groundDesc;
+					groundDesc._collisionShape = MakeShared<BoxCollisionShape>(BoxCollisionShape(Float2(1000.0f, 0.5f), Transform2D::GetIdentity()));
+					groundDesc._inverseMass = 0.0f;
+					world.CreateBody(groundDesc);
+
+					// 서로 떨어진 작은 상자 더미들과, 잠들지 않는 공 몇 개
+					const uint32 kStackCount = 500;
+					for (uint32 stackIndex = 0; stackIndex < kStackCount; ++stackIndex)
+					{
+						for (uint32 i = 0; i < 4; ++i)
+						{
+							BodyCreationDesc boxDesc;
+							boxDesc._collisionShape = MakeShared<BoxCollisionShape>(BoxCollisionShape(Float2(0.5f, 0.5f), Transform2D::GetIdentity()));
+							boxDesc._transform2D._translation = Float2(static_cast<float>(stackIndex) * 3.0f - 750.0f, 1.0f + static_cast<float>(i));
+							boxDesc._bodyMotionType = BodyMotionType::Dynamic;
+							boxDesc._inverseInertia = 6.0f;
+							world.CreateBody(boxDesc);
+						}
+					}
+					for (uint32 i = 0; i < 20; ++i)
+					{
+						BodyCreationDesc ballDesc;
+						ballDesc._collisionShape = MakeShared<CircleCollisionShape>(CircleCollisionShape(Float2::kZero, 0.25f));
+						ballDesc._transform2D._translation = Float2(static_cast<float>(i) * 75.0f - 748.5f, 8.0f);
+						ballDesc._bodyMotionType = BodyMotionType::Dynamic;
+						ballDesc._canSleep = false;
+						world.CreateBody(ballDesc);
+					}
+					for (uint32 step = 0; step < 300; ++step)
+					{
+						world.Step(1.0f / 60.0f);
+					}
+
+					Profiler::ScopedCPUProfiler profiler{ isSleepEnabled ? "Step x 100 - Mostly sleeping stacks" : "Step x 100 - Mostly sleeping stacks (sleep disabled)" };
+					for (uint32 step = 0; step < 100; ++step)
+					{
+						world.Step(1.0f / 60.0f);
+					}
+				}
+			}
+#endif
 			return true;
 		}
 	}
@@ -0,0 +1,131 @@
+﻿#include <MintPhysics/Include/ThreadPool.hpp>
+
+
+namespace mint
+{
+	namespace Physics2D
+	{
+		ThreadPool::ThreadPool()
+			: _runIndex{ 0 }
+			, _isStopping{ false }
+			, _busyWorkerThreadCount{ 0 }
+			, _taskFunction{ nullptr }
+			, _taskContext{ nullptr }
+			, _taskCount{ 0 }
+			, _nextTaskIndex{ 0 }
+		{
+			__noop;
+		}
+
+		ThreadPool::~ThreadPool()
+		{
+			StopWorkerThreads();
+		}
+
+		void ThreadPool::SetThreadCount(const uint32 threadCount)
+		{
+			MINT_ASSERT(threadCount > 0, "thread 수는 1 이상이어야 합니다!");
+
+			const uint32 workerThreadCount = Max(threadCount, 1u) - 1;
+			if (workerThreadCount == _workerThreads.Size())
+			{
+				return;
+			}
+
+			StopWorkerThreads();
+
+			_isStopping = false;
+			// 작업 thread 가 시작되기 전에 Run 이 불려도 그 작업을 놓치지 않도록, 지금의 _runIndex 를 넘겨 준다.
+			const uint64 runIndex = _runIndex;
+			for (uint32 i = 0; i < workerThreadCount; ++i)
+			{
+				_workerThreads.PushBack(std::thread([this, runIndex]() { RunWorkerThread(runIndex); }));
+			}
+		}
+
+		void ThreadPool::Run(const uint32 taskCount, const TaskFunction taskFunction, void* const context)
+		{
+			if (_workerThreads.IsEmpty() == true || taskCount <= 1)
+			{
+				for (uint32 taskIndex = 0; taskIndex < taskCount; ++taskIndex)
+				{
+					taskFunction(context, taskIndex);
+				}
+				return;
+			}
+
+			{
+				std::lock_guard<std::mutex> lock{ _mutex };
+				_taskFunction = taskFunction;
+				_taskContext = context;
+				_taskCount = taskCount;
+				_nextTaskIndex.store(0, std::memory_order_relaxed);
+				_busyWorkerThreadCount = _workerThreads.Size();
+				++_runIndex;
+			}
+			_workCondition.notify_all();
+
+			ExecuteTasks();
+
+			// 작업 thread 가 마지막 작업을 끝낼 때까지 기다려야 결과를 읽을 수 있다.
+			std::unique_lock<std::mutex> lock{ _mutex };
+			_doneCondition.wait(lock, [this]() { return _busyWorkerThreadCount == 0; });
+		}
+
+		void ThreadPool::RunWorkerThread(uint64 lastRunIndex)
+		{
+			while (true)
+			{
+				{
+					std::unique_lock<std::mutex> lock{ _mutex };
+					_workCondition.wait(lock, [this, lastRunIndex]() { return _isStopping == true || _runIndex != lastRunIndex; });
+					if (_isStopping == true)
+					{
+						return;
+					}
+					lastRunIndex = _runIndex;
+				}
+
+				ExecuteTasks();
+
+				{
+					std::lock_guard<std::mutex> lock{ _mutex };
+					--_busyWorkerThreadCount;
+					if (_busyWorkerThreadCount == 0)
+					{
+						_doneCondition.notify_one();
+					}
+				}
+			}
+		}
+
+		void ThreadPool::ExecuteTasks()
+		{
+			while (true)
+			{
+				const uint32 taskIndex = _nextTaskIndex.fetch_add(1, std::memory_order_relaxed);
+				if (taskIndex >= _taskCount)
+				{
+					return;
+				}
+
+				_taskFunction(_taskContext, taskIndex);
+			}
+		}
+
+		void ThreadPool::StopWorkerThreads()
+		{
+			{
+				std::lock_guard<std::mutex> lock{ _mutex };
+				_isStopping = true;
+			}
+			_workCondition.notify_all();
+
+			for (std::thread& workerThread : _workerThreads)
+			{
+				workerThread.join();
+			}
+			_workerThreads.Clear();
+		}
+	}
+}
@@ -1,5 +1,9 @@
 ﻿#include <MintPhysics/Source/CollisionShape.cpp>
 #include <MintPhysics/Source/Intersection.cpp>
 #include <MintPhysics/Source/TimeStepCalculator.cpp>
+#include <MintPhysics/Source/DynamicAABBTree.cpp>
+#include <MintPhysics/Source/SweepAndPrune.cpp>
+#include <MintPhysics/Source/SpatialHashGrid.cpp>
+#include <MintPhysics/Source/ThreadPool.cpp>
 #include <MintPhysics/Source/PhysicsWorld.cpp>
 #include <MintPhysics/Source/TestPhysics.cpp>
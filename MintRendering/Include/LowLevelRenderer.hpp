@@ -213,8 +213,8 @@ namespace mint
 				_isOrdinalRenderCommandGroupsSorted = true;
 			}
 
-			const uint32 index = mint::BinarySearch(_ordinalRenderCommandGroups, key, OrdinalRenderCommandGroup::Evaluator());
-			if (IsValidIndex(index) == false)
+			const uint32 index = mint::LowerBound(_ordinalRenderCommandGroups, key, OrdinalRenderCommandGroup::Evaluator());
+			if (index >= _ordinalRenderCommandGroups.Size() || _ordinalRenderCommandGroups[index]._key != key)
 			{
 				return;
 			}
@@ -1,6 +1,7 @@
 ﻿#include <MintRendering/Include/ShapeGenerator.h>
 #include <MintMath/Include/Float2x2.h>
 #include <MintMath/Include/Geometry.h>
+#include <MintMath/Include/FastMath.h>
 #include <Assets/Include/CppHlsl/CppHlslStreamData.h>
 
 
@@ -59,8 +60,11 @@ namespace mint
 			for (uint8 i = 0; i < sideCount; ++i)
 			{
 				const float theta = (static_cast<float>(i) / sideCount) * Math::kTwoPi;
-				v._position._x = shapeTransform._translation._x + ::cos(theta) * radius;
-				v._position._y = shapeTransform._translation._y + ::sin(theta) * radius;
+				float sinTheta;
+				float cosTheta;
+				Math::Fast::SinCos(theta, sinTheta, cosTheta);
+				v._position._x = shapeTransform._translation._x + cosTheta * radius;
+				v._position._y = shapeTransform._translation._y + sinTheta * radius;
 				vertices.PushBack(v);
 			}
 
@@ -99,8 +103,11 @@ namespace mint
 			for (uint8 i = 0; i <= sideCount; ++i)
 			{
 				const float theta = (static_cast<float>(i) / sideCount) * Math::kPi;
-				v._position._x = shapeTransform._translation._x + ::cos(shapeTransform._rotation + theta) * radius;
-				v._position._y = shapeTransform._translation._y + ::sin(shapeTransform._rotation + theta) * radius;
+				float sinTheta;
+				float cosTheta;
+				Math::Fast::SinCos(shapeTransform._rotation + theta, sinTheta, cosTheta);
+				v._position._x = shapeTransform._translation._x + cosTheta * radius;
+				v._position._y = shapeTransform._translation._y + sinTheta * radius;
 				vertices.PushBack(v);
 			}
 
@@ -134,8 +141,11 @@ namespace mint
 			for (uint8 i = 0; i <= sideCount; ++i)
 			{
 				const float theta = (static_cast<float>(i) / sideCount) * Math::kPiOverTwo;
-				v._position._x = shapeTransform._translation._x + ::cos(shapeTransform._rotation + theta) * radius;
-				v._position._y = shapeTransform._translation._y + ::sin(shapeTransform._rotation + theta) * radius;
+				float sinTheta;
+				float cosTheta;
+				Math::Fast::SinCos(shapeTransform._rotation + theta, sinTheta, cosTheta);
+				v._position._x = shapeTransform._translation._x + cosTheta * radius;
+				v._position._y = shapeTransform._translation._y + sinTheta * radius;
 				vertices.PushBack(v);
 			}
 
@@ -247,7 +257,8 @@ namespace mint
 		void ShapeGenerator::GenerateConvexShape(const Vector<Float2>& points, const Color& color, Vector<VS_INPUT_SHAPE>& vertices, Vector<IndexElementType>& indices, const Transform2D& shapeTransform)
 		{
 			Vector<Float2> rawVertices = points;
-			GrahamScan_Convexify(rawVertices);
+			Vector<Float2> scratch;
+			ConvexHull_Compute(rawVertices, scratch);
 
 			const ScopedShapeTransformer scopedShapeTransformer{ vertices, shapeTransform };
 			const uint32 vertexBase = vertices.Size();
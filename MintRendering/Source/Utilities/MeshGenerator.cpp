@@ -615,11 +615,7 @@ namespace mint
 		void MeshGenerator::TransformMeshData(MeshData& meshData, const Float4x4& transformationMatrix) noexcept
 		{
 			const uint32 positionCount = meshData.GetPositionCount();
-			for (uint32 positionIndex = 0; positionIndex < positionCount; ++positionIndex)
-			{
-				Float4& position = meshData._positionArray[positionIndex];
-				position = transformationMatrix.Mul(position);
-			}
+			Float4x4::Mul(transformationMatrix, meshData._positionArray.Data(), positionCount, meshData._positionArray.Data());
 			meshData.UpdateVertexFromPositions();
 		}
 
@@ -1,6 +1,7 @@
 ﻿#include <MintRendering/Include/Utilities/Plotter.h>
 
 #include <MintContainer/Include/Vector.hpp>
+#include <MintContainer/Include/Algorithm.hpp>
 
 #include <MintContainer/Include/StringUtil.hpp>
 
@@ -39,14 +40,17 @@ namespace mint
 			_xDataSets.PushBack(xData);
 			_yDataSets.PushBack(yData);
 
-			const uint32 dataCount = xData.Size();
-			for (uint32 dataIndex = 0; dataIndex < dataCount; ++dataIndex)
+			float dataMin = 0.0f;
+			float dataMax = 0.0f;
+			if (MinMax(xData, dataMin, dataMax) == true)
 			{
-				_min._x = Min(_min._x, xData[dataIndex]);
-				_min._y = Min(_min._y, yData[dataIndex]);
-
-				_max._x = Max(_max._x, xData[dataIndex]);
-				_max._y = Max(_max._y, yData[dataIndex]);
+				_min._x = Min(_min._x, dataMin);
+				_max._x = Max(_max._x, dataMax);
+			}
+			if (MinMax(yData, dataMin, dataMax) == true)
+			{
+				_min._y = Min(_min._y, dataMin);
+				_max._y = Max(_max._y, dataMax);
 			}
 
 			_range = _max - _min;